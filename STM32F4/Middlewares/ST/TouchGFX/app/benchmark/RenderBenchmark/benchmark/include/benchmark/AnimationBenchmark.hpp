@@ -0,0 +1,66 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef ANIMATION_BENCHMARK_HPP
+#define ANIMATION_BENCHMARK_HPP
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Measures the time spent ticking ScheduledMoveAnimator widgets, with the widgets
+ * registered as timer widgets and with the AnimationScheduler of the application, using the
+ * floating point EasingEquations and the FixedPointEasingEquations.
+ *
+ * The animations scenario is run with 32 animations, the most the timer widgets allow,
+ * and with 200 animations, which only the scheduler allows. Each frame is ticked with the
+ * draw operations cached, so the tick time covers stepping the animations and
+ * invalidating their areas, and the cached areas are then drawn separately. The frames
+ * drawn with the scheduler must be identical to the frames drawn with timer widgets using
+ * the same easing equations. One CSV row is written per configuration, and a summary is
+ * printed to stderr:
+ *
+ *     animations,ticked_by,easing,frames,avg_tick_us,max_tick_us,avg_draw_us,different_frames
+ */
+class AnimationBenchmark
+{
+public:
+    AnimationBenchmark(HALHeadless& hal, FrontendHeap& heap);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out    The file to write the results to.
+     * @param frames The number of frames to measure per configuration.
+     *
+     * @return false if a frame ticked by the scheduler differs from the frame ticked as
+     *         timer widgets.
+     */
+    bool run(FILE* out, uint32_t frames);
+
+private:
+    static const uint32_t WARMUP_FRAMES = 2;
+    static const uint16_t TIMER_WIDGET_ANIMATIONS = 32;
+    static const uint16_t SCHEDULED_ANIMATIONS = 200;
+
+    uint32_t tickFrames(FILE* out, uint16_t animations, bool scheduler, bool fixedPointEasing, uint32_t frames);
+
+    HALHeadless& hal;
+    FrontendHeap& heap;
+    uint32_t* referenceHashes;
+};
+
+#endif // ANIMATION_BENCHMARK_HPP
@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef BENCHMARK_RECORDER_HPP
+#define BENCHMARK_RECORDER_HPP
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+#include <mvp/AcceleratedMVPApplication.hpp>
+#include <touchgfx/Callback.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Records the per-frame statistics reported by HALHeadless, together with the blit
+ * operations counted by HeadlessDMA and the areas invalidated and redrawn by the
+ * application, as one CSV row per frame:
+ *
+ *     scenario,frame,frame_time_us,rendered,pixels_flushed,rects_flushed,blit_ops,blit_pixels,
+ *     dirty_pixels,redrawn_pixels,copied_pixels,drawn_pixels
+ *
+ * A summary for each scenario is printed to stderr when the scenario ends.
+ */
+class BenchmarkRecorder
+{
+public:
+    BenchmarkRecorder(HALHeadless& hal, HeadlessDMA& dma, AcceleratedMVPApplication& app);
+
+    /**
+     * Opens the CSV output file and writes the header line.
+     *
+     * @param filename The name of the file. If null or "-", stdout is used.
+     *
+     * @return true if the file could be opened.
+     */
+    bool open(const char* filename);
+
+    /**
+     * Closes the CSV output file.
+     */
+    void close();
+
+    /**
+     * Starts recording frames for a scenario.
+     *
+     * @param name The name of the scenario, written in the first column.
+     */
+    void beginScenario(const char* name);
+
+    /**
+     * Stops recording frames and prints a summary of the scenario to stderr.
+     */
+    void endScenario();
+
+private:
+    HALHeadless& hal;
+    HeadlessDMA& dma;
+    AcceleratedMVPApplication& app;
+    Callback<BenchmarkRecorder, const FrameStatistics&> frameCallback;
+    FILE* csv;
+    const char* scenarioName;
+    uint32_t numberOfFrames;
+    uint64_t totalFrameTimeUS;
+    uint32_t maxFrameTimeUS;
+    uint64_t totalPixelsFlushed;
+    uint64_t totalBlitOperations;
+    uint64_t totalDirtyPixels;
+    uint64_t totalRedrawnPixels;
+    uint64_t totalDrawnPixels;
+
+    void frameRendered(const FrameStatistics& statistics);
+};
+
+#endif // BENCHMARK_RECORDER_HPP
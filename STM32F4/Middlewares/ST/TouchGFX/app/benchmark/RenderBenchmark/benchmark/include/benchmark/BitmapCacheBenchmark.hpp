@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef BITMAP_CACHE_BENCHMARK_HPP
+#define BITMAP_CACHE_BENCHMARK_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/widgets/Image.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Exercises the automatic BitmapCache with a database of bitmaps which is twice the size
+ * of the cache. Screens showing different, overlapping sets of the bitmaps are visited in
+ * turn. The first frame of a screen draws all its Images, after which every other frame
+ * redraws one Image and the frames in between draw nothing.
+ *
+ * The screens are first drawn directly from the bitmap database, bypassing the cache, and
+ * then by the Images, whose draws LCD16bppAccelerated reports to the automatic cache, so
+ * it must be the LCD of the HAL. The frame buffers must be identical in every frame. The
+ * benchmark registers its own bitmap database, which Bitmap only allows once, so it must
+ * run before anything else registers one. The cache statistics, the most bytes moved to
+ * compact the cache in one frame and the longest time spent in BitmapCache::endFrame() are
+ * reported. The compaction budget is smaller than the default, so compacting the cache
+ * after a change of screen takes several frames.
+ *
+ * One CSV row is written, and a summary is printed to stderr:
+ *
+ *     frames,hits,misses,admissions,evictions,deferrals,admitted_bytes,compacted_bytes,
+ *     max_frame_compacted_bytes,max_end_frame_us
+ */
+class BitmapCacheBenchmark
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param [in] cache The memory to use for the cache.
+     * @param size       The size of the memory in bytes.
+     */
+    BitmapCacheBenchmark(uint16_t* cache, uint32_t size);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if the cached bitmaps were not drawn identically.
+     */
+    bool run(FILE* out);
+
+private:
+    static const uint16_t NUMBER_OF_BITMAPS = 24;
+    static const uint16_t BITMAP_WIDTH = 96;
+    static const uint16_t BITMAP_HEIGHT = 96;
+    static const uint16_t NUMBER_OF_SCREENS = 4;
+    static const uint16_t IMAGES_PER_SCREEN = 8;
+    static const uint16_t NUMBER_OF_VISITS = 12;
+    static const uint16_t FRAMES_PER_VISIT = 16;
+    static const uint32_t NUMBER_OF_FRAMES = NUMBER_OF_VISITS * FRAMES_PER_VISIT;
+    static const uint32_t COMPACTION_BUDGET = 2 * BITMAP_WIDTH * BITMAP_HEIGHT * 2;
+
+    struct FrameMaximums
+    {
+        uint32_t endFrameUS;
+        uint32_t compactedBytes;
+    };
+
+    void createDatabase();
+    void drawFrames(uint32_t* hashes, FrameMaximums& maximums, bool useImages);
+    void drawImage(const Image& image, bool useImage);
+    uint32_t hashFrameBuffer();
+    unsigned random();
+
+    uint16_t* cache;
+    uint32_t cacheSize;
+    unsigned seed;
+    Bitmap::BitmapData* database;
+    uint8_t* bitmapData[NUMBER_OF_BITMAPS];
+    uint32_t referenceHashes[NUMBER_OF_FRAMES];
+    uint32_t cachedHashes[NUMBER_OF_FRAMES];
+};
+
+#endif // BITMAP_CACHE_BENCHMARK_HPP
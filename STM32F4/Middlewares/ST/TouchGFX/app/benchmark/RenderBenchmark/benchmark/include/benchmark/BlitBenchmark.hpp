@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef BLIT_BENCHMARK_HPP
+#define BLIT_BENCHMARK_HPP
+
+#include <platform/driver/lcd/LCD16bpp.hpp>
+#include <platform/driver/lcd/LCD16bppAccelerated.hpp>
+#include <platform/driver/lcd/LCD24bpp.hpp>
+#include <platform/driver/lcd/LCD24bppAccelerated.hpp>
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Compares the software blit operations of LCD16bppAccelerated and LCD24bppAccelerated,
+ * which use the BlitKernels selected at compile time, to those of LCD16bpp and LCD24bpp.
+ *
+ * First, every operation is performed on random frame buffer contents, with random
+ * rectangles, colors and alpha values, by both LCDs. The frame buffers must be identical
+ * afterwards. Then the number of pixels per second drawn by each LCD is measured.
+ *
+ * The blit capabilities of the DMA are cleared, so everything is drawn in software. The
+ * 24 bit operations draw into the 16 bit frame buffers of the HAL, which are large enough
+ * for one 24 bit frame buffer as three buffers are allocated.
+ *
+ * One CSV row is written per operation, and a summary is printed to stderr:
+ *
+ *     operation,scalar_pixels_per_s,kernel_pixels_per_s
+ */
+class BlitBenchmark
+{
+public:
+    BlitBenchmark(HeadlessDMA& dma);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if the LCDs did not draw identical pixels.
+     */
+    bool run(FILE* out);
+
+private:
+    static const int16_t BITMAP_WIDTH = 200;
+    static const int16_t BITMAP_HEIGHT = 100;
+    static const unsigned NUMBER_OF_ROUNDS = 4;
+    static const unsigned TRIALS_PER_ROUND = 100;
+    static const unsigned MIN_MEASURE_TIME_US = 20000;
+
+    enum Operation
+    {
+        FILL,
+        FILL_WITH_ALPHA,
+        COPY,
+        COPY_WITH_ALPHA,
+        COPY_ARGB8888,
+        COPY_ARGB8888_WITH_ALPHA,
+        FILL_24BPP,
+        FILL_24BPP_WITH_ALPHA,
+        COPY_24BPP,
+        COPY_24BPP_WITH_ALPHA,
+        NUMBER_OF_OPERATIONS
+    };
+
+    struct Blit
+    {
+        int16_t x;
+        int16_t y;
+        Rect rect;
+        uint32_t color;
+        uint8_t alpha;
+    };
+
+    static const char* getName(Operation operation);
+    static bool is24bpp(Operation operation);
+    static bool hasAlpha(Operation operation);
+
+    void perform(LCD& lcd, Operation operation, const Blit& blit);
+    bool verify(Operation operation, uint32_t bytes);
+    double measure(LCD& lcd, Operation operation);
+    void randomizeBitmaps();
+    void randomizeFrameBuffer(uint32_t bytes);
+    Blit randomBlit(Operation operation);
+    unsigned random();
+
+    HeadlessDMA& dma;
+    LCD16bpp scalar16;
+    LCD16bppAccelerated kernels16;
+    LCD24bpp scalar24;
+    LCD24bppAccelerated kernels24;
+    BitmapId rgb565;
+    BitmapId argb8888;
+    BitmapId rgb888;
+    uint8_t* original;
+    uint8_t* expected;
+    unsigned seed;
+};
+
+#endif // BLIT_BENCHMARK_HPP
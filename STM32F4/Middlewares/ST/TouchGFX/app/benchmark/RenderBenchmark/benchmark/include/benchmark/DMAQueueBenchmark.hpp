@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef DMA_QUEUE_BENCHMARK_HPP
+#define DMA_QUEUE_BENCHMARK_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Measures how many blit operations the CoalescingDMA_Queue merges for a screen made of many
+ * small parts, like a toolbar of adjacent boxes, a segmented progress bar and images drawn
+ * in several dirty rectangles. Between the blit operations the CPU draws into the frame
+ * buffer, which must wait for the DMA. Finally, random small parts which often touch or
+ * overlap are drawn.
+ *
+ * The frames are drawn three times by the HeadlessDMA: performing every operation as soon
+ * as it is queued, deferring the operations like a busy DMA would, and deferring them with
+ * merging enabled. The frame buffer must be identical after every frame in all three modes.
+ * Every operation is given a fixed setup time, about what it takes to program, start and
+ * take the completion interrupt of DMA2D on an STM32F4 at 168 MHz. This is the cost that
+ * merging saves, copying the pixels in software has next to no cost per operation.
+ *
+ * One CSV row is written per mode, and a summary is printed to stderr:
+ *
+ *     mode,frames,queued_ops,merged_ops,executed_ops,dma_busy_us,draw_us
+ */
+class DMAQueueBenchmark
+{
+public:
+    DMAQueueBenchmark(HeadlessDMA& dma);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if the frames differ between the modes.
+     */
+    bool run(FILE* out);
+
+private:
+    static const uint32_t NUMBER_OF_FRAMES = 200;
+    static const int16_t IMAGE_WIDTH = 160;
+    static const int16_t IMAGE_HEIGHT = 120;
+    static const int16_t ICON_SIZE = 64;
+    static const int16_t STRIP_HEIGHT = 20;
+    static const int16_t SEGMENTS = 12;
+    static const int RANDOM_PARTS = 24;
+    static const uint32_t OPERATION_SETUP_NS = 2000;
+
+    enum Mode
+    {
+        IMMEDIATE,
+        DEFERRED,
+        COALESCING,
+        NUMBER_OF_MODES
+    };
+
+    struct Result
+    {
+        DMA_Statistics statistics;
+        uint32_t drawUS;
+    };
+
+    void createBitmaps();
+    Result drawFrames(Mode mode);
+    void drawFrame(uint32_t frame);
+    void drawSoftwareLine(int16_t x, int16_t y, int16_t length);
+    uint32_t hashFrameBuffer();
+    unsigned random();
+
+    HeadlessDMA& dma;
+    BitmapId image;
+    BitmapId icon;
+    unsigned seed;
+    uint32_t hashes[NUMBER_OF_MODES][NUMBER_OF_FRAMES];
+};
+
+#endif // DMA_QUEUE_BENCHMARK_HPP
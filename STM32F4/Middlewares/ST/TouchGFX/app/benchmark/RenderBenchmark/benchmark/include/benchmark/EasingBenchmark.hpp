@@ -0,0 +1,68 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef EASING_BENCHMARK_HPP
+#define EASING_BENCHMARK_HPP
+
+#include <touchgfx/EasingEquations.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Compares FixedPointEasingEquations to the floating point EasingEquations.
+ *
+ * First, every equation is evaluated for all steps of durations up to MAX_DURATION, for
+ * changes from a few pixels to the full int16_t range, and compared to the exact curve
+ * computed in double precision. The fixed point equations must be within 1 + |c| / 2048 of
+ * the exact curve. Then the time per call of both equations is measured.
+ *
+ * The elastic EasingEquations do not scale their oscillation with the change, so their
+ * error is reported but not checked. One CSV row is written per equation, and a summary is
+ * printed to stderr:
+ *
+ *     equation,float_ns_per_call,fixed_ns_per_call,float_max_error,fixed_max_error
+ */
+class EasingBenchmark
+{
+public:
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if a fixed point equation exceeds its error bound.
+     */
+    bool run(FILE* out);
+
+private:
+    static const uint16_t MAX_DURATION = 120;
+    static const uint16_t TIMED_DURATION = 60;
+    static const unsigned MIN_MEASURE_TIME_US = 20000;
+
+    struct Equation
+    {
+        const char* name;
+        EasingEquation floatEquation;
+        EasingEquation fixedPointEquation;
+        double (*curve)(double);
+        int mode;
+    };
+
+    static const Equation equations[];
+
+    static double evaluate(const Equation& equation, double progress);
+    static double measure(EasingEquation equation);
+};
+
+#endif // EASING_BENCHMARK_HPP
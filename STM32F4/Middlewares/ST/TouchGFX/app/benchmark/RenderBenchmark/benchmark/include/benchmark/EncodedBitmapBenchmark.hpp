@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef ENCODED_BITMAP_BENCHMARK_HPP
+#define ENCODED_BITMAP_BENCHMARK_HPP
+
+#include <platform/driver/lcd/LCD16bppAccelerated.hpp>
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+#include <touchgfx/EncodedBitmap.hpp>
+#include <vector>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Compares bitmaps in the Bitmap::ENCODED format, created with the BitmapEncoder of the
+ * bitmapencoder tool, to the same bitmaps stored as raw RGB565 or ARGB8888 pixels.
+ *
+ * A few typical images are generated: an icon with anti-aliased transparent edges, an opaque
+ * UI panel with flat colors, a photo-like opaque image, and a soft shadow. Each image is
+ * encoded with every encoding able to store it. First, random parts of the encoded bitmaps
+ * are drawn at random positions and alpha values by LCD16bppAccelerated, and must give the
+ * same frame buffer as drawing the raw bitmap: ARGB8888 for L8 and ARGB8888_LZ4, RGB565 for
+ * RGB565_RLE. EncodedBitmap::decode() must reproduce the raw pixels as well. Then the size of
+ * each bitmap, and the number of pixels per second drawn, is measured for the whole bitmap
+ * and for its right half, which requires decoding the left half of LZ4 lines too.
+ *
+ * The blit capabilities of the DMA are cleared, so everything is drawn in software. The
+ * benchmark registers its own bitmap database, which Bitmap only allows once, so it must
+ * run before anything else registers one.
+ *
+ * One CSV row is written per bitmap, and a summary is printed to stderr:
+ *
+ *     image,format,bytes,raw_bytes,pixels_per_s,right_half_pixels_per_s
+ */
+class EncodedBitmapBenchmark
+{
+public:
+    EncodedBitmapBenchmark(HeadlessDMA& dma);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if an encoded bitmap was not drawn or decoded like the raw bitmap.
+     */
+    bool run(FILE* out);
+
+private:
+    static const uint16_t BITMAP_WIDTH = 160;
+    static const uint16_t BITMAP_HEIGHT = 120;
+    static const unsigned NUMBER_OF_TRIALS = 400;
+    static const unsigned MIN_MEASURE_TIME_US = 20000;
+
+    enum Image
+    {
+        ICON,
+        PANEL,
+        PHOTO,
+        SHADOW,
+        NUMBER_OF_IMAGES
+    };
+
+    static const int NUMBER_OF_ENCODINGS = 3;
+    static const uint16_t BITMAPS_PER_IMAGE = 2 + NUMBER_OF_ENCODINGS; ///< ARGB8888, RGB565 and the encodings
+    static const uint16_t NUMBER_OF_BITMAPS = NUMBER_OF_IMAGES * BITMAPS_PER_IMAGE;
+
+    static const char* getName(Image image);
+    static uint32_t getPixel(Image image, int x, int y);
+    static uint16_t getBitmapId(Image image, int bitmap);
+
+    void createDatabase();
+    bool verify(Image image, int encoding);
+    double measure(BitmapId bitmap, const Rect& rect);
+    void randomizeFrameBuffer();
+    unsigned random();
+
+    HeadlessDMA& dma;
+    LCD16bppAccelerated lcd;
+    unsigned seed;
+    Bitmap::BitmapData* database;
+    std::vector<uint32_t> argb8888[NUMBER_OF_IMAGES];
+    std::vector<uint16_t> rgb565[NUMBER_OF_IMAGES];
+    std::vector<uint8_t> encoded[NUMBER_OF_IMAGES][NUMBER_OF_ENCODINGS];
+    uint16_t* original;
+    uint16_t* expected;
+};
+
+#endif // ENCODED_BITMAP_BENCHMARK_HPP
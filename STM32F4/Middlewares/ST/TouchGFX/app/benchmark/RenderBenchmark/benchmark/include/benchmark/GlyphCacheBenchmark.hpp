@@ -0,0 +1,91 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef GLYPH_CACHE_BENCHMARK_HPP
+#define GLYPH_CACHE_BENCHMARK_HPP
+
+#include <touchgfx/CachedFont.hpp>
+#include <touchgfx/FontManager.hpp>
+#include <touchgfx/InternalFlashFont.hpp>
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Measures drawing frequently updated numbers, like a TextAreaWithWildcard showing values,
+ * with a 4 bpp font through the GlyphCache compared to directly from the font.
+ *
+ * A font with random glyphs for the printable ASCII characters is generated. Every frame
+ * redraws a number of lines of text with changing values. The frames are first drawn using
+ * the font directly, then using a CachedFont wrapping it, after clearing the cache and
+ * caching the digits like a screen would in setupScreen(). The frame buffers must be
+ * identical in every frame.
+ *
+ * The blit capabilities of the DMA are cleared, so everything is drawn in software. One CSV
+ * row is written per font, and a summary is printed to stderr:
+ *
+ *     font,frames,draw_us,hits,misses,admissions,rejections,admitted_bytes
+ */
+class GlyphCacheBenchmark
+{
+public:
+    GlyphCacheBenchmark(HeadlessDMA& dma);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if the cached glyphs were not drawn identically.
+     */
+    bool run(FILE* out);
+
+private:
+    static const Unicode::UnicodeChar FIRST_CHAR = 0x20;
+    static const uint16_t NUMBER_OF_GLYPHS = 95;
+    static const uint16_t FONT_HEIGHT = 24;
+    static const uint16_t NUMBER_OF_LINES = 6;
+    static const uint32_t NUMBER_OF_FRAMES = 300;
+    static const uint16_t CACHE_SLOTS = 64;
+    static const uint32_t CACHE_SIZE = 8 * 1024;
+
+    class SingleFontProvider : public FontProvider
+    {
+    public:
+        SingleFontProvider() : font(0) { }
+        virtual Font* getFont(FontId fontId)
+        {
+            return font;
+        }
+        Font* font;
+    };
+
+    void createFont();
+    uint32_t drawFrames(const Font* font, uint32_t* hashes);
+    uint32_t hashFrameBuffer();
+    unsigned random();
+
+    HeadlessDMA& dma;
+    unsigned seed;
+    GlyphNode glyphs[NUMBER_OF_GLYPHS];
+    uint8_t* glyphData;
+    InternalFlashFont* flashFont;
+    CachedFont* cachedFont;
+    SingleFontProvider fontProvider;
+    uint8_t* cacheMemory;
+    uint32_t referenceHashes[NUMBER_OF_FRAMES];
+    uint32_t cachedHashes[NUMBER_OF_FRAMES];
+};
+
+#endif // GLYPH_CACHE_BENCHMARK_HPP
@@ -0,0 +1,122 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef GOLDEN_IMAGE_TEST_HPP
+#define GOLDEN_IMAGE_TEST_HPP
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <platform/driver/touch/ScriptedTouchController.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <touchgfx/Callback.hpp>
+#include <stdio.h>
+#include <vector>
+
+using namespace touchgfx;
+
+/**
+ * Renders a script of scenario switches and touch interactions, and compares every frame
+ * against golden hashes stored in a text file. A frame is hashed after it has been drawn,
+ * together with each rectangle flushed in the frame, i.e. the area invalidated and
+ * redrawn. The script is a text file with one command per line, and # starting a comment:
+ *
+ *     scenario <name>        Switches to a scenario, starting from its initial state
+ *     wait <frames>          Draws frames without changing the touch
+ *     press <x> <y>          Touches the display at (x, y) until released
+ *     drag <x> <y> <frames>  Moves the touch to (x, y) in equal steps, one per frame
+ *     release                Stops touching the display
+ *     click <x> <y>          Touches the display at (x, y) for one frame
+ *
+ * The golden file has a line per frame with the 64-bit FNV-1a hash of the frame buffer and
+ * the number of rectangles flushed, each followed by a line per rectangle:
+ *
+ *     frame <number> <hash> <rectangles>
+ *     rect <x> <y> <width> <height> <hash>
+ *
+ * A frame fails the test if its frame hash differs from the golden hash. For the first
+ * failing frames, the frame is written to the diff directory as a PPM image, together with
+ * an image where the rectangles flushed in only one of the frame and the golden frame, or
+ * with different pixels, are shown in color, outlined in red, and the rest of the frame is
+ * grayed out. A frame with the
+ * expected pixels but different rectangles passes the test, but is reported as a change
+ * in what is invalidated. One CSV row is written per frame, and a summary is printed to
+ * stderr:
+ *
+ *     frame,frame_hash,golden_hash,rects,different_rects,result
+ */
+class GoldenImageTest
+{
+public:
+    GoldenImageTest(HALHeadless& hal, ScriptedTouchController& touchController, FrontendHeap& heap);
+
+    /**
+     * Runs the script.
+     *
+     * @param out           The file to write the results to.
+     * @param scriptFile    The script to run.
+     * @param goldenFile    The golden hashes to compare against, or to write when updating.
+     * @param update        If true, the golden file is written instead of compared against.
+     * @param diffDirectory The directory to write images of the failing frames to, or null
+     *                      to not write any.
+     *
+     * @return false if the script or golden file could not be read or written, or if a
+     *         frame differs from the golden hash.
+     */
+    bool run(FILE* out, const char* scriptFile, const char* goldenFile, bool update, const char* diffDirectory);
+
+private:
+    static const uint32_t MAX_DIFF_IMAGES = 16;
+
+    struct RectHash
+    {
+        Rect rect;
+        uint64_t hash;
+    };
+
+    struct FrameHash
+    {
+        uint64_t hash;
+        uint32_t firstRect;
+        uint32_t numberOfRects;
+    };
+
+    bool runScript(FILE* script, const char* scriptFile);
+    void drawFrames(uint32_t numberOfFrames);
+    bool readGolden(const char* goldenFile);
+    bool writeGolden(const char* goldenFile) const;
+    void compareFrame(uint32_t frame);
+    static bool containsRect(const std::vector<RectHash>& rectHashes, const FrameHash& frame, const RectHash& rect);
+    bool writeImages(uint32_t frame, const std::vector<Rect>& differentRects) const;
+
+    void frameDrawn(const FrameStatistics& statistics);
+    void rectFlushed(const Rect& rect);
+
+    HALHeadless& hal;
+    ScriptedTouchController& touchController;
+    FrontendHeap& heap;
+    Callback<GoldenImageTest, const FrameStatistics&> frameCallback;
+    Callback<GoldenImageTest, const Rect&> flushCallback;
+    FILE* csv;
+    const char* diffDirectory;
+    bool comparing;
+    std::vector<Rect> flushedRects;
+    std::vector<uint16_t> lastFrame;
+    std::vector<FrameHash> frames;
+    std::vector<RectHash> rects;
+    std::vector<FrameHash> goldenFrames;
+    std::vector<RectHash> goldenRects;
+    uint32_t failedFrames;
+    uint32_t changedInvalidations;
+    uint32_t imagesWritten;
+};
+
+#endif // GOLDEN_IMAGE_TEST_HPP
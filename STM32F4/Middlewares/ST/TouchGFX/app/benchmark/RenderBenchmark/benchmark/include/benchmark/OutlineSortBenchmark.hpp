@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef OUTLINE_SORT_BENCHMARK_HPP
+#define OUTLINE_SORT_BENCHMARK_HPP
+
+#include <touchgfx/canvas_widget_renderer/Outline.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Measures the number of Outline cells sorted per second by Outline::qsortCells() and by
+ * Outline::radixSortCells(). The cells are either generated along the outlines of rings, in
+ * drawing order like the cells of a gauge made from Circle widgets, or spread uniformly over
+ * the display.
+ *
+ * One CSV row is written per distribution and number of cells, and a summary is printed to
+ * stderr:
+ *
+ *     distribution,cells,qsort_cells_per_s,radix_cells_per_s
+ */
+class OutlineSortBenchmark
+{
+public:
+    OutlineSortBenchmark(unsigned width, unsigned height);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if the sorts did not agree on the order of the cells.
+     */
+    bool run(FILE* out);
+
+private:
+    static const unsigned MAX_CELLS = 16384;
+    static const unsigned MAX_ROWS = 1024;
+    static const unsigned MIN_MEASURE_TIME_US = 20000;
+
+    enum Distribution
+    {
+        RINGS,
+        UNIFORM
+    };
+
+    void generateCells(Distribution distribution, unsigned numCells);
+    double measure(unsigned numCells, bool radix);
+    bool verify(unsigned numCells) const;
+    unsigned random();
+
+    unsigned width;
+    unsigned height;
+    unsigned seed;
+    Cell original[MAX_CELLS];
+    Cell cells[MAX_CELLS];
+    Cell expected[MAX_CELLS];
+    uint16_t buffer[MAX_ROWS];
+};
+
+#endif // OUTLINE_SORT_BENCHMARK_HPP
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef PAINTER_BENCHMARK_HPP
+#define PAINTER_BENCHMARK_HPP
+
+#include <touchgfx/widgets/canvas/PainterRGB565.hpp>
+#include <touchgfx/widgets/canvas/PainterRGB565LinearGradient.hpp>
+#include <touchgfx/widgets/canvas/PainterRGB565RadialGradient.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Measures the cost per pixel of the RGB565 painters, calling render() directly with the
+ * scan lines of an anti-aliased disc, so the rasterization of the shape is not measured.
+ *
+ * Each painter is measured painting every pixel through renderNext() and renderPixel(),
+ * which is how AbstractPainterRGB565::render() paints for painters without renderSpan(),
+ * and then using its span path. For the color painter the span path is its own render().
+ * Every other frame is drawn with a widget alpha, and the gradients move between frames.
+ * For the gradient painters, the frame buffer must be identical after every frame for both
+ * paths. The render() of the color painter blends in RGB565 and rounds differently, so it is
+ * only measured.
+ *
+ * The cycles are read from the time stamp counter on x86, and are nanoseconds elsewhere.
+ * One CSV row is written per painter and path, and a summary is printed to stderr:
+ *
+ *     painter,path,frames,pixels,cycles_per_pixel,ns_per_pixel
+ */
+class PainterBenchmark
+{
+public:
+    PainterBenchmark();
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if the frames of a gradient painter differ between the paths.
+     */
+    bool run(FILE* out);
+
+private:
+    static const uint32_t NUMBER_OF_FRAMES = 200;
+    static const int16_t RADIUS = 120;
+    static const int MAX_SPANS = 2 * RADIUS + 3;
+
+    enum PainterType
+    {
+        COLOR,
+        LINEAR_GRADIENT,
+        RADIAL_GRADIENT,
+        NUMBER_OF_PAINTERS
+    };
+
+    enum Path
+    {
+        PER_PIXEL,
+        SPAN,
+        NUMBER_OF_PATHS
+    };
+
+    /**
+     * A painter which can be given a widget alpha without a Canvas.
+     */
+    template <class T>
+    class Measured : public T
+    {
+    public:
+        using T::setWidgetAlpha;
+    };
+
+    /**
+     * A color painter which paints through AbstractPainterRGB565::render().
+     */
+    class PerPixelColor : public Measured<PainterRGB565>
+    {
+    public:
+        virtual void render(uint8_t* ptr, int x, int xAdjust, int y, unsigned count, const uint8_t* covers)
+        {
+            AbstractPainterRGB565::render(ptr, x, xAdjust, y, count, covers);
+        }
+    };
+
+    /**
+     * A gradient painter which only paints through renderNext().
+     */
+    template <class T>
+    class PerPixelGradient : public Measured<T>
+    {
+    protected:
+        virtual bool renderSpan(uint32_t* colors, unsigned count)
+        {
+            return false;
+        }
+    };
+
+    struct Span
+    {
+        int16_t x;
+        int16_t y;
+        uint16_t count;
+        uint32_t coversOffset;
+    };
+
+    struct Result
+    {
+        uint64_t cycles;
+        uint64_t nanoseconds;
+        uint64_t pixels;
+    };
+
+    void createSpans();
+    AbstractPainter& getPainter(PainterType type, Path path, uint32_t frame);
+    Result drawFrames(PainterType type, Path path);
+    uint32_t hashFrameBuffer();
+
+    Measured<PainterRGB565> color;
+    PerPixelColor perPixelColor;
+    Measured<PainterRGB565LinearGradient> linearGradient;
+    PerPixelGradient<PainterRGB565LinearGradient> perPixelLinearGradient;
+    Measured<PainterRGB565RadialGradient> radialGradient;
+    PerPixelGradient<PainterRGB565RadialGradient> perPixelRadialGradient;
+
+    Span spans[MAX_SPANS];
+    int numberOfSpans;
+    uint8_t covers[MAX_SPANS * (2 * RADIUS + 4)];
+    uint32_t hashes[NUMBER_OF_PATHS][NUMBER_OF_FRAMES];
+};
+
+#endif // PAINTER_BENCHMARK_HPP
@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef PARALLEL_RENDER_BENCHMARK_HPP
+#define PARALLEL_RENDER_BENCHMARK_HPP
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <gui/common/Scenario.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Verifies that drawing the scenarios with RenderWorkers puts the same pixels in the frame
+ * buffer as drawing them on a single thread, and measures the speed-up.
+ *
+ * Each scenario is first drawn on a single thread into a single frame buffer, saving every
+ * frame. It is then started again and drawn by PosixRenderWorkers with a few numbers of
+ * workers, each worker with its own CanvasWidgetRenderer buffer. After every frame, the
+ * frame buffer must be identical to the saved frame.
+ *
+ * The workers draw without the DMA, so the speed-up is measured against a single worker
+ * rather than the single thread. It is limited by the number of processors online, which is
+ * printed first.
+ *
+ * One CSV row is written per scenario and number of workers, and a summary is printed to
+ * stderr:
+ *
+ *     scenario,workers,frames,single_thread_us,total_us,avg_frame_us,speedup,different_frames
+ */
+class ParallelRenderBenchmark
+{
+public:
+    ParallelRenderBenchmark(HALHeadless& hal, FrontendHeap& heap, uint32_t canvasBufferSize);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out    The file to write the results to.
+     * @param first  The first scenario to draw.
+     * @param last   The last scenario to draw.
+     * @param frames The number of frames to compare per scenario.
+     *
+     * @return false if any frame drawn in parallel differs from the single thread.
+     */
+    bool run(FILE* out, Scenario first, Scenario last, uint32_t frames);
+
+private:
+    static const uint32_t WARMUP_FRAMES = 2;
+    static const int NUMBER_OF_CONFIGURATIONS = 3;
+
+    void startScenario(Scenario scenario);
+    uint64_t drawReferenceFrames(Scenario scenario, uint32_t frames);
+    uint32_t drawParallelFrames(Scenario scenario, uint32_t frames, uint8_t workers, uint64_t& totalUS);
+
+    HALHeadless& hal;
+    FrontendHeap& heap;
+    uint32_t canvasBufferSize;
+    uint16_t* referenceFrames;
+    uint16_t* frameBuffer;
+};
+
+#endif // PARALLEL_RENDER_BENCHMARK_HPP
@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef PARTIAL_FRAME_BUFFER_BENCHMARK_HPP
+#define PARTIAL_FRAME_BUFFER_BENCHMARK_HPP
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <touchgfx/hal/PartialFrameBuffer.hpp>
+#include <touchgfx/Callback.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <gui/common/Scenario.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Verifies that drawing the scenarios in strips, using a PartialFrameBuffer, puts the same
+ * pixels on the display as drawing them into a full frame buffer.
+ *
+ * Each scenario is first drawn into a single full frame buffer, saving every frame. It is
+ * then started again and drawn into strip buffers of a few sizes. The strips are sent to an
+ * emulated display with its own graphics RAM. A transmission is only completed when the
+ * renderer waits for its strip buffer, or at the end of the frame, so a strip buffer reused
+ * too early would put the wrong pixels on the display. After every frame, the graphics RAM
+ * must be identical to the saved frame.
+ *
+ * One CSV row is written per scenario and strip configuration, and a summary is printed to
+ * stderr:
+ *
+ *     scenario,strip_lines,strip_buffers,strip_bytes,frames,strips,transmitted_bytes,
+ *     overlapped_strips,different_frames
+ */
+class PartialFrameBufferBenchmark
+{
+public:
+    PartialFrameBufferBenchmark(HALHeadless& hal, FrontendHeap& heap);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out    The file to write the results to.
+     * @param first  The first scenario to draw.
+     * @param last   The last scenario to draw.
+     * @param frames The number of frames to compare per scenario.
+     *
+     * @return false if the display differs from the full frame buffer after any frame.
+     */
+    bool run(FILE* out, Scenario first, Scenario last, uint32_t frames);
+
+private:
+    static const uint32_t WARMUP_FRAMES = 2;
+    static const int NUMBER_OF_CONFIGURATIONS = 3;
+
+    struct Configuration
+    {
+        uint16_t lines;
+        uint16_t buffers;
+    };
+
+    struct Transmit
+    {
+        Rect area;
+        const uint16_t* pixels;
+    };
+
+    /**
+     * Strip buffers which complete the oldest transmission when waiting for a buffer.
+     */
+    class StripBuffers : public PartialFrameBuffer
+    {
+    public:
+        StripBuffers(PartialFrameBufferBenchmark& benchmark, uint16_t* buffer, uint32_t bufferSize, uint16_t numberOfBuffers);
+        using PartialFrameBuffer::getNumberOfTransmits;
+
+    protected:
+        virtual void waitForTransmit();
+
+    private:
+        PartialFrameBufferBenchmark& benchmark;
+    };
+
+    void startScenario(Scenario scenario);
+    void drawReferenceFrames(Scenario scenario, uint32_t frames);
+    bool drawStripFrames(FILE* out, Scenario scenario, uint32_t frames, const Configuration& configuration);
+    void transmit(const Rect& area, const uint16_t* pixels);
+    void completeTransmit();
+
+    HALHeadless& hal;
+    FrontendHeap& heap;
+    Callback<PartialFrameBufferBenchmark, const Rect&, const uint16_t*> transmitCallback;
+    StripBuffers* stripBuffers;
+    uint16_t* referenceFrames;
+    uint16_t* displayRAM;
+    Transmit transmits[8];
+    uint16_t firstTransmit;
+    uint16_t numberOfTransmits;
+    uint64_t strips;
+    uint64_t transmittedBytes;
+    uint64_t overlappedStrips;
+};
+
+#endif // PARTIAL_FRAME_BUFFER_BENCHMARK_HPP
@@ -0,0 +1,136 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCROLL_BLIT_BENCHMARK_HPP
+#define SCROLL_BLIT_BENCHMARK_HPP
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <gui/containers/ScrollListItem.hpp>
+#include <touchgfx/Screen.hpp>
+#include <touchgfx/containers/ScrollableContainer.hpp>
+#include <touchgfx/containers/SwipeContainer.hpp>
+#include <touchgfx/widgets/Box.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * The screen of the ScrollBlitBenchmark. Shows either a ScrollableContainer with a grid of
+ * scroll list items, scrolled diagonally back and forth, or a SwipeContainer with pages of
+ * scroll list items, dragged and released to swipe to the next page. Optionally, a box
+ * moving across the screen in front of the container prevents moving its pixels while the
+ * box overlaps it.
+ */
+class ScrollBlitBenchmarkScreen : public Screen
+{
+public:
+    enum ContainerType
+    {
+        SCROLLABLE_CONTAINER,
+        SWIPE_CONTAINER
+    };
+
+    ScrollBlitBenchmarkScreen(ContainerType type, bool overlay, bool scrollByBlit, BitmapId dot, BitmapId selectedDot);
+    virtual ~ScrollBlitBenchmarkScreen() { }
+
+    virtual void setupScreen();
+    virtual void handleTickEvent();
+
+    static const char* getName(ContainerType type);
+
+private:
+    static const int16_t COLUMNS = 2;
+    static const int16_t ROWS = 16;
+    static const int16_t NUMBER_OF_PAGES = 3;
+    static const int16_t ITEMS_PER_PAGE = 5;
+    static const uint32_t SCROLL_PERIOD = 160;
+    static const uint32_t SWIPE_PERIOD = 40;
+    static const uint32_t SWIPE_DRAG_TICKS = 16;
+    static const uint32_t OVERLAY_PERIOD = 48;
+
+    // Makes the scrolling of a ScrollableContainer available without simulating a finger
+    class DraggedContainer : public ScrollableContainer
+    {
+    public:
+        void scrollBy(int16_t deltaX, int16_t deltaY)
+        {
+            doScroll(deltaX, deltaY);
+        }
+    };
+
+    ContainerType type;
+    bool overlay;
+    uint32_t tick;
+
+    Box background;
+
+    DraggedContainer scrollableContainer;
+    Container grid;
+    Box gridBackground;
+    ScrollListItem gridItems[COLUMNS * ROWS];
+
+    SwipeContainer swipeContainer;
+    Container pages[NUMBER_OF_PAGES];
+    Box pageBackgrounds[NUMBER_OF_PAGES];
+    ScrollListItem pageItems[NUMBER_OF_PAGES * ITEMS_PER_PAGE];
+
+    Box overlayBox;
+};
+
+/**
+ * Compares scrolling a ScrollableContainer and swiping a SwipeContainer with the contents
+ * redrawn in every frame, and with the pixels moved in the frame buffer by the
+ * FrameBufferScroller so only the newly exposed strips are drawn.
+ *
+ * Each configuration is run with scroll-by-blit disabled, saving every frame, and then
+ * enabled. The frames must be identical. The configurations with an overlay have a box moving
+ * in front of the container every other half period, forcing a full redraw while it is shown,
+ * and the pixels to be moved while it is hidden. Frames
+ * are double buffered, and the frame compared is the one displayed after each simulated
+ * vsync. The frame time is the time spent in a simulated vsync. One CSV row is written per
+ * configuration and mode, and a summary is printed to stderr:
+ *
+ *     container,overlay,scroll_by_blit,frames,avg_frame_time_us,redrawn_pixels_per_frame,scrolled_pixels_per_frame,different_frames
+ */
+class ScrollBlitBenchmark
+{
+public:
+    ScrollBlitBenchmark(HALHeadless& hal, FrontendHeap& heap);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out    The file to write the results to.
+     * @param frames The number of frames to measure per configuration.
+     *
+     * @return false if a frame drawn with scroll-by-blit differs from the frame redrawn.
+     */
+    bool run(FILE* out, uint32_t frames);
+
+private:
+    static const uint32_t WARMUP_FRAMES = 2;
+    static const uint16_t DOT_SIZE = 10;
+
+    uint32_t drawFrames(FILE* out, ScrollBlitBenchmarkScreen::ContainerType type, bool overlay, bool scrollByBlit, uint32_t frames);
+    BitmapId createDot(colortype color);
+
+    HALHeadless& hal;
+    FrontendHeap& heap;
+    ScrollBlitBenchmarkScreen* screen;
+    BitmapId dot;
+    BitmapId selectedDot;
+    uint16_t* referenceFrames;
+};
+
+#endif // SCROLL_BLIT_BENCHMARK_HPP
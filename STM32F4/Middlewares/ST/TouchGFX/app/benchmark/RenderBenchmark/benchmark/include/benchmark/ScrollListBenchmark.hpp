@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCROLL_LIST_BENCHMARK_HPP
+#define SCROLL_LIST_BENCHMARK_HPP
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Measures the frame time of the scroll list scenario with a list of 10000 items, with the
+ * items drawn normally and from a cache using CachedListItem.
+ *
+ * The list is flung back and forth like in the scroll list scenario. Each configuration is
+ * run with items drawn normally, saving every frame, and then with the items drawn from the
+ * cache. The cached items are only rendered when an item scrolls into view, or the data of
+ * an item changes, so the frames must be identical. The configurations with updates change
+ * the data of an item in view at a fixed interval. The scroll list scenario itself, with 200
+ * items drawn normally, is measured as a reference.
+ *
+ * Frames are drawn into a single frame buffer. The frame time is the time spent in a
+ * simulated vsync, which includes handling the tick and drawing the invalidated areas. One
+ * CSV row is written per configuration, and a summary is printed to stderr:
+ *
+ *     items,cached,update_interval,frames,avg_frame_time_us,max_frame_time_us,different_frames
+ */
+class ScrollListBenchmark
+{
+public:
+    ScrollListBenchmark(HALHeadless& hal, FrontendHeap& heap);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out    The file to write the results to.
+     * @param frames The number of frames to measure per configuration.
+     *
+     * @return false if a frame drawn from the cache differs from the frame drawn normally.
+     */
+    bool run(FILE* out, uint32_t frames);
+
+private:
+    static const uint32_t WARMUP_FRAMES = 2;
+    static const int NUMBER_OF_CONFIGURATIONS = 3;
+
+    struct Configuration
+    {
+        int16_t items;
+        uint16_t updateInterval;
+    };
+
+    uint32_t drawFrames(FILE* out, const Configuration& configuration, bool cached, uint32_t frames, bool compare);
+
+    HALHeadless& hal;
+    FrontendHeap& heap;
+    uint16_t* frameBuffer;
+    uint16_t* referenceFrames;
+};
+
+#endif // SCROLL_LIST_BENCHMARK_HPP
@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef TEXTURE_MAPPER_BENCHMARK_HPP
+#define TEXTURE_MAPPER_BENCHMARK_HPP
+
+#include <touchgfx/widgets/TextureMapper.hpp>
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Measures a 240x240 dial rotating around the z axis while zooming in and out, which the
+ * TextureMapper draws using the affine path, compared to the general perspective path.
+ *
+ * Every combination of bitmap format, rendering algorithm and alpha is drawn for a number of
+ * frames, first using the perspective path and then the affine path. The two frames are
+ * compared pixel by pixel. The affine path rounds the texture coordinates differently, so a
+ * few pixels may sample a neighboring texel, which can differ a lot on the edges of the tick
+ * marks. The share of differing pixels must stay below 0.1% of the dial. A wrong texel or
+ * blend would show in every frame. The largest difference of a color channel is reported.
+ *
+ * The blit capabilities of the DMA are cleared, so everything is drawn in software. One CSV
+ * row is written per combination, and a summary is printed to stderr:
+ *
+ *     format,algorithm,alpha,frames,perspective_fps,affine_fps,max_channel_diff,diff_pixels_percent
+ */
+class TextureMapperBenchmark
+{
+public:
+    TextureMapperBenchmark(HeadlessDMA& dma);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out The file to write the results to.
+     *
+     * @return false if the affine path differs more than tolerated from the perspective path.
+     */
+    bool run(FILE* out);
+
+private:
+    static const uint16_t DIAL_SIZE = 240;
+    static const uint32_t NUMBER_OF_FRAMES = 120;
+    static const uint32_t MAX_DIFF_PIXELS_PER_MILLE = 1;
+
+    /**
+     * A TextureMapper which can be rotated without a screen to invalidate.
+     */
+    class Dial : public TextureMapper
+    {
+    public:
+        void setZAngle(float angle)
+        {
+            zAngle = angle;
+            applyTransformation();
+        }
+    };
+
+    struct Result
+    {
+        uint32_t perspectiveUS;
+        uint32_t affineUS;
+        uint32_t diffPixels;
+        int maxChannelDiff;
+    };
+
+    void createDial(Bitmap::BitmapFormat format);
+    Result drawFrames(TextureMapper::RenderingAlgorithm algorithm, uint8_t alpha);
+    uint32_t drawFrame(bool affine, uint32_t frame);
+    void compareFrames(Result& result);
+
+    HeadlessDMA& dma;
+    BitmapId dial;
+    Dial textureMapper;
+    uint16_t* reference;
+};
+
+#endif // TEXTURE_MAPPER_BENCHMARK_HPP
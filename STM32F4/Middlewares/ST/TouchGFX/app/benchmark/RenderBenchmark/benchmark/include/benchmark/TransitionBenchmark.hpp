@@ -0,0 +1,66 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef TRANSITION_BENCHMARK_HPP
+#define TRANSITION_BENCHMARK_HPP
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <stdio.h>
+
+using namespace touchgfx;
+
+/**
+ * Measures the frame time of screen transitions between pages with 50 widgets, with the
+ * widgets of the page transitioning to moved and drawn in every tick, and with the page
+ * drawn once into a screen cache bitmap, which is moved instead.
+ *
+ * The slide transition scenario is run with a background and 7x7 tiles on every page,
+ * using a SlideTransition and a CoverTransition. Each transition is run with the widgets
+ * moved, saving every frame, and then with the screen cache bitmap set. The frames must be
+ * identical. Frames are double buffered, and the frame compared is the one displayed after
+ * each simulated vsync. The frame time is the time spent in a simulated vsync. One CSV row
+ * is written per configuration, and a summary is printed to stderr:
+ *
+ *     transition,cached,widgets,frames,avg_frame_time_us,max_frame_time_us,different_frames
+ */
+class TransitionBenchmark
+{
+public:
+    TransitionBenchmark(HALHeadless& hal, FrontendHeap& heap);
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param out    The file to write the results to.
+     * @param frames The number of frames to measure per configuration.
+     *
+     * @return false if a frame drawn with the screen cache differs from the frame drawn
+     *         normally.
+     */
+    bool run(FILE* out, uint32_t frames);
+
+private:
+    static const uint32_t WARMUP_FRAMES = 2;
+    static const uint16_t COLUMNS = 7;
+    static const uint16_t ROWS = 7;
+
+    uint32_t drawFrames(FILE* out, bool cover, bool cached, uint32_t frames);
+
+    HALHeadless& hal;
+    FrontendHeap& heap;
+    BitmapId screenCache;
+    uint16_t* referenceFrames;
+};
+
+#endif // TRANSITION_BENCHMARK_HPP
@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/AnimationBenchmark.hpp>
+#include <gui/common/Scenario.hpp>
+#include <touchgfx/AnimationScheduler.hpp>
+
+namespace
+{
+uint32_t hashFrameBuffer()
+{
+    // FNV-1a of the frame buffer drawn into
+    const uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(HAL::DISPLAY_WIDTH) * HAL::DISPLAY_HEIGHT; i++)
+    {
+        hash = (hash ^ frameBuffer[i]) * 16777619u;
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+    return hash;
+}
+}
+
+AnimationBenchmark::AnimationBenchmark(HALHeadless& hal, FrontendHeap& heap)
+    : hal(hal),
+      heap(heap),
+      referenceHashes(0)
+{
+}
+
+bool AnimationBenchmark::run(FILE* out, uint32_t frames)
+{
+    referenceHashes = new uint32_t[2 * frames];
+
+    bool identical = true;
+    fprintf(out, "animations,ticked_by,easing,frames,avg_tick_us,max_tick_us,avg_draw_us,different_frames\n");
+    for (int fixedPointEasing = 0; fixedPointEasing < 2; fixedPointEasing++)
+    {
+        tickFrames(out, TIMER_WIDGET_ANIMATIONS, false, fixedPointEasing != 0, frames);
+    }
+    for (int fixedPointEasing = 0; fixedPointEasing < 2; fixedPointEasing++)
+    {
+        if (tickFrames(out, TIMER_WIDGET_ANIMATIONS, true, fixedPointEasing != 0, frames) != 0)
+        {
+            identical = false;
+        }
+    }
+    for (int fixedPointEasing = 0; fixedPointEasing < 2; fixedPointEasing++)
+    {
+        tickFrames(out, SCHEDULED_ANIMATIONS, true, fixedPointEasing != 0, frames);
+    }
+
+    AnimationScheduler::setInstance(&heap.app.getAnimationScheduler());
+    delete[] referenceHashes;
+    referenceHashes = 0;
+    return identical;
+}
+
+uint32_t AnimationBenchmark::tickFrames(FILE* out, uint16_t animations, bool scheduler, bool fixedPointEasing, uint32_t frames)
+{
+    heap.model = Model();
+    heap.model.setAnimations(animations, fixedPointEasing);
+    AnimationScheduler::setInstance(scheduler ? &heap.app.getAnimationScheduler() : 0);
+    heap.app.gotoScenario(SCENARIO_ANIMATIONS);
+    hal.setTickLimit(WARMUP_FRAMES);
+    hal.taskEntry();
+
+    uint64_t totalTickUS = 0;
+    uint32_t maxTickUS = 0;
+    uint64_t totalDrawUS = 0;
+    uint32_t differentFrames = 0;
+    uint32_t* references = referenceHashes + (fixedPointEasing ? frames : 0);
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        const uint32_t start = HALHeadless::getMicroseconds();
+        heap.app.cacheDrawOperations(true);
+        heap.app.handleTickEvent();
+        const uint32_t ticked = HALHeadless::getMicroseconds();
+        heap.app.cacheDrawOperations(false);
+        const uint32_t drawn = HALHeadless::getMicroseconds();
+        totalTickUS += ticked - start;
+        maxTickUS = MAX(maxTickUS, ticked - start);
+        totalDrawUS += drawn - ticked;
+
+        if (animations == TIMER_WIDGET_ANIMATIONS)
+        {
+            const uint32_t hash = hashFrameBuffer();
+            if (!scheduler)
+            {
+                references[frame] = hash;
+            }
+            else if (hash != references[frame])
+            {
+                if (differentFrames == 0)
+                {
+                    fprintf(stderr, "Scheduled animations: frame %u differs from the timer widget frame\n", frame);
+                }
+                differentFrames++;
+            }
+        }
+    }
+
+    const char* tickedBy = scheduler ? "scheduler" : "timer_widgets";
+    const char* easing = fixedPointEasing ? "fixed" : "float";
+    fprintf(out, "%u,%s,%s,%u,%.1f,%u,%.1f,%u\n", animations, tickedBy, easing, frames,
+            static_cast<double>(totalTickUS) / frames, static_cast<unsigned>(maxTickUS),
+            static_cast<double>(totalDrawUS) / frames, differentFrames);
+    fprintf(stderr, "%3u animations, %-13s %-5s: tick avg %7.1f us  max %6u us  draw avg %8.1f us%s\n", animations,
+            tickedBy, easing, static_cast<double>(totalTickUS) / frames, static_cast<unsigned>(maxTickUS),
+            static_cast<double>(totalDrawUS) / frames,
+            !scheduler || animations != TIMER_WIDGET_ANIMATIONS ? "" : (differentFrames == 0 ? "  identical" : "  DIFFERENT"));
+    return differentFrames;
+}
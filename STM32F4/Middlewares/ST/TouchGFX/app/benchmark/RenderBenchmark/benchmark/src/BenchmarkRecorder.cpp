@@ -0,0 +1,140 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/BenchmarkRecorder.hpp>
+#include <string.h>
+
+BenchmarkRecorder::BenchmarkRecorder(HALHeadless& hal_, HeadlessDMA& dma_, AcceleratedMVPApplication& app_)
+    : hal(hal_),
+      dma(dma_),
+      app(app_),
+      frameCallback(this, &BenchmarkRecorder::frameRendered),
+      csv(0),
+      scenarioName(0),
+      numberOfFrames(0),
+      totalFrameTimeUS(0),
+      maxFrameTimeUS(0),
+      totalPixelsFlushed(0),
+      totalBlitOperations(0),
+      totalDirtyPixels(0),
+      totalRedrawnPixels(0),
+      totalDrawnPixels(0)
+{
+    hal.setFrameCallback(frameCallback);
+}
+
+bool BenchmarkRecorder::open(const char* filename)
+{
+    if (filename == 0 || strcmp(filename, "-") == 0)
+    {
+        csv = stdout;
+    }
+    else
+    {
+        csv = fopen(filename, "w");
+        if (csv == 0)
+        {
+            return false;
+        }
+    }
+    fprintf(csv, "scenario,frame,frame_time_us,rendered,pixels_flushed,rects_flushed,blit_ops,blit_pixels,dirty_pixels,redrawn_pixels,copied_pixels,drawn_pixels\n");
+    return true;
+}
+
+void BenchmarkRecorder::close()
+{
+    if (csv != 0 && csv != stdout)
+    {
+        fclose(csv);
+    }
+    csv = 0;
+}
+
+void BenchmarkRecorder::beginScenario(const char* name)
+{
+    scenarioName = name;
+    numberOfFrames = 0;
+    totalFrameTimeUS = 0;
+    maxFrameTimeUS = 0;
+    totalPixelsFlushed = 0;
+    totalBlitOperations = 0;
+    totalDirtyPixels = 0;
+    totalRedrawnPixels = 0;
+    totalDrawnPixels = 0;
+    dma.resetStatistics();
+    app.resetInvalidationStatistics();
+    hal.resetFrameCounter();
+}
+
+void BenchmarkRecorder::endScenario()
+{
+    if (numberOfFrames > 0)
+    {
+        fprintf(stderr, "%-20s frames: %5u  avg: %8.1f us  max: %8u us  pixels/frame: %9.1f  blits/frame: %7.1f  dirty/frame: %9.1f  redrawn/frame: %9.1f  overdraw: %4.2f\n",
+               scenarioName, static_cast<unsigned>(numberOfFrames),
+               static_cast<double>(totalFrameTimeUS) / numberOfFrames,
+               static_cast<unsigned>(maxFrameTimeUS),
+               static_cast<double>(totalPixelsFlushed) / numberOfFrames,
+               static_cast<double>(totalBlitOperations) / numberOfFrames,
+               static_cast<double>(totalDirtyPixels) / numberOfFrames,
+               static_cast<double>(totalRedrawnPixels) / numberOfFrames,
+               totalRedrawnPixels > 0 ? static_cast<double>(totalDrawnPixels) / totalRedrawnPixels : 0.0);
+    }
+    scenarioName = 0;
+}
+
+void BenchmarkRecorder::frameRendered(const FrameStatistics& statistics)
+{
+    if (scenarioName == 0)
+    {
+        return;
+    }
+
+    const uint32_t blitOperations = dma.getNumberOfOperations();
+    const uint32_t blitPixels = dma.getNumberOfPixels();
+    dma.resetStatistics();
+    const InvalidationStatistics& invalidation = app.getInvalidationStatistics();
+    const uint32_t dirtyPixels = static_cast<uint32_t>(invalidation.invalidatedArea);
+    const uint32_t redrawnPixels = static_cast<uint32_t>(invalidation.redrawnArea);
+    const uint32_t copiedPixels = static_cast<uint32_t>(invalidation.copiedArea);
+    const uint32_t drawnPixels = static_cast<uint32_t>(invalidation.drawnArea);
+    app.resetInvalidationStatistics();
+
+    if (csv != 0)
+    {
+        fprintf(csv, "%s,%u,%u,%d,%u,%u,%u,%u,%u,%u,%u,%u\n", scenarioName,
+                static_cast<unsigned>(statistics.frameNumber),
+                static_cast<unsigned>(statistics.frameTimeUS),
+                statistics.rendered ? 1 : 0,
+                static_cast<unsigned>(statistics.pixelsFlushed),
+                static_cast<unsigned>(statistics.rectsFlushed),
+                static_cast<unsigned>(blitOperations),
+                static_cast<unsigned>(blitPixels),
+                static_cast<unsigned>(dirtyPixels),
+                static_cast<unsigned>(redrawnPixels),
+                static_cast<unsigned>(copiedPixels),
+                static_cast<unsigned>(drawnPixels));
+    }
+
+    numberOfFrames++;
+    totalFrameTimeUS += statistics.frameTimeUS;
+    if (statistics.frameTimeUS > maxFrameTimeUS)
+    {
+        maxFrameTimeUS = statistics.frameTimeUS;
+    }
+    totalPixelsFlushed += statistics.pixelsFlushed;
+    totalBlitOperations += blitOperations;
+    totalDirtyPixels += dirtyPixels;
+    totalRedrawnPixels += redrawnPixels;
+    totalDrawnPixels += drawnPixels;
+}
@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/BitmapCacheBenchmark.hpp>
+#include <touchgfx/BitmapCache.hpp>
+#include <platform/driver/lcd/LCD16bpp.hpp>
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <new>
+#include <stdlib.h>
+
+BitmapCacheBenchmark::BitmapCacheBenchmark(uint16_t* cache_, uint32_t size)
+    : cache(cache_),
+      cacheSize(size),
+      seed(1),
+      database(0)
+{
+}
+
+bool BitmapCacheBenchmark::run(FILE* out)
+{
+    // The database can only be registered once, so it stays registered
+    createDatabase();
+    BitmapCache::registerBitmapDatabase(database, NUMBER_OF_BITMAPS, cache, cacheSize);
+
+    // Nothing is cached until the Images are drawn
+    FrameMaximums maximums = { 0, 0 };
+    drawFrames(referenceHashes, maximums, false);
+    BitmapCache::setCompactionBudget(COMPACTION_BUDGET);
+    BitmapCache::resetStatistics();
+    maximums.endFrameUS = 0;
+    maximums.compactedBytes = 0;
+    drawFrames(cachedHashes, maximums, true);
+
+    bool identical = true;
+    for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES && identical; frame++)
+    {
+        if (cachedHashes[frame] != referenceHashes[frame])
+        {
+            fprintf(stderr, "Frame %u differs when drawn using the bitmap cache\n", frame);
+            identical = false;
+        }
+    }
+
+    const BitmapCacheStatistics& statistics = BitmapCache::getStatistics();
+    fprintf(out, "frames,hits,misses,admissions,evictions,deferrals,admitted_bytes,compacted_bytes,max_frame_compacted_bytes,max_end_frame_us\n");
+    fprintf(out, "%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n", NUMBER_OF_FRAMES, statistics.hits, statistics.misses, statistics.admissions,
+            statistics.evictions, statistics.deferrals, statistics.admittedBytes, statistics.compactedBytes, maximums.compactedBytes,
+            maximums.endFrameUS);
+    fprintf(stderr, "Frames: %u  hits: %u  misses: %u  hit rate: %.1f%%\n", NUMBER_OF_FRAMES, statistics.hits, statistics.misses,
+            100.0 * statistics.hits / (statistics.hits + statistics.misses));
+    fprintf(stderr, "Admissions: %u (%u bytes)  evictions: %u  deferrals: %u  longest endFrame: %u us\n",
+            statistics.admissions, statistics.admittedBytes, statistics.evictions, statistics.deferrals, maximums.endFrameUS);
+    fprintf(stderr, "Compacted: %u bytes  most in one frame: %u bytes (budget %u bytes)\n",
+            statistics.compactedBytes, maximums.compactedBytes, COMPACTION_BUDGET);
+    return identical;
+}
+
+void BitmapCacheBenchmark::createDatabase()
+{
+    // Every third bitmap has an alpha channel, the rest are opaque
+    database = static_cast<Bitmap::BitmapData*>(malloc(NUMBER_OF_BITMAPS * sizeof(Bitmap::BitmapData)));
+    for (uint16_t i = 0; i < NUMBER_OF_BITMAPS; i++)
+    {
+        const bool alpha = i % 3 == 0;
+        const uint32_t bytes = BITMAP_WIDTH * BITMAP_HEIGHT * (alpha ? 4 : 2);
+        bitmapData[i] = new uint8_t[bytes];
+        for (uint32_t j = 0; j < bytes; j++)
+        {
+            bitmapData[i][j] = static_cast<uint8_t>(random());
+        }
+        const Bitmap::BitmapData bitmap =
+        {
+            bitmapData[i], 0, BITMAP_WIDTH, BITMAP_HEIGHT,
+            0, 0, static_cast<uint16_t>(alpha ? 0 : BITMAP_WIDTH), static_cast<uint16_t>(alpha ? 0 : BITMAP_HEIGHT),
+            static_cast<uint8_t>(alpha ? Bitmap::ARGB8888 : Bitmap::RGB565)
+        };
+        new (&database[i]) Bitmap::BitmapData(bitmap);
+    }
+}
+
+void BitmapCacheBenchmark::drawFrames(uint32_t* hashes, FrameMaximums& maximums, bool useImages)
+{
+    // The frames are drawn outside the HAL loop, which normally lets the DMA start
+    HAL::getInstance()->allowDMATransfers();
+    HAL::lcd().fillRect(Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT), 0);
+
+    // The images are laid out in a 4x2 grid. They cannot be created before the bitmap
+    // database has been registered.
+    Image images[IMAGES_PER_SCREEN];
+    for (uint16_t i = 0; i < IMAGES_PER_SCREEN; i++)
+    {
+        images[i].setXY((i % 4) * 120 + 12, (i / 4) * 136 + 20);
+    }
+
+    uint32_t frame = 0;
+    for (uint16_t visit = 0; visit < NUMBER_OF_VISITS; visit++)
+    {
+        // Visit the screens in a varying order, each using a window of the bitmaps
+        const uint16_t screen = (visit * 3 + visit / NUMBER_OF_SCREENS) % NUMBER_OF_SCREENS;
+        for (uint16_t i = 0; i < IMAGES_PER_SCREEN; i++)
+        {
+            images[i].setBitmap(Bitmap((screen * 6 + i) % NUMBER_OF_BITMAPS));
+        }
+
+        for (uint16_t f = 0; f < FRAMES_PER_VISIT; f++)
+        {
+            if (f == 0)
+            {
+                for (uint16_t i = 0; i < IMAGES_PER_SCREEN; i++)
+                {
+                    drawImage(images[i], useImages);
+                }
+            }
+            else if (f % 2 == 1)
+            {
+                drawImage(images[(f / 2) % IMAGES_PER_SCREEN], useImages);
+            }
+
+            const uint32_t compactedBytes = BitmapCache::getStatistics().compactedBytes;
+            const uint32_t start = HALHeadless::getMicroseconds();
+            BitmapCache::endFrame();
+            const uint32_t elapsedUS = HALHeadless::getMicroseconds() - start;
+            maximums.endFrameUS = MAX(maximums.endFrameUS, elapsedUS);
+            maximums.compactedBytes = MAX(maximums.compactedBytes, BitmapCache::getStatistics().compactedBytes - compactedBytes);
+            hashes[frame++] = hashFrameBuffer();
+        }
+    }
+}
+
+void BitmapCacheBenchmark::drawImage(const Image& image, bool useImage)
+{
+    const Rect rect(0, 0, BITMAP_WIDTH, BITMAP_HEIGHT);
+    if (useImage)
+    {
+        image.draw(rect);
+    }
+    else
+    {
+        // Like Image::draw(), but drawn by LCD16bpp, which does not report the draw to the cache
+        static_cast<LCD16bpp&>(HAL::lcd()).LCD16bpp::drawPartialBitmap(Bitmap(image.getBitmap()), image.getX(), image.getY(), rect, 255);
+    }
+}
+
+uint32_t BitmapCacheBenchmark::hashFrameBuffer()
+{
+    // FNV-1a of the frame buffer, after the DMA has finished drawing
+    const uint8_t* frameBuffer = reinterpret_cast<const uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    uint32_t hash = 2166136261U;
+    for (uint32_t i = 0; i < HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT * 2; i++)
+    {
+        hash = (hash ^ frameBuffer[i]) * 16777619U;
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+    return hash;
+}
+
+unsigned BitmapCacheBenchmark::random()
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
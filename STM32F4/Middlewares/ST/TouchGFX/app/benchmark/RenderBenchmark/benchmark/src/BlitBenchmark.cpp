@@ -0,0 +1,229 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/BlitBenchmark.hpp>
+#include <platform/driver/lcd/BlitKernels.hpp>
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <string.h>
+
+BlitBenchmark::BlitBenchmark(HeadlessDMA& dma_)
+    : dma(dma_),
+      rgb565(BITMAP_INVALID),
+      argb8888(BITMAP_INVALID),
+      rgb888(BITMAP_INVALID),
+      original(0),
+      expected(0),
+      seed(1)
+{
+}
+
+bool BlitBenchmark::run(FILE* out)
+{
+    rgb565 = Bitmap::dynamicBitmapCreate(BITMAP_WIDTH, BITMAP_HEIGHT, Bitmap::RGB565);
+    argb8888 = Bitmap::dynamicBitmapCreate(BITMAP_WIDTH, BITMAP_HEIGHT, Bitmap::ARGB8888);
+    rgb888 = Bitmap::dynamicBitmapCreate(BITMAP_WIDTH, BITMAP_HEIGHT, Bitmap::RGB888);
+    if (rgb565 == BITMAP_INVALID || argb8888 == BITMAP_INVALID || rgb888 == BITMAP_INVALID)
+    {
+        fprintf(stderr, "Unable to create the bitmaps\n");
+        return false;
+    }
+
+    // Everything must be drawn in software, by the LCDs being compared
+    dma.setBlitCaps(0);
+
+    const uint32_t pixels = HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT;
+    original = new uint8_t[pixels * 3];
+    expected = new uint8_t[pixels * 3];
+
+    bool identical = true;
+    fprintf(out, "operation,scalar_pixels_per_s,kernel_pixels_per_s\n");
+    fprintf(stderr, "Blit kernels: %s\n", BlitKernels::getName());
+    for (int i = 0; i < NUMBER_OF_OPERATIONS && identical; i++)
+    {
+        const Operation operation = static_cast<Operation>(i);
+        const uint32_t bytes = pixels * (is24bpp(operation) ? 3 : 2);
+        identical = verify(operation, bytes);
+        if (identical)
+        {
+            randomizeBitmaps();
+            randomizeFrameBuffer(bytes);
+            const double scalarRate = measure(is24bpp(operation) ? static_cast<LCD&>(scalar24) : scalar16, operation);
+            const double kernelRate = measure(is24bpp(operation) ? static_cast<LCD&>(kernels24) : kernels16, operation);
+
+            fprintf(out, "%s,%.0f,%.0f\n", getName(operation), scalarRate, kernelRate);
+            fprintf(stderr, "%-24s scalar: %7.1f Mpixels/s  kernels: %7.1f Mpixels/s  speedup: %5.2f\n",
+                    getName(operation), scalarRate / 1e6, kernelRate / 1e6, kernelRate / scalarRate);
+        }
+    }
+
+    delete[] original;
+    delete[] expected;
+    return identical;
+}
+
+const char* BlitBenchmark::getName(Operation operation)
+{
+    static const char* const names[NUMBER_OF_OPERATIONS] =
+    {
+        "fill", "fill_alpha", "copy", "copy_alpha", "argb8888", "argb8888_alpha",
+        "fill_24bpp", "fill_alpha_24bpp", "copy_24bpp", "copy_alpha_24bpp"
+    };
+    return names[operation];
+}
+
+bool BlitBenchmark::is24bpp(Operation operation)
+{
+    return operation >= FILL_24BPP;
+}
+
+bool BlitBenchmark::hasAlpha(Operation operation)
+{
+    return operation == FILL_WITH_ALPHA || operation == COPY_WITH_ALPHA || operation == COPY_ARGB8888_WITH_ALPHA ||
+           operation == FILL_24BPP_WITH_ALPHA || operation == COPY_24BPP_WITH_ALPHA;
+}
+
+void BlitBenchmark::perform(LCD& lcd, Operation operation, const Blit& blit)
+{
+    switch (operation)
+    {
+    case COPY:
+    case COPY_WITH_ALPHA:
+        lcd.drawPartialBitmap(Bitmap(rgb565), blit.x, blit.y, blit.rect, blit.alpha);
+        break;
+    case COPY_ARGB8888:
+    case COPY_ARGB8888_WITH_ALPHA:
+        lcd.drawPartialBitmap(Bitmap(argb8888), blit.x, blit.y, blit.rect, blit.alpha);
+        break;
+    case COPY_24BPP:
+    case COPY_24BPP_WITH_ALPHA:
+        lcd.drawPartialBitmap(Bitmap(rgb888), blit.x, blit.y, blit.rect, blit.alpha);
+        break;
+    default:
+        lcd.fillRect(Rect(blit.x + blit.rect.x, blit.y + blit.rect.y, blit.rect.width, blit.rect.height), colortype(blit.color), blit.alpha);
+        break;
+    }
+}
+
+bool BlitBenchmark::verify(Operation operation, uint32_t bytes)
+{
+    LCD& scalar = is24bpp(operation) ? static_cast<LCD&>(scalar24) : scalar16;
+    LCD& kernels = is24bpp(operation) ? static_cast<LCD&>(kernels24) : kernels16;
+    uint8_t* frameBuffer = reinterpret_cast<uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    HAL::getInstance()->unlockFrameBuffer();
+
+    for (unsigned round = 0; round < NUMBER_OF_ROUNDS; round++)
+    {
+        randomizeBitmaps();
+        randomizeFrameBuffer(bytes);
+        memcpy(original, frameBuffer, bytes);
+        for (unsigned trial = 0; trial < TRIALS_PER_ROUND; trial++)
+        {
+            const Blit blit = randomBlit(operation);
+            perform(scalar, operation, blit);
+            memcpy(expected, frameBuffer, bytes);
+            memcpy(frameBuffer, original, bytes);
+            perform(kernels, operation, blit);
+            if (memcmp(frameBuffer, expected, bytes) != 0)
+            {
+                uint32_t i = 0;
+                while (frameBuffer[i] == expected[i])
+                {
+                    i++;
+                }
+                const uint32_t pixel = i / (is24bpp(operation) ? 3 : 2);
+                fprintf(stderr, "%s: pixel %u,%u is %02x instead of %02x, drawing %d,%d,%d,%d at %d,%d with color %06x and alpha %u\n",
+                        getName(operation), pixel % HAL::FRAME_BUFFER_WIDTH, pixel / HAL::FRAME_BUFFER_WIDTH, frameBuffer[i], expected[i],
+                        blit.rect.x, blit.rect.y, blit.rect.width, blit.rect.height, blit.x, blit.y, blit.color, blit.alpha);
+                return false;
+            }
+            memcpy(original, frameBuffer, bytes);
+        }
+    }
+    return true;
+}
+
+double BlitBenchmark::measure(LCD& lcd, Operation operation)
+{
+    Blit blit;
+    blit.x = 1; // Not aligned to a 32 bit word
+    blit.y = 1;
+    blit.rect = Rect(0, 0, BITMAP_WIDTH, BITMAP_HEIGHT);
+    blit.color = is24bpp(operation) ? 0x3C8AD2 : 0x3C8A;
+    blit.alpha = hasAlpha(operation) ? 128 : 255;
+
+    uint32_t iterations = 0;
+    uint32_t elapsedUS = 0;
+    const uint32_t start = HALHeadless::getMicroseconds();
+    do
+    {
+        for (int batch = 0; batch < 16; batch++)
+        {
+            perform(lcd, operation, blit);
+        }
+        iterations += 16;
+        elapsedUS = HALHeadless::getMicroseconds() - start;
+    }
+    while (elapsedUS < MIN_MEASURE_TIME_US);
+
+    return static_cast<double>(BITMAP_WIDTH * BITMAP_HEIGHT) * iterations * 1e6 / (elapsedUS > 0 ? elapsedUS : 1);
+}
+
+void BlitBenchmark::randomizeBitmaps()
+{
+    const int pixels = BITMAP_WIDTH * BITMAP_HEIGHT;
+    uint16_t* rgb565Data = reinterpret_cast<uint16_t*>(Bitmap::dynamicBitmapGetAddress(rgb565));
+    uint32_t* argb8888Data = reinterpret_cast<uint32_t*>(Bitmap::dynamicBitmapGetAddress(argb8888));
+    uint8_t* rgb888Data = Bitmap::dynamicBitmapGetAddress(rgb888);
+    for (int i = 0; i < pixels; i++)
+    {
+        rgb565Data[i] = static_cast<uint16_t>(random() ^ (random() << 8));
+        // Like most images, use plenty of fully transparent and fully opaque pixels
+        const unsigned kind = random() % 4;
+        const uint32_t alpha = kind == 0 ? 0 : (kind == 1 ? 0xFF : random() & 0xFF);
+        argb8888Data[i] = (alpha << 24) | ((random() << 12) ^ random());
+    }
+    for (int i = 0; i < pixels * 3; i++)
+    {
+        rgb888Data[i] = static_cast<uint8_t>(random());
+    }
+}
+
+void BlitBenchmark::randomizeFrameBuffer(uint32_t bytes)
+{
+    uint8_t* frameBuffer = reinterpret_cast<uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    for (uint32_t i = 0; i < bytes; i++)
+    {
+        frameBuffer[i] = static_cast<uint8_t>(random());
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+BlitBenchmark::Blit BlitBenchmark::randomBlit(Operation operation)
+{
+    Blit blit;
+    blit.x = random() % (HAL::DISPLAY_WIDTH - BITMAP_WIDTH + 1);
+    blit.y = random() % (HAL::DISPLAY_HEIGHT - BITMAP_HEIGHT + 1);
+    blit.rect.width = 1 + random() % BITMAP_WIDTH;
+    blit.rect.height = 1 + random() % BITMAP_HEIGHT;
+    blit.rect.x = random() % (BITMAP_WIDTH - blit.rect.width + 1);
+    blit.rect.y = random() % (BITMAP_HEIGHT - blit.rect.height + 1);
+    blit.color = ((random() << 15) ^ random()) & (is24bpp(operation) ? 0xFFFFFF : 0xFFFF);
+    blit.alpha = hasAlpha(operation) ? 1 + random() % 254 : 255;
+    return blit;
+}
+
+unsigned BlitBenchmark::random()
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
@@ -0,0 +1,231 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/DMAQueueBenchmark.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+
+DMAQueueBenchmark::DMAQueueBenchmark(HeadlessDMA& dma_)
+    : dma(dma_),
+      image(BITMAP_INVALID),
+      icon(BITMAP_INVALID),
+      seed(1)
+{
+}
+
+bool DMAQueueBenchmark::run(FILE* out)
+{
+    static const char* const modeNames[NUMBER_OF_MODES] = { "immediate", "deferred", "coalescing" };
+
+    createBitmaps();
+    if (image == BITMAP_INVALID || icon == BITMAP_INVALID)
+    {
+        fprintf(stderr, "Unable to create the bitmaps\n");
+        return false;
+    }
+    dma.setBlitCaps(HeadlessDMA::SUPPORTED_BLIT_CAPS);
+    HAL::getInstance()->allowDMATransfers();
+
+    bool identical = true;
+    fprintf(out, "mode,frames,queued_ops,merged_ops,executed_ops,dma_busy_us,draw_us\n");
+    for (int m = 0; m < NUMBER_OF_MODES; m++)
+    {
+        const Mode mode = static_cast<Mode>(m);
+        const Result result = drawFrames(mode);
+        const DMA_Statistics& statistics = result.statistics;
+        fprintf(out, "%s,%u,%u,%u,%u,%u,%u\n", modeNames[mode], NUMBER_OF_FRAMES, statistics.queuedOperations, statistics.mergedOperations,
+                statistics.executedOperations, statistics.busyTime / 1000, result.drawUS);
+        fprintf(stderr, "%-10s operations per frame: queued %6.1f  merged %6.1f  executed %6.1f  DMA busy %u us  draw %u us\n",
+                modeNames[mode], static_cast<double>(statistics.queuedOperations) / NUMBER_OF_FRAMES,
+                static_cast<double>(statistics.mergedOperations) / NUMBER_OF_FRAMES,
+                static_cast<double>(statistics.executedOperations) / NUMBER_OF_FRAMES, statistics.busyTime / 1000, result.drawUS);
+
+        for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES && identical; frame++)
+        {
+            if (hashes[mode][frame] != hashes[IMMEDIATE][frame])
+            {
+                fprintf(stderr, "Frame %u differs when the DMA is %s\n", frame, modeNames[mode]);
+                identical = false;
+            }
+        }
+    }
+
+    Bitmap::dynamicBitmapDelete(image);
+    Bitmap::dynamicBitmapDelete(icon);
+    image = icon = BITMAP_INVALID;
+    return identical;
+}
+
+void DMAQueueBenchmark::createBitmaps()
+{
+    image = Bitmap::dynamicBitmapCreate(IMAGE_WIDTH, IMAGE_HEIGHT, Bitmap::RGB565);
+    icon = Bitmap::dynamicBitmapCreate(ICON_SIZE, ICON_SIZE, Bitmap::ARGB8888);
+    if (image == BITMAP_INVALID || icon == BITMAP_INVALID)
+    {
+        return;
+    }
+
+    uint16_t* pixels = reinterpret_cast<uint16_t*>(Bitmap::dynamicBitmapGetAddress(image));
+    for (int16_t y = 0; y < IMAGE_HEIGHT; y++)
+    {
+        for (int16_t x = 0; x < IMAGE_WIDTH; x++)
+        {
+            pixels[y * IMAGE_WIDTH + x] = static_cast<uint16_t>(((x * 31 / IMAGE_WIDTH) << 11) | ((y * 63 / IMAGE_HEIGHT) << 5) | ((x ^ y) & 0x1F));
+        }
+    }
+    uint32_t* argb = reinterpret_cast<uint32_t*>(Bitmap::dynamicBitmapGetAddress(icon));
+    for (int16_t y = 0; y < ICON_SIZE; y++)
+    {
+        for (int16_t x = 0; x < ICON_SIZE; x++)
+        {
+            // A round icon with a soft edge
+            const int32_t dx = 2 * x + 1 - ICON_SIZE;
+            const int32_t dy = 2 * y + 1 - ICON_SIZE;
+            const int32_t distance = dx * dx + dy * dy;
+            const int32_t edge = ICON_SIZE * ICON_SIZE;
+            const uint32_t alpha = distance >= edge ? 0 : MIN(255, (edge - distance) / 16);
+            argb[y * ICON_SIZE + x] = (alpha << 24) | (static_cast<uint32_t>(x * 4) << 16) | 0x80C0;
+        }
+    }
+}
+
+DMAQueueBenchmark::Result DMAQueueBenchmark::drawFrames(Mode mode)
+{
+    dma.setDeferredTransfers(mode != IMMEDIATE);
+    dma.setMergingEnabled(mode == COALESCING);
+    dma.setOperationSetupTime(OPERATION_SETUP_NS);
+    dma.resetStatistics();
+
+    Result result;
+    result.drawUS = 0;
+    for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES; frame++)
+    {
+        const uint32_t start = HALHeadless::getMicroseconds();
+        drawFrame(frame);
+        dma.flush();
+        result.drawUS += HALHeadless::getMicroseconds() - start;
+        hashes[mode][frame] = hashFrameBuffer();
+    }
+    result.statistics = dma.getStatistics();
+
+    dma.setDeferredTransfers(false);
+    dma.setMergingEnabled(false);
+    dma.setOperationSetupTime(0);
+    return result;
+}
+
+void DMAQueueBenchmark::drawFrame(uint32_t frame)
+{
+    // The same random parts in every mode
+    seed = frame + 1;
+    LCD& lcd = HAL::lcd();
+    const int16_t width = HAL::DISPLAY_WIDTH;
+    const int16_t height = HAL::DISPLAY_HEIGHT;
+
+    // Background and a toolbar of adjacent boxes with the same color
+    lcd.fillRect(Rect(0, 0, width, height), 0x18E3);
+    for (int16_t x = 0; x < width; x += 40)
+    {
+        lcd.fillRect(Rect(x, 0, 40, 32), 0x2945);
+    }
+    // A highlighted button in the toolbar, partly covered by a label background
+    const int16_t selected = static_cast<int16_t>((frame / 10) % (width / 40)) * 40;
+    lcd.fillRect(Rect(selected, 0, 40, 32), 0x4A69);
+    lcd.fillRect(Rect(selected + 4, 8, 32, 16), 0x4A69);
+
+    // A segmented progress bar
+    const int16_t segmentWidth = (width - 40) / SEGMENTS;
+    const int16_t progress = static_cast<int16_t>(frame % (SEGMENTS + 1));
+    for (int16_t i = 0; i < SEGMENTS; i++)
+    {
+        lcd.fillRect(Rect(20 + i * segmentWidth, height - 30, segmentWidth, 12), i < progress ? 0x07E0 : 0x3186);
+    }
+
+    // An image drawn in several dirty rectangles, with a line drawn by the CPU on top
+    const int16_t imageX = 20;
+    const int16_t imageY = 50;
+    for (int16_t y = 0; y < IMAGE_HEIGHT; y += STRIP_HEIGHT)
+    {
+        lcd.drawPartialBitmap(Bitmap(image), imageX, imageY, Rect(0, y, IMAGE_WIDTH, STRIP_HEIGHT), 255);
+    }
+    drawSoftwareLine(imageX, static_cast<int16_t>(imageY + frame % IMAGE_HEIGHT), IMAGE_WIDTH);
+    lcd.fillRect(Rect(imageX, imageY + IMAGE_HEIGHT - 24, IMAGE_WIDTH, 24), 0x0000, 128);
+
+    // A faded image and an icon drawn in strips, each strip in two halves
+    const int16_t fadedX = 200;
+    for (int16_t y = 0; y < IMAGE_HEIGHT; y += STRIP_HEIGHT)
+    {
+        lcd.drawPartialBitmap(Bitmap(image), fadedX, imageY, Rect(0, y, IMAGE_WIDTH / 2, STRIP_HEIGHT), 160);
+        lcd.drawPartialBitmap(Bitmap(image), fadedX, imageY, Rect(IMAGE_WIDTH / 2, y, IMAGE_WIDTH / 2, STRIP_HEIGHT), 160);
+    }
+    const int16_t iconX = static_cast<int16_t>(fadedX + frame % (IMAGE_WIDTH - ICON_SIZE));
+    for (int16_t y = 0; y < ICON_SIZE; y += ICON_SIZE / 4)
+    {
+        lcd.drawPartialBitmap(Bitmap(icon), iconX, imageY + 20, Rect(0, y, ICON_SIZE, ICON_SIZE / 4), 255);
+    }
+
+    // Small random parts on a grid, which often touch or overlap, to check that operations
+    // are only moved ahead of operations they do not depend on
+    static const colortype colors[] = { 0xF800, 0x07E0, 0x001F };
+    const int16_t randomX = 380;
+    for (int i = 0; i < RANDOM_PARTS; i++)
+    {
+        const int16_t x = static_cast<int16_t>(randomX + (random() % 8) * 8);
+        const int16_t y = static_cast<int16_t>(imageY + (random() % 8) * 8);
+        const int16_t w = static_cast<int16_t>(8 + (random() % 3) * 8);
+        const int16_t h = static_cast<int16_t>(8 + (random() % 3) * 8);
+        switch (random() % 3)
+        {
+        case 0:
+            lcd.fillRect(Rect(x, y, w, h), colors[random() % 3]);
+            break;
+        case 1:
+            lcd.fillRect(Rect(x, y, w, h), colors[random() % 3], 128);
+            break;
+        default:
+            lcd.drawPartialBitmap(Bitmap(image), x, y, Rect(x - randomX, y - imageY, w, h), 255);
+            break;
+        }
+    }
+}
+
+void DMAQueueBenchmark::drawSoftwareLine(int16_t x, int16_t y, int16_t length)
+{
+    // Like a widget drawn by the CPU, which must wait for the DMA to finish
+    uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    for (int16_t i = 0; i < length; i++)
+    {
+        frameBuffer[y * HAL::FRAME_BUFFER_WIDTH + x + i] = 0xFFFF;
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+unsigned DMAQueueBenchmark::random()
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
+
+uint32_t DMAQueueBenchmark::hashFrameBuffer()
+{
+    // FNV-1a of the frame buffer
+    const uint8_t* frameBuffer = reinterpret_cast<const uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    uint32_t hash = 2166136261U;
+    for (uint32_t i = 0; i < HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT * 2; i++)
+    {
+        hash = (hash ^ frameBuffer[i]) * 16777619U;
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+    return hash;
+}
@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/EasingBenchmark.hpp>
+#include <touchgfx/FixedPointEasingEquations.hpp>
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <math.h>
+
+namespace
+{
+// The exact ease in curves, in double precision. The ease out and ease in/out curves
+// are derived from them like the equations do.
+enum Mode
+{
+    EASE_IN,
+    EASE_OUT,
+    EASE_IN_OUT
+};
+
+double linear(double p)
+{
+    return p;
+}
+
+double quad(double p)
+{
+    return p * p;
+}
+
+double cubic(double p)
+{
+    return p * p * p;
+}
+
+double quart(double p)
+{
+    return p * p * p * p;
+}
+
+double quint(double p)
+{
+    return p * p * p * p * p;
+}
+
+double back(double p)
+{
+    const double s = 1.70158;
+    return p * p * ((s + 1) * p - s);
+}
+
+double backInOut(double p)
+{
+    const double s = 1.70158 * 1.525;
+    return p * p * ((s + 1) * p - s);
+}
+
+double bounce(double p)
+{
+    p = 1 - p;
+    double bounceOut;
+    if (p < 1 / 2.75)
+    {
+        bounceOut = 7.5625 * p * p;
+    }
+    else if (p < 2 / 2.75)
+    {
+        p -= 1.5 / 2.75;
+        bounceOut = 7.5625 * p * p + 0.75;
+    }
+    else if (p < 2.5 / 2.75)
+    {
+        p -= 2.25 / 2.75;
+        bounceOut = 7.5625 * p * p + 0.9375;
+    }
+    else
+    {
+        p -= 2.625 / 2.75;
+        bounceOut = 7.5625 * p * p + 0.984375;
+    }
+    return 1 - bounceOut;
+}
+
+double circ(double p)
+{
+    return 1 - sqrt(1 - p * p);
+}
+
+double sine(double p)
+{
+    return 1 - cos(p * M_PI / 2);
+}
+
+double expo(double p)
+{
+    return p == 0 ? 0 : pow(2, 10 * (p - 1));
+}
+
+double elastic(double p)
+{
+    return sin(13 * M_PI / 2 * p) * pow(2, 10 * (p - 1));
+}
+}
+
+#define EQUATIONS(name, curve, inOutCurve) \
+    { #name "EaseIn", &EasingEquations::name##EaseIn, &FixedPointEasingEquations::name##EaseIn, &curve, EASE_IN }, \
+    { #name "EaseOut", &EasingEquations::name##EaseOut, &FixedPointEasingEquations::name##EaseOut, &curve, EASE_OUT }, \
+    { #name "EaseInOut", &EasingEquations::name##EaseInOut, &FixedPointEasingEquations::name##EaseInOut, &inOutCurve, EASE_IN_OUT }
+
+const EasingBenchmark::Equation EasingBenchmark::equations[] =
+{
+    EQUATIONS(back, back, backInOut),
+    EQUATIONS(bounce, bounce, bounce),
+    EQUATIONS(circ, circ, circ),
+    EQUATIONS(cubic, cubic, cubic),
+    EQUATIONS(elastic, elastic, elastic),
+    EQUATIONS(expo, expo, expo),
+    { "linearEaseNone", &EasingEquations::linearEaseNone, &FixedPointEasingEquations::linearEaseNone, &linear, EASE_IN },
+    EQUATIONS(quad, quad, quad),
+    EQUATIONS(quart, quart, quart),
+    EQUATIONS(quint, quint, quint),
+    EQUATIONS(sine, sine, sine),
+    { 0, 0, 0, 0, EASE_IN }
+};
+
+bool EasingBenchmark::run(FILE* out)
+{
+    static const int16_t changes[] = { 3, -7, 100, 272, -480, 480, 1000, 4096, -20000, 32767 };
+
+    bool withinBound = true;
+    fprintf(out, "equation,float_ns_per_call,fixed_ns_per_call,float_max_error,fixed_max_error\n");
+    for (const Equation* equation = equations; equation->name; equation++)
+    {
+        double floatMaxError = 0;
+        double fixedMaxError = 0;
+        bool equationWithinBound = true;
+        for (uint16_t d = 1; d <= MAX_DURATION; d++)
+        {
+            for (uint16_t t = 0; t <= d; t++)
+            {
+                const double progress = evaluate(*equation, static_cast<double>(t) / d);
+                for (unsigned i = 0; i < sizeof(changes) / sizeof(changes[0]); i++)
+                {
+                    const int16_t c = changes[i];
+                    const double exact = progress * c;
+                    if (fabs(exact) > 32767)
+                    {
+                        // Not representable, e.g. overshooting the full range
+                        continue;
+                    }
+                    const double floatError = fabs(equation->floatEquation(t, 0, c, d) - exact);
+                    const double fixedError = fabs(equation->fixedPointEquation(t, 0, c, d) - exact);
+                    floatMaxError = MAX(floatMaxError, floatError);
+                    fixedMaxError = MAX(fixedMaxError, fixedError);
+                    if (fixedError >= 1 + abs(c) / 2048.0)
+                    {
+                        if (equationWithinBound)
+                        {
+                            fprintf(stderr, "%s: %d instead of %.2f at t=%u, c=%d, d=%u\n", equation->name,
+                                    equation->fixedPointEquation(t, 0, c, d), exact, t, c, d);
+                        }
+                        equationWithinBound = false;
+                    }
+                }
+            }
+        }
+        withinBound = withinBound && equationWithinBound;
+
+        const double floatNS = measure(equation->floatEquation);
+        const double fixedNS = measure(equation->fixedPointEquation);
+        fprintf(out, "%s,%.2f,%.2f,%.2f,%.2f\n", equation->name, floatNS, fixedNS, floatMaxError, fixedMaxError);
+        fprintf(stderr, "%-18s float: %6.2f ns  fixed: %6.2f ns  max error float: %8.2f  fixed: %5.2f%s\n", equation->name,
+                floatNS, fixedNS, floatMaxError, fixedMaxError, equationWithinBound ? "" : "  OUT OF BOUND");
+    }
+    return withinBound;
+}
+
+double EasingBenchmark::evaluate(const Equation& equation, double progress)
+{
+    switch (equation.mode)
+    {
+    case EASE_OUT:
+        return 1 - equation.curve(1 - progress);
+    case EASE_IN_OUT:
+        return progress < 0.5 ? equation.curve(2 * progress) / 2 : 1 - equation.curve(2 - 2 * progress) / 2;
+    default:
+        return equation.curve(progress);
+    }
+}
+
+double EasingBenchmark::measure(EasingEquation equation)
+{
+    // Sum the results, so that the calls cannot be optimized away
+    volatile int32_t sum = 0;
+    uint32_t calls = 0;
+    uint32_t elapsedUS = 0;
+    const uint32_t start = HALHeadless::getMicroseconds();
+    do
+    {
+        int32_t batchSum = 0;
+        for (uint16_t t = 0; t <= TIMED_DURATION; t++)
+        {
+            batchSum += equation(t, 10, 300, TIMED_DURATION);
+        }
+        sum = sum + batchSum;
+        calls += TIMED_DURATION + 1;
+        elapsedUS = HALHeadless::getMicroseconds() - start;
+    }
+    while (elapsedUS < MIN_MEASURE_TIME_US);
+
+    return elapsedUS * 1000.0 / calls;
+}
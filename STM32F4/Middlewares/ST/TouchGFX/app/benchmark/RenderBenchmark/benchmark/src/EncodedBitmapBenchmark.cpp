@@ -0,0 +1,321 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/EncodedBitmapBenchmark.hpp>
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <BitmapEncoder.hpp>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+namespace
+{
+const char* const formatNames[] = { "argb8888", "rgb565", "l8", "rgb565_rle", "argb8888_lz4" };
+
+// Deterministic noise in the range 0-255
+uint32_t noise(int x, int y)
+{
+    uint32_t h = static_cast<uint32_t>(x) * 374761393U + static_cast<uint32_t>(y) * 668265263U;
+    h = (h ^ (h >> 13)) * 1274126177U;
+    return (h ^ (h >> 16)) & 0xFF;
+}
+} // namespace
+
+EncodedBitmapBenchmark::EncodedBitmapBenchmark(HeadlessDMA& dma_)
+    : dma(dma_),
+      seed(1),
+      database(0),
+      original(0),
+      expected(0)
+{
+}
+
+bool EncodedBitmapBenchmark::run(FILE* out)
+{
+    createDatabase();
+    Bitmap::registerBitmapDatabase(database, NUMBER_OF_BITMAPS);
+
+    // Everything must be drawn in software, like the encoded bitmaps
+    dma.setBlitCaps(0);
+
+    const uint32_t pixels = HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT;
+    original = new uint16_t[pixels];
+    expected = new uint16_t[pixels];
+
+    bool identical = true;
+    for (int image = 0; image < NUMBER_OF_IMAGES && identical; image++)
+    {
+        for (int encoding = 0; encoding < NUMBER_OF_ENCODINGS && identical; encoding++)
+        {
+            if (!encoded[image][encoding].empty())
+            {
+                identical = verify(static_cast<Image>(image), encoding);
+            }
+        }
+    }
+
+    if (identical)
+    {
+        fprintf(out, "image,format,bytes,raw_bytes,pixels_per_s,right_half_pixels_per_s\n");
+        const Rect whole(0, 0, BITMAP_WIDTH, BITMAP_HEIGHT);
+        const Rect rightHalf(BITMAP_WIDTH / 2, 0, BITMAP_WIDTH - BITMAP_WIDTH / 2, BITMAP_HEIGHT);
+        for (int i = 0; i < NUMBER_OF_IMAGES; i++)
+        {
+            const Image image = static_cast<Image>(i);
+            const bool opaque = !rgb565[image].empty();
+            const uint32_t rawBytes = BITMAP_WIDTH * BITMAP_HEIGHT * (opaque ? 2 : 4);
+            for (int bitmap = 0; bitmap < BITMAPS_PER_IMAGE; bitmap++)
+            {
+                const uint8_t* data = database[getBitmapId(image, bitmap)].data;
+                if (data == 0)
+                {
+                    continue;
+                }
+                const uint32_t bytes = bitmap < 2 ? BITMAP_WIDTH * BITMAP_HEIGHT * (bitmap == 0 ? 4 : 2)
+                                       : EncodedBitmap::getSize(data, BITMAP_WIDTH, BITMAP_HEIGHT);
+                randomizeFrameBuffer();
+                const double rate = measure(getBitmapId(image, bitmap), whole);
+                const double rightHalfRate = measure(getBitmapId(image, bitmap), rightHalf);
+                fprintf(out, "%s,%s,%u,%u,%.0f,%.0f\n", getName(image), formatNames[bitmap], bytes, rawBytes, rate, rightHalfRate);
+                fprintf(stderr, "%-6s %-12s %6u bytes (%5.1f%% of raw)  %7.1f Mpixels/s  right half: %7.1f Mpixels/s\n",
+                        getName(image), formatNames[bitmap], bytes, 100.0 * bytes / rawBytes, rate / 1e6, rightHalfRate / 1e6);
+            }
+        }
+    }
+
+    delete[] original;
+    delete[] expected;
+    return identical;
+}
+
+const char* EncodedBitmapBenchmark::getName(Image image)
+{
+    static const char* const names[NUMBER_OF_IMAGES] = { "icon", "panel", "photo", "shadow" };
+    return names[image];
+}
+
+uint32_t EncodedBitmapBenchmark::getPixel(Image image, int x, int y)
+{
+    switch (image)
+    {
+    case ICON:
+        {
+            // A two colored disc with a dark rim, anti-aliased with 16 levels of alpha
+            const int dx = 2 * x + 1 - BITMAP_WIDTH;
+            const int dy = 2 * y + 1 - BITMAP_HEIGHT;
+            const int radius = 2 * (BITMAP_HEIGHT / 2 - 4);
+            const int distance = static_cast<int>(dx * dx + dy * dy);
+            const int inside = radius * radius - distance;
+            if (inside <= -4 * radius)
+            {
+                return 0;
+            }
+            const uint32_t color = distance > (radius - 12) * (radius - 12) ? 0x102040 : (dy < 0 ? 0x3080E0 : 0xF0F0F0);
+            const int coverage = inside >= 0 ? 15 : 15 + inside * 15 / (4 * radius);
+            return (static_cast<uint32_t>(coverage * 17) << 24) | color;
+        }
+    case PANEL:
+        {
+            // A title bar, a framed body with a few buttons, and separator lines
+            if (y < 20)
+            {
+                return x < 4 || x >= BITMAP_WIDTH - 4 ? 0xFF203050 : 0xFF3060A0;
+            }
+            if (x < 2 || y < 22 || x >= BITMAP_WIDTH - 2 || y >= BITMAP_HEIGHT - 2)
+            {
+                return 0xFF808890;
+            }
+            if (y >= 90 && y < 110 && ((x >= 10 && x < 70) || (x >= 90 && x < 150)))
+            {
+                return x < 70 ? 0xFF40A040 : 0xFFC04040;
+            }
+            return (y - 22) % 16 == 15 ? 0xFFC8CCD0 : 0xFFE8ECF0;
+        }
+    case PHOTO:
+        {
+            // Smooth gradients with noise, like a photo or a rendered background
+            const uint32_t r = MIN(255U, static_cast<uint32_t>(x * 255 / BITMAP_WIDTH) + (noise(x, y) & 0x0F));
+            const uint32_t g = MIN(255U, static_cast<uint32_t>(y * 255 / BITMAP_HEIGHT) + (noise(y, x) & 0x0F));
+            const uint32_t b = 96 + ((x + y) & 0x3F) + (noise(x + y, x - y) & 0x07);
+            return 0xFF000000 | (r << 16) | (g << 8) | b;
+        }
+    case SHADOW:
+    case NUMBER_OF_IMAGES:
+        break;
+    }
+    // A soft drop shadow, falling off towards the edges
+    const int dx = MIN(x, BITMAP_WIDTH - 1 - x);
+    const int dy = MIN(y, BITMAP_HEIGHT - 1 - y);
+    const uint32_t alpha = MIN(dx, dy) >= 24 ? 160 : MIN(dx, dy) * 160 / 24;
+    return (alpha << 24) | 0x101018;
+}
+
+uint16_t EncodedBitmapBenchmark::getBitmapId(Image image, int bitmap)
+{
+    return static_cast<uint16_t>(image * BITMAPS_PER_IMAGE + bitmap);
+}
+
+void EncodedBitmapBenchmark::createDatabase()
+{
+    // Each image is stored as ARGB8888, RGB565 if it is opaque, and with each encoding
+    // able to store it
+    database = static_cast<Bitmap::BitmapData*>(malloc(NUMBER_OF_BITMAPS * sizeof(Bitmap::BitmapData)));
+    for (int i = 0; i < NUMBER_OF_IMAGES; i++)
+    {
+        const Image image = static_cast<Image>(i);
+        std::vector<uint32_t>& pixels = argb8888[image];
+        bool opaque = true;
+        for (int y = 0; y < BITMAP_HEIGHT; y++)
+        {
+            for (int x = 0; x < BITMAP_WIDTH; x++)
+            {
+                pixels.push_back(getPixel(image, x, y));
+                opaque = opaque && (pixels.back() >> 24) == 0xFF;
+            }
+        }
+        if (opaque)
+        {
+            for (uint32_t j = 0; j < pixels.size(); j++)
+            {
+                rgb565[image].push_back(static_cast<uint16_t>(((pixels[j] >> 8) & 0xF800) | ((pixels[j] >> 5) & 0x07E0) | ((pixels[j] >> 3) & 0x001F)));
+            }
+        }
+        for (int encoding = 0; encoding < NUMBER_OF_ENCODINGS; encoding++)
+        {
+            BitmapEncoder::encode(&pixels[0], BITMAP_WIDTH, BITMAP_HEIGHT, static_cast<EncodedBitmap::Encoding>(encoding), encoded[image][encoding]);
+        }
+
+        for (int bitmap = 0; bitmap < BITMAPS_PER_IMAGE; bitmap++)
+        {
+            const uint8_t* data = 0;
+            uint8_t format = Bitmap::ENCODED;
+            if (bitmap == 0)
+            {
+                data = reinterpret_cast<const uint8_t*>(&pixels[0]);
+                format = Bitmap::ARGB8888;
+            }
+            else if (bitmap == 1)
+            {
+                data = opaque ? reinterpret_cast<const uint8_t*>(&rgb565[image][0]) : 0;
+                format = Bitmap::RGB565;
+            }
+            else if (!encoded[image][bitmap - 2].empty())
+            {
+                data = &encoded[image][bitmap - 2][0];
+            }
+            const Bitmap::BitmapData bitmapData =
+            {
+                data, 0, BITMAP_WIDTH, BITMAP_HEIGHT,
+                0, 0, static_cast<uint16_t>(opaque ? BITMAP_WIDTH : 0), static_cast<uint16_t>(opaque ? BITMAP_HEIGHT : 0),
+                format
+            };
+            new (&database[getBitmapId(image, bitmap)]) Bitmap::BitmapData(bitmapData);
+        }
+    }
+}
+
+bool EncodedBitmapBenchmark::verify(Image image, int encoding)
+{
+    // RGB565_RLE draws like the RGB565 bitmap, the others like the ARGB8888 bitmap
+    const bool isRGB565 = encoding == EncodedBitmap::RGB565_RLE;
+    const Bitmap reference(getBitmapId(image, isRGB565 ? 1 : 0));
+    const Bitmap bitmap(getBitmapId(image, 2 + encoding));
+    const uint8_t* data = bitmap.getData();
+
+    std::vector<uint8_t> decoded(BITMAP_WIDTH * BITMAP_HEIGHT * (isRGB565 ? 2 : 4));
+    EncodedBitmap::decode(data, BITMAP_WIDTH, BITMAP_HEIGHT, &decoded[0]);
+    if (memcmp(&decoded[0], reference.getData(), decoded.size()) != 0)
+    {
+        fprintf(stderr, "%s %s: decoded pixels differ\n", getName(image), formatNames[2 + encoding]);
+        return false;
+    }
+
+    const uint32_t bytes = HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT * sizeof(uint16_t);
+    uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    HAL::getInstance()->unlockFrameBuffer();
+    randomizeFrameBuffer();
+    memcpy(original, frameBuffer, bytes);
+    for (unsigned trial = 0; trial < NUMBER_OF_TRIALS; trial++)
+    {
+        // Partly outside the display at times, and half of the time solid
+        const int16_t x = static_cast<int16_t>(random() % (HAL::DISPLAY_WIDTH + BITMAP_WIDTH / 2)) - BITMAP_WIDTH / 4;
+        const int16_t y = static_cast<int16_t>(random() % (HAL::DISPLAY_HEIGHT + BITMAP_HEIGHT / 2)) - BITMAP_HEIGHT / 4;
+        Rect rect;
+        rect.width = 1 + random() % BITMAP_WIDTH;
+        rect.height = 1 + random() % BITMAP_HEIGHT;
+        rect.x = random() % (BITMAP_WIDTH - rect.width + 1);
+        rect.y = random() % (BITMAP_HEIGHT - rect.height + 1);
+        const uint8_t alpha = trial % 2 == 0 ? 255 : static_cast<uint8_t>(1 + random() % 254);
+
+        lcd.drawPartialBitmap(reference, x, y, rect, alpha);
+        memcpy(expected, frameBuffer, bytes);
+        memcpy(frameBuffer, original, bytes);
+        if (trial % 4 < 2)
+        {
+            lcd.drawPartialBitmap(bitmap, x, y, rect, alpha);
+        }
+        else
+        {
+            lcd.blitCopy(data, Bitmap::ENCODED, Rect(x, y, BITMAP_WIDTH, BITMAP_HEIGHT), rect, alpha, EncodedBitmap::hasTransparentPixels(data));
+        }
+        if (memcmp(frameBuffer, expected, bytes) != 0)
+        {
+            uint32_t i = 0;
+            while (frameBuffer[i] == expected[i])
+            {
+                i++;
+            }
+            fprintf(stderr, "%s %s: pixel %u,%u is %04x instead of %04x, drawing %d,%d,%d,%d at %d,%d with alpha %u\n",
+                    getName(image), formatNames[2 + encoding], i % HAL::FRAME_BUFFER_WIDTH, i / HAL::FRAME_BUFFER_WIDTH,
+                    frameBuffer[i], expected[i], rect.x, rect.y, rect.width, rect.height, x, y, alpha);
+            return false;
+        }
+        memcpy(original, frameBuffer, bytes);
+    }
+    return true;
+}
+
+double EncodedBitmapBenchmark::measure(BitmapId bitmap, const Rect& rect)
+{
+    uint32_t iterations = 0;
+    uint32_t elapsedUS = 0;
+    const uint32_t start = HALHeadless::getMicroseconds();
+    do
+    {
+        for (int batch = 0; batch < 16; batch++)
+        {
+            lcd.drawPartialBitmap(Bitmap(bitmap), 1, 1, rect, 255);
+        }
+        iterations += 16;
+        elapsedUS = HALHeadless::getMicroseconds() - start;
+    }
+    while (elapsedUS < MIN_MEASURE_TIME_US);
+
+    return static_cast<double>(rect.width * rect.height) * iterations * 1e6 / (elapsedUS > 0 ? elapsedUS : 1);
+}
+
+void EncodedBitmapBenchmark::randomizeFrameBuffer()
+{
+    uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT); i++)
+    {
+        frameBuffer[i] = static_cast<uint16_t>(random() ^ (random() << 8));
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+unsigned EncodedBitmapBenchmark::random()
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
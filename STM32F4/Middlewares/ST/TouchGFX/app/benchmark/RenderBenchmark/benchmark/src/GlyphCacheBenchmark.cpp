@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/GlyphCacheBenchmark.hpp>
+#include <touchgfx/GlyphCache.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <stdlib.h>
+
+GlyphCacheBenchmark::GlyphCacheBenchmark(HeadlessDMA& dma_)
+    : dma(dma_),
+      seed(1),
+      glyphData(0),
+      flashFont(0),
+      cachedFont(0),
+      cacheMemory(0)
+{
+}
+
+bool GlyphCacheBenchmark::run(FILE* out)
+{
+    dma.setBlitCaps(0);
+    createFont();
+    cacheMemory = static_cast<uint8_t*>(malloc(CACHE_SIZE));
+    GlyphCache::setCache(cacheMemory, CACHE_SIZE, CACHE_SLOTS);
+
+    const uint32_t flashUS = drawFrames(flashFont, referenceHashes);
+
+    // Like a screen showing numbers would do in setupScreen()
+    fontProvider.font = cachedFont;
+    FontManager::setFontProvider(&fontProvider);
+    GlyphCache::clear();
+    GlyphCache::resetStatistics();
+    GlyphCache::cacheDigits(0);
+    const uint32_t cachedUS = drawFrames(cachedFont, cachedHashes);
+
+    bool identical = true;
+    for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES && identical; frame++)
+    {
+        if (cachedHashes[frame] != referenceHashes[frame])
+        {
+            fprintf(stderr, "Frame %u differs when drawn using the glyph cache\n", frame);
+            identical = false;
+        }
+    }
+
+    const GlyphCacheStatistics& statistics = GlyphCache::getStatistics();
+    fprintf(out, "font,frames,draw_us,hits,misses,admissions,rejections,admitted_bytes\n");
+    fprintf(out, "flash,%u,%u,0,0,0,0,0\n", NUMBER_OF_FRAMES, flashUS);
+    fprintf(out, "cached,%u,%u,%u,%u,%u,%u,%u\n", NUMBER_OF_FRAMES, cachedUS, statistics.hits, statistics.misses,
+            statistics.admissions, statistics.rejections, statistics.admittedBytes);
+    fprintf(stderr, "Frames: %u  flash font: %u us  cached font: %u us  speedup: %.2fx\n", NUMBER_OF_FRAMES, flashUS, cachedUS,
+            cachedUS > 0 ? static_cast<double>(flashUS) / cachedUS : 0.0);
+    fprintf(stderr, "Hits: %u  misses: %u  admissions: %u (%u bytes)  rejections: %u\n", statistics.hits, statistics.misses,
+            statistics.admissions, statistics.admittedBytes, statistics.rejections);
+    return identical;
+}
+
+void GlyphCacheBenchmark::createFont()
+{
+    // 4 bpp glyphs in the A4 format of varying width, sorted by unicode like the font
+    // converter does
+    uint32_t dataSize = 0;
+    for (uint16_t i = 0; i < NUMBER_OF_GLYPHS; i++)
+    {
+        const uint8_t width = static_cast<uint8_t>(8 + i % 7);
+        const GlyphNode glyph = { dataSize, static_cast<Unicode::UnicodeChar>(FIRST_CHAR + i), width, FONT_HEIGHT, FONT_HEIGHT - 4, 0,
+                                  static_cast<uint8_t>(width + 2), 0, 0, GLYPH_DATA_FORMAT_A4
+                                };
+        glyphs[i] = glyph;
+        dataSize += ((width + 1) / 2) * FONT_HEIGHT;
+    }
+    glyphData = new uint8_t[dataSize];
+    for (uint32_t i = 0; i < dataSize; i++)
+    {
+        glyphData[i] = static_cast<uint8_t>(random());
+    }
+
+    flashFont = new InternalFlashFont(glyphs, NUMBER_OF_GLYPHS, FONT_HEIGHT, 4, 4, 0, 0, glyphData, 0, '?', 0);
+    cachedFont = new CachedFont(flashFont);
+}
+
+uint32_t GlyphCacheBenchmark::drawFrames(const Font* font, uint32_t* hashes)
+{
+    static const char* const labels[NUMBER_OF_LINES] = { "Speed", "RPM", "Oil", "Coolant", "Fuel", "Range" };
+    const Rect lines(20, 20, 300, NUMBER_OF_LINES * 36);
+    HAL::lcd().fillRect(Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT), 0);
+
+    uint32_t drawUS = 0;
+    for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES; frame++)
+    {
+        // Redraw the values, like TextAreaWithWildcard::draw() does when invalidated
+        HAL::lcd().fillRect(lines, 0);
+        const uint32_t start = HALHeadless::getMicroseconds();
+        for (uint16_t line = 0; line < NUMBER_OF_LINES; line++)
+        {
+            Unicode::UnicodeChar text[32];
+            const int value = static_cast<int>((frame * (line + 3) * 37) % 20000) - 1000;
+            Unicode::strncpy(text, labels[line], 32);
+            const uint16_t length = Unicode::strlen(text);
+            Unicode::snprintf(text + length, 32 - length, ": %d.%d", value / 10, abs(value % 10));
+            const Rect area(lines.x, lines.y + line * 36, lines.width, 36);
+            LCD::StringVisuals visuals(font, 0xFFFF, 255, LEFT, 0, TEXT_ROTATE_0, TEXT_DIRECTION_LTR, 0);
+            HAL::lcd().drawString(area, Rect(0, 0, area.width, area.height), visuals, text);
+        }
+        drawUS += HALHeadless::getMicroseconds() - start;
+        hashes[frame] = hashFrameBuffer();
+    }
+    return drawUS;
+}
+
+uint32_t GlyphCacheBenchmark::hashFrameBuffer()
+{
+    // FNV-1a of the frame buffer
+    const uint8_t* frameBuffer = reinterpret_cast<const uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    uint32_t hash = 2166136261U;
+    for (uint32_t i = 0; i < HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT * 2; i++)
+    {
+        hash = (hash ^ frameBuffer[i]) * 16777619U;
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+    return hash;
+}
+
+unsigned GlyphCacheBenchmark::random()
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
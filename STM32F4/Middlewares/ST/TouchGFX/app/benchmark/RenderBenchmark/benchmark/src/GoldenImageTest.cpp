@@ -0,0 +1,465 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/GoldenImageTest.hpp>
+#include <gui/common/Scenario.hpp>
+#include <touchgfx/transforms/DisplayTransformation.hpp>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+namespace
+{
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+const uint64_t FNV_PRIME = 1099511628211ull;
+
+uint64_t hashPixels(const uint16_t* frameBuffer, const Rect& area)
+{
+    // FNV-1a of the pixels of the area in the frame buffer
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (int16_t y = area.y; y < area.bottom(); y++)
+    {
+        const uint16_t* pixel = frameBuffer + y * HAL::FRAME_BUFFER_WIDTH + area.x;
+        for (int16_t x = 0; x < area.width; x++)
+        {
+            hash = (hash ^ pixel[x]) * FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
+Rect toFrameBuffer(const Rect& rect)
+{
+    Rect area(rect);
+    DisplayTransformation::transformDisplayToFrameBuffer(area);
+    return area & Rect(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+}
+
+void writeRGB(FILE* file, uint16_t pixel, bool dimmed)
+{
+    uint8_t rgb[3] =
+    {
+        static_cast<uint8_t>(((pixel >> 8) & 0xF8) | (pixel >> 13)),
+        static_cast<uint8_t>(((pixel >> 3) & 0xFC) | ((pixel >> 9) & 0x03)),
+        static_cast<uint8_t>(((pixel << 3) & 0xF8) | ((pixel >> 2) & 0x07))
+    };
+    if (dimmed)
+    {
+        // Gray, at a third of the brightness
+        const uint8_t gray = static_cast<uint8_t>((rgb[0] * 77 + rgb[1] * 150 + rgb[2] * 29) / (256 * 3));
+        rgb[0] = rgb[1] = rgb[2] = gray;
+    }
+    fwrite(rgb, 1, sizeof(rgb), file);
+}
+}
+
+GoldenImageTest::GoldenImageTest(HALHeadless& hal, ScriptedTouchController& touchController, FrontendHeap& heap)
+    : hal(hal),
+      touchController(touchController),
+      heap(heap),
+      frameCallback(this, &GoldenImageTest::frameDrawn),
+      flushCallback(this, &GoldenImageTest::rectFlushed),
+      csv(0),
+      diffDirectory(0),
+      comparing(false),
+      failedFrames(0),
+      changedInvalidations(0),
+      imagesWritten(0)
+{
+}
+
+bool GoldenImageTest::run(FILE* out, const char* scriptFile, const char* goldenFile, bool update, const char* diffDir)
+{
+    FILE* script = fopen(scriptFile, "r");
+    if (script == 0)
+    {
+        fprintf(stderr, "Unable to open %s\n", scriptFile);
+        return false;
+    }
+    if (!update && !readGolden(goldenFile))
+    {
+        fclose(script);
+        return false;
+    }
+    if (diffDir && !update)
+    {
+        mkdir(diffDir, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+    }
+
+    csv = out;
+    diffDirectory = diffDir;
+    comparing = !update;
+    frames.clear();
+    rects.clear();
+    flushedRects.clear();
+    failedFrames = 0;
+    changedInvalidations = 0;
+    imagesWritten = 0;
+    lastFrame.assign(static_cast<uint32_t>(HAL::FRAME_BUFFER_WIDTH) * HAL::FRAME_BUFFER_HEIGHT, 0);
+    fprintf(csv, "frame,frame_hash,golden_hash,rects,different_rects,result\n");
+
+    hal.setFrameCallback(frameCallback);
+    hal.setFlushCallback(flushCallback);
+    const uint32_t start = HALHeadless::getMicroseconds();
+    bool passed = runScript(script, scriptFile);
+    const uint32_t elapsedUS = HALHeadless::getMicroseconds() - start;
+    fclose(script);
+    touchController.release();
+
+    const uint32_t numberOfFrames = static_cast<uint32_t>(frames.size());
+    if (passed && update)
+    {
+        passed = writeGolden(goldenFile);
+        fprintf(stderr, "%s: %u frames in %.2f s, golden hashes written to %s\n", scriptFile, numberOfFrames,
+                elapsedUS / 1000000.0, goldenFile);
+    }
+    else if (passed)
+    {
+        if (numberOfFrames != goldenFrames.size())
+        {
+            fprintf(stderr, "%s: the script draws %u frames, %s has %u\n", scriptFile, numberOfFrames, goldenFile,
+                    static_cast<unsigned int>(goldenFrames.size()));
+            passed = false;
+        }
+        if (failedFrames > 0)
+        {
+            passed = false;
+        }
+        fprintf(stderr, "%s: %u frames in %.2f s (%.2f ms/frame), %u different from %s, %u with different invalidated rectangles\n",
+                scriptFile, numberOfFrames, elapsedUS / 1000000.0, numberOfFrames ? elapsedUS / 1000.0 / numberOfFrames : 0.0,
+                failedFrames, goldenFile, changedInvalidations);
+        if (imagesWritten > 0)
+        {
+            fprintf(stderr, "Images of the first %u different frames written to %s\n", imagesWritten, diffDirectory);
+        }
+    }
+    return passed;
+}
+
+bool GoldenImageTest::runScript(FILE* script, const char* scriptFile)
+{
+    char line[256];
+    uint32_t lineNumber = 0;
+    int32_t touchX = 0;
+    int32_t touchY = 0;
+    while (fgets(line, sizeof(line), script))
+    {
+        lineNumber++;
+        char* comment = strchr(line, '#');
+        if (comment)
+        {
+            *comment = '\0';
+        }
+
+        char command[32];
+        char name[64];
+        int x;
+        int y;
+        unsigned int n;
+        char extra;
+        if (sscanf(line, " %31s", command) != 1)
+        {
+            continue; // Empty line
+        }
+        if (strcmp(command, "scenario") == 0 && sscanf(line, " %*s %63s %c", name, &extra) == 1)
+        {
+            const Scenario scenario = findScenario(name);
+            if (scenario == NUMBER_OF_SCENARIOS)
+            {
+                fprintf(stderr, "%s:%u: unknown scenario %s\n", scriptFile, lineNumber, name);
+                return false;
+            }
+            heap.model = Model();
+            heap.app.gotoScenario(scenario);
+        }
+        else if (strcmp(command, "wait") == 0 && sscanf(line, " %*s %u %c", &n, &extra) == 1)
+        {
+            drawFrames(n);
+        }
+        else if (strcmp(command, "press") == 0 && sscanf(line, " %*s %d %d %c", &x, &y, &extra) == 2)
+        {
+            touchX = x;
+            touchY = y;
+            touchController.press(touchX, touchY);
+        }
+        else if (strcmp(command, "drag") == 0 && sscanf(line, " %*s %d %d %u %c", &x, &y, &n, &extra) == 3 && n > 0)
+        {
+            if (!touchController.isTouched())
+            {
+                fprintf(stderr, "%s:%u: drag without press\n", scriptFile, lineNumber);
+                return false;
+            }
+            const int32_t fromX = touchX;
+            const int32_t fromY = touchY;
+            for (uint32_t step = 1; step <= n; step++)
+            {
+                touchX = fromX + (x - fromX) * static_cast<int32_t>(step) / static_cast<int32_t>(n);
+                touchY = fromY + (y - fromY) * static_cast<int32_t>(step) / static_cast<int32_t>(n);
+                touchController.press(touchX, touchY);
+                drawFrames(1);
+            }
+        }
+        else if (strcmp(command, "release") == 0 && sscanf(line, " %*s %c", &extra) < 1)
+        {
+            touchController.release();
+        }
+        else if (strcmp(command, "click") == 0 && sscanf(line, " %*s %d %d %c", &x, &y, &extra) == 2)
+        {
+            touchX = x;
+            touchY = y;
+            touchController.press(touchX, touchY);
+            drawFrames(1);
+            touchController.release();
+        }
+        else
+        {
+            fprintf(stderr, "%s:%u: invalid command: %s", scriptFile, lineNumber, line);
+            return false;
+        }
+    }
+    return true;
+}
+
+void GoldenImageTest::drawFrames(uint32_t numberOfFrames)
+{
+    for (uint32_t frame = 0; frame < numberOfFrames; frame++)
+    {
+        hal.simulateVSync();
+    }
+}
+
+bool GoldenImageTest::readGolden(const char* goldenFile)
+{
+    FILE* file = fopen(goldenFile, "r");
+    if (file == 0)
+    {
+        fprintf(stderr, "Unable to open %s, use --update-golden to create it\n", goldenFile);
+        return false;
+    }
+
+    goldenFrames.clear();
+    goldenRects.clear();
+    char line[256];
+    uint32_t lineNumber = 0;
+    bool valid = true;
+    while (valid && fgets(line, sizeof(line), file))
+    {
+        lineNumber++;
+        unsigned int frame;
+        unsigned long long hash;
+        unsigned int numberOfRects;
+        int x;
+        int y;
+        int width;
+        int height;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+        {
+            continue;
+        }
+        if (sscanf(line, "frame %u %llx %u", &frame, &hash, &numberOfRects) == 3 && frame == goldenFrames.size())
+        {
+            FrameHash golden = { hash, static_cast<uint32_t>(goldenRects.size()), numberOfRects };
+            goldenFrames.push_back(golden);
+        }
+        else if (sscanf(line, "rect %d %d %d %d %llx", &x, &y, &width, &height, &hash) == 5 && !goldenFrames.empty())
+        {
+            RectHash golden = { Rect(x, y, width, height), hash };
+            goldenRects.push_back(golden);
+        }
+        else
+        {
+            fprintf(stderr, "%s:%u: invalid line: %s", goldenFile, lineNumber, line);
+            valid = false;
+        }
+    }
+    for (uint32_t i = 0; valid && i < goldenFrames.size(); i++)
+    {
+        const FrameHash& golden = goldenFrames[i];
+        const uint32_t end = i + 1 < goldenFrames.size() ? goldenFrames[i + 1].firstRect : static_cast<uint32_t>(goldenRects.size());
+        if (golden.firstRect + golden.numberOfRects != end)
+        {
+            fprintf(stderr, "%s: frame %u does not have %u rectangles\n", goldenFile, i, golden.numberOfRects);
+            valid = false;
+        }
+    }
+    fclose(file);
+    return valid;
+}
+
+bool GoldenImageTest::writeGolden(const char* goldenFile) const
+{
+    FILE* file = fopen(goldenFile, "w");
+    if (file == 0)
+    {
+        fprintf(stderr, "Unable to open %s\n", goldenFile);
+        return false;
+    }
+    fprintf(file, "# Golden hashes of the render benchmark, written by --update-golden\n");
+    for (uint32_t i = 0; i < frames.size(); i++)
+    {
+        const FrameHash& frame = frames[i];
+        fprintf(file, "frame %u %016llx %u\n", i, static_cast<unsigned long long>(frame.hash), frame.numberOfRects);
+        for (uint32_t r = frame.firstRect; r < frame.firstRect + frame.numberOfRects; r++)
+        {
+            const RectHash& rect = rects[r];
+            fprintf(file, "rect %d %d %d %d %016llx\n", rect.rect.x, rect.rect.y, rect.rect.width, rect.rect.height,
+                    static_cast<unsigned long long>(rect.hash));
+        }
+    }
+    const bool written = ferror(file) == 0;
+    fclose(file);
+    return written;
+}
+
+void GoldenImageTest::compareFrame(uint32_t frame)
+{
+    const FrameHash& actual = frames[frame];
+    if (frame >= goldenFrames.size())
+    {
+        fprintf(csv, "%u,%016llx,,%u,%u,extra\n", frame, static_cast<unsigned long long>(actual.hash), actual.numberOfRects, actual.numberOfRects);
+        failedFrames++;
+        return;
+    }
+
+    // The rectangles explain where a difference is, and whether the frame was invalidated
+    // differently, but only the frame hash decides if the frame is correct
+    const FrameHash& golden = goldenFrames[frame];
+    std::vector<Rect> differentRects;
+    for (uint32_t r = actual.firstRect; r < actual.firstRect + actual.numberOfRects; r++)
+    {
+        if (!containsRect(goldenRects, golden, rects[r]))
+        {
+            differentRects.push_back(rects[r].rect);
+        }
+    }
+    // Golden rectangles not flushed at all show where the frame was not redrawn
+    for (uint32_t r = golden.firstRect; r < golden.firstRect + golden.numberOfRects; r++)
+    {
+        if (!containsRect(rects, actual, goldenRects[r]))
+        {
+            differentRects.push_back(goldenRects[r].rect);
+        }
+    }
+    const bool identical = actual.hash == golden.hash;
+    const bool sameRects = differentRects.empty();
+    const char* result = identical ? (sameRects ? "pass" : "pass_rects_changed") : "fail";
+    fprintf(csv, "%u,%016llx,%016llx,%u,%u,%s\n", frame, static_cast<unsigned long long>(actual.hash),
+            static_cast<unsigned long long>(golden.hash), actual.numberOfRects, static_cast<unsigned int>(differentRects.size()), result);
+    if (identical)
+    {
+        if (!sameRects)
+        {
+            changedInvalidations++;
+        }
+        return;
+    }
+
+    if (failedFrames == 0)
+    {
+        fprintf(stderr, "Frame %u differs from the golden hash, %u rectangles flushed, %u golden, %u different\n", frame,
+                actual.numberOfRects, golden.numberOfRects, static_cast<unsigned int>(differentRects.size()));
+    }
+    failedFrames++;
+    if (diffDirectory && imagesWritten < MAX_DIFF_IMAGES && writeImages(frame, differentRects))
+    {
+        imagesWritten++;
+    }
+}
+
+bool GoldenImageTest::containsRect(const std::vector<RectHash>& rectHashes, const FrameHash& frame, const RectHash& rect)
+{
+    for (uint32_t r = frame.firstRect; r < frame.firstRect + frame.numberOfRects; r++)
+    {
+        if (rectHashes[r].rect == rect.rect && rectHashes[r].hash == rect.hash)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GoldenImageTest::writeImages(uint32_t frame, const std::vector<Rect>& differentRects) const
+{
+    const int16_t width = HAL::FRAME_BUFFER_WIDTH;
+    const int16_t height = HAL::FRAME_BUFFER_HEIGHT;
+    bool written = true;
+    for (int diff = 0; diff < 2; diff++)
+    {
+        char filename[512];
+        snprintf(filename, sizeof(filename), "%s/frame_%05u_%s.ppm", diffDirectory, frame, diff ? "diff" : "actual");
+        FILE* file = fopen(filename, "wb");
+        if (file == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", filename);
+            return false;
+        }
+        fprintf(file, "P6\n%d %d\n255\n", width, height);
+        for (int16_t y = 0; y < height; y++)
+        {
+            for (int16_t x = 0; x < width; x++)
+            {
+                uint16_t pixel = lastFrame[y * width + x];
+                bool dimmed = diff != 0;
+                for (uint32_t r = 0; diff && r < differentRects.size(); r++)
+                {
+                    const Rect area = toFrameBuffer(differentRects[r]);
+                    if (area.intersect(x, y))
+                    {
+                        dimmed = false;
+                        if (x == area.x || y == area.y || x == area.right() - 1 || y == area.bottom() - 1)
+                        {
+                            pixel = 0xF800; // Red outline
+                        }
+                    }
+                }
+                writeRGB(file, pixel, dimmed);
+            }
+        }
+        written = written && ferror(file) == 0;
+        fclose(file);
+    }
+    return written;
+}
+
+void GoldenImageTest::frameDrawn(const FrameStatistics& statistics)
+{
+    // Without any flushed rectangles, the displayed frame is unchanged, and the frame
+    // buffer drawn into may be an older frame, so the last frame drawn is kept
+    if (statistics.rendered && !flushedRects.empty())
+    {
+        const uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+        memcpy(&lastFrame[0], frameBuffer, lastFrame.size() * sizeof(uint16_t));
+        HAL::getInstance()->unlockFrameBuffer();
+    }
+
+    const Rect frameBufferArea(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+    const uint64_t hash = flushedRects.empty() && !frames.empty() ? frames.back().hash : hashPixels(&lastFrame[0], frameBufferArea);
+    FrameHash frame = { hash, static_cast<uint32_t>(rects.size()), static_cast<uint32_t>(flushedRects.size()) };
+    for (uint32_t r = 0; r < flushedRects.size(); r++)
+    {
+        RectHash rect = { flushedRects[r], hashPixels(&lastFrame[0], toFrameBuffer(flushedRects[r])) };
+        rects.push_back(rect);
+    }
+    frames.push_back(frame);
+    flushedRects.clear();
+
+    if (comparing)
+    {
+        compareFrame(static_cast<uint32_t>(frames.size() - 1));
+    }
+}
+
+void GoldenImageTest::rectFlushed(const Rect& rect)
+{
+    flushedRects.push_back(rect);
+}
@@ -0,0 +1,141 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/OutlineSortBenchmark.hpp>
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <math.h>
+#include <string.h>
+
+OutlineSortBenchmark::OutlineSortBenchmark(unsigned width_, unsigned height_)
+    : width(width_),
+      height(height_),
+      seed(1)
+{
+}
+
+bool OutlineSortBenchmark::run(FILE* out)
+{
+    static const unsigned sizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, MAX_CELLS };
+    static const char* const names[] = { "rings", "uniform" };
+
+    fprintf(out, "distribution,cells,qsort_cells_per_s,radix_cells_per_s\n");
+    for (int distribution = RINGS; distribution <= UNIFORM; distribution++)
+    {
+        for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+        {
+            const unsigned numCells = sizes[i];
+            generateCells(static_cast<Distribution>(distribution), numCells);
+
+            memcpy(expected, original, numCells * sizeof(Cell));
+            Outline::qsortCells(expected, numCells);
+
+            const double qsortRate = measure(numCells, false);
+            const double radixRate = measure(numCells, true);
+            if (!verify(numCells))
+            {
+                fprintf(stderr, "radixSortCells() disagrees with qsortCells() for %u %s cells\n", numCells, names[distribution]);
+                return false;
+            }
+
+            fprintf(out, "%s,%u,%.0f,%.0f\n", names[distribution], numCells, qsortRate, radixRate);
+            fprintf(stderr, "%-8s %6u cells  qsort: %7.1f Mcells/s  radix: %7.1f Mcells/s  speedup: %5.2f\n",
+                    names[distribution], numCells, qsortRate / 1e6, radixRate / 1e6, radixRate / qsortRate);
+        }
+    }
+    return true;
+}
+
+void OutlineSortBenchmark::generateCells(Distribution distribution, unsigned numCells)
+{
+    unsigned n = 0;
+    if (distribution == UNIFORM)
+    {
+        for (; n < numCells; n++)
+        {
+            original[n].set(random() % width, random() % height, 1 + random() % 32, random() % 1024);
+        }
+        return;
+    }
+
+    // Walk the outline of one ring after the other, adding a cell whenever the pen enters a
+    // new cell, like Outline::lineTo() does
+    while (n < numCells)
+    {
+        const int radius = 8 + random() % (height / 2 - 8);
+        const int centerX = radius + random() % (width - 2 * radius);
+        const int centerY = radius + random() % (height - 2 * radius);
+        for (int edge = 0; edge < 2 && n < numCells; edge++)
+        {
+            const double r = radius - edge * 6;
+            const unsigned steps = static_cast<unsigned>(r * 16);
+            int lastX = -1;
+            int lastY = -1;
+            for (unsigned step = 0; step <= steps && n < numCells; step++)
+            {
+                const double angle = 2 * M_PI * step / steps;
+                const int x = centerX + static_cast<int>(floor(r * cos(angle)));
+                const int y = centerY + static_cast<int>(floor(r * sin(angle)));
+                if (x != lastX || y != lastY)
+                {
+                    original[n++].set(x, y, 1 + random() % 32, random() % 1024);
+                    lastX = x;
+                    lastY = y;
+                }
+            }
+        }
+    }
+}
+
+double OutlineSortBenchmark::measure(unsigned numCells, bool radix)
+{
+    uint32_t iterations = 0;
+    uint32_t elapsedUS = 0;
+    const uint32_t start = HALHeadless::getMicroseconds();
+    do
+    {
+        // Sort a batch at a time to keep the time stamps out of the measurement. Restoring
+        // the unsorted cells is included, but costs the same for all sorts.
+        for (int batch = 0; batch < 16; batch++)
+        {
+            memcpy(cells, original, numCells * sizeof(Cell));
+            if (!radix || !Outline::radixSortCells(cells, numCells, buffer, sizeof(buffer)))
+            {
+                Outline::qsortCells(cells, numCells);
+            }
+        }
+        iterations += 16;
+        elapsedUS = HALHeadless::getMicroseconds() - start;
+    }
+    while (elapsedUS < MIN_MEASURE_TIME_US);
+
+    return static_cast<double>(numCells) * iterations * 1e6 / (elapsedUS > 0 ? elapsedUS : 1);
+}
+
+bool OutlineSortBenchmark::verify(unsigned numCells) const
+{
+    // Cells with the same coordinates may come in any order, the rasterizer adds them up
+    for (unsigned i = 0; i < numCells; i++)
+    {
+        if (cells[i].packedCoord() != expected[i].packedCoord())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+unsigned OutlineSortBenchmark::random()
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
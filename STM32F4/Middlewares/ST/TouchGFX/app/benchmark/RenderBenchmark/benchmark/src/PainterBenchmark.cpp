@@ -0,0 +1,197 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/PainterBenchmark.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+uint64_t readCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+}
+
+uint64_t readNanoseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+} // namespace
+
+PainterBenchmark::PainterBenchmark()
+    : numberOfSpans(0)
+{
+    color.setColor(0x3D7F);
+    perPixelColor.setColor(0x3D7F);
+}
+
+bool PainterBenchmark::run(FILE* out)
+{
+    static const char* const painterNames[NUMBER_OF_PAINTERS] = { "color", "linear_gradient", "radial_gradient" };
+    static const char* const pathNames[NUMBER_OF_PATHS] = { "per_pixel", "span" };
+
+    createSpans();
+
+    bool identical = true;
+    fprintf(out, "painter,path,frames,pixels,cycles_per_pixel,ns_per_pixel\n");
+    for (int p = 0; p < NUMBER_OF_PAINTERS; p++)
+    {
+        const PainterType type = static_cast<PainterType>(p);
+        double cyclesPerPixel[NUMBER_OF_PATHS];
+        for (int i = 0; i < NUMBER_OF_PATHS; i++)
+        {
+            const Path path = static_cast<Path>(i);
+            const Result result = drawFrames(type, path);
+            cyclesPerPixel[path] = static_cast<double>(result.cycles) / result.pixels;
+            const double nsPerPixel = static_cast<double>(result.nanoseconds) / result.pixels;
+            fprintf(out, "%s,%s,%u,%llu,%.2f,%.2f\n", painterNames[type], pathNames[path], NUMBER_OF_FRAMES,
+                    static_cast<unsigned long long>(result.pixels), cyclesPerPixel[path], nsPerPixel);
+        }
+        fprintf(stderr, "%-16s cycles per pixel: per pixel %6.2f  span %6.2f  speedup %.2fx\n", painterNames[type],
+                cyclesPerPixel[PER_PIXEL], cyclesPerPixel[SPAN], cyclesPerPixel[PER_PIXEL] / cyclesPerPixel[SPAN]);
+
+        // The render() of the color painter blends in RGB565, and rounds differently
+        for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES && type != COLOR; frame++)
+        {
+            if (hashes[SPAN][frame] != hashes[PER_PIXEL][frame])
+            {
+                fprintf(stderr, "Frame %u differs between the paths of the %s painter\n", frame, painterNames[type]);
+                identical = false;
+                break;
+            }
+        }
+    }
+    return identical;
+}
+
+void PainterBenchmark::createSpans()
+{
+    // The scan lines of a disc in the middle of the display, with the edge pixels partly
+    // covered like the canvas widget renderer would
+    const int16_t centerX = HAL::DISPLAY_WIDTH / 2;
+    const int16_t centerY = HAL::DISPLAY_HEIGHT / 2;
+    uint32_t offset = 0;
+    numberOfSpans = 0;
+    for (int16_t dy = -RADIUS; dy < RADIUS; dy++)
+    {
+        const float y = dy + 0.5f;
+        const float halfWidth = sqrtf(static_cast<float>(RADIUS * RADIUS) - y * y);
+        const float left = centerX - halfWidth;
+        const float right = centerX + halfWidth;
+        const int16_t first = static_cast<int16_t>(floorf(left));
+        const int16_t last = static_cast<int16_t>(ceilf(right)) - 1;
+
+        Span& span = spans[numberOfSpans++];
+        span.x = first;
+        span.y = centerY + dy;
+        span.count = static_cast<uint16_t>(last - first + 1);
+        span.coversOffset = offset;
+        for (int16_t x = first; x <= last; x++)
+        {
+            const float covered = MIN(x + 1.0f, right) - MAX(static_cast<float>(x), left);
+            covers[offset++] = static_cast<uint8_t>(covered * 255.0f + 0.5f);
+        }
+    }
+}
+
+AbstractPainter& PainterBenchmark::getPainter(PainterType type, Path path, uint32_t frame)
+{
+    // Gradients from an opaque color to a translucent color, moving a little every frame
+    const int16_t centerX = HAL::DISPLAY_WIDTH / 2;
+    const int16_t centerY = HAL::DISPLAY_HEIGHT / 2;
+    const int16_t shift = static_cast<int16_t>(frame % 40) - 20;
+    const uint8_t widgetAlpha = frame % 2 == 0 ? 255 : 160;
+    switch (type)
+    {
+    case LINEAR_GRADIENT:
+        {
+            Measured<PainterRGB565LinearGradient>& painter = path == SPAN ? linearGradient : perPixelLinearGradient;
+            painter.setStartColor(0xF800);
+            painter.setEndColor(0x07FF, 128);
+            painter.setGradient(centerX - RADIUS + shift, centerY - RADIUS, centerX + RADIUS, centerY + RADIUS / 2 + shift);
+            painter.setWidgetAlpha(widgetAlpha);
+            return painter;
+        }
+    case RADIAL_GRADIENT:
+        {
+            Measured<PainterRGB565RadialGradient>& painter = path == SPAN ? radialGradient : perPixelRadialGradient;
+            painter.setStartColor(0xFFE0);
+            painter.setEndColor(0x8010, 96);
+            painter.setGradient(centerX + shift, centerY - shift / 2, RADIUS + shift);
+            painter.setWidgetAlpha(widgetAlpha);
+            return painter;
+        }
+    default:
+        {
+            Measured<PainterRGB565>& painter = path == SPAN ? color : perPixelColor;
+            painter.setAlpha(frame % 3 == 0 ? 255 : 200);
+            painter.setWidgetAlpha(widgetAlpha);
+            return painter;
+        }
+    }
+}
+
+PainterBenchmark::Result PainterBenchmark::drawFrames(PainterType type, Path path)
+{
+    Result result = { 0, 0, 0 };
+    for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES; frame++)
+    {
+        AbstractPainter& painter = getPainter(type, path, frame);
+        uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+        for (uint32_t i = 0; i < HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT; i++)
+        {
+            frameBuffer[i] = 0x3186;
+        }
+
+        const uint64_t startCycles = readCycles();
+        const uint64_t startNanoseconds = readNanoseconds();
+        for (int i = 0; i < numberOfSpans; i++)
+        {
+            const Span& span = spans[i];
+            uint8_t* row = reinterpret_cast<uint8_t*>(frameBuffer + span.y * HAL::FRAME_BUFFER_WIDTH);
+            painter.render(row, span.x, 0, span.y, span.count, covers + span.coversOffset);
+            result.pixels += span.count;
+        }
+        result.nanoseconds += readNanoseconds() - startNanoseconds;
+        result.cycles += readCycles() - startCycles;
+        HAL::getInstance()->unlockFrameBuffer();
+
+        hashes[path][frame] = hashFrameBuffer();
+    }
+    return result;
+}
+
+uint32_t PainterBenchmark::hashFrameBuffer()
+{
+    // FNV-1a of the frame buffer
+    const uint8_t* frameBuffer = reinterpret_cast<const uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    uint32_t hash = 2166136261U;
+    for (uint32_t i = 0; i < HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT * 2; i++)
+    {
+        hash = (hash ^ frameBuffer[i]) * 16777619U;
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+    return hash;
+}
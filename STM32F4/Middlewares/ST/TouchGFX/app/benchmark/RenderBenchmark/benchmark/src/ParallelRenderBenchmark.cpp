@@ -0,0 +1,146 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/ParallelRenderBenchmark.hpp>
+#include <platform/hal/simulator/headless/PosixRenderWorkers.hpp>
+#include <touchgfx/canvas_widget_renderer/CanvasWidgetRenderer.hpp>
+#include <string.h>
+#include <unistd.h>
+
+ParallelRenderBenchmark::ParallelRenderBenchmark(HALHeadless& hal, FrontendHeap& heap, uint32_t canvasBufferSize)
+    : hal(hal),
+      heap(heap),
+      canvasBufferSize(canvasBufferSize),
+      referenceFrames(0),
+      frameBuffer(0)
+{
+}
+
+bool ParallelRenderBenchmark::run(FILE* out, Scenario first, Scenario last, uint32_t frames)
+{
+    // A single worker draws like several workers, without the DMA, so the speed-up is
+    // relative to that
+    static const uint8_t numbersOfWorkers[NUMBER_OF_CONFIGURATIONS] = { 1, 2, 4 };
+
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    referenceFrames = new uint16_t[frames * displayPixels];
+    frameBuffer = new uint16_t[displayPixels];
+
+    // The calling thread keeps the buffer set up by main()
+    uint8_t* canvasBuffers = new uint8_t[(RenderWorkers::MAX_WORKERS - 1) * canvasBufferSize];
+    for (uint8_t worker = 1; worker < RenderWorkers::MAX_WORKERS; worker++)
+    {
+        CanvasWidgetRenderer::setupBuffer(canvasBuffers + (worker - 1) * canvasBufferSize, canvasBufferSize, worker);
+    }
+
+    fprintf(stderr, "%ld processors online\n", sysconf(_SC_NPROCESSORS_ONLN));
+    bool identical = true;
+    fprintf(out, "scenario,workers,frames,single_thread_us,total_us,avg_frame_us,speedup,different_frames\n");
+    for (int scenario = first; scenario <= last; scenario++)
+    {
+        const uint64_t singleThreadUS = drawReferenceFrames(static_cast<Scenario>(scenario), frames);
+        uint64_t oneWorkerUS = 0;
+        for (int i = 0; i < NUMBER_OF_CONFIGURATIONS; i++)
+        {
+            uint64_t totalUS = 0;
+            const uint32_t differentFrames = drawParallelFrames(static_cast<Scenario>(scenario), frames, numbersOfWorkers[i], totalUS);
+            if (i == 0)
+            {
+                oneWorkerUS = totalUS;
+            }
+            const double speedup = totalUS == 0 ? 0.0 : static_cast<double>(oneWorkerUS) / totalUS;
+            fprintf(out, "%s,%u,%u,%llu,%llu,%.1f,%.2f,%u\n", getScenarioName(static_cast<Scenario>(scenario)), numbersOfWorkers[i], frames,
+                    static_cast<unsigned long long>(singleThreadUS), static_cast<unsigned long long>(totalUS),
+                    static_cast<double>(totalUS) / frames, speedup, differentFrames);
+            fprintf(stderr, "%-16s %u workers: %8.1f us/frame (single thread %8.1f), %4.2fx one worker, %s\n",
+                    getScenarioName(static_cast<Scenario>(scenario)), numbersOfWorkers[i], static_cast<double>(totalUS) / frames,
+                    static_cast<double>(singleThreadUS) / frames, speedup, differentFrames == 0 ? "identical" : "DIFFERENT");
+            if (differentFrames > 0)
+            {
+                identical = false;
+            }
+        }
+    }
+
+    for (uint8_t worker = 1; worker < RenderWorkers::MAX_WORKERS; worker++)
+    {
+        CanvasWidgetRenderer::setupBuffer(0, 0, worker);
+    }
+    delete[] canvasBuffers;
+    delete[] frameBuffer;
+    delete[] referenceFrames;
+    frameBuffer = 0;
+    referenceFrames = 0;
+    return identical;
+}
+
+void ParallelRenderBenchmark::startScenario(Scenario scenario)
+{
+    heap.model = Model();
+    heap.app.gotoScenario(scenario);
+    hal.setTickLimit(WARMUP_FRAMES);
+    hal.taskEntry();
+}
+
+uint64_t ParallelRenderBenchmark::drawReferenceFrames(Scenario scenario, uint32_t frames)
+{
+    // A single frame buffer, so every frame is drawn on top of the previous one, exactly as
+    // when drawing in parallel
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    hal.setFrameBufferStartAddresses(frameBuffer, 0, 0);
+    startScenario(scenario);
+    uint64_t totalUS = 0;
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        hal.simulateVSync();
+        totalUS += hal.getFrameStatistics().frameTimeUS;
+        memcpy(referenceFrames + frame * displayPixels, frameBuffer, displayPixels * sizeof(uint16_t));
+    }
+    return totalUS;
+}
+
+uint32_t ParallelRenderBenchmark::drawParallelFrames(Scenario scenario, uint32_t frames, uint8_t workers, uint64_t& totalUS)
+{
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    PosixRenderWorkers renderWorkers(workers);
+    hal.setFrameBufferStartAddresses(frameBuffer, 0, 0);
+    startScenario(scenario);
+    RenderWorkers::setInstance(&renderWorkers);
+
+    totalUS = 0;
+    uint32_t differentFrames = 0;
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        hal.simulateVSync();
+        totalUS += hal.getFrameStatistics().frameTimeUS;
+
+        const uint16_t* reference = referenceFrames + frame * displayPixels;
+        if (memcmp(frameBuffer, reference, displayPixels * sizeof(uint16_t)) != 0)
+        {
+            if (differentFrames == 0)
+            {
+                uint32_t i = 0;
+                while (frameBuffer[i] == reference[i])
+                {
+                    i++;
+                }
+                fprintf(stderr, "%s with %u workers: frame %u differs first at (%u, %u), 0x%04X instead of 0x%04X\n",
+                        getScenarioName(scenario), workers, frame, i % HAL::DISPLAY_WIDTH, i / HAL::DISPLAY_WIDTH,
+                        frameBuffer[i], reference[i]);
+            }
+            differentFrames++;
+        }
+    }
+    RenderWorkers::setInstance(0);
+    return differentFrames;
+}
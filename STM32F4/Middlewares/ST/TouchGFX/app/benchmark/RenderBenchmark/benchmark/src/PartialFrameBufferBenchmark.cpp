@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/PartialFrameBufferBenchmark.hpp>
+#include <string.h>
+#include <cassert>
+
+PartialFrameBufferBenchmark::StripBuffers::StripBuffers(PartialFrameBufferBenchmark& benchmark, uint16_t* buffer, uint32_t bufferSize, uint16_t numberOfBuffers)
+    : PartialFrameBuffer(buffer, bufferSize, numberOfBuffers, benchmark.transmitCallback),
+      benchmark(benchmark)
+{
+}
+
+void PartialFrameBufferBenchmark::StripBuffers::waitForTransmit()
+{
+    benchmark.completeTransmit();
+}
+
+PartialFrameBufferBenchmark::PartialFrameBufferBenchmark(HALHeadless& hal, FrontendHeap& heap)
+    : hal(hal),
+      heap(heap),
+      transmitCallback(this, &PartialFrameBufferBenchmark::transmit),
+      stripBuffers(0),
+      referenceFrames(0),
+      displayRAM(0),
+      firstTransmit(0),
+      numberOfTransmits(0),
+      strips(0),
+      transmittedBytes(0),
+      overlappedStrips(0)
+{
+}
+
+bool PartialFrameBufferBenchmark::run(FILE* out, Scenario first, Scenario last, uint32_t frames)
+{
+    // One line of the display in two buffers, a small strip in two buffers and a bigger
+    // strip in three buffers
+    static const Configuration configurations[NUMBER_OF_CONFIGURATIONS] = { { 1, 2 }, { 16, 2 }, { 40, 3 } };
+
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    referenceFrames = new uint16_t[(frames + 1) * displayPixels];
+    displayRAM = new uint16_t[displayPixels];
+
+    bool identical = true;
+    fprintf(out, "scenario,strip_lines,strip_buffers,strip_bytes,frames,strips,transmitted_bytes,overlapped_strips,different_frames\n");
+    for (int scenario = first; scenario <= last; scenario++)
+    {
+        drawReferenceFrames(static_cast<Scenario>(scenario), frames);
+        for (int i = 0; i < NUMBER_OF_CONFIGURATIONS; i++)
+        {
+            if (!drawStripFrames(out, static_cast<Scenario>(scenario), frames, configurations[i]))
+            {
+                identical = false;
+            }
+        }
+    }
+
+    delete[] displayRAM;
+    delete[] referenceFrames;
+    displayRAM = 0;
+    referenceFrames = 0;
+    return identical;
+}
+
+void PartialFrameBufferBenchmark::startScenario(Scenario scenario)
+{
+    // Start from the first page of the slide transition scenario every time
+    heap.model = Model();
+    heap.app.gotoScenario(scenario);
+    hal.setTickLimit(WARMUP_FRAMES);
+    hal.taskEntry();
+}
+
+void PartialFrameBufferBenchmark::drawReferenceFrames(Scenario scenario, uint32_t frames)
+{
+    // A single frame buffer, so the frame drawn is always the one in the frame buffer. The
+    // last frame is the frame buffer itself.
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    uint16_t* frameBuffer = referenceFrames + frames * displayPixels;
+    heap.app.setPartialFrameBuffer(0);
+    hal.setFrameBufferStartAddresses(frameBuffer, 0, 0);
+    startScenario(scenario);
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        hal.simulateVSync();
+        memcpy(referenceFrames + frame * displayPixels, frameBuffer, displayPixels * sizeof(uint16_t));
+    }
+}
+
+bool PartialFrameBufferBenchmark::drawStripFrames(FILE* out, Scenario scenario, uint32_t frames, const Configuration& configuration)
+{
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    const uint32_t bufferSize = configuration.lines * HAL::DISPLAY_WIDTH * sizeof(uint16_t) * configuration.buffers;
+    uint16_t* buffer = new uint16_t[bufferSize / sizeof(uint16_t)];
+    StripBuffers buffers(*this, buffer, bufferSize, configuration.buffers);
+    stripBuffers = &buffers;
+
+    // Pixels never sent to the display would show up as magenta
+    for (uint32_t i = 0; i < displayPixels; i++)
+    {
+        displayRAM[i] = 0xF81F;
+    }
+
+    hal.setFrameBufferStartAddresses(buffer, 0, 0);
+    heap.app.setPartialFrameBuffer(&buffers);
+    startScenario(scenario);
+    strips = 0;
+    transmittedBytes = 0;
+    overlappedStrips = 0;
+
+    uint32_t differentFrames = 0;
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        hal.simulateVSync();
+        buffers.flush();
+
+        const uint16_t* reference = referenceFrames + frame * displayPixels;
+        if (memcmp(displayRAM, reference, displayPixels * sizeof(uint16_t)) != 0)
+        {
+            if (differentFrames == 0)
+            {
+                uint32_t i = 0;
+                while (displayRAM[i] == reference[i])
+                {
+                    i++;
+                }
+                fprintf(stderr, "%s with %u lines in %u buffers: frame %u differs first at (%u, %u), 0x%04X instead of 0x%04X\n",
+                        getScenarioName(scenario), configuration.lines, configuration.buffers, frame,
+                        i % HAL::DISPLAY_WIDTH, i / HAL::DISPLAY_WIDTH, displayRAM[i], reference[i]);
+            }
+            differentFrames++;
+        }
+    }
+
+    heap.app.setPartialFrameBuffer(0);
+    stripBuffers = 0;
+    delete[] buffer;
+
+    fprintf(out, "%s,%u,%u,%u,%u,%llu,%llu,%llu,%u\n", getScenarioName(scenario), configuration.lines, configuration.buffers,
+            bufferSize, frames, static_cast<unsigned long long>(strips), static_cast<unsigned long long>(transmittedBytes),
+            static_cast<unsigned long long>(overlappedStrips), differentFrames);
+    fprintf(stderr, "%-16s %2u lines x %u buffers (%6u bytes instead of %6u): %7.1f strips/frame, %5.1f%% drawn during a transmit, %s\n",
+            getScenarioName(scenario), configuration.lines, configuration.buffers, bufferSize,
+            static_cast<unsigned>(displayPixels * sizeof(uint16_t)), static_cast<double>(strips) / frames,
+            strips == 0 ? 0.0 : 100.0 * overlappedStrips / strips, differentFrames == 0 ? "identical" : "DIFFERENT");
+    return differentFrames == 0;
+}
+
+void PartialFrameBufferBenchmark::transmit(const Rect& area, const uint16_t* pixels)
+{
+    strips++;
+    transmittedBytes += area.width * area.height * sizeof(uint16_t);
+    if (stripBuffers->getNumberOfTransmits() > 1)
+    {
+        overlappedStrips++;
+    }
+
+    assert(numberOfTransmits < sizeof(transmits) / sizeof(transmits[0]) && "Too many strip buffers");
+    Transmit& t = transmits[(firstTransmit + numberOfTransmits) % (sizeof(transmits) / sizeof(transmits[0]))];
+    t.area = area;
+    t.pixels = pixels;
+    numberOfTransmits++;
+}
+
+void PartialFrameBufferBenchmark::completeTransmit()
+{
+    assert(numberOfTransmits > 0 && "Waiting for a strip which was never sent");
+    const Transmit& t = transmits[firstTransmit];
+    for (int16_t y = 0; y < t.area.height; y++)
+    {
+        memcpy(displayRAM + (t.area.y + y) * HAL::DISPLAY_WIDTH + t.area.x, t.pixels + y * t.area.width, t.area.width * sizeof(uint16_t));
+    }
+    firstTransmit = (firstTransmit + 1) % (sizeof(transmits) / sizeof(transmits[0]));
+    numberOfTransmits--;
+    stripBuffers->transmitCompleted();
+}
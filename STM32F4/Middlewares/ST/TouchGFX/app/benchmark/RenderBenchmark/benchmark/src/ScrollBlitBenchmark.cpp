@@ -0,0 +1,239 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/ScrollBlitBenchmark.hpp>
+#include <touchgfx/Color.hpp>
+#include <string.h>
+
+ScrollBlitBenchmarkScreen::ScrollBlitBenchmarkScreen(ContainerType type, bool overlay, bool scrollByBlit, BitmapId dot, BitmapId selectedDot)
+    : type(type),
+      overlay(overlay),
+      tick(0)
+{
+    background.setPosition(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    background.setColor(Color::getColorFrom24BitRGB(0x10, 0x18, 0x28));
+    add(background);
+
+    const int16_t width = ScrollListItem::WIDTH;
+    const int16_t height = ITEMS_PER_PAGE * ScrollListItem::HEIGHT;
+    const int16_t x = (HAL::DISPLAY_WIDTH - width) / 2;
+    const int16_t y = (HAL::DISPLAY_HEIGHT - height) / 2;
+
+    // The items leave gaps between them, so they are put on an opaque background
+    if (type == SCROLLABLE_CONTAINER)
+    {
+        grid.setPosition(0, 0, COLUMNS * ScrollListItem::WIDTH, ROWS * ScrollListItem::HEIGHT);
+        gridBackground.setPosition(0, 0, grid.getWidth(), grid.getHeight());
+        gridBackground.setColor(Color::getColorFrom24BitRGB(0x20, 0x20, 0x28));
+        grid.add(gridBackground);
+        for (int16_t i = 0; i < COLUMNS * ROWS; i++)
+        {
+            gridItems[i].setXY((i % COLUMNS) * ScrollListItem::WIDTH, (i / COLUMNS) * ScrollListItem::HEIGHT);
+            gridItems[i].setup(i, 0);
+            grid.add(gridItems[i]);
+        }
+        scrollableContainer.setPosition(x, y, width, height);
+        scrollableContainer.add(grid);
+        scrollableContainer.setScrollByBlit(scrollByBlit);
+        add(scrollableContainer);
+    }
+    else
+    {
+        for (int16_t page = 0; page < NUMBER_OF_PAGES; page++)
+        {
+            pages[page].setPosition(0, 0, width, height);
+            pageBackgrounds[page].setPosition(0, 0, width, height);
+            pageBackgrounds[page].setColor(Color::getColorFrom24BitRGB(0x20, 0x20, 0x28));
+            pages[page].add(pageBackgrounds[page]);
+            for (int16_t i = 0; i < ITEMS_PER_PAGE; i++)
+            {
+                ScrollListItem& item = pageItems[page * ITEMS_PER_PAGE + i];
+                item.setXY(0, i * ScrollListItem::HEIGHT);
+                item.setup(page * ITEMS_PER_PAGE + i, 0);
+                pages[page].add(item);
+            }
+            swipeContainer.add(pages[page]);
+        }
+        swipeContainer.setXY(x, y);
+        swipeContainer.setPageIndicatorBitmaps(Bitmap(dot), Bitmap(selectedDot));
+        swipeContainer.setPageIndicatorXYWithCenteredX(width / 2, height - 2 * Bitmap(dot).getHeight());
+        swipeContainer.setScrollByBlit(scrollByBlit);
+        add(swipeContainer);
+    }
+
+    overlayBox.setPosition(0, y + height / 2 - 20, 80, 40);
+    overlayBox.setColor(Color::getColorFrom24BitRGB(0xE0, 0x60, 0x20));
+    overlayBox.setVisible(false);
+    add(overlayBox);
+}
+
+void ScrollBlitBenchmarkScreen::setupScreen()
+{
+    if (type == SCROLLABLE_CONTAINER)
+    {
+        scrollableContainer.setScrollbarsPermanentlyVisible();
+    }
+    else
+    {
+        // Application::switchScreen clears the timer widgets registered while constructing the screen
+        Application::getInstance()->registerTimerWidget(&swipeContainer);
+    }
+}
+
+void ScrollBlitBenchmarkScreen::handleTickEvent()
+{
+    if (type == SCROLLABLE_CONTAINER)
+    {
+        // Diagonally down and to the right, then back
+        const int16_t direction = (tick % SCROLL_PERIOD) < SCROLL_PERIOD / 2 ? -1 : 1;
+        scrollableContainer.scrollBy(3 * direction, 6 * direction);
+    }
+    else
+    {
+        // Swipe to the last page, then back to the first
+        const uint32_t phase = tick % SWIPE_PERIOD;
+        const bool left = (tick / SWIPE_PERIOD) % (2 * (NUMBER_OF_PAGES - 1)) < static_cast<uint32_t>(NUMBER_OF_PAGES - 1);
+        if (phase < SWIPE_DRAG_TICKS)
+        {
+            swipeContainer.handleDragEvent(DragEvent(DragEvent::DRAGGED, 0, 0, left ? -12 : 12, 0));
+        }
+        else if (phase == SWIPE_DRAG_TICKS)
+        {
+            swipeContainer.handleClickEvent(ClickEvent(ClickEvent::RELEASED, 0, 0));
+        }
+    }
+
+    if (overlay)
+    {
+        // Shown for the first half of every period
+        const bool visible = (tick % OVERLAY_PERIOD) < OVERLAY_PERIOD / 2;
+        if (visible != overlayBox.isVisible())
+        {
+            overlayBox.invalidate();
+            overlayBox.setVisible(visible);
+        }
+        overlayBox.moveTo((tick * 4) % (HAL::DISPLAY_WIDTH - overlayBox.getWidth()), overlayBox.getY());
+    }
+    tick++;
+}
+
+const char* ScrollBlitBenchmarkScreen::getName(ContainerType type)
+{
+    return type == SCROLLABLE_CONTAINER ? "scrollable" : "swipe";
+}
+
+ScrollBlitBenchmark::ScrollBlitBenchmark(HALHeadless& hal, FrontendHeap& heap)
+    : hal(hal),
+      heap(heap),
+      screen(0),
+      dot(BITMAP_INVALID),
+      selectedDot(BITMAP_INVALID),
+      referenceFrames(0)
+{
+}
+
+bool ScrollBlitBenchmark::run(FILE* out, uint32_t frames)
+{
+    static const ScrollBlitBenchmarkScreen::ContainerType types[] = { ScrollBlitBenchmarkScreen::SCROLLABLE_CONTAINER, ScrollBlitBenchmarkScreen::SWIPE_CONTAINER };
+
+    // Let the first scenario be set up, so there is a screen to switch from
+    hal.setTickLimit(WARMUP_FRAMES);
+    hal.taskEntry();
+
+    dot = createDot(Color::getColorFrom24BitRGB(0x80, 0x80, 0x80));
+    selectedDot = createDot(Color::getColorFrom24BitRGB(0xFF, 0xFF, 0xFF));
+    referenceFrames = new uint16_t[frames * HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT];
+
+    bool identical = true;
+    fprintf(out, "container,overlay,scroll_by_blit,frames,avg_frame_time_us,redrawn_pixels_per_frame,scrolled_pixels_per_frame,different_frames\n");
+    for (unsigned i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+    {
+        for (int overlay = 0; overlay < 2; overlay++)
+        {
+            drawFrames(out, types[i], overlay != 0, false, frames);
+            if (drawFrames(out, types[i], overlay != 0, true, frames) != 0)
+            {
+                identical = false;
+            }
+        }
+    }
+
+    delete[] referenceFrames;
+    referenceFrames = 0;
+    return identical;
+}
+
+uint32_t ScrollBlitBenchmark::drawFrames(FILE* out, ScrollBlitBenchmarkScreen::ContainerType type, bool overlay, bool scrollByBlit, uint32_t frames)
+{
+    ScrollBlitBenchmarkScreen* previous = screen;
+    screen = new ScrollBlitBenchmarkScreen(type, overlay, scrollByBlit, dot, selectedDot);
+    heap.app.switchScreen(screen);
+    delete previous;
+    hal.setTickLimit(WARMUP_FRAMES);
+    hal.taskEntry();
+    heap.app.resetInvalidationStatistics();
+
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    uint64_t totalFrameTimeUS = 0;
+    uint32_t differentFrames = 0;
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        const uint32_t start = HALHeadless::getMicroseconds();
+        hal.simulateVSync();
+        totalFrameTimeUS += HALHeadless::getMicroseconds() - start;
+
+        // The frame drawn in the previous vsync is displayed after the swap
+        const uint16_t* frameBuffer = hal.getDisplayFrameBuffer();
+        uint16_t* reference = referenceFrames + frame * displayPixels;
+        if (!scrollByBlit)
+        {
+            memcpy(reference, frameBuffer, displayPixels * sizeof(uint16_t));
+        }
+        else if (memcmp(frameBuffer, reference, displayPixels * sizeof(uint16_t)) != 0)
+        {
+            if (differentFrames == 0)
+            {
+                uint32_t i = 0;
+                while (frameBuffer[i] == reference[i])
+                {
+                    i++;
+                }
+                fprintf(stderr, "%s%s: frame %u differs first at (%u, %u), 0x%04X instead of 0x%04X\n",
+                        ScrollBlitBenchmarkScreen::getName(type), overlay ? " with overlay" : "", frame,
+                        i % HAL::DISPLAY_WIDTH, i / HAL::DISPLAY_WIDTH, frameBuffer[i], reference[i]);
+            }
+            differentFrames++;
+        }
+    }
+
+    const InvalidationStatistics& statistics = heap.app.getInvalidationStatistics();
+    const double redrawnPerFrame = static_cast<double>(statistics.redrawnArea) / frames;
+    const double scrolledPerFrame = static_cast<double>(statistics.scrolledArea) / frames;
+    fprintf(out, "%s,%d,%d,%u,%.1f,%.0f,%.0f,%u\n", ScrollBlitBenchmarkScreen::getName(type), overlay ? 1 : 0, scrollByBlit ? 1 : 0, frames,
+            static_cast<double>(totalFrameTimeUS) / frames, redrawnPerFrame, scrolledPerFrame, differentFrames);
+    fprintf(stderr, "%-10s %-7s %-6s: avg %8.1f us  redrawn %7.0f px  scrolled %7.0f px%s\n", ScrollBlitBenchmarkScreen::getName(type),
+            overlay ? "overlay" : "", scrollByBlit ? "blit" : "redraw", static_cast<double>(totalFrameTimeUS) / frames, redrawnPerFrame,
+            scrolledPerFrame, !scrollByBlit ? "" : (differentFrames == 0 ? "  identical" : "  DIFFERENT"));
+    return differentFrames;
+}
+
+BitmapId ScrollBlitBenchmark::createDot(colortype color)
+{
+    const BitmapId id = Bitmap::dynamicBitmapCreate(DOT_SIZE, DOT_SIZE, Bitmap::RGB565);
+    uint16_t* pixels = reinterpret_cast<uint16_t*>(Bitmap::dynamicBitmapGetAddress(id));
+    for (uint16_t i = 0; i < DOT_SIZE * DOT_SIZE; i++)
+    {
+        pixels[i] = static_cast<uint16_t>(color);
+    }
+    return id;
+}
@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/ScrollListBenchmark.hpp>
+#include <gui/common/Scenario.hpp>
+#include <string.h>
+
+ScrollListBenchmark::ScrollListBenchmark(HALHeadless& hal, FrontendHeap& heap)
+    : hal(hal),
+      heap(heap),
+      frameBuffer(0),
+      referenceFrames(0)
+{
+}
+
+bool ScrollListBenchmark::run(FILE* out, uint32_t frames)
+{
+    // The scroll list scenario, and a long list without and with the data of items changing
+    static const Configuration configurations[NUMBER_OF_CONFIGURATIONS] = { { 200, 0 }, { 10000, 0 }, { 10000, 8 } };
+
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    frameBuffer = new uint16_t[displayPixels];
+    referenceFrames = new uint16_t[frames * displayPixels];
+    hal.setFrameBufferStartAddresses(frameBuffer, 0, 0);
+
+    bool identical = true;
+    fprintf(out, "items,cached,update_interval,frames,avg_frame_time_us,max_frame_time_us,different_frames\n");
+    for (int i = 0; i < NUMBER_OF_CONFIGURATIONS; i++)
+    {
+        drawFrames(out, configurations[i], false, frames, false);
+        if (drawFrames(out, configurations[i], true, frames, true) != 0)
+        {
+            identical = false;
+        }
+    }
+
+    delete[] referenceFrames;
+    delete[] frameBuffer;
+    referenceFrames = 0;
+    frameBuffer = 0;
+    return identical;
+}
+
+uint32_t ScrollListBenchmark::drawFrames(FILE* out, const Configuration& configuration, bool cached, uint32_t frames, bool compare)
+{
+    heap.model = Model();
+    heap.model.setScrollList(configuration.items, cached, configuration.updateInterval);
+    heap.app.gotoScenario(SCENARIO_SCROLL_LIST);
+    hal.setTickLimit(WARMUP_FRAMES);
+    hal.taskEntry();
+
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    uint64_t totalFrameTimeUS = 0;
+    uint32_t maxFrameTimeUS = 0;
+    uint32_t differentFrames = 0;
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        const uint32_t start = HALHeadless::getMicroseconds();
+        hal.simulateVSync();
+        const uint32_t frameTimeUS = HALHeadless::getMicroseconds() - start;
+        totalFrameTimeUS += frameTimeUS;
+        maxFrameTimeUS = MAX(maxFrameTimeUS, frameTimeUS);
+
+        uint16_t* reference = referenceFrames + frame * displayPixels;
+        if (!compare)
+        {
+            memcpy(reference, frameBuffer, displayPixels * sizeof(uint16_t));
+        }
+        else if (memcmp(frameBuffer, reference, displayPixels * sizeof(uint16_t)) != 0)
+        {
+            if (differentFrames == 0)
+            {
+                uint32_t i = 0;
+                while (frameBuffer[i] == reference[i])
+                {
+                    i++;
+                }
+                fprintf(stderr, "%u cached items: frame %u differs first at (%u, %u), 0x%04X instead of 0x%04X\n",
+                        configuration.items, frame, i % HAL::DISPLAY_WIDTH, i / HAL::DISPLAY_WIDTH, frameBuffer[i], reference[i]);
+            }
+            differentFrames++;
+        }
+    }
+
+    fprintf(out, "%u,%d,%u,%u,%.1f,%u,%u\n", configuration.items, cached ? 1 : 0, configuration.updateInterval, frames,
+            static_cast<double>(totalFrameTimeUS) / frames, static_cast<unsigned>(maxFrameTimeUS), differentFrames);
+    fprintf(stderr, "%5u items, %-6s update interval %2u: avg %8.1f us  max %8u us%s\n", configuration.items, cached ? "cached" : "drawn",
+            configuration.updateInterval, static_cast<double>(totalFrameTimeUS) / frames,
+            static_cast<unsigned>(maxFrameTimeUS), !compare ? "" : (differentFrames == 0 ? "  identical" : "  DIFFERENT"));
+    return differentFrames;
+}
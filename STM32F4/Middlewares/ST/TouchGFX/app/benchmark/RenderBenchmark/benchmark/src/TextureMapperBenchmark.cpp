@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/TextureMapperBenchmark.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+TextureMapperBenchmark::TextureMapperBenchmark(HeadlessDMA& dma_)
+    : dma(dma_),
+      dial(BITMAP_INVALID),
+      reference(0)
+{
+}
+
+bool TextureMapperBenchmark::run(FILE* out)
+{
+    static const Bitmap::BitmapFormat formats[] = { Bitmap::RGB565, Bitmap::ARGB8888 };
+    static const char* const formatNames[] = { "RGB565", "ARGB8888" };
+    static const TextureMapper::RenderingAlgorithm algorithms[] = { TextureMapper::NEAREST_NEIGHBOR, TextureMapper::BILINEAR_INTERPOLATION };
+    static const char* const algorithmNames[] = { "nearest_neighbor", "bilinear" };
+    static const uint8_t alphas[] = { 255, 160 };
+
+    dma.setBlitCaps(0);
+    reference = new uint16_t[HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT];
+
+    bool withinTolerance = true;
+    fprintf(out, "format,algorithm,alpha,frames,perspective_fps,affine_fps,max_channel_diff,diff_pixels_percent\n");
+    for (int f = 0; f < 2; f++)
+    {
+        createDial(formats[f]);
+        for (int a = 0; a < 2; a++)
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                const Result result = drawFrames(algorithms[a], alphas[i]);
+                const double perspectiveFPS = result.perspectiveUS > 0 ? NUMBER_OF_FRAMES * 1000000.0 / result.perspectiveUS : 0.0;
+                const double affineFPS = result.affineUS > 0 ? NUMBER_OF_FRAMES * 1000000.0 / result.affineUS : 0.0;
+                const double diffPercent = 100.0 * result.diffPixels / (static_cast<double>(NUMBER_OF_FRAMES) * DIAL_SIZE * DIAL_SIZE);
+                fprintf(out, "%s,%s,%u,%u,%.1f,%.1f,%d,%.3f\n", formatNames[f], algorithmNames[a], alphas[i], NUMBER_OF_FRAMES,
+                        perspectiveFPS, affineFPS, result.maxChannelDiff, diffPercent);
+                fprintf(stderr, "%-8s %-16s alpha %3u: perspective %7.1f fps  affine %7.1f fps  speedup %.2fx  max diff %d  differing %.3f%%\n",
+                        formatNames[f], algorithmNames[a], alphas[i], perspectiveFPS, affineFPS,
+                        result.affineUS > 0 ? static_cast<double>(result.perspectiveUS) / result.affineUS : 0.0, result.maxChannelDiff, diffPercent);
+
+                if (result.diffPixels * 1000 > MAX_DIFF_PIXELS_PER_MILLE * NUMBER_OF_FRAMES * DIAL_SIZE * DIAL_SIZE)
+                {
+                    fprintf(stderr, "The affine path differs more than tolerated from the perspective path\n");
+                    withinTolerance = false;
+                }
+            }
+        }
+        Bitmap::dynamicBitmapDelete(dial);
+        dial = BITMAP_INVALID;
+    }
+
+    TextureMapper::setAffineDrawingEnabled(true);
+    delete[] reference;
+    reference = 0;
+    return withinTolerance;
+}
+
+void TextureMapperBenchmark::createDial(Bitmap::BitmapFormat format)
+{
+    // A dial face with a gradient, tick marks and a needle. Outside the face the ARGB8888 dial
+    // is transparent.
+    dial = Bitmap::dynamicBitmapCreate(DIAL_SIZE, DIAL_SIZE, format);
+    assert(dial != BITMAP_INVALID && "Bitmap cache too small for the TextureMapper benchmark");
+    uint8_t* pixels = Bitmap::dynamicBitmapGetAddress(dial);
+    const float center = (DIAL_SIZE - 1) / 2.0f;
+    for (uint16_t y = 0; y < DIAL_SIZE; y++)
+    {
+        for (uint16_t x = 0; x < DIAL_SIZE; x++)
+        {
+            const float dx = x - center;
+            const float dy = y - center;
+            const float radius = sqrtf(dx * dx + dy * dy);
+            const float angle = atan2f(dy, dx);
+            uint8_t r = 0x10;
+            uint8_t g = 0x10;
+            uint8_t b = 0x18;
+            uint8_t a = 0;
+            if (radius < center)
+            {
+                r = static_cast<uint8_t>(0x30 + radius);
+                g = static_cast<uint8_t>(0x20 + radius / 2);
+                b = static_cast<uint8_t>(0xC0 - radius / 2);
+                a = 0xFF;
+                const float tick = fmodf(angle + 2.0f * static_cast<float>(M_PI), static_cast<float>(M_PI) / 6.0f);
+                if (radius > center - 20 && (tick < 0.03f || tick > static_cast<float>(M_PI) / 6.0f - 0.03f))
+                {
+                    r = g = b = 0xFF;
+                }
+                if (dx > 0 && fabsf(dy) < 3.0f && radius < center - 10)
+                {
+                    r = 0xFF;
+                    g = b = 0x20;
+                }
+            }
+            else if (radius < center + 1)
+            {
+                // Antialiased rim
+                a = static_cast<uint8_t>((center + 1 - radius) * 0xFF);
+                r = g = b = 0xC0;
+            }
+
+            if (format == Bitmap::ARGB8888)
+            {
+                reinterpret_cast<uint32_t*>(pixels)[y * DIAL_SIZE + x] = (a << 24) | (r << 16) | (g << 8) | b;
+            }
+            else
+            {
+                reinterpret_cast<uint16_t*>(pixels)[y * DIAL_SIZE + x] = static_cast<uint16_t>(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+            }
+        }
+    }
+
+    textureMapper.setBitmap(Bitmap(dial));
+    textureMapper.setXY((HAL::DISPLAY_WIDTH - DIAL_SIZE) / 2, (HAL::DISPLAY_HEIGHT - DIAL_SIZE) / 2);
+    textureMapper.setBitmapPosition(0.0f, 0.0f);
+    textureMapper.setCameraDistance(1000.0f);
+    textureMapper.setOrigo(DIAL_SIZE / 2.0f, DIAL_SIZE / 2.0f, 1000.0f);
+    textureMapper.setCamera(DIAL_SIZE / 2.0f, DIAL_SIZE / 2.0f);
+}
+
+TextureMapperBenchmark::Result TextureMapperBenchmark::drawFrames(TextureMapper::RenderingAlgorithm algorithm, uint8_t alpha)
+{
+    textureMapper.setRenderingAlgorithm(algorithm);
+    textureMapper.setAlpha(alpha);
+
+    Result result = { 0, 0, 0, 0 };
+    for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES; frame++)
+    {
+        result.perspectiveUS += drawFrame(false, frame);
+        memcpy(reference, HAL::getInstance()->lockFrameBuffer(), HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT * 2);
+        HAL::getInstance()->unlockFrameBuffer();
+        result.affineUS += drawFrame(true, frame);
+        compareFrames(result);
+    }
+    return result;
+}
+
+uint32_t TextureMapperBenchmark::drawFrame(bool affine, uint32_t frame)
+{
+    // Rotate a full turn while zooming between 0.75 and 1.25
+    const float angle = frame * 2.0f * static_cast<float>(M_PI) / NUMBER_OF_FRAMES;
+    textureMapper.setScale(1.0f + 0.25f * sinf(angle * 2.0f));
+    textureMapper.setZAngle(angle);
+    TextureMapper::setAffineDrawingEnabled(affine);
+
+    HAL::lcd().fillRect(Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT), 0x3186);
+    const uint32_t start = HALHeadless::getMicroseconds();
+    textureMapper.draw(Rect(0, 0, textureMapper.getWidth(), textureMapper.getHeight()));
+    return HALHeadless::getMicroseconds() - start;
+}
+
+void TextureMapperBenchmark::compareFrames(Result& result)
+{
+    const uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    for (uint32_t i = 0; i < HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT; i++)
+    {
+        if (frameBuffer[i] != reference[i])
+        {
+            // Compare the channels in their own precision
+            result.diffPixels++;
+            const int r = abs((frameBuffer[i] >> 11) - (reference[i] >> 11));
+            const int g = abs(((frameBuffer[i] >> 5) & 0x3F) - ((reference[i] >> 5) & 0x3F));
+            const int b = abs((frameBuffer[i] & 0x1F) - (reference[i] & 0x1F));
+            result.maxChannelDiff = MAX(result.maxChannelDiff, MAX(r, MAX(g, b)));
+        }
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+}
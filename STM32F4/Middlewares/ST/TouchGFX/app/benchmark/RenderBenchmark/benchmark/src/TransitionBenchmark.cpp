@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <benchmark/TransitionBenchmark.hpp>
+#include <gui/common/Scenario.hpp>
+#include <touchgfx/transitions/Transition.hpp>
+#include <string.h>
+
+TransitionBenchmark::TransitionBenchmark(HALHeadless& hal, FrontendHeap& heap)
+    : hal(hal),
+      heap(heap),
+      screenCache(BITMAP_INVALID),
+      referenceFrames(0)
+{
+}
+
+bool TransitionBenchmark::run(FILE* out, uint32_t frames)
+{
+    screenCache = Bitmap::dynamicBitmapCreate(HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT, Bitmap::RGB565);
+    if (screenCache == BITMAP_INVALID)
+    {
+        fprintf(stderr, "Unable to create the screen cache bitmap\n");
+        return false;
+    }
+    referenceFrames = new uint16_t[frames * HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT];
+
+    bool identical = true;
+    fprintf(out, "transition,cached,widgets,frames,avg_frame_time_us,max_frame_time_us,different_frames\n");
+    for (int cover = 0; cover < 2; cover++)
+    {
+        drawFrames(out, cover != 0, false, frames);
+        if (drawFrames(out, cover != 0, true, frames) != 0)
+        {
+            identical = false;
+        }
+    }
+
+    Transition::setScreenCacheBitmap(BITMAP_INVALID);
+    Bitmap::dynamicBitmapDelete(screenCache);
+    screenCache = BITMAP_INVALID;
+    delete[] referenceFrames;
+    referenceFrames = 0;
+    return identical;
+}
+
+uint32_t TransitionBenchmark::drawFrames(FILE* out, bool cover, bool cached, uint32_t frames)
+{
+    heap.model = Model();
+    heap.model.setSlideTransition(cover, COLUMNS, ROWS);
+    Transition::setScreenCacheBitmap(cached ? screenCache : BITMAP_INVALID);
+    heap.app.gotoScenario(SCENARIO_SLIDE_TRANSITION);
+    hal.setTickLimit(WARMUP_FRAMES);
+    hal.taskEntry();
+
+    const uint32_t displayPixels = HAL::DISPLAY_WIDTH * HAL::DISPLAY_HEIGHT;
+    uint64_t totalFrameTimeUS = 0;
+    uint32_t maxFrameTimeUS = 0;
+    uint32_t differentFrames = 0;
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        const uint32_t start = HALHeadless::getMicroseconds();
+        hal.simulateVSync();
+        const uint32_t frameTimeUS = HALHeadless::getMicroseconds() - start;
+        totalFrameTimeUS += frameTimeUS;
+        maxFrameTimeUS = MAX(maxFrameTimeUS, frameTimeUS);
+
+        // The frame drawn in the previous vsync is displayed after the swap
+        const uint16_t* frameBuffer = hal.getDisplayFrameBuffer();
+        uint16_t* reference = referenceFrames + frame * displayPixels;
+        if (!cached)
+        {
+            memcpy(reference, frameBuffer, displayPixels * sizeof(uint16_t));
+        }
+        else if (memcmp(frameBuffer, reference, displayPixels * sizeof(uint16_t)) != 0)
+        {
+            if (differentFrames == 0)
+            {
+                uint32_t i = 0;
+                while (frameBuffer[i] == reference[i])
+                {
+                    i++;
+                }
+                fprintf(stderr, "Cached %s transition: frame %u differs first at (%u, %u), 0x%04X instead of 0x%04X\n",
+                        cover ? "cover" : "slide", frame, i % HAL::DISPLAY_WIDTH, i / HAL::DISPLAY_WIDTH, frameBuffer[i], reference[i]);
+            }
+            differentFrames++;
+        }
+    }
+
+    const unsigned widgets = 1 + COLUMNS * ROWS;
+    fprintf(out, "%s,%d,%u,%u,%.1f,%u,%u\n", cover ? "cover" : "slide", cached ? 1 : 0, widgets, frames,
+            static_cast<double>(totalFrameTimeUS) / frames, static_cast<unsigned>(maxFrameTimeUS), differentFrames);
+    fprintf(stderr, "%s transition, %u widgets, %-6s: avg %8.1f us  max %8u us%s\n", cover ? "cover" : "slide", widgets,
+            cached ? "cached" : "drawn", static_cast<double>(totalFrameTimeUS) / frames, static_cast<unsigned>(maxFrameTimeUS),
+            !cached ? "" : (differentFrames == 0 ? "  identical" : "  DIFFERENT"));
+    return differentFrames;
+}
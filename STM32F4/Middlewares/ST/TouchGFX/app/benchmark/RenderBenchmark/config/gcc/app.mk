@@ -0,0 +1,23 @@
+##############################################################################
+# This file is part of the TouchGFX 4.10.0 distribution.
+# Modified by the contributors of this repository.
+#
+# <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+# All rights reserved.</center></h2>
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+# Relative location of the TouchGFX framework from root of application
+touchgfx_path := ../../../touchgfx
+
+# Optional additional compiler flags. The benchmark renders into a 16bpp
+# frame buffer using HeadlessDMA, which only supports RGB565.
+user_cflags := -DUSE_BPP=16
+
+# Optimization level used when measuring
+optimization_cflags := -O2
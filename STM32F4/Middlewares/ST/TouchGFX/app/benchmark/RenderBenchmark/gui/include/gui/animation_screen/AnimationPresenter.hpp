@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef ANIMATION_PRESENTER_HPP
+#define ANIMATION_PRESENTER_HPP
+
+#include <gui/model/ModelListener.hpp>
+#include <mvp/Presenter.hpp>
+
+using namespace touchgfx;
+
+class AnimationView;
+
+/**
+ * The Presenter for the animated boxes benchmark screen.
+ */
+class AnimationPresenter : public Presenter, public ModelListener
+{
+public:
+    AnimationPresenter(AnimationView& v);
+
+    /**
+     * The activate function is called automatically when this screen is "switched in"
+     * (ie. made active).
+     */
+    virtual void activate();
+
+    /**
+     * The deactivate function is called automatically when this screen is "switched out"
+     * (ie. made inactive).
+     */
+    virtual void deactivate();
+
+    virtual ~AnimationPresenter() {};
+
+    /**
+     * Gets the number of boxes to animate.
+     */
+    uint16_t getNumberOfAnimations() const;
+
+    /**
+     * Gets whether the boxes are moved using FixedPointEasingEquations.
+     */
+    bool getFixedPointEasing() const;
+
+private:
+    AnimationPresenter();
+
+    AnimationView& view;
+};
+
+#endif // ANIMATION_PRESENTER_HPP
@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef ANIMATION_VIEW_HPP
+#define ANIMATION_VIEW_HPP
+
+#include <mvp/View.hpp>
+#include <gui/animation_screen/AnimationPresenter.hpp>
+#include <touchgfx/widgets/Box.hpp>
+#include <touchgfx/mixins/ScheduledMoveAnimator.hpp>
+
+using namespace touchgfx;
+
+/**
+ * Small boxes moving around the screen using ScheduledMoveAnimator, each starting a new
+ * move with a pseudo random destination, duration and easing equations when the previous
+ * one ends. The boxes exercise the ticking of many concurrent animations and the easing
+ * equations.
+ */
+class AnimationView : public View<AnimationPresenter>
+{
+public:
+    AnimationView();
+    virtual ~AnimationView() { }
+
+    virtual void setupScreen();
+
+    virtual void tearDownScreen();
+
+    static const int MAX_ANIMATIONS = 256;
+private:
+    static const int16_t BOX_SIZE = 12;
+
+    void startAnimation(ScheduledMoveAnimator<Box>& box);
+    void animationEnded(const MoveAnimator<Box>& box);
+    uint32_t nextRandom(uint32_t range);
+
+    Box background;
+    ScheduledMoveAnimator<Box> boxes[MAX_ANIMATIONS];
+    Callback<AnimationView, const MoveAnimator<Box>&> animationEndedCallback;
+    uint16_t numberOfBoxes;
+    bool fixedPointEasing;
+    uint32_t random;
+};
+
+#endif // ANIMATION_VIEW_HPP
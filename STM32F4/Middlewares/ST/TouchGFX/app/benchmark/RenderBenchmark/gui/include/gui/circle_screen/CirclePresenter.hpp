@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef CIRCLE_PRESENTER_HPP
+#define CIRCLE_PRESENTER_HPP
+
+#include <gui/model/ModelListener.hpp>
+#include <mvp/Presenter.hpp>
+
+using namespace touchgfx;
+
+class CircleView;
+
+/**
+ * The Presenter for the animated circles benchmark screen.
+ */
+class CirclePresenter : public Presenter, public ModelListener
+{
+public:
+    CirclePresenter(CircleView& v);
+
+    /**
+     * The activate function is called automatically when this screen is "switched in"
+     * (ie. made active).
+     */
+    virtual void activate();
+
+    /**
+     * The deactivate function is called automatically when this screen is "switched out"
+     * (ie. made inactive).
+     */
+    virtual void deactivate();
+
+    virtual ~CirclePresenter() {};
+
+private:
+    CirclePresenter();
+
+    CircleView& view;
+};
+
+#endif // CIRCLE_PRESENTER_HPP
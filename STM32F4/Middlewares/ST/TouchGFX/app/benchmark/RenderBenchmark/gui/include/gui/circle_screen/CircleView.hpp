@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef CIRCLE_VIEW_HPP
+#define CIRCLE_VIEW_HPP
+
+#include <mvp/View.hpp>
+#include <gui/circle_screen/CirclePresenter.hpp>
+#include <touchgfx/widgets/Box.hpp>
+#include <touchgfx/widgets/canvas/Circle.hpp>
+#include <touchgfx/widgets/canvas/PainterRGB565.hpp>
+
+using namespace touchgfx;
+
+/**
+ * A grid of anti-aliased arcs drawn by the CanvasWidgetRenderer. The arcs grow
+ * and shrink at different speeds, so that the invalidated areas overlap in
+ * varying ways.
+ */
+class CircleView : public View<CirclePresenter>
+{
+public:
+    CircleView()
+        : tickCounter(0)
+    {
+    }
+    virtual ~CircleView() { }
+
+    virtual void setupScreen();
+
+    virtual void tearDownScreen();
+
+    virtual void handleTickEvent();
+private:
+    static const int NUMBER_OF_COLUMNS = 4;
+    static const int NUMBER_OF_ROWS = 2;
+    static const int NUMBER_OF_CIRCLES = NUMBER_OF_COLUMNS * NUMBER_OF_ROWS;
+
+    Box background;
+    Circle circles[NUMBER_OF_CIRCLES];
+    PainterRGB565 painters[NUMBER_OF_CIRCLES];
+    uint16_t tickCounter;
+};
+
+#endif // CIRCLE_VIEW_HPP
@@ -0,0 +1,113 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#ifndef FRONTENDAPPLICATION_HPP
+#define FRONTENDAPPLICATION_HPP
+
+#include <mvp/View.hpp>
+#include <mvp/AcceleratedMVPApplication.hpp>
+#include <gui/model/Model.hpp>
+#include <gui/common/Scenario.hpp>
+
+using namespace touchgfx;
+
+class FrontendHeap;
+
+/**
+ * The FrontendApplication of the render benchmark. Each benchmark scenario has its
+ * own screen, and gotoScenario() is used by the benchmark runner to select the
+ * scenario to measure.
+ *
+ * As with all MVP applications, the screen switch requested by the gotoXXScreen()
+ * functions is performed at the next tick.
+ */
+class FrontendApplication : public AcceleratedMVPApplication
+{
+public:
+    FrontendApplication(Model& m, FrontendHeap& heap);
+    virtual ~FrontendApplication() { }
+
+    /**
+     * Request a transition to the screen of the given scenario.
+     */
+    void gotoScenario(Scenario scenario);
+
+    /**
+     * Request a transition to the "TextureMapper" screen.
+     */
+    void gotoTextureMapperScreen();
+
+    /**
+     * Request a transition to the "Circle" screen.
+     */
+    void gotoCircleScreen();
+
+    /**
+     * Request a transition to the "ScrollList" screen.
+     */
+    void gotoScrollListScreen();
+
+    /**
+     * Request a transition to the "Slide" screen without animation.
+     */
+    void gotoSlideScreen();
+
+    /**
+     * Request a transition to the next page of the "Slide" screen, sliding it in from
+     * the right using a SlideTransition.
+     */
+    void gotoSlideScreenSlideTransitionEast();
+
+    /**
+     * Request a transition to the next page of the "Slide" screen, covering the current
+     * page from the right using a CoverTransition.
+     */
+    void gotoSlideScreenCoverTransitionEast();
+
+    /**
+     * Request a transition to the "Dashboard" screen.
+     */
+    void gotoDashboardScreen();
+
+    /**
+     * Request a transition to the "Animation" screen.
+     */
+    void gotoAnimationScreen();
+
+    /**
+     * Called automatically every frame. Will call tick on the model and then delegate
+     * the tick event to the framework for further processing.
+     */
+    virtual void handleTickEvent()
+    {
+        model.tick();
+        AcceleratedMVPApplication::handleTickEvent();
+    }
+private:
+    Callback<FrontendApplication> transitionCallback;
+    FrontendHeap& frontendHeap;
+    Model& model;
+    void gotoTextureMapperScreenImpl();
+    void gotoCircleScreenImpl();
+    void gotoScrollListScreenImpl();
+    void gotoSlideScreenImpl();
+    void gotoSlideScreenSlideTransitionEastImpl();
+    void gotoSlideScreenCoverTransitionEastImpl();
+    void gotoDashboardScreenImpl();
+    void gotoAnimationScreenImpl();
+};
+
+#endif /* FRONTENDAPPLICATION_HPP */
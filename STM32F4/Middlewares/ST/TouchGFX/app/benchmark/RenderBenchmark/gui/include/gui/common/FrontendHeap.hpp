@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#ifndef FRONTENDHEAP_HPP
+#define FRONTENDHEAP_HPP
+
+#include <common/Meta.hpp>
+#include <common/Partition.hpp>
+#include <mvp/MVPHeap.hpp>
+#include <touchgfx/transitions/NoTransition.hpp>
+#include <touchgfx/transitions/SlideTransition.hpp>
+#include <touchgfx/transitions/CoverTransition.hpp>
+#include <gui/common/FrontendApplication.hpp>
+#include <gui/model/Model.hpp>
+#include <gui/texture_mapper_screen/TextureMapperView.hpp>
+#include <gui/texture_mapper_screen/TextureMapperPresenter.hpp>
+#include <gui/circle_screen/CircleView.hpp>
+#include <gui/circle_screen/CirclePresenter.hpp>
+#include <gui/scroll_list_screen/ScrollListView.hpp>
+#include <gui/scroll_list_screen/ScrollListPresenter.hpp>
+#include <gui/slide_screen/SlideView.hpp>
+#include <gui/slide_screen/SlidePresenter.hpp>
+#include <gui/dashboard_screen/DashboardView.hpp>
+#include <gui/dashboard_screen/DashboardPresenter.hpp>
+#include <gui/animation_screen/AnimationView.hpp>
+#include <gui/animation_screen/AnimationPresenter.hpp>
+
+/**
+ * This class provides the memory that shall be used for memory allocations
+ * in the frontend. A single instance of the FrontendHeap is allocated once (in heap
+ * memory), and all other frontend objects such as views, presenters and data model are
+ * allocated within the scope of this FrontendHeap. As such, the RAM usage of the entire
+ * user interface is sizeof(FrontendHeap).
+ *
+ * @note The FrontendHeap reserves memory for the most memory-consuming presenter and
+ * view only. The largest of these classes are determined at compile-time using template
+ * magic. As such, it is important to add all presenters, views and transitions to the
+ * type lists in this class.
+ *
+ */
+class FrontendHeap : public MVPHeap
+{
+public:
+    /**
+     * A list of all view types. Must end with meta::Nil.
+     * @note All view types used in the application MUST be added to this list!
+     */
+    typedef meta::TypeList< TextureMapperView,
+            meta::TypeList< CircleView,
+            meta::TypeList< ScrollListView,
+            meta::TypeList< SlideView,
+            meta::TypeList< DashboardView,
+            meta::TypeList< AnimationView,
+            meta::Nil > > > > > > ViewTypes;
+
+    /**
+     * Determine (compile time) the View type of largest size.
+     */
+    typedef meta::select_type_maxsize< ViewTypes >::type MaxViewType;
+
+    /**
+     * A list of all presenter types. Must end with meta::Nil.
+     * @note All presenter types used in the application MUST be added to this list!
+     */
+    typedef meta::TypeList< TextureMapperPresenter,
+            meta::TypeList< CirclePresenter,
+            meta::TypeList< ScrollListPresenter,
+            meta::TypeList< SlidePresenter,
+            meta::TypeList< DashboardPresenter,
+            meta::TypeList< AnimationPresenter,
+            meta::Nil > > > > > > PresenterTypes;
+
+    /**
+     * Determine (compile time) the Presenter type of largest size.
+     */
+    typedef meta::select_type_maxsize< PresenterTypes >::type MaxPresenterType;
+
+    /**
+     * A list of all transition types. Must end with meta::Nil.
+     * @note All transition types used in the application MUST be added to this list!
+     */
+    typedef meta::TypeList< NoTransition,
+            meta::TypeList< SlideTransition<EAST>,
+            meta::TypeList< CoverTransition<EAST>,
+            meta::Nil > > > TransitionTypes;
+
+    /**
+     * Determine (compile time) the Transition type of largest size.
+     */
+    typedef meta::select_type_maxsize< TransitionTypes >::type MaxTransitionType;
+
+    static FrontendHeap& getInstance()
+    {
+        static FrontendHeap instance;
+        return instance;
+    }
+
+    Partition< PresenterTypes, 1 > presenters;
+    Partition< ViewTypes, 1 > views;
+    Partition< TransitionTypes, 1 > transitions;
+    FrontendApplication app;
+    Model model;
+private:
+    FrontendHeap()
+        : MVPHeap(presenters, views, transitions, app),
+          presenters(),
+          views(),
+          transitions(),
+          app(model, *this)
+    {
+        // Goto start screen
+        app.gotoScenario(SCENARIO_TEXTURE_MAPPER);
+    }
+};
+
+#endif
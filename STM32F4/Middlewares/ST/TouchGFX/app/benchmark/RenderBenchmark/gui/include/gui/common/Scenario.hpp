@@ -0,0 +1,51 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCENARIO_HPP
+#define SCENARIO_HPP
+
+/**
+ * The rendering scenarios exercised by the benchmark. Each scenario has its own
+ * screen, which animates itself every tick so that every frame has something to
+ * render.
+ */
+enum Scenario
+{
+    SCENARIO_TEXTURE_MAPPER,  ///< A bitmap rotating around all axes using a TextureMapper
+    SCENARIO_CIRCLES,         ///< Anti-aliased, animated arcs drawn by CanvasWidgets
+    SCENARIO_SCROLL_LIST,     ///< A ScrollList being flung back and forth
+    SCENARIO_SLIDE_TRANSITION, ///< Screens sliding in using SlideTransition
+    SCENARIO_DASHBOARD,       ///< Stacked opaque panels with moving indicators
+    SCENARIO_ANIMATIONS,      ///< Many small boxes moved by ScheduledMoveAnimator
+    NUMBER_OF_SCENARIOS
+};
+
+/**
+ * Gets the name of a scenario, as used on the command line and in the CSV output.
+ *
+ * @param scenario The scenario.
+ *
+ * @return The name.
+ */
+const char* getScenarioName(Scenario scenario);
+
+/**
+ * Looks up a scenario by name.
+ *
+ * @param name The name of the scenario.
+ *
+ * @return The scenario, or NUMBER_OF_SCENARIOS if no scenario has the given name.
+ */
+Scenario findScenario(const char* name);
+
+#endif // SCENARIO_HPP
@@ -0,0 +1,51 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCROLL_LIST_ITEM_HPP
+#define SCROLL_LIST_ITEM_HPP
+
+#include <touchgfx/containers/Container.hpp>
+#include <touchgfx/widgets/Box.hpp>
+#include <touchgfx/widgets/canvas/Circle.hpp>
+#include <touchgfx/widgets/canvas/PainterRGB565.hpp>
+
+using namespace touchgfx;
+
+/**
+ * An item in the ScrollList of the ScrollList benchmark screen. An item consists of a
+ * background, a bar and an anti-aliased progress arc, whose color and length depend on the
+ * index of the item and the version of its data.
+ */
+class ScrollListItem : public Container
+{
+public:
+    static const int16_t WIDTH = 400;
+    static const int16_t HEIGHT = 48;
+
+    ScrollListItem();
+    virtual ~ScrollListItem() { }
+
+    /**
+     * Updates the item to show the list element with the given index and data version.
+     */
+    void setup(int16_t index, uint8_t version);
+private:
+    static const int16_t ARC_SIZE = 40;
+
+    Box background;
+    Box bar;
+    Circle arc;
+    PainterRGB565 arcPainter;
+};
+
+#endif // SCROLL_LIST_ITEM_HPP
@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef DASHBOARD_PRESENTER_HPP
+#define DASHBOARD_PRESENTER_HPP
+
+#include <gui/model/ModelListener.hpp>
+#include <mvp/Presenter.hpp>
+
+using namespace touchgfx;
+
+class DashboardView;
+
+/**
+ * The Presenter for the dashboard benchmark screen.
+ */
+class DashboardPresenter : public Presenter, public ModelListener
+{
+public:
+    DashboardPresenter(DashboardView& v);
+
+    /**
+     * The activate function is called automatically when this screen is "switched in"
+     * (ie. made active).
+     */
+    virtual void activate();
+
+    /**
+     * The deactivate function is called automatically when this screen is "switched out"
+     * (ie. made inactive).
+     */
+    virtual void deactivate();
+
+    virtual ~DashboardPresenter() {};
+
+private:
+    DashboardPresenter();
+
+    DashboardView& view;
+};
+
+#endif // DASHBOARD_PRESENTER_HPP
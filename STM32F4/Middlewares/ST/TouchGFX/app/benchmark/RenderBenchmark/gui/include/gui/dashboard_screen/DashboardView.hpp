@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef DASHBOARD_VIEW_HPP
+#define DASHBOARD_VIEW_HPP
+
+#include <mvp/View.hpp>
+#include <gui/dashboard_screen/DashboardPresenter.hpp>
+#include <touchgfx/containers/Container.hpp>
+#include <touchgfx/widgets/Box.hpp>
+
+using namespace touchgfx;
+
+/**
+ * A dashboard of stacked, mostly opaque widgets: a full-screen background, panels
+ * with a frame and a face, and a moving indicator inside each panel. A translucent
+ * highlight sweeps across the panels. Most of the pixels of the widgets further
+ * back are covered, which makes the screen suitable for measuring overdraw.
+ */
+class DashboardView : public View<DashboardPresenter>
+{
+public:
+    DashboardView()
+        : tickCounter(0)
+    {
+    }
+    virtual ~DashboardView() { }
+
+    virtual void setupScreen();
+
+    virtual void tearDownScreen();
+
+    virtual void handleTickEvent();
+private:
+    static const int NUMBER_OF_COLUMNS = 3;
+    static const int NUMBER_OF_ROWS = 2;
+    static const int NUMBER_OF_PANELS = NUMBER_OF_COLUMNS * NUMBER_OF_ROWS;
+    static const int FRAME_WIDTH = 4;
+    static const int INDICATOR_SIZE = 24;
+
+    Box background;
+    Container panels[NUMBER_OF_PANELS];
+    Box frames[NUMBER_OF_PANELS];
+    Box faces[NUMBER_OF_PANELS];
+    Box indicators[NUMBER_OF_PANELS];
+    Box highlight;
+    uint16_t tickCounter;
+};
+
+#endif // DASHBOARD_VIEW_HPP
@@ -0,0 +1,169 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#ifndef MODEL_HPP
+#define MODEL_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+class ModelListener;
+
+/**
+ * The Model class defines the data model in the model-view-presenter paradigm.
+ * The Model is a singular object used across all presenters. The currently active
+ * presenter will have a pointer to the Model through deriving from ModelListener.
+ *
+ * For the benchmark, the Model only keeps track of the state that must survive
+ * screen transitions, i.e. which page is shown by the slide transition scenario, and
+ * the configuration of the slide transition, scroll list and animation scenarios, which
+ * benchmarks may change.
+ */
+class Model
+{
+public:
+    Model();
+
+    /**
+     * Sets the modelListener to point to the currently active presenter. Called automatically
+     * when switching screen.
+     */
+    void bind(ModelListener* listener)
+    {
+        modelListener = listener;
+    }
+
+    /**
+     * This function will be called automatically every frame.
+     */
+    void tick();
+
+    /**
+     * Gets the page currently shown by the slide transition scenario.
+     */
+    uint16_t getSlidePage() const
+    {
+        return slidePage;
+    }
+
+    /**
+     * Advances to the next page of the slide transition scenario.
+     */
+    void nextSlidePage()
+    {
+        slidePage++;
+    }
+
+    /**
+     * Configures the pages of the slide transition scenario. By default, the pages have
+     * 8x4 tiles and slide in using a SlideTransition.
+     *
+     * @param cover   If true, the pages cover the previous page using a CoverTransition.
+     * @param columns The number of columns of tiles.
+     * @param rows    The number of rows of tiles, at most SlideView::MAX_TILES tiles in total.
+     */
+    void setSlideTransition(bool cover, uint16_t columns, uint16_t rows)
+    {
+        slideCover = cover;
+        slideColumns = columns;
+        slideRows = rows;
+    }
+
+    bool getSlideCover() const
+    {
+        return slideCover;
+    }
+
+    uint16_t getSlideColumns() const
+    {
+        return slideColumns;
+    }
+
+    uint16_t getSlideRows() const
+    {
+        return slideRows;
+    }
+
+    /**
+     * Configures the list of the scroll list scenario. By default, the list has 200
+     * items, drawn normally, whose data never changes.
+     *
+     * @param numberOfItems  The number of items in the list.
+     * @param cachedItems    If true, the items are drawn from a cache using CachedListItem.
+     * @param updateInterval If not 0, the data of an item in view changes at this interval
+     *                       in ticks.
+     */
+    void setScrollList(int16_t numberOfItems, bool cachedItems, uint16_t updateInterval)
+    {
+        scrollListItems = numberOfItems;
+        scrollListCached = cachedItems;
+        scrollListUpdateInterval = updateInterval;
+    }
+
+    int16_t getScrollListItems() const
+    {
+        return scrollListItems;
+    }
+
+    bool getScrollListCached() const
+    {
+        return scrollListCached;
+    }
+
+    uint16_t getScrollListUpdateInterval() const
+    {
+        return scrollListUpdateInterval;
+    }
+
+    /**
+     * Configures the boxes of the animation scenario. By default, 200 boxes are moved
+     * using EasingEquations.
+     *
+     * @param numberOfAnimations The number of boxes, at most AnimationView::MAX_ANIMATIONS.
+     * @param fixedPointEasing   If true, the boxes are moved using FixedPointEasingEquations.
+     */
+    void setAnimations(uint16_t numberOfAnimations, bool fixedPointEasing)
+    {
+        animations = numberOfAnimations;
+        animationsFixedPointEasing = fixedPointEasing;
+    }
+
+    uint16_t getNumberOfAnimations() const
+    {
+        return animations;
+    }
+
+    bool getFixedPointEasing() const
+    {
+        return animationsFixedPointEasing;
+    }
+protected:
+    /**
+     * Pointer to the currently active presenter.
+     */
+    ModelListener* modelListener;
+
+    uint16_t slidePage;
+    bool slideCover;
+    uint16_t slideColumns;
+    uint16_t slideRows;
+    int16_t scrollListItems;
+    bool scrollListCached;
+    uint16_t scrollListUpdateInterval;
+    uint16_t animations;
+    bool animationsFixedPointEasing;
+};
+
+#endif /* MODEL_HPP */
@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#ifndef MODELLISTENER_HPP
+#define MODELLISTENER_HPP
+
+#include <gui/model/Model.hpp>
+
+/**
+ * ModelListener is the interface through which the Model can inform the currently
+ * active presenter of events. All presenters should derive from this class.
+ * It also provides a model pointer for the presenter to interact with the Model.
+ *
+ * The bind function is called automatically.
+ */
+class ModelListener
+{
+public:
+    ModelListener() : model(0) {}
+
+    virtual ~ModelListener() {}
+
+    /**
+     * Sets the model pointer to point to the Model object. Called automatically
+     * when switching screen.
+     */
+    void bind(Model* m)
+    {
+        model = m;
+    }
+protected:
+    Model* model;
+};
+
+#endif /* MODELLISTENER_HPP */
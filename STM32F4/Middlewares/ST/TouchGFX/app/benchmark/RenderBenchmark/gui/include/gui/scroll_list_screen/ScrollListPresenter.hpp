@@ -0,0 +1,68 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCROLL_LIST_PRESENTER_HPP
+#define SCROLL_LIST_PRESENTER_HPP
+
+#include <gui/model/ModelListener.hpp>
+#include <mvp/Presenter.hpp>
+
+using namespace touchgfx;
+
+class ScrollListView;
+
+/**
+ * The Presenter for the ScrollList fling benchmark screen.
+ */
+class ScrollListPresenter : public Presenter, public ModelListener
+{
+public:
+    ScrollListPresenter(ScrollListView& v);
+
+    /**
+     * The activate function is called automatically when this screen is "switched in"
+     * (ie. made active).
+     */
+    virtual void activate();
+
+    /**
+     * The deactivate function is called automatically when this screen is "switched out"
+     * (ie. made inactive).
+     */
+    virtual void deactivate();
+
+    virtual ~ScrollListPresenter() {};
+
+    /**
+     * Gets the number of items in the list.
+     */
+    int16_t getNumberOfItems() const;
+
+    /**
+     * Query if the items are drawn from a cache.
+     */
+    bool useCachedItems() const;
+
+    /**
+     * Gets the interval in ticks between changes of the data of an item, or 0 if the data
+     * never changes.
+     */
+    uint16_t getUpdateInterval() const;
+
+private:
+    ScrollListPresenter();
+
+    ScrollListView& view;
+};
+
+#endif // SCROLL_LIST_PRESENTER_HPP
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCROLL_LIST_VIEW_HPP
+#define SCROLL_LIST_VIEW_HPP
+
+#include <mvp/View.hpp>
+#include <gui/scroll_list_screen/ScrollListPresenter.hpp>
+#include <gui/containers/ScrollListItem.hpp>
+#include <touchgfx/containers/scrollers/DrawableList.hpp>
+#include <touchgfx/containers/scrollers/ScrollList.hpp>
+#include <touchgfx/mixins/CachedListItem.hpp>
+#include <touchgfx/widgets/Box.hpp>
+
+using namespace touchgfx;
+
+/**
+ * A vertical ScrollList which is repeatedly flung to a new position far away from
+ * the current one, causing every visible item to move each frame.
+ *
+ * The number of items, whether they are drawn from a cache, and how often the data of an
+ * item changes, are configured through the Model.
+ */
+class ScrollListView : public View<ScrollListPresenter>
+{
+public:
+    ScrollListView();
+    virtual ~ScrollListView() { }
+
+    virtual void setupScreen();
+
+    virtual void tearDownScreen();
+
+    virtual void handleTickEvent();
+private:
+    static const int16_t MAX_NUMBER_OF_ITEMS = 10000;
+    static const int16_t TICKS_PER_FLING = 40;
+    static const int16_t FLING_ANIMATION_STEPS = 30;
+
+    Box background;
+    ScrollList scrollList;
+    DrawableListItems<ScrollListItem, 8> listItems;
+    DrawableListItems<CachedListItem<ScrollListItem>, 8> cachedListItems;
+    Callback<ScrollListView, DrawableListItemsInterface*, int16_t, int16_t> updateItemCallback;
+    uint16_t tickCounter;
+    uint16_t flingCounter;
+    int16_t numberOfItems;
+    bool cachedItems;
+    uint16_t updateInterval;
+    uint8_t itemVersions[MAX_NUMBER_OF_ITEMS];
+
+    void updateItemCallbackHandler(DrawableListItemsInterface* items, int16_t containerIndex, int16_t itemIndex);
+};
+
+#endif // SCROLL_LIST_VIEW_HPP
@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SLIDE_PRESENTER_HPP
+#define SLIDE_PRESENTER_HPP
+
+#include <gui/model/ModelListener.hpp>
+#include <mvp/Presenter.hpp>
+
+using namespace touchgfx;
+
+class SlideView;
+
+/**
+ * The Presenter for the slide transition benchmark screen.
+ */
+class SlidePresenter : public Presenter, public ModelListener
+{
+public:
+    SlidePresenter(SlideView& v);
+
+    /**
+     * The activate function is called automatically when this screen is "switched in"
+     * (ie. made active).
+     */
+    virtual void activate();
+
+    /**
+     * The deactivate function is called automatically when this screen is "switched out"
+     * (ie. made inactive).
+     */
+    virtual void deactivate();
+
+    virtual ~SlidePresenter() {};
+
+    /**
+     * Gets the page number to show.
+     */
+    uint16_t getPage() const;
+
+    /**
+     * Gets the number of columns of tiles.
+     */
+    uint16_t getColumns() const;
+
+    /**
+     * Gets the number of rows of tiles.
+     */
+    uint16_t getRows() const;
+
+    /**
+     * Slides in the next page.
+     */
+    void nextPage();
+
+private:
+    SlidePresenter();
+
+    SlideView& view;
+};
+
+#endif // SLIDE_PRESENTER_HPP
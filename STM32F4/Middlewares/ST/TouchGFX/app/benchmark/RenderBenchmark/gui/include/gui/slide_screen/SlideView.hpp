@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SLIDE_VIEW_HPP
+#define SLIDE_VIEW_HPP
+
+#include <mvp/View.hpp>
+#include <gui/slide_screen/SlidePresenter.hpp>
+#include <touchgfx/widgets/Box.hpp>
+
+using namespace touchgfx;
+
+/**
+ * A page filled with a grid of colored tiles. After a short while the next page is
+ * slid in from the right using a SlideTransition, which snapshots this page and
+ * moves both pages across the screen, or a CoverTransition, which moves the next page
+ * over this page.
+ */
+class SlideView : public View<SlidePresenter>
+{
+public:
+    SlideView()
+        : tickCounter(0)
+    {
+    }
+    virtual ~SlideView() { }
+
+    virtual void setupScreen();
+
+    virtual void tearDownScreen();
+
+    virtual void handleTickEvent();
+
+    static const int MAX_TILES = 64;
+private:
+    static const uint16_t TICKS_PER_PAGE = 10;
+
+    Box background;
+    Box tiles[MAX_TILES];
+    uint16_t tickCounter;
+};
+
+#endif // SLIDE_VIEW_HPP
@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef TEXTURE_MAPPER_PRESENTER_HPP
+#define TEXTURE_MAPPER_PRESENTER_HPP
+
+#include <gui/model/ModelListener.hpp>
+#include <mvp/Presenter.hpp>
+
+using namespace touchgfx;
+
+class TextureMapperView;
+
+/**
+ * The Presenter for the rotating TextureMapper benchmark screen.
+ */
+class TextureMapperPresenter : public Presenter, public ModelListener
+{
+public:
+    TextureMapperPresenter(TextureMapperView& v);
+
+    /**
+     * The activate function is called automatically when this screen is "switched in"
+     * (ie. made active).
+     */
+    virtual void activate();
+
+    /**
+     * The deactivate function is called automatically when this screen is "switched out"
+     * (ie. made inactive).
+     */
+    virtual void deactivate();
+
+    virtual ~TextureMapperPresenter() {};
+
+private:
+    TextureMapperPresenter();
+
+    TextureMapperView& view;
+};
+
+#endif // TEXTURE_MAPPER_PRESENTER_HPP
@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef TEXTURE_MAPPER_VIEW_HPP
+#define TEXTURE_MAPPER_VIEW_HPP
+
+#include <mvp/View.hpp>
+#include <gui/texture_mapper_screen/TextureMapperPresenter.hpp>
+#include <touchgfx/widgets/Box.hpp>
+#include <touchgfx/widgets/TextureMapper.hpp>
+
+using namespace touchgfx;
+
+/**
+ * A bitmap rotating around all three axes using a TextureMapper. The bitmap is
+ * generated at runtime as a dynamic bitmap, so the benchmark does not depend on
+ * the image converter.
+ */
+class TextureMapperView : public View<TextureMapperPresenter>
+{
+public:
+    TextureMapperView()
+        : bitmapId(BITMAP_INVALID),
+          tickCounter(0)
+    {
+    }
+    virtual ~TextureMapperView() { }
+
+    virtual void setupScreen();
+
+    virtual void tearDownScreen();
+
+    virtual void handleTickEvent();
+private:
+    static const uint16_t BITMAP_SIZE = 128;
+
+    Box background;
+    TextureMapper textureMapper;
+    BitmapId bitmapId;
+    uint16_t tickCounter;
+};
+
+#endif // TEXTURE_MAPPER_VIEW_HPP
@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/animation_screen/AnimationPresenter.hpp>
+#include <gui/animation_screen/AnimationView.hpp>
+
+AnimationPresenter::AnimationPresenter(AnimationView& v)
+    : view(v)
+{
+}
+
+void AnimationPresenter::activate()
+{
+}
+
+void AnimationPresenter::deactivate()
+{
+}
+
+uint16_t AnimationPresenter::getNumberOfAnimations() const
+{
+    return model->getNumberOfAnimations();
+}
+
+bool AnimationPresenter::getFixedPointEasing() const
+{
+    return model->getFixedPointEasing();
+}
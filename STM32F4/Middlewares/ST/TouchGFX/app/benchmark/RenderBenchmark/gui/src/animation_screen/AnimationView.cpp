@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/animation_screen/AnimationView.hpp>
+#include <touchgfx/Color.hpp>
+#include <touchgfx/EasingEquations.hpp>
+#include <touchgfx/FixedPointEasingEquations.hpp>
+#include <cassert>
+
+namespace
+{
+// The same equations in the same order, so that the boxes move alike with both
+#define EASING_EQUATIONS(C) \
+    { &C::backEaseIn, &C::backEaseOut, &C::backEaseInOut, &C::bounceEaseIn, &C::bounceEaseOut, &C::bounceEaseInOut, \
+      &C::circEaseIn, &C::circEaseOut, &C::circEaseInOut, &C::cubicEaseIn, &C::cubicEaseOut, &C::cubicEaseInOut, \
+      &C::elasticEaseIn, &C::elasticEaseOut, &C::elasticEaseInOut, &C::expoEaseIn, &C::expoEaseOut, &C::expoEaseInOut, \
+      &C::linearEaseNone, &C::quadEaseIn, &C::quadEaseOut, &C::quadEaseInOut, &C::quartEaseIn, &C::quartEaseOut, \
+      &C::quartEaseInOut, &C::quintEaseIn, &C::quintEaseOut, &C::quintEaseInOut, &C::sineEaseIn, &C::sineEaseOut, \
+      &C::sineEaseInOut }
+
+const int NUMBER_OF_EQUATIONS = 31;
+const EasingEquation floatEquations[NUMBER_OF_EQUATIONS] = EASING_EQUATIONS(EasingEquations);
+const EasingEquation fixedPointEquations[NUMBER_OF_EQUATIONS] = EASING_EQUATIONS(FixedPointEasingEquations);
+}
+
+AnimationView::AnimationView()
+    : animationEndedCallback(this, &AnimationView::animationEnded),
+      numberOfBoxes(0),
+      fixedPointEasing(false),
+      random(0)
+{
+}
+
+void AnimationView::setupScreen()
+{
+    numberOfBoxes = presenter->getNumberOfAnimations();
+    fixedPointEasing = presenter->getFixedPointEasing();
+    assert(numberOfBoxes <= MAX_ANIMATIONS && "Too many animations");
+    random = 12345;
+
+    background.setPosition(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    background.setColor(Color::getColorFrom24BitRGB(0x10, 0x10, 0x20));
+    add(background);
+
+    const int16_t columns = HAL::DISPLAY_WIDTH / (BOX_SIZE * 2);
+    for (uint16_t i = 0; i < numberOfBoxes; i++)
+    {
+        boxes[i].setPosition((i % columns) * BOX_SIZE * 2, (i / columns) * BOX_SIZE * 2 % (HAL::DISPLAY_HEIGHT - BOX_SIZE), BOX_SIZE, BOX_SIZE);
+        boxes[i].setColor(Color::getColorFrom24BitRGB(0x40 + (i * 37) % 0xC0, 0xFF - (i * 11) % 0xC0, 0x80 + (i * 5) % 0x80));
+        boxes[i].setMoveAnimationEndedAction(animationEndedCallback);
+        add(boxes[i]);
+        startAnimation(boxes[i]);
+    }
+}
+
+void AnimationView::tearDownScreen()
+{
+}
+
+void AnimationView::startAnimation(ScheduledMoveAnimator<Box>& box)
+{
+    const EasingEquation* equations = fixedPointEasing ? fixedPointEquations : floatEquations;
+    const int16_t x = nextRandom(HAL::DISPLAY_WIDTH - BOX_SIZE);
+    const int16_t y = nextRandom(HAL::DISPLAY_HEIGHT - BOX_SIZE);
+    const uint16_t duration = 20 + nextRandom(40);
+    const EasingEquation xEquation = equations[nextRandom(NUMBER_OF_EQUATIONS)];
+    const EasingEquation yEquation = equations[nextRandom(NUMBER_OF_EQUATIONS)];
+    box.startMoveAnimation(x, y, duration, xEquation, yEquation);
+}
+
+void AnimationView::animationEnded(const MoveAnimator<Box>& box)
+{
+    startAnimation(boxes[static_cast<const ScheduledMoveAnimator<Box>*>(&box) - boxes]);
+}
+
+uint32_t AnimationView::nextRandom(uint32_t range)
+{
+    random = random * 1103515245 + 12345;
+    return (random >> 16) % range;
+}
@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/circle_screen/CircleView.hpp>
+#include <touchgfx/Color.hpp>
+
+void CircleView::setupScreen()
+{
+    background.setPosition(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    background.setColor(Color::getColorFrom24BitRGB(0x10, 0x10, 0x10));
+    add(background);
+
+    const int16_t cellWidth = HAL::DISPLAY_WIDTH / NUMBER_OF_COLUMNS;
+    const int16_t cellHeight = HAL::DISPLAY_HEIGHT / NUMBER_OF_ROWS;
+    const int16_t radius = (cellWidth < cellHeight ? cellWidth : cellHeight) / 2 - 10;
+    for (int i = 0; i < NUMBER_OF_CIRCLES; i++)
+    {
+        painters[i].setColor(Color::getColorFrom24BitRGB(0x40 + i * 0x18, 0xFF - i * 0x18, 0x80));
+        circles[i].setPosition((i % NUMBER_OF_COLUMNS) * cellWidth, (i / NUMBER_OF_COLUMNS) * cellHeight, cellWidth, cellHeight);
+        circles[i].setCircle(cellWidth / 2, cellHeight / 2, radius);
+        circles[i].setLineWidth(12);
+        circles[i].setArc(0, 0);
+        circles[i].setPainter(painters[i]);
+        add(circles[i]);
+    }
+}
+
+void CircleView::tearDownScreen()
+{
+}
+
+void CircleView::handleTickEvent()
+{
+    tickCounter++;
+    for (int i = 0; i < NUMBER_OF_CIRCLES; i++)
+    {
+        // Sweep the arc from 0 to 360 degrees and back, each circle at its own speed
+        const int16_t period = 720;
+        const int16_t position = (tickCounter * (i + 3)) % period;
+        circles[i].updateArcEnd(position < 360 ? position : period - position);
+    }
+}
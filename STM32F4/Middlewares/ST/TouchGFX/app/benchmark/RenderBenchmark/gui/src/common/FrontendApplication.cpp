@@ -0,0 +1,163 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#include <new>
+#include <gui/common/FrontendApplication.hpp>
+#include <mvp/View.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/transitions/NoTransition.hpp>
+#include <touchgfx/transitions/SlideTransition.hpp>
+#include <touchgfx/transitions/CoverTransition.hpp>
+#include <gui/texture_mapper_screen/TextureMapperView.hpp>
+#include <gui/texture_mapper_screen/TextureMapperPresenter.hpp>
+#include <gui/circle_screen/CircleView.hpp>
+#include <gui/circle_screen/CirclePresenter.hpp>
+#include <gui/scroll_list_screen/ScrollListView.hpp>
+#include <gui/scroll_list_screen/ScrollListPresenter.hpp>
+#include <gui/slide_screen/SlideView.hpp>
+#include <gui/slide_screen/SlidePresenter.hpp>
+#include <gui/dashboard_screen/DashboardView.hpp>
+#include <gui/dashboard_screen/DashboardPresenter.hpp>
+#include <gui/animation_screen/AnimationView.hpp>
+#include <gui/animation_screen/AnimationPresenter.hpp>
+#include <gui/common/FrontendHeap.hpp>
+
+using namespace touchgfx;
+
+FrontendApplication::FrontendApplication(Model& m, FrontendHeap& heap)
+    : touchgfx::AcceleratedMVPApplication(),
+      transitionCallback(),
+      frontendHeap(heap),
+      model(m)
+{
+}
+
+void FrontendApplication::gotoScenario(Scenario scenario)
+{
+    switch (scenario)
+    {
+    case SCENARIO_TEXTURE_MAPPER:
+        gotoTextureMapperScreen();
+        break;
+    case SCENARIO_CIRCLES:
+        gotoCircleScreen();
+        break;
+    case SCENARIO_SCROLL_LIST:
+        gotoScrollListScreen();
+        break;
+    case SCENARIO_SLIDE_TRANSITION:
+        gotoSlideScreen();
+        break;
+    case SCENARIO_DASHBOARD:
+        gotoDashboardScreen();
+        break;
+    case SCENARIO_ANIMATIONS:
+        gotoAnimationScreen();
+        break;
+    case NUMBER_OF_SCENARIOS:
+        assert(0 && "Unknown scenario");
+        break;
+    }
+}
+
+void FrontendApplication::gotoTextureMapperScreen()
+{
+    transitionCallback = touchgfx::Callback< FrontendApplication >(this, &FrontendApplication::gotoTextureMapperScreenImpl);
+    pendingScreenTransitionCallback = &transitionCallback;
+}
+
+void FrontendApplication::gotoTextureMapperScreenImpl()
+{
+    makeTransition< TextureMapperView, TextureMapperPresenter, touchgfx::NoTransition, Model >(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
+
+void FrontendApplication::gotoCircleScreen()
+{
+    transitionCallback = touchgfx::Callback< FrontendApplication >(this, &FrontendApplication::gotoCircleScreenImpl);
+    pendingScreenTransitionCallback = &transitionCallback;
+}
+
+void FrontendApplication::gotoCircleScreenImpl()
+{
+    makeTransition< CircleView, CirclePresenter, touchgfx::NoTransition, Model >(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
+
+void FrontendApplication::gotoScrollListScreen()
+{
+    transitionCallback = touchgfx::Callback< FrontendApplication >(this, &FrontendApplication::gotoScrollListScreenImpl);
+    pendingScreenTransitionCallback = &transitionCallback;
+}
+
+void FrontendApplication::gotoScrollListScreenImpl()
+{
+    makeTransition< ScrollListView, ScrollListPresenter, touchgfx::NoTransition, Model >(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
+
+void FrontendApplication::gotoSlideScreen()
+{
+    transitionCallback = touchgfx::Callback< FrontendApplication >(this, &FrontendApplication::gotoSlideScreenImpl);
+    pendingScreenTransitionCallback = &transitionCallback;
+}
+
+void FrontendApplication::gotoSlideScreenImpl()
+{
+    makeTransition< SlideView, SlidePresenter, touchgfx::NoTransition, Model >(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
+
+void FrontendApplication::gotoDashboardScreen()
+{
+    transitionCallback = touchgfx::Callback< FrontendApplication >(this, &FrontendApplication::gotoDashboardScreenImpl);
+    pendingScreenTransitionCallback = &transitionCallback;
+}
+
+void FrontendApplication::gotoDashboardScreenImpl()
+{
+    makeTransition< DashboardView, DashboardPresenter, touchgfx::NoTransition, Model >(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
+
+void FrontendApplication::gotoAnimationScreen()
+{
+    transitionCallback = touchgfx::Callback< FrontendApplication >(this, &FrontendApplication::gotoAnimationScreenImpl);
+    pendingScreenTransitionCallback = &transitionCallback;
+}
+
+void FrontendApplication::gotoAnimationScreenImpl()
+{
+    makeTransition< AnimationView, AnimationPresenter, touchgfx::NoTransition, Model >(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
+
+void FrontendApplication::gotoSlideScreenSlideTransitionEast()
+{
+    transitionCallback = touchgfx::Callback< FrontendApplication >(this, &FrontendApplication::gotoSlideScreenSlideTransitionEastImpl);
+    pendingScreenTransitionCallback = &transitionCallback;
+}
+
+void FrontendApplication::gotoSlideScreenSlideTransitionEastImpl()
+{
+    makeTransition< SlideView, SlidePresenter, touchgfx::SlideTransition<EAST>, Model >(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
+
+void FrontendApplication::gotoSlideScreenCoverTransitionEast()
+{
+    transitionCallback = touchgfx::Callback< FrontendApplication >(this, &FrontendApplication::gotoSlideScreenCoverTransitionEastImpl);
+    pendingScreenTransitionCallback = &transitionCallback;
+}
+
+void FrontendApplication::gotoSlideScreenCoverTransitionEastImpl()
+{
+    makeTransition< SlideView, SlidePresenter, touchgfx::CoverTransition<EAST>, Model >(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/common/Scenario.hpp>
+#include <string.h>
+
+static const char* const scenarioNames[NUMBER_OF_SCENARIOS] =
+{
+    "texture_mapper",
+    "circles",
+    "scroll_list",
+    "slide_transition",
+    "dashboard",
+    "animations"
+};
+
+const char* getScenarioName(Scenario scenario)
+{
+    return scenario < NUMBER_OF_SCENARIOS ? scenarioNames[scenario] : "unknown";
+}
+
+Scenario findScenario(const char* name)
+{
+    for (int i = 0; i < NUMBER_OF_SCENARIOS; i++)
+    {
+        if (strcmp(name, scenarioNames[i]) == 0)
+        {
+            return static_cast<Scenario>(i);
+        }
+    }
+    return NUMBER_OF_SCENARIOS;
+}
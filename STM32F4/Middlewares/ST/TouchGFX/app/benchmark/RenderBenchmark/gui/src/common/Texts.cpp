@@ -0,0 +1,34 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/Texts.hpp>
+#include <touchgfx/TextProvider.hpp>
+#include <touchgfx/Font.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+
+// The benchmark does not use any texts, so there is no text database generated by the
+// text converter. Provide the definitions it would otherwise contain, configured for
+// left-to-right text only.
+
+touchgfx::Font::StringWidthFunctionPointer touchgfx::Font::getStringWidthFunction = &touchgfx::Font::getStringWidthLTR;
+touchgfx::LCD::DrawStringFunctionPointer touchgfx::LCD::drawStringFunction = &touchgfx::LCD::drawStringLTR;
+touchgfx::TextProvider::UnicodeConverterInitFunctionPointer touchgfx::TextProvider::unicodeConverterInitFunction = static_cast<touchgfx::TextProvider::UnicodeConverterInitFunctionPointer>(0);
+touchgfx::TextProvider::UnicodeConverterFunctionPointer touchgfx::TextProvider::unicodeConverterFunction = static_cast<touchgfx::TextProvider::UnicodeConverterFunctionPointer>(0);
+
+touchgfx::LanguageId touchgfx::Texts::currentLanguage = 0;
+const touchgfx::Unicode::UnicodeChar* const* touchgfx::Texts::currentLanguagePtr = 0;
+
+void touchgfx::Texts::setLanguage(touchgfx::LanguageId id)
+{
+    currentLanguage = id;
+}
@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/containers/ScrollListItem.hpp>
+#include <touchgfx/Color.hpp>
+
+ScrollListItem::ScrollListItem()
+{
+    setWidth(WIDTH);
+    setHeight(HEIGHT);
+
+    background.setPosition(0, 1, WIDTH, HEIGHT - 2);
+    add(background);
+
+    bar.setPosition(8, 12, 0, HEIGHT - 24);
+    add(bar);
+
+    arc.setPosition(WIDTH - ARC_SIZE - 4, (HEIGHT - ARC_SIZE) / 2, ARC_SIZE, ARC_SIZE);
+    arc.setCircle(ARC_SIZE / 2, ARC_SIZE / 2, ARC_SIZE / 2 - 5);
+    arc.setLineWidth(6);
+    arc.setCapPrecision(10);
+    arc.setPainter(arcPainter);
+    add(arc);
+}
+
+void ScrollListItem::setup(int16_t index, uint8_t version)
+{
+    background.setColor((index & 1) ? Color::getColorFrom24BitRGB(0x30, 0x30, 0x38) : Color::getColorFrom24BitRGB(0x40, 0x40, 0x48));
+    bar.setColor(Color::getColorFrom24BitRGB((index * 37) & 0xFF, (index * 73) & 0xFF, (index * 109) & 0xFF));
+    bar.setWidth(16 + ((index + version * 7) * 29) % (WIDTH - ARC_SIZE - 32));
+    arcPainter.setColor(Color::getColorFrom24BitRGB((index * 109) & 0xFF, 0xC0, (index * 37) & 0xFF));
+    arc.setArc(0, 30 + ((index + version * 7) * 47) % 330);
+}
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/dashboard_screen/DashboardView.hpp>
+#include <touchgfx/Color.hpp>
+
+void DashboardView::setupScreen()
+{
+    background.setPosition(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    background.setColor(Color::getColorFrom24BitRGB(0x10, 0x10, 0x10));
+    add(background);
+
+    const int16_t cellWidth = HAL::DISPLAY_WIDTH / NUMBER_OF_COLUMNS;
+    const int16_t cellHeight = HAL::DISPLAY_HEIGHT / NUMBER_OF_ROWS;
+    for (int i = 0; i < NUMBER_OF_PANELS; i++)
+    {
+        panels[i].setPosition((i % NUMBER_OF_COLUMNS) * cellWidth + 4, (i / NUMBER_OF_COLUMNS) * cellHeight + 4, cellWidth - 8, cellHeight - 8);
+        frames[i].setPosition(0, 0, panels[i].getWidth(), panels[i].getHeight());
+        frames[i].setColor(Color::getColorFrom24BitRGB(0x80, 0x80, 0x80));
+        faces[i].setPosition(FRAME_WIDTH, FRAME_WIDTH, panels[i].getWidth() - 2 * FRAME_WIDTH, panels[i].getHeight() - 2 * FRAME_WIDTH);
+        faces[i].setColor(Color::getColorFrom24BitRGB(0x20 + i * 0x10, 0x30, 0x60));
+        indicators[i].setPosition(FRAME_WIDTH, FRAME_WIDTH, INDICATOR_SIZE, INDICATOR_SIZE);
+        indicators[i].setColor(Color::getColorFrom24BitRGB(0xFF, 0xC0 - i * 0x10, 0x20));
+        panels[i].add(frames[i]);
+        panels[i].add(faces[i]);
+        panels[i].add(indicators[i]);
+        add(panels[i]);
+    }
+
+    highlight.setPosition(0, 0, 40, HAL::DISPLAY_HEIGHT);
+    highlight.setColor(Color::getColorFrom24BitRGB(0xFF, 0xFF, 0xFF));
+    highlight.setAlpha(64);
+    add(highlight);
+}
+
+void DashboardView::tearDownScreen()
+{
+}
+
+void DashboardView::handleTickEvent()
+{
+    tickCounter++;
+    for (int i = 0; i < NUMBER_OF_PANELS; i++)
+    {
+        // Move the indicator back and forth along the diagonal of the face, each at its own speed
+        const int16_t rangeX = faces[i].getWidth() - INDICATOR_SIZE;
+        const int16_t rangeY = faces[i].getHeight() - INDICATOR_SIZE;
+        const int16_t period = 2 * rangeX;
+        const int16_t position = (tickCounter * (i + 2)) % period;
+        const int16_t x = position < rangeX ? position : period - position;
+        indicators[i].moveTo(FRAME_WIDTH + x, FRAME_WIDTH + x * rangeY / rangeX);
+    }
+
+    highlight.moveTo((tickCounter * 4) % (HAL::DISPLAY_WIDTH + highlight.getWidth()) - highlight.getWidth(), 0);
+}
@@ -0,0 +1,26 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#include <gui/model/Model.hpp>
+#include <gui/model/ModelListener.hpp>
+
+Model::Model() : modelListener(0), slidePage(0), slideCover(false), slideColumns(8), slideRows(4), scrollListItems(200), scrollListCached(false), scrollListUpdateInterval(0), animations(200), animationsFixedPointEasing(false)
+{
+}
+
+void Model::tick()
+{
+}
@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/scroll_list_screen/ScrollListPresenter.hpp>
+#include <gui/scroll_list_screen/ScrollListView.hpp>
+
+ScrollListPresenter::ScrollListPresenter(ScrollListView& v)
+    : view(v)
+{
+}
+
+void ScrollListPresenter::activate()
+{
+}
+
+void ScrollListPresenter::deactivate()
+{
+}
+
+int16_t ScrollListPresenter::getNumberOfItems() const
+{
+    return model->getScrollListItems();
+}
+
+bool ScrollListPresenter::useCachedItems() const
+{
+    return model->getScrollListCached();
+}
+
+uint16_t ScrollListPresenter::getUpdateInterval() const
+{
+    return model->getScrollListUpdateInterval();
+}
@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/scroll_list_screen/ScrollListView.hpp>
+#include <touchgfx/Color.hpp>
+#include <touchgfx/EasingEquations.hpp>
+#include <string.h>
+
+ScrollListView::ScrollListView()
+    : updateItemCallback(this, &ScrollListView::updateItemCallbackHandler),
+      tickCounter(0),
+      flingCounter(0),
+      numberOfItems(0),
+      cachedItems(false),
+      updateInterval(0)
+{
+}
+
+void ScrollListView::setupScreen()
+{
+    numberOfItems = MIN(presenter->getNumberOfItems(), MAX_NUMBER_OF_ITEMS);
+    cachedItems = presenter->useCachedItems();
+    updateInterval = presenter->getUpdateInterval();
+    memset(itemVersions, 0, sizeof(itemVersions));
+
+    background.setPosition(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    background.setColor(Color::getColorFrom24BitRGB(0x00, 0x00, 0x00));
+    add(background);
+
+    scrollList.setPosition((HAL::DISPLAY_WIDTH - ScrollListItem::WIDTH) / 2, 0, ScrollListItem::WIDTH, HAL::DISPLAY_HEIGHT);
+    scrollList.setHorizontal(false);
+    scrollList.setCircular(false);
+    scrollList.setEasingEquation(EasingEquations::cubicEaseOut);
+    scrollList.setDrawableSize(ScrollListItem::HEIGHT, 0);
+    if (cachedItems)
+    {
+        // The cache is filled with the color of the screen behind the list
+        for (int16_t i = 0; i < cachedListItems.getNumberOfDrawables(); i++)
+        {
+            cachedListItems[i].setCacheBackgroundColor(background.getColor());
+        }
+        scrollList.setDrawables(cachedListItems, updateItemCallback);
+    }
+    else
+    {
+        scrollList.setDrawables(listItems, updateItemCallback);
+    }
+    scrollList.setNumberOfItems(numberOfItems);
+    add(scrollList);
+}
+
+void ScrollListView::tearDownScreen()
+{
+}
+
+void ScrollListView::handleTickEvent()
+{
+    if (updateInterval != 0 && tickCounter % updateInterval == updateInterval - 1)
+    {
+        // Change the data of an item in view, which then shows another bar
+        const int16_t item = scrollList.getItem(tickCounter % listItems.getNumberOfDrawables());
+        if (item >= 0)
+        {
+            itemVersions[item]++;
+            scrollList.itemChanged(item);
+        }
+    }
+
+    if (tickCounter++ % TICKS_PER_FLING == 0)
+    {
+        // Alternate between long flings down and shorter flings back up
+        flingCounter++;
+        const int16_t target = (flingCounter & 1) ? (flingCounter * 17) % numberOfItems : (flingCounter * 5) % numberOfItems;
+        scrollList.animateToItem(target, FLING_ANIMATION_STEPS);
+    }
+}
+
+void ScrollListView::updateItemCallbackHandler(DrawableListItemsInterface* items, int16_t containerIndex, int16_t itemIndex)
+{
+    if (cachedItems)
+    {
+        cachedListItems[containerIndex].setup(itemIndex, itemVersions[itemIndex]);
+        cachedListItems[containerIndex].setCacheKey(itemIndex, itemVersions[itemIndex]);
+    }
+    else
+    {
+        listItems[containerIndex].setup(itemIndex, itemVersions[itemIndex]);
+    }
+}
@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/slide_screen/SlidePresenter.hpp>
+#include <gui/slide_screen/SlideView.hpp>
+#include <gui/common/FrontendApplication.hpp>
+
+SlidePresenter::SlidePresenter(SlideView& v)
+    : view(v)
+{
+}
+
+void SlidePresenter::activate()
+{
+}
+
+void SlidePresenter::deactivate()
+{
+}
+
+uint16_t SlidePresenter::getPage() const
+{
+    return model->getSlidePage();
+}
+
+uint16_t SlidePresenter::getColumns() const
+{
+    return model->getSlideColumns();
+}
+
+uint16_t SlidePresenter::getRows() const
+{
+    return model->getSlideRows();
+}
+
+void SlidePresenter::nextPage()
+{
+    model->nextSlidePage();
+    FrontendApplication* app = static_cast<FrontendApplication*>(Application::getInstance());
+    if (model->getSlideCover())
+    {
+        app->gotoSlideScreenCoverTransitionEast();
+    }
+    else
+    {
+        app->gotoSlideScreenSlideTransitionEast();
+    }
+}
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/slide_screen/SlideView.hpp>
+#include <touchgfx/Color.hpp>
+
+void SlideView::setupScreen()
+{
+    const uint16_t page = presenter->getPage();
+    const int columns = presenter->getColumns();
+    const int rows = presenter->getRows();
+    assert(columns * rows <= MAX_TILES && "Too many tiles");
+
+    background.setPosition(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    background.setColor(Color::getColorFrom24BitRGB(0xFF, 0xFF, 0xFF));
+    add(background);
+
+    const int16_t tileWidth = HAL::DISPLAY_WIDTH / columns;
+    const int16_t tileHeight = HAL::DISPLAY_HEIGHT / rows;
+    for (int i = 0; i < columns * rows; i++)
+    {
+        const int shade = (i + page * 7) * 23;
+        tiles[i].setPosition((i % columns) * tileWidth + 2, (i / columns) * tileHeight + 2, tileWidth - 4, tileHeight - 4);
+        tiles[i].setColor(Color::getColorFrom24BitRGB(shade & 0xFF, (shade * 3) & 0xFF, (page * 50) & 0xFF));
+        add(tiles[i]);
+    }
+}
+
+void SlideView::tearDownScreen()
+{
+}
+
+void SlideView::handleTickEvent()
+{
+    // Only called once the transition bringing in this page has completed
+    if (++tickCounter == TICKS_PER_PAGE)
+    {
+        presenter->nextPage();
+    }
+}
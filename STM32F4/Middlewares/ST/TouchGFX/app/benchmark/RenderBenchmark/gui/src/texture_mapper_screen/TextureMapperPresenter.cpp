@@ -0,0 +1,28 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/texture_mapper_screen/TextureMapperPresenter.hpp>
+#include <gui/texture_mapper_screen/TextureMapperView.hpp>
+
+TextureMapperPresenter::TextureMapperPresenter(TextureMapperView& v)
+    : view(v)
+{
+}
+
+void TextureMapperPresenter::activate()
+{
+}
+
+void TextureMapperPresenter::deactivate()
+{
+}
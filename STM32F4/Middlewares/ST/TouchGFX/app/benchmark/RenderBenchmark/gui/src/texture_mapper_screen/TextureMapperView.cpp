@@ -0,0 +1,61 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <gui/texture_mapper_screen/TextureMapperView.hpp>
+#include <touchgfx/Color.hpp>
+
+void TextureMapperView::setupScreen()
+{
+    background.setPosition(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    background.setColor(Color::getColorFrom24BitRGB(0x20, 0x20, 0x30));
+    add(background);
+
+    bitmapId = Bitmap::dynamicBitmapCreate(BITMAP_SIZE, BITMAP_SIZE, Bitmap::RGB565);
+    assert(bitmapId != BITMAP_INVALID && "Bitmap cache too small for the TextureMapper scenario");
+
+    // Checkerboard with a color gradient, so that both sampling and interpolation errors show
+    uint16_t* pixels = reinterpret_cast<uint16_t*>(Bitmap::dynamicBitmapGetAddress(bitmapId));
+    for (uint16_t y = 0; y < BITMAP_SIZE; y++)
+    {
+        for (uint16_t x = 0; x < BITMAP_SIZE; x++)
+        {
+            const bool odd = ((x >> 4) ^ (y >> 4)) & 1;
+            pixels[y * BITMAP_SIZE + x] = Color::getColorFrom24BitRGB(x * 2, y * 2, odd ? 0xFF : 0x40);
+        }
+    }
+
+    textureMapper.setBitmap(Bitmap(bitmapId));
+    textureMapper.setPosition(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    textureMapper.setBitmapPosition((HAL::DISPLAY_WIDTH - BITMAP_SIZE) / 2, (HAL::DISPLAY_HEIGHT - BITMAP_SIZE) / 2);
+    textureMapper.setCameraDistance(1000.0f);
+    textureMapper.setOrigo(HAL::DISPLAY_WIDTH / 2.0f, HAL::DISPLAY_HEIGHT / 2.0f, 1000.0f);
+    textureMapper.setCamera(HAL::DISPLAY_WIDTH / 2.0f, HAL::DISPLAY_HEIGHT / 2.0f);
+    textureMapper.setScale(1.5f);
+    textureMapper.setRenderingAlgorithm(TextureMapper::BILINEAR_INTERPOLATION);
+    add(textureMapper);
+}
+
+void TextureMapperView::tearDownScreen()
+{
+    if (bitmapId != BITMAP_INVALID)
+    {
+        Bitmap::dynamicBitmapDelete(bitmapId);
+        bitmapId = BITMAP_INVALID;
+    }
+}
+
+void TextureMapperView::handleTickEvent()
+{
+    tickCounter++;
+    textureMapper.updateAngles(tickCounter * 0.011f, tickCounter * 0.017f, tickCounter * 0.029f);
+}
@@ -0,0 +1,660 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+#include <platform/hal/simulator/headless/HeadlessInstrumentation.hpp>
+#include <platform/hal/simulator/headless/PosixRenderWorkers.hpp>
+#include <platform/driver/touch/ScriptedTouchController.hpp>
+#include <platform/driver/lcd/LCD16bpp.hpp>
+#include <platform/driver/lcd/LCD16bppAccelerated.hpp>
+#include <touchgfx/canvas_widget_renderer/CanvasWidgetRenderer.hpp>
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/hal/RenderProfiler.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <gui/common/Scenario.hpp>
+#include <benchmark/AnimationBenchmark.hpp>
+#include <benchmark/BenchmarkRecorder.hpp>
+#include <benchmark/BitmapCacheBenchmark.hpp>
+#include <benchmark/BlitBenchmark.hpp>
+#include <benchmark/DMAQueueBenchmark.hpp>
+#include <benchmark/EasingBenchmark.hpp>
+#include <benchmark/EncodedBitmapBenchmark.hpp>
+#include <benchmark/GlyphCacheBenchmark.hpp>
+#include <benchmark/GoldenImageTest.hpp>
+#include <benchmark/OutlineSortBenchmark.hpp>
+#include <benchmark/PainterBenchmark.hpp>
+#include <benchmark/ParallelRenderBenchmark.hpp>
+#include <benchmark/PartialFrameBufferBenchmark.hpp>
+#include <benchmark/ScrollBlitBenchmark.hpp>
+#include <benchmark/ScrollListBenchmark.hpp>
+#include <benchmark/TextureMapperBenchmark.hpp>
+#include <benchmark/TransitionBenchmark.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CANVAS_BUFFER_SIZE (7200)
+#define BITMAP_CACHE_SIZE (512 * 1024)
+#define NUMBER_OF_DYNAMIC_BITMAPS (16)
+#define WARMUP_FRAMES (2)
+#define TRACE_EVENTS (65535)
+
+using namespace touchgfx;
+
+static void printUsage(const char* program)
+{
+    printf("Usage: %s [options]\n", program);
+    printf("  --scenario <name>  Scenario to run, or \"all\" (default)\n");
+    printf("  --frames <n>       Number of frames to record per scenario (default 300)\n");
+    printf("  --csv <file>       Write per-frame statistics to file, \"-\" for stdout (default)\n");
+    printf("  --trace <file>     Write the draws of the recorded frames to file as a Chrome trace\n");
+    printf("  --no-dma           Render everything in software, do not use blit operations\n");
+    printf("  --no-blit-kernels  Draw with LCD16bpp instead of LCD16bppAccelerated\n");
+    printf("  --coalescing-dma   Defer the blit operations like a busy DMA, and merge them in the queue\n");
+    printf("  --canvas-buffer <bytes>\n");
+    printf("                     Size of the canvas widget renderer buffer (default and max %d)\n", CANVAS_BUFFER_SIZE);
+    printf("  --render-workers <n>\n");
+    printf("                     Draw the dirty region on n threads (default 1, max %d)\n", RenderWorkers::MAX_WORKERS);
+    printf("  --sort-benchmark   Measure the sorting of canvas outline cells instead of rendering\n");
+    printf("  --blit-benchmark   Verify and measure the blit kernels instead of rendering\n");
+    printf("  --bitmap-cache-benchmark\n");
+    printf("                     Verify and measure the automatic bitmap cache instead of rendering\n");
+    printf("  --glyph-cache-benchmark\n");
+    printf("                     Verify and measure the glyph cache instead of rendering\n");
+    printf("  --texture-mapper-benchmark\n");
+    printf("                     Compare the affine and perspective texture mapping instead of rendering\n");
+    printf("  --dma-queue-benchmark\n");
+    printf("                     Verify and measure merging of blit operations instead of rendering\n");
+    printf("  --painter-benchmark\n");
+    printf("                     Compare the cycles per pixel of the per pixel and span painters instead of rendering\n");
+    printf("  --partial-framebuffer-benchmark\n");
+    printf("                     Verify drawing the scenarios in strips against a full frame buffer\n");
+    printf("  --encoded-bitmap-benchmark\n");
+    printf("                     Compare the size and drawing speed of encoded and raw bitmaps instead of rendering\n");
+    printf("  --scroll-list-benchmark\n");
+    printf("                     Compare the frame time of a list of 10000 items drawn normally and from a cache\n");
+    printf("  --scroll-blit-benchmark\n");
+    printf("                     Verify and measure moving the pixels of scrolled containers instead of redrawing them\n");
+    printf("  --transition-benchmark\n");
+    printf("                     Compare the frame time of screen transitions with the new screen drawn every tick and cached\n");
+    printf("  --easing-benchmark Verify and measure the fixed point easing equations against the floating point ones\n");
+    printf("  --animation-benchmark\n");
+    printf("                     Compare the tick time of animations ticked as timer widgets and by the animation scheduler\n");
+    printf("  --parallel-benchmark\n");
+    printf("                     Verify and measure drawing the scenarios on several threads against a single thread\n");
+    printf("  --golden-test <script>\n");
+    printf("                     Run a script of scenarios and touches, and compare the frames to golden hashes\n");
+    printf("  --golden <file>    Golden hashes of the script (default: the script with the extension .golden)\n");
+    printf("  --update-golden    Write the golden hashes of the script instead of comparing\n");
+    printf("  --diff-dir <dir>   Write images of frames differing from the golden hashes to dir\n");
+    printf("Scenarios:");
+    for (int i = 0; i < NUMBER_OF_SCENARIOS; i++)
+    {
+        printf(" %s", getScenarioName(static_cast<Scenario>(i)));
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+    const char* scenarioName = "all";
+    const char* csvFile = "-";
+    const char* traceFile = 0;
+    uint32_t frames = 300;
+    bool useDMA = true;
+    bool useBlitKernels = true;
+    bool coalescingDMA = false;
+    uint32_t canvasBufferSize = CANVAS_BUFFER_SIZE;
+    uint32_t numberOfRenderWorkers = 1;
+    bool sortBenchmark = false;
+    bool blitBenchmark = false;
+    bool bitmapCacheBenchmark = false;
+    bool glyphCacheBenchmark = false;
+    bool textureMapperBenchmark = false;
+    bool dmaQueueBenchmark = false;
+    bool painterBenchmark = false;
+    bool partialFrameBufferBenchmark = false;
+    bool encodedBitmapBenchmark = false;
+    bool scrollListBenchmark = false;
+    bool scrollBlitBenchmark = false;
+    bool transitionBenchmark = false;
+    bool easingBenchmark = false;
+    bool animationBenchmark = false;
+    bool parallelBenchmark = false;
+    const char* goldenTestScript = 0;
+    const char* goldenFile = 0;
+    bool updateGolden = false;
+    const char* diffDirectory = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc)
+        {
+            scenarioName = argv[++i];
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            frames = strtoul(argv[++i], 0, 10);
+        }
+        else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+        {
+            csvFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            traceFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--no-dma") == 0)
+        {
+            useDMA = false;
+        }
+        else if (strcmp(argv[i], "--no-blit-kernels") == 0)
+        {
+            useBlitKernels = false;
+        }
+        else if (strcmp(argv[i], "--coalescing-dma") == 0)
+        {
+            coalescingDMA = true;
+        }
+        else if (strcmp(argv[i], "--canvas-buffer") == 0 && i + 1 < argc)
+        {
+            canvasBufferSize = strtoul(argv[++i], 0, 10);
+            if (canvasBufferSize == 0 || canvasBufferSize > CANVAS_BUFFER_SIZE)
+            {
+                printUsage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--render-workers") == 0 && i + 1 < argc)
+        {
+            numberOfRenderWorkers = strtoul(argv[++i], 0, 10);
+            if (numberOfRenderWorkers == 0 || numberOfRenderWorkers > RenderWorkers::MAX_WORKERS)
+            {
+                printUsage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--sort-benchmark") == 0)
+        {
+            sortBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--blit-benchmark") == 0)
+        {
+            blitBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--bitmap-cache-benchmark") == 0)
+        {
+            bitmapCacheBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--glyph-cache-benchmark") == 0)
+        {
+            glyphCacheBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--texture-mapper-benchmark") == 0)
+        {
+            textureMapperBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--dma-queue-benchmark") == 0)
+        {
+            dmaQueueBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--painter-benchmark") == 0)
+        {
+            painterBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--partial-framebuffer-benchmark") == 0)
+        {
+            partialFrameBufferBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--encoded-bitmap-benchmark") == 0)
+        {
+            encodedBitmapBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--scroll-list-benchmark") == 0)
+        {
+            scrollListBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--scroll-blit-benchmark") == 0)
+        {
+            scrollBlitBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--transition-benchmark") == 0)
+        {
+            transitionBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--easing-benchmark") == 0)
+        {
+            easingBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--animation-benchmark") == 0)
+        {
+            animationBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--parallel-benchmark") == 0)
+        {
+            parallelBenchmark = true;
+        }
+        else if (strcmp(argv[i], "--golden-test") == 0 && i + 1 < argc)
+        {
+            goldenTestScript = argv[++i];
+        }
+        else if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc)
+        {
+            goldenFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--update-golden") == 0)
+        {
+            updateGolden = true;
+        }
+        else if (strcmp(argv[i], "--diff-dir") == 0 && i + 1 < argc)
+        {
+            diffDirectory = argv[++i];
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (sortBenchmark)
+    {
+        // Uses the cell coordinates of a 480x272 display, like the render benchmark
+        static OutlineSortBenchmark outlineSortBenchmark(480, 272);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool sorted = outlineSortBenchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return sorted ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    Scenario first = SCENARIO_TEXTURE_MAPPER;
+    Scenario last = static_cast<Scenario>(NUMBER_OF_SCENARIOS - 1);
+    if (strcmp(scenarioName, "all") != 0)
+    {
+        first = last = findScenario(scenarioName);
+        if (first == NUMBER_OF_SCENARIOS)
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    HeadlessDMA dma;
+    if (!useDMA)
+    {
+        dma.setBlitCaps(0);
+    }
+    dma.setDeferredTransfers(coalescingDMA);
+    dma.setMergingEnabled(coalescingDMA);
+    // Operations not supported by the DMA are drawn using the blit kernels, unless disabled
+    LCD16bpp scalarLCD;
+    LCD16bppAccelerated acceleratedLCD;
+    LCD& lcd = useBlitKernels ? static_cast<LCD&>(acceleratedLCD) : scalarLCD;
+    // Touches are only given by the golden image test scripts
+    ScriptedTouchController tc;
+
+    // Create hardware layer. Use a display size of 480x272.
+    static HALHeadless hal(dma, lcd, tc, 480, 272);
+    hal.initialize();
+    hal.init();
+
+    static uint16_t bitmapCache[BITMAP_CACHE_SIZE / sizeof(uint16_t)];
+    if (bitmapCacheBenchmark)
+    {
+        if (!useBlitKernels)
+        {
+            fprintf(stderr, "The bitmap cache is fed by LCD16bppAccelerated, it cannot be used with --no-blit-kernels\n");
+            return EXIT_FAILURE;
+        }
+        // Registers its own bitmap database
+        static BitmapCacheBenchmark benchmark(bitmapCache, BITMAP_CACHE_SIZE);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (encodedBitmapBenchmark)
+    {
+        // Registers its own bitmap database
+        static EncodedBitmapBenchmark benchmark(dma);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // The benchmark has no static bitmaps, but a database must be registered for the
+    // dynamic bitmaps to work
+    static const Bitmap::BitmapData noBitmaps[1] = { { 0, 0, 0, 0, 0, 0, 0, 0, 0 } };
+    Bitmap::registerBitmapDatabase(noBitmaps, 0, bitmapCache, BITMAP_CACHE_SIZE, NUMBER_OF_DYNAMIC_BITMAPS);
+
+    if (blitBenchmark)
+    {
+        static BlitBenchmark benchmark(dma);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (glyphCacheBenchmark)
+    {
+        static GlyphCacheBenchmark benchmark(dma);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (textureMapperBenchmark)
+    {
+        static TextureMapperBenchmark benchmark(dma);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool withinTolerance = benchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return withinTolerance ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (dmaQueueBenchmark)
+    {
+        static DMAQueueBenchmark benchmark(dma);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (painterBenchmark)
+    {
+        static PainterBenchmark benchmark;
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    static uint8_t canvasBuffer[CANVAS_BUFFER_SIZE];
+    CanvasWidgetRenderer::setupBuffer(canvasBuffer, canvasBufferSize);
+
+    FrontendHeap& heap = FrontendHeap::getInstance();
+    hal.registerEventListener(*(Application::getInstance()));
+
+    if (partialFrameBufferBenchmark)
+    {
+        static PartialFrameBufferBenchmark benchmark(hal, heap);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out, first, last, frames);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (parallelBenchmark)
+    {
+        static ParallelRenderBenchmark benchmark(hal, heap, canvasBufferSize);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out, first, last, frames);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (scrollListBenchmark)
+    {
+        static ScrollListBenchmark benchmark(hal, heap);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out, frames);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (scrollBlitBenchmark)
+    {
+        static ScrollBlitBenchmark benchmark(hal, heap);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out, frames);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (transitionBenchmark)
+    {
+        static TransitionBenchmark benchmark(hal, heap);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out, frames);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (easingBenchmark)
+    {
+        static EasingBenchmark benchmark;
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool withinBound = benchmark.run(out);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return withinBound ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (animationBenchmark)
+    {
+        static AnimationBenchmark benchmark(hal, heap);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool identical = benchmark.run(out, frames);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // Every worker but the calling thread needs a canvas buffer of its own
+    static uint8_t workerCanvasBuffers[RenderWorkers::MAX_WORKERS - 1][CANVAS_BUFFER_SIZE];
+    for (uint32_t worker = 1; worker < numberOfRenderWorkers; worker++)
+    {
+        CanvasWidgetRenderer::setupBuffer(workerCanvasBuffers[worker - 1], canvasBufferSize, static_cast<uint8_t>(worker));
+    }
+    static PosixRenderWorkers renderWorkers(static_cast<uint8_t>(numberOfRenderWorkers));
+    RenderWorkers::setInstance(numberOfRenderWorkers > 1 ? &renderWorkers : 0);
+
+    if (goldenTestScript)
+    {
+        static char defaultGoldenFile[512];
+        if (goldenFile == 0)
+        {
+            const char* extension = strrchr(goldenTestScript, '.');
+            const int length = extension && strchr(extension, '/') == 0 ? static_cast<int>(extension - goldenTestScript) : static_cast<int>(strlen(goldenTestScript));
+            snprintf(defaultGoldenFile, sizeof(defaultGoldenFile), "%.*s.golden", length, goldenTestScript);
+            goldenFile = defaultGoldenFile;
+        }
+        static GoldenImageTest test(hal, tc, heap);
+        FILE* out = strcmp(csvFile, "-") == 0 ? stdout : fopen(csvFile, "w");
+        if (out == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", csvFile);
+            return EXIT_FAILURE;
+        }
+        const bool passed = test.run(out, goldenTestScript, goldenFile, updateGolden, diffDirectory);
+        if (out != stdout)
+        {
+            fclose(out);
+        }
+        return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    BenchmarkRecorder recorder(hal, dma, heap.app);
+    if (!recorder.open(csvFile))
+    {
+        fprintf(stderr, "Unable to open %s\n", csvFile);
+        return EXIT_FAILURE;
+    }
+
+    // Only the recorded frames are profiled, keeping the most recent events
+    static HeadlessInstrumentation instrumentation;
+    static RenderProfiler::Event traceEvents[TRACE_EVENTS];
+    static RenderProfiler profiler(instrumentation, HeadlessInstrumentation::CLOCK_FREQUENCY, traceEvents, TRACE_EVENTS);
+
+    for (int scenario = first; scenario <= last; scenario++)
+    {
+        // Let the screen switch happen, and the first full frame be drawn, before measuring
+        heap.app.gotoScenario(static_cast<Scenario>(scenario));
+        hal.setTickLimit(WARMUP_FRAMES);
+        hal.taskEntry();
+
+        recorder.beginScenario(getScenarioName(static_cast<Scenario>(scenario)));
+        RenderProfiler::setInstance(traceFile ? &profiler : 0);
+        hal.setTickLimit(frames);
+        hal.taskEntry();
+        RenderProfiler::setInstance(0);
+        recorder.endScenario();
+    }
+
+    recorder.close();
+
+    if (traceFile)
+    {
+        FILE* trace = fopen(traceFile, "w");
+        if (trace == 0)
+        {
+            fprintf(stderr, "Unable to open %s\n", traceFile);
+            return EXIT_FAILURE;
+        }
+        const bool written = profiler.writeChromeTrace(trace);
+        fclose(trace);
+        fprintf(stderr, "Traced %u events to %s, %u older events lost\n", profiler.getNumberOfEvents(), traceFile, static_cast<unsigned int>(profiler.getNumberOfLostEvents()));
+        if (!written)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+##############################################################################
+# Copyright (c) 2026 The contributors of this repository.
+#
+# This file is not part of the TouchGFX distribution by STMicroelectronics
+# and is not covered by its license SLA0044. It is licensed under the MIT
+# License.
+#
+# SPDX-License-Identifier: MIT
+#
+##############################################################################
+
+# Framework sources which must be compiled with the application, for the
+# target as well as for the simulator, in addition to linking libtouchgfx.
+# Include this file after setting touchgfx_path, and add the files to the
+# sources of the application:
+#
+#     include $(touchgfx_path)/framework/framework_sources.mk
+#     framework_files += $(touchgfx_framework_files)
+#
+# Projects which are not built with make (IAR, Keil, MSVS) must list the
+# same files. The list contains
+#
+#  - the sources added to the framework, which are not part of libtouchgfx.
+#  - the sources of libtouchgfx whose classes have changed layout or
+#    behaviour. The objects compiled from them take precedence over the
+#    ones in libtouchgfx.
+#
+# The platform DMA classes of a target must also be compiled from source,
+# since DMA_Interface has grown (the members are appended and the
+# constructor is inline, so the DMA objects of libtouchgfx are unaffected).
+touchgfx_framework_files := \
+    $(touchgfx_path)/framework/source/platform/driver/lcd/BlitKernels.cpp \
+    $(touchgfx_path)/framework/source/platform/driver/lcd/LCD16bppAccelerated.cpp \
+    $(touchgfx_path)/framework/source/platform/driver/lcd/LCD24bppAccelerated.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/BitmapCache.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/CachedFont.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/EncodedBitmap.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/GlyphCache.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/Region.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/AnimationScheduler.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/FixedPointEasingEquations.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/hal/CoalescingDMA_Queue.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/hal/FrameBufferScroller.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/hal/OffscreenRenderer.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/hal/PartialFrameBuffer.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/hal/RenderProfiler.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/hal/RenderWorkers.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/transitions/Transition.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/containers/ScrollableContainer.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/containers/SwipeContainer.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/containers/scrollers/DrawableList.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/canvas_widget_renderer/Outline.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/canvas_widget_renderer/CellEstimator.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/canvas_widget_renderer/CanvasWidgetRenderer.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/AbstractGradientPainterRGB565.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/AbstractPainterRGB565.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/AbstractPainterRGB888.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/Canvas.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/CanvasWidget.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/PainterRGB565.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/PainterRGB565Bitmap.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/PainterRGB565LinearGradient.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/PainterRGB565RadialGradient.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/PainterRGB888.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/canvas/PainterRGB888Bitmap.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/ScalableImage.cpp \
+    $(touchgfx_path)/framework/source/touchgfx/widgets/TextureMapper.cpp
+
+# The dirty region, occlusion culling, frame buffer scrolling, animation
+# scheduling and parallel drawing of AcceleratedMVPApplication. Only needed
+# when the FrontendApplication derives from AcceleratedMVPApplication rather
+# than from the header only MVPApplication.
+touchgfx_accelerated_mvp_files := \
+    $(touchgfx_path)/framework/source/mvp/AcceleratedMVPApplication.cpp
@@ -0,0 +1,479 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef ACCELERATEDMVPAPPLICATION_HPP
+#define ACCELERATEDMVPAPPLICATION_HPP
+
+#include <mvp/MVPApplication.hpp>
+#include <touchgfx/AnimationScheduler.hpp>
+#include <touchgfx/hal/FrameBufferScroller.hpp>
+#include <touchgfx/hal/PartialFrameBuffer.hpp>
+#include <touchgfx/hal/RenderWorkers.hpp>
+#include <touchgfx/Region.hpp>
+
+namespace touchgfx
+{
+/**
+ * @struct InvalidationStatistics AcceleratedMVPApplication.hpp mvp/AcceleratedMVPApplication.hpp
+ *
+ * @brief Accumulated measurements of the areas drawn by AcceleratedMVPApplication.
+ *
+ *        Accumulated measurements of the areas drawn by AcceleratedMVPApplication since the
+ *        last call to AcceleratedMVPApplication::resetInvalidationStatistics().
+ */
+struct InvalidationStatistics
+{
+    uint32_t numberOfFrames;  ///< Number of frames in which something was drawn.
+    uint32_t numberOfRects;   ///< Number of rectangles drawn.
+    uint64_t invalidatedArea; ///< Number of pixels actually invalidated, counting each pixel once per frame.
+    uint64_t redrawnArea;     ///< Number of pixels redrawn, including pixels wasted by merging rectangles.
+    uint64_t copiedArea;      ///< Number of pixels copied from the previous frame buffer instead of being redrawn.
+    uint64_t drawnArea;       ///< Number of pixels drawn by widgets. Divide by redrawnArea to get the overdraw factor.
+    uint32_t culledDrawables; ///< Number of drawables in the draw chain that were completely hidden and not drawn.
+    uint64_t scrolledArea;    ///< Number of pixels moved within the frame buffer instead of being redrawn.
+};
+
+/**
+ * @class AcceleratedMVPApplication AcceleratedMVPApplication.hpp mvp/AcceleratedMVPApplication.hpp
+ *
+ * @brief An MVPApplication which only redraws what has changed.
+ *
+ *        An MVPApplication which tracks the invalidated area of each frame in a Region and
+ *        draws it one disjoint rectangle at a time, skipping the parts of the widgets covered
+ *        by solid widgets in front of them. The dirty region can be drawn into a
+ *        PartialFrameBuffer, or in parallel by RenderWorkers.
+ *
+ *        It is also the FrameBufferScroller instance, moving the pixels of scrolled
+ *        containers from the previous frame buffer, and owns the AnimationScheduler instance
+ *        advancing the animations of the animator mixins.
+ *
+ *        MVPApplication itself is header only and drawn by Application as before. Derive the
+ *        FrontendApplication from this class instead to opt in, and compile
+ *        AcceleratedMVPApplication.cpp with the application.
+ *
+ * @see MVPApplication
+ */
+class AcceleratedMVPApplication : public MVPApplication, public FrameBufferScroller
+{
+public:
+
+    /**
+     * @fn AcceleratedMVPApplication::AcceleratedMVPApplication()
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor.
+     */
+    AcceleratedMVPApplication() :
+        dirtyRegion(dirtyRects, MAX_DIRTY_RECTS),
+        lastDirtyRegion(lastDirtyRects, MAX_DIRTY_RECTS),
+        lastTFTFrameBuffer(0),
+        partialFrameBuffer(0),
+        numberOfScrollOperations(0),
+        numberOfRenderPieces(0),
+        renderJob(this, &AcceleratedMVPApplication::drawWorkerPieces)
+    {
+        FrameBufferScroller::setInstance(this);
+        AnimationScheduler::setInstance(&animationScheduler);
+        resetInvalidationStatistics();
+    }
+
+    /**
+     * @fn virtual AcceleratedMVPApplication::~AcceleratedMVPApplication()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor.
+     */
+    virtual ~AcceleratedMVPApplication() { }
+
+    /**
+     * @fn virtual void AcceleratedMVPApplication::handlePendingScreenTransition();
+     *
+     * @brief Handles the pending screen transition.
+     *
+     *        Handles the pending screen transition like MVPApplication, after unscheduling
+     *        the animations of the screen about to be destroyed.
+     */
+    virtual void handlePendingScreenTransition();
+
+    /**
+     * @fn virtual void AcceleratedMVPApplication::handleTickEvent();
+     *
+     * @brief Handle tick.
+     *
+     *        Handle tick. Ticks the timer widgets like Application, followed by the
+     *        animations of the AnimationScheduler. Like the timer widgets, the animations are
+     *        not ticked while a screen transition is running.
+     */
+    virtual void handleTickEvent();
+
+    /**
+     * @fn AnimationScheduler& AcceleratedMVPApplication::getAnimationScheduler()
+     *
+     * @brief Gets the animation scheduler.
+     *
+     *        Gets the animation scheduler.
+     *
+     * @return The animation scheduler.
+     */
+    AnimationScheduler& getAnimationScheduler()
+    {
+        return animationScheduler;
+    }
+
+    /**
+     * @fn virtual void AcceleratedMVPApplication::draw(Rect& rect);
+     *
+     * @brief Draws the specified area of the screen.
+     *
+     *        Draws the specified area of the screen. While draw operations are being cached,
+     *        the area is added to the dirty region, and drawn when caching is disabled.
+     *
+     * @param [in] rect The area to draw, in absolute coordinates. Will be clipped to the screen.
+     */
+    virtual void draw(Rect& rect);
+
+    /**
+     * @fn virtual void AcceleratedMVPApplication::cacheDrawOperations(bool enableCache);
+     *
+     * @brief Enables or disables caching of draw operations.
+     *
+     *        Enables or disables caching of draw operations. When caching is disabled, the
+     *        accumulated dirty region is drawn one disjoint rectangle at a time.
+     *
+     *        When double buffering is used, the area drawn in the previous frame must also
+     *        be updated in the current frame buffer. For 16bpp displays this area is copied
+     *        from the previous frame buffer rather than being redrawn. Finally the
+     *        BitmapCache is given the chance to cache the bitmaps missed during the frame.
+     *
+     *        When RenderWorkers are registered, the dirty region is split into horizontal
+     *        bands which are drawn in parallel by the workers. The drawables to draw in each
+     *        band are found on the calling task, and all bands are drawn and flushed before
+     *        this function returns.
+     *
+     * @param enableCache true to enable caching, false to disable caching and draw the dirty
+     *                    region.
+     */
+    virtual void cacheDrawOperations(bool enableCache);
+
+    /**
+     * @fn virtual bool AcceleratedMVPApplication::scrollArea(const Rect& area, int16_t deltaX, int16_t deltaY);
+     *
+     * @brief Moves the pixels of an area of the display.
+     *
+     *        Moves the pixels of an area of the display. The pixels are copied from the
+     *        previous frame buffer when the dirty region is drawn, and the exposed parts of
+     *        the area and the parts of the dirty region inside the area moved by the distance
+     *        are added to the dirty region.
+     *
+     *        Scrolling requires double buffering and a 16 bpp display without rotation, and
+     *        is only done while draw operations are cached and no PartialFrameBuffer is set.
+     *        An area can be scrolled several times per frame, but up to
+     *        MAX_SCROLL_OPERATIONS different areas, which must not overlap, can be scrolled.
+     *
+     * @param area   The area, in absolute coordinates.
+     * @param deltaX The horizontal distance to move the pixels.
+     * @param deltaY The vertical distance to move the pixels.
+     *
+     * @return false if the pixels cannot be moved, in which case the caller must invalidate
+     *         the area.
+     */
+    virtual bool scrollArea(const Rect& area, int16_t deltaX, int16_t deltaY);
+
+    /**
+     * @fn void AcceleratedMVPApplication::setDirtyRegionCapacity(uint16_t capacity)
+     *
+     * @brief Sets the maximum number of rectangles drawn per frame.
+     *
+     *        Sets the maximum number of rectangles drawn per frame. More rectangles avoid
+     *        redrawing unchanged pixels between independently updated widgets, fewer
+     *        rectangles reduce the cost of traversing the widget tree for each rectangle.
+     *
+     * @param capacity The capacity, between 1 and MAX_DIRTY_RECTS.
+     */
+    void setDirtyRegionCapacity(uint16_t capacity);
+
+    /**
+     * @fn void AcceleratedMVPApplication::setDirtyRegionMergeThreshold(uint32_t pixels)
+     *
+     * @brief Sets the number of wasted pixels accepted when merging dirty rectangles.
+     *
+     *        Sets the number of wasted pixels accepted when merging dirty rectangles.
+     *
+     * @param pixels The number of pixels.
+     *
+     * @see Region::setMergeThreshold
+     */
+    void setDirtyRegionMergeThreshold(uint32_t pixels)
+    {
+        dirtyRegion.setMergeThreshold(pixels);
+        lastDirtyRegion.setMergeThreshold(pixels);
+    }
+
+    /**
+     * @fn void AcceleratedMVPApplication::setPartialFrameBuffer(PartialFrameBuffer* stripBuffers)
+     *
+     * @brief Draws into a ring of strip buffers instead of a full frame buffer.
+     *
+     *        Draws into a ring of strip buffers instead of a full frame buffer. Each area to
+     *        draw is split into horizontal strips, which are drawn one at a time into the
+     *        strip buffers and sent to the display by the PartialFrameBuffer.
+     *
+     * @param [in] stripBuffers The strip buffers, or 0 to draw into the frame buffer of the
+     *                          HAL again.
+     *
+     * @see PartialFrameBuffer
+     */
+    void setPartialFrameBuffer(PartialFrameBuffer* stripBuffers)
+    {
+        partialFrameBuffer = stripBuffers;
+    }
+
+    /**
+     * @fn const InvalidationStatistics& AcceleratedMVPApplication::getInvalidationStatistics() const
+     *
+     * @brief Gets the accumulated invalidation statistics.
+     *
+     *        Gets the accumulated invalidation statistics.
+     *
+     * @return The statistics.
+     */
+    const InvalidationStatistics& getInvalidationStatistics() const
+    {
+        return invalidationStatistics;
+    }
+
+    /**
+     * @fn void AcceleratedMVPApplication::resetInvalidationStatistics();
+     *
+     * @brief Resets the invalidation statistics.
+     *
+     *        Resets the invalidation statistics.
+     */
+    void resetInvalidationStatistics();
+
+    static const uint16_t MAX_DIRTY_RECTS = 16;   ///< Maximum number of rectangles in the dirty region. @remarks Memory impact: 2 * x * sizeof(Rect)
+    static const uint16_t MAX_DRAW_OPERATIONS = 64; ///< Maximum number of widget draws per dirty rectangle when culling. @remarks Memory impact: x * (sizeof(Rect) + sizeof(Drawable*))
+    static const uint16_t MAX_VISIBLE_RECTS = 8;  ///< Maximum number of rectangles used for tracking the uncovered part of a dirty rectangle.
+    static const uint16_t MAX_SCROLL_OPERATIONS = 4; ///< Maximum number of different areas scrolled per frame.
+    static const uint16_t MAX_RENDER_PIECES = 32;  ///< Maximum number of pieces the dirty region is split into for RenderWorkers. Must be at least MAX_DIRTY_RECTS.
+    static const int16_t MIN_RENDER_PIECE_HEIGHT = 8; ///< Minimum height of the bands drawn by RenderWorkers, unless a dirty rectangle is lower.
+
+protected:
+    Rect dirtyRects[MAX_DIRTY_RECTS];                  ///< Storage for dirtyRegion.
+    Rect lastDirtyRects[MAX_DIRTY_RECTS];              ///< Storage for lastDirtyRegion.
+    Region dirtyRegion;                                ///< The area invalidated in the current frame.
+    Region lastDirtyRegion;                            ///< The area invalidated since the frame buffers were last swapped.
+    uint16_t* lastTFTFrameBuffer;                      ///< The frame buffer displayed when the dirty region was last drawn.
+    InvalidationStatistics invalidationStatistics;     ///< Accumulated measurements.
+    PartialFrameBuffer* partialFrameBuffer;            ///< The strip buffers drawn into, or 0 to draw into the frame buffer.
+
+    /**
+     * @struct DrawOperation AcceleratedMVPApplication.hpp mvp/AcceleratedMVPApplication.hpp
+     *
+     * @brief A part of a drawable to be drawn.
+     *
+     *        A part of a drawable to be drawn, found by planCulled().
+     */
+    struct DrawOperation
+    {
+        Drawable* drawable; ///< The drawable.
+        Rect area;          ///< The area to draw, relative to the drawable.
+    };
+
+    DrawOperation drawOperations[MAX_DRAW_OPERATIONS]; ///< Storage for planCulled().
+
+    /**
+     * @struct ScrollOperation AcceleratedMVPApplication.hpp mvp/AcceleratedMVPApplication.hpp
+     *
+     * @brief An area of the frame buffer to be scrolled.
+     *
+     *        An area of the frame buffer to be scrolled, recorded by scrollArea().
+     */
+    struct ScrollOperation
+    {
+        Rect area;      ///< The area, in absolute coordinates.
+        int16_t deltaX; ///< The total horizontal distance to move the pixels.
+        int16_t deltaY; ///< The total vertical distance to move the pixels.
+
+        /**
+         * @fn Rect getDestination() const
+         *
+         * @brief Gets the part of the area covered by the moved pixels.
+         *
+         *        Gets the part of the area covered by the moved pixels.
+         *
+         * @return The destination, in absolute coordinates.
+         */
+        Rect getDestination() const
+        {
+            return area & Rect(area.x + deltaX, area.y + deltaY, area.width, area.height);
+        }
+    };
+
+    ScrollOperation scrollOperations[MAX_SCROLL_OPERATIONS]; ///< The areas scrolled in the current frame.
+    uint16_t numberOfScrollOperations;                       ///< Number of areas scrolled in the current frame.
+
+    AnimationScheduler animationScheduler;                   ///< The animations advanced every tick.
+
+    /**
+     * @struct RenderPiece AcceleratedMVPApplication.hpp mvp/AcceleratedMVPApplication.hpp
+     *
+     * @brief A band of the dirty region drawn by one of the RenderWorkers.
+     *
+     *        A band of the dirty region drawn by one of the RenderWorkers.
+     */
+    struct RenderPiece
+    {
+        Rect area;                   ///< The area, in absolute coordinates.
+        uint16_t firstOperation;     ///< Index of the first draw operation of the piece.
+        uint16_t numberOfOperations; ///< Number of draw operations of the piece.
+        uint32_t drawnArea;          ///< Number of pixels drawn by the draw operations.
+        uint8_t worker;              ///< The worker drawing the piece.
+    };
+
+    RenderPiece renderPieces[MAX_RENDER_PIECES];             ///< The pieces planned for the workers.
+    uint16_t numberOfRenderPieces;                           ///< Number of pieces planned for the workers.
+    Callback<AcceleratedMVPApplication, uint8_t> renderJob;  ///< The job run by the workers, calling drawWorkerPieces().
+
+    /**
+     * @fn void AcceleratedMVPApplication::drawArea(Rect& rect, bool culling);
+     *
+     * @brief Draws and flushes an area of the current screen.
+     *
+     *        Draws and flushes an area of the current screen. When a PartialFrameBuffer is
+     *        set, the area is drawn one strip at a time.
+     *
+     * @param [in] rect The area to draw, in absolute coordinates.
+     * @param culling   true to skip the parts of the widgets that are covered by solid
+     *                  widgets in front of them.
+     */
+    void drawArea(Rect& rect, bool culling);
+
+    /**
+     * @fn void AcceleratedMVPApplication::drawFrameBufferArea(Rect& rect, bool culling);
+     *
+     * @brief Draws and flushes an area of the current screen into the frame buffer.
+     *
+     *        Draws and flushes an area of the current screen into the frame buffer.
+     *
+     * @param [in] rect The area to draw, in absolute coordinates.
+     * @param culling   true to skip the parts of the widgets that are covered by solid
+     *                  widgets in front of them.
+     */
+    void drawFrameBufferArea(Rect& rect, bool culling);
+
+    /**
+     * @fn bool AcceleratedMVPApplication::drawCulled(const Rect& rect);
+     *
+     * @brief Draws an area of the current screen using occlusion culling.
+     *
+     *        Draws an area of the current screen. The parts of the drawables to draw are found
+     *        by planCulled() and drawn back to front.
+     *
+     * @param rect The area to draw, in absolute coordinates.
+     *
+     * @return false if there were too many parts to draw, in which case nothing is drawn.
+     */
+    bool drawCulled(const Rect& rect);
+
+    /**
+     * @fn bool AcceleratedMVPApplication::planCulled(const Rect& rect, uint16_t firstOperation, uint16_t& numberOfOperations);
+     *
+     * @brief Finds the parts of the drawables to draw in an area using occlusion culling.
+     *
+     *        Finds the parts of the drawables to draw in an area of the current screen. The
+     *        draw chain is traversed front to back, recording the parts of each drawable not
+     *        covered by the solid rectangles of the drawables in front of it in
+     *        drawOperations. Drawables which are completely covered are skipped.
+     *
+     * @param rect                     The area to draw, in absolute coordinates.
+     * @param firstOperation           Index of the first draw operation to record.
+     * @param [out] numberOfOperations Number of draw operations recorded.
+     *
+     * @return false if there was no room for all the parts.
+     */
+    bool planCulled(const Rect& rect, uint16_t firstOperation, uint16_t& numberOfOperations);
+
+    /**
+     * @fn void AcceleratedMVPApplication::drawPlanned(uint16_t firstOperation, uint16_t numberOfOperations);
+     *
+     * @brief Draws a range of the recorded draw operations back to front.
+     *
+     *        Draws a range of the recorded draw operations back to front.
+     *
+     * @param firstOperation     Index of the first draw operation.
+     * @param numberOfOperations Number of draw operations.
+     */
+    void drawPlanned(uint16_t firstOperation, uint16_t numberOfOperations);
+
+    /**
+     * @fn bool AcceleratedMVPApplication::drawDirtyRegionInParallel();
+     *
+     * @brief Draws and flushes the dirty region using the RenderWorkers.
+     *
+     *        Draws and flushes the dirty region using the RenderWorkers. The dirty rectangles
+     *        are split into horizontal bands which are planned using planCulled() as long as
+     *        there is room for their draw operations, and then drawn by the workers. A band
+     *        with too many parts to draw is drawn by the calling task.
+     *
+     * @return false if there are no workers, or the dirty region cannot be drawn in
+     *         parallel, in which case nothing is drawn.
+     */
+    bool drawDirtyRegionInParallel();
+
+    /**
+     * @fn uint16_t AcceleratedMVPApplication::splitDirtyRegion(Rect* pieces, uint16_t numberOfPieces) const;
+     *
+     * @brief Splits the dirty region into horizontal bands.
+     *
+     *        Splits the dirty region into horizontal bands of roughly the same area, at least
+     *        one per dirty rectangle, and none lower than MIN_RENDER_PIECE_HEIGHT unless the
+     *        rectangle is.
+     *
+     * @param [out] pieces   The bands, room for MAX_RENDER_PIECES.
+     * @param numberOfPieces The wanted number of bands.
+     *
+     * @return The number of bands.
+     */
+    uint16_t splitDirtyRegion(Rect* pieces, uint16_t numberOfPieces) const;
+
+    /**
+     * @fn void AcceleratedMVPApplication::drawRenderPieces(RenderWorkers& workers);
+     *
+     * @brief Draws and flushes the planned render pieces.
+     *
+     *        Assigns the planned render pieces to the workers, largest first to the least
+     *        loaded worker, which only depends on the pieces so frames are drawn the same way
+     *        every time. The workers then draw the pieces, and the pieces are flushed when all
+     *        workers are done.
+     *
+     * @param [in] workers The workers.
+     */
+    void drawRenderPieces(RenderWorkers& workers);
+
+    /**
+     * @fn void AcceleratedMVPApplication::drawWorkerPieces(uint8_t worker);
+     *
+     * @brief Draws the render pieces assigned to a worker.
+     *
+     *        Draws the render pieces assigned to a worker. Called by the worker.
+     *
+     * @param worker The index of the worker.
+     */
+    void drawWorkerPieces(uint8_t worker);
+};
+} // namespace touchgfx
+
+#endif // ACCELERATEDMVPAPPLICATION_HPP
@@ -0,0 +1,166 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef BLITKERNELS_HPP
+#define BLITKERNELS_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+/**
+ * The implementation of the BlitKernels is selected at compile time. Define one of the
+ * following in the compiler options to override the default:
+ *
+ * BLIT_KERNELS_VECTOR: Processes 8 pixels at a time using the vector extensions of GCC and
+ *                      Clang, which compile to SSE2 on x86 and to NEON on ARM application
+ *                      processors. Default when compiling for SSE2 or NEON, e.g. the simulator.
+ * BLIT_KERNELS_WORD:   Processes 32 bit words, i.e. two 16 bit pixels or four bytes of 24 bit
+ *                      pixels, at a time in portable C++. Color channels are blended in
+ *                      16 bit lanes of a 32 bit register, so every multiplication blends two
+ *                      channels. Default for all other targets, e.g. Cortex-M.
+ */
+#if !defined(BLIT_KERNELS_VECTOR) && !defined(BLIT_KERNELS_WORD)
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON))
+#define BLIT_KERNELS_VECTOR
+#else
+#define BLIT_KERNELS_WORD
+#endif
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class BlitKernels BlitKernels.hpp platform/driver/lcd/BlitKernels.hpp
+ *
+ * @brief Software implementations of the most common blit operations.
+ *
+ *        Software implementations of the most common blit operations, working on several
+ *        pixels at a time. The results are identical to those of the per-pixel loops in
+ *        LCD16bpp and LCD24bpp, so the kernels can replace them on platforms without a blit
+ *        accelerator like Chrom-ART.
+ *
+ *        All kernels work on a rectangle of pixels in memory. Strides are given in pixels,
+ *        so a stride of HAL::FRAME_BUFFER_WIDTH steps one line in the frame buffer. Alpha
+ *        values of 0 must be handled by the caller, as nothing should be drawn.
+ *
+ * @see LCD16bppAccelerated
+ * @see LCD24bppAccelerated
+ */
+class BlitKernels
+{
+public:
+    /**
+     * @fn static const char* BlitKernels::getName();
+     *
+     * @brief Gets the name of the implementation selected at compile time.
+     *
+     *        Gets the name of the implementation selected at compile time, "vector" or "word".
+     *
+     * @return The name of the implementation.
+     */
+    static const char* getName();
+
+    /**
+     * @fn static void BlitKernels::fill16(uint16_t* dst, int16_t width, int16_t height, int16_t dstStride, uint16_t color, uint8_t alpha);
+     *
+     * @brief Fills a rectangle of RGB565 pixels with a color.
+     *
+     *        Fills a rectangle of RGB565 pixels with a color. Each color channel becomes
+     *        (color * alpha + dst * (256 - alpha)) >> 8, except for alpha 255 where the color
+     *        is just stored.
+     *
+     * @param [in,out] dst Pointer to the first pixel of the rectangle.
+     * @param width        The width of the rectangle.
+     * @param height       The height of the rectangle.
+     * @param dstStride    The number of pixels from one line of dst to the next.
+     * @param color        The RGB565 color.
+     * @param alpha        The alpha of the color, 1-255.
+     */
+    static void fill16(uint16_t* dst, int16_t width, int16_t height, int16_t dstStride, uint16_t color, uint8_t alpha);
+
+    /**
+     * @fn static void BlitKernels::copy16(uint16_t* dst, const uint16_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha);
+     *
+     * @brief Copies a rectangle of RGB565 pixels.
+     *
+     *        Copies a rectangle of RGB565 pixels. Each color channel becomes (src * alpha +
+     *        dst * (256 - alpha)) >> 8, except for alpha 255 where the source is just copied.
+     *
+     * @param [in,out] dst Pointer to the first pixel of the destination rectangle.
+     * @param src          Pointer to the first pixel of the source rectangle.
+     * @param width        The width of the rectangle.
+     * @param height       The height of the rectangle.
+     * @param dstStride    The number of pixels from one line of dst to the next.
+     * @param srcStride    The number of pixels from one line of src to the next.
+     * @param alpha        The alpha of the source, 1-255.
+     */
+    static void copy16(uint16_t* dst, const uint16_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha);
+
+    /**
+     * @fn static void BlitKernels::copyARGB8888To16(uint16_t* dst, const uint32_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha);
+     *
+     * @brief Blends a rectangle of ARGB8888 pixels onto RGB565 pixels.
+     *
+     *        Blends a rectangle of ARGB8888 pixels onto RGB565 pixels. With A being the alpha
+     *        of the source pixel times the given alpha, each color channel becomes (src * A +
+     *        dst * (65536 - A)) >> 16, where the source channels are reduced to 5 and 6 bits
+     *        first. Fully opaque pixels are just converted and stored.
+     *
+     * @param [in,out] dst Pointer to the first pixel of the destination rectangle.
+     * @param src          Pointer to the first pixel of the source rectangle.
+     * @param width        The width of the rectangle.
+     * @param height       The height of the rectangle.
+     * @param dstStride    The number of pixels from one line of dst to the next.
+     * @param srcStride    The number of pixels from one line of src to the next.
+     * @param alpha        The alpha of the source, 1-255.
+     */
+    static void copyARGB8888To16(uint16_t* dst, const uint32_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha);
+
+    /**
+     * @fn static void BlitKernels::fill24(uint8_t* dst, int16_t width, int16_t height, int16_t dstStride, uint32_t color, uint8_t alpha);
+     *
+     * @brief Fills a rectangle of 24 bit pixels with a color.
+     *
+     *        Fills a rectangle of 24 bit pixels, stored as blue, green and red bytes, with a
+     *        color. Each byte becomes (color * alpha + dst * (256 - alpha)) >> 8, except for
+     *        alpha 255 where the color is just stored.
+     *
+     * @param [in,out] dst Pointer to the first pixel of the rectangle.
+     * @param width        The width of the rectangle.
+     * @param height       The height of the rectangle.
+     * @param dstStride    The number of pixels from one line of dst to the next.
+     * @param color        The color as 0xRRGGBB.
+     * @param alpha        The alpha of the color, 1-255.
+     */
+    static void fill24(uint8_t* dst, int16_t width, int16_t height, int16_t dstStride, uint32_t color, uint8_t alpha);
+
+    /**
+     * @fn static void BlitKernels::copy24(uint8_t* dst, const uint8_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha);
+     *
+     * @brief Copies a rectangle of 24 bit pixels.
+     *
+     *        Copies a rectangle of 24 bit pixels. Each byte becomes (src * alpha + dst * (256
+     *        - alpha)) >> 8, except for alpha 255 where the source is just copied.
+     *
+     * @param [in,out] dst Pointer to the first pixel of the destination rectangle.
+     * @param src          Pointer to the first pixel of the source rectangle.
+     * @param width        The width of the rectangle.
+     * @param height       The height of the rectangle.
+     * @param dstStride    The number of pixels from one line of dst to the next.
+     * @param srcStride    The number of pixels from one line of src to the next.
+     * @param alpha        The alpha of the source, 1-255.
+     */
+    static void copy24(uint8_t* dst, const uint8_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha);
+};
+} // namespace touchgfx
+
+#endif // BLITKERNELS_HPP
@@ -0,0 +1,163 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef LCD16BPPACCELERATED_HPP
+#define LCD16BPPACCELERATED_HPP
+
+#include <platform/driver/lcd/LCD16bpp.hpp>
+#include <touchgfx/hal/BlitOp.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class LCD16bppAccelerated LCD16bppAccelerated.hpp platform/driver/lcd/LCD16bppAccelerated.hpp
+ *
+ * @brief An LCD16bpp which performs the common blit operations using BlitKernels.
+ *
+ *        An LCD16bpp which performs solid and alpha blended fills, opaque and alpha blended
+ *        copies of RGB565 data, and ARGB8888 bitmaps, using BlitKernels instead of drawing one
+ *        pixel at a time. The result is identical to that of LCD16bpp.
+ *
+ *        Use it in place of LCD16bpp on platforms without a blit accelerator, or with an
+ *        accelerator which lacks some of the operations. Operations supported by the HAL
+ *        blit capabilities are still performed by the DMA, as are all operations when the
+ *        display is rotated.
+ *
+ *        Bitmaps in the Bitmap::ENCODED format are decoded line by line while drawing, see
+ *        EncodedBitmap.
+ *
+ * @see LCD16bpp
+ * @see BlitKernels
+ */
+class LCD16bppAccelerated : public LCD16bpp
+{
+public:
+
+    virtual ~LCD16bppAccelerated() {}
+
+    /**
+     * @fn virtual void LCD16bppAccelerated::drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha = 255, bool useOptimized = true);
+     *
+     * @brief Draws a portion of a bitmap.
+     *
+     *        Draws a portion of a bitmap. ARGB8888 bitmaps are blended using BlitKernels,
+     *        encoded bitmaps are decoded while drawing, other formats are drawn by LCD16bpp.
+     *        The draw is reported to the BitmapCache.
+     *
+     * @param bitmap       The bitmap to draw.
+     * @param x            The absolute x coordinate to place pixel (0, 0) on the screen.
+     * @param y            The absolute y coordinate to place pixel (0, 0) on the screen.
+     * @param rect         A rectangle describing what region of the bitmap is to be drawn.
+     * @param alpha        Optional alpha value. Default is 255 (solid).
+     * @param useOptimized if false, do not attempt to substitute (parts of) this bitmap with
+     *                     faster fillrects.
+     */
+    virtual void drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha = 255, bool useOptimized = true);
+
+    /**
+     * @fn virtual void LCD16bppAccelerated::blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+     *
+     * @brief Blits a 2D source-array to the framebuffer.
+     *
+     *        Blits a 2D source-array to the framebuffer using BlitKernels.
+     *
+     * @param sourceData           The source-array pointer (points to the beginning of the
+     *                             data).  The sourceData must be stored as 16-bits RGB565
+     *                             values.
+     * @param source               The location and dimension of the source.
+     * @param blitRect             A rectangle describing what region is to be drawn.
+     * @param alpha                The alpha value to use for blending (255 = solid, no blending)
+     * @param hasTransparentPixels If true, this data copy contains transparent pixels and
+     *                             require hardware support for that to be enabled.
+     */
+    virtual void blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+
+    /**
+     * @fn virtual void LCD16bppAccelerated::blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+     *
+     * @brief Blits a 2D source-array to the framebuffer while converting the format.
+     *
+     *        Blits a 2D source-array to the framebuffer while converting the format. ARGB8888
+     *        data is blended using BlitKernels, and Bitmap::ENCODED data is decoded.
+     *
+     * @param sourceData           The source-array pointer (points to the beginning of the
+     *                             data). The sourceData must be stored in a format suitable for
+     *                             the selected display.
+     * @param sourceFormat         The bitmap format used in the source data.
+     * @param source               The location and dimension of the source.
+     * @param blitRect             A rectangle describing what region is to be drawn.
+     * @param alpha                The alpha value to use for blending (255 = solid, no blending)
+     * @param hasTransparentPixels If true, this data copy contains transparent pixels and
+     *                             require hardware support for that to be enabled.
+     */
+    virtual void blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+
+    /**
+     * @fn virtual void LCD16bppAccelerated::fillRect(const Rect& rect, colortype color, uint8_t alpha = 255);
+     *
+     * @brief Draws a filled rectangle in the specified color.
+     *
+     *        Draws a filled rectangle in the specified color using BlitKernels.
+     *
+     * @param rect  The rectangle to draw in absolute coordinates.
+     * @param color The rectangle color.
+     * @param alpha The rectangle opacity (255=solid)
+     */
+    virtual void fillRect(const Rect& rect, colortype color, uint8_t alpha = 255);
+
+protected:
+    /**
+     * @fn static bool LCD16bppAccelerated::useBlitKernels(BlitOperations operation);
+     *
+     * @brief Queries if BlitKernels should perform the given operation.
+     *
+     *        Queries if BlitKernels should perform the given operation, which is the case
+     *        when the display is not rotated and the HAL does not support the operation.
+     *
+     * @param operation The operation.
+     *
+     * @return true if BlitKernels should be used.
+     */
+    static bool useBlitKernels(BlitOperations operation);
+
+    /**
+     * @fn static void LCD16bppAccelerated::blitCopyARGB8888(const uint32_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha);
+     *
+     * @brief Blends ARGB8888 data onto the framebuffer using BlitKernels.
+     *
+     *        Blends ARGB8888 data onto the framebuffer using BlitKernels.
+     *
+     * @param sourceData The source-array pointer (points to the beginning of the data).
+     * @param source     The location and dimension of the source.
+     * @param blitRect   A rectangle describing what region is to be drawn.
+     * @param alpha      The alpha value to use for blending.
+     */
+    static void blitCopyARGB8888(const uint32_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha);
+
+    /**
+     * @fn static void LCD16bppAccelerated::blitCopyEncoded(const uint8_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha);
+     *
+     * @brief Decodes Bitmap::ENCODED data onto the framebuffer.
+     *
+     *        Decodes Bitmap::ENCODED data onto the framebuffer, one line at a time. Only the
+     *        lines inside blitRect are read.
+     *
+     * @param sourceData The encoded data, starting with the EncodedBitmap header.
+     * @param source     The location and dimension of the source.
+     * @param blitRect   A rectangle describing what region is to be drawn.
+     * @param alpha      The alpha value to use for blending.
+     */
+    static void blitCopyEncoded(const uint8_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha);
+};
+} // namespace touchgfx
+#endif // LCD16BPPACCELERATED_HPP
@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef LCD24BPPACCELERATED_HPP
+#define LCD24BPPACCELERATED_HPP
+
+#include <platform/driver/lcd/LCD24bpp.hpp>
+#include <touchgfx/hal/BlitOp.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class LCD24bppAccelerated LCD24bppAccelerated.hpp platform/driver/lcd/LCD24bppAccelerated.hpp
+ *
+ * @brief An LCD24bpp which performs the common blit operations using BlitKernels.
+ *
+ *        An LCD24bpp which performs solid and alpha blended fills, and opaque and alpha
+ *        blended copies of RGB888 data, using BlitKernels instead of drawing one pixel at a
+ *        time. The result is identical to that of LCD24bpp.
+ *
+ *        Use it in place of LCD24bpp on platforms without a blit accelerator, or with an
+ *        accelerator which lacks some of the operations. Operations supported by the HAL
+ *        blit capabilities are still performed by the DMA, as are all operations when the
+ *        display is rotated.
+ *
+ * @see LCD24bpp
+ * @see BlitKernels
+ */
+class LCD24bppAccelerated : public LCD24bpp
+{
+public:
+
+    virtual ~LCD24bppAccelerated() {}
+
+    /**
+     * @fn virtual void LCD24bppAccelerated::drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha = 255, bool useOptimized = true);
+     *
+     * @brief Draws a portion of a bitmap.
+     *
+     *        Draws a portion of a bitmap using LCD24bpp, after reporting the draw to the
+     *        BitmapCache.
+     *
+     * @param bitmap       The bitmap to draw.
+     * @param x            The absolute x coordinate to place pixel (0, 0) on the screen.
+     * @param y            The absolute y coordinate to place pixel (0, 0) on the screen.
+     * @param rect         A rectangle describing what region of the bitmap is to be drawn.
+     * @param alpha        Optional alpha value. Default is 255 (solid).
+     * @param useOptimized if false, do not attempt to substitute (parts of) this bitmap with
+     *                     faster fillrects.
+     */
+    virtual void drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha = 255, bool useOptimized = true);
+
+    /**
+     * @fn virtual void LCD24bppAccelerated::blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+     *
+     * @brief Blits a 2D source-array to the framebuffer.
+     *
+     *        Blits a 2D source-array to the framebuffer using BlitKernels.
+     *
+     * @param sourceData           The source-array pointer (points to the beginning of the
+     *                             data). The sourceData must be stored as 24-bits RGB888
+     *                             values.
+     * @param source               The location and dimension of the source.
+     * @param blitRect             A rectangle describing what region is to be drawn.
+     * @param alpha                The alpha value to use for blending (255 = solid, no blending)
+     * @param hasTransparentPixels If true, this data copy contains transparent pixels and
+     *                             require hardware support for that to be enabled.
+     */
+    virtual void blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+
+    /**
+     * @fn virtual void LCD24bppAccelerated::blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+     *
+     * @brief Blits a 2D source-array to the framebuffer while converting the format.
+     *
+     *        Blits a 2D source-array to the framebuffer while converting the format. RGB888
+     *        data is copied using BlitKernels.
+     *
+     * @param sourceData           The source-array pointer (points to the beginning of the
+     *                             data). The sourceData must be stored in a format suitable for
+     *                             the selected display.
+     * @param sourceFormat         The bitmap format used in the source data.
+     * @param source               The location and dimension of the source.
+     * @param blitRect             A rectangle describing what region is to be drawn.
+     * @param alpha                The alpha value to use for blending (255 = solid, no blending)
+     * @param hasTransparentPixels If true, this data copy contains transparent pixels and
+     *                             require hardware support for that to be enabled.
+     */
+    virtual void blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+
+    /**
+     * @fn virtual void LCD24bppAccelerated::fillRect(const Rect& rect, colortype color, uint8_t alpha = 255);
+     *
+     * @brief Draws a filled rectangle in the specified color.
+     *
+     *        Draws a filled rectangle in the specified color using BlitKernels.
+     *
+     * @param rect  The rectangle to draw in absolute coordinates.
+     * @param color The rectangle color.
+     * @param alpha The rectangle opacity (255=solid)
+     */
+    virtual void fillRect(const Rect& rect, colortype color, uint8_t alpha = 255);
+
+protected:
+    /**
+     * @fn static bool LCD24bppAccelerated::useBlitKernels(BlitOperations operation);
+     *
+     * @brief Queries if BlitKernels should perform the given operation.
+     *
+     *        Queries if BlitKernels should perform the given operation, which is the case
+     *        when the display is not rotated and the HAL does not support the operation.
+     *
+     * @param operation The operation.
+     *
+     * @return true if BlitKernels should be used.
+     */
+    static bool useBlitKernels(BlitOperations operation);
+
+    /**
+     * @fn static void LCD24bppAccelerated::blitCopyRGB888(const uint8_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha);
+     *
+     * @brief Copies RGB888 data to the framebuffer using BlitKernels.
+     *
+     *        Copies RGB888 data to the framebuffer using BlitKernels.
+     *
+     * @param sourceData The source-array pointer (points to the beginning of the data).
+     * @param source     The location and dimension of the source.
+     * @param blitRect   A rectangle describing what region is to be drawn.
+     * @param alpha      The alpha value to use for blending.
+     */
+    static void blitCopyRGB888(const uint8_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha);
+};
+} // namespace touchgfx
+#endif // LCD24BPPACCELERATED_HPP
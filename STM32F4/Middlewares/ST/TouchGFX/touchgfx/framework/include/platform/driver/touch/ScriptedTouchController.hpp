@@ -0,0 +1,148 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCRIPTEDTOUCHCONTROLLER_HPP
+#define SCRIPTEDTOUCHCONTROLLER_HPP
+
+#include <platform/driver/touch/TouchController.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class ScriptedTouchController ScriptedTouchController.hpp platform/driver/touch/ScriptedTouchController.hpp
+ *
+ * @brief TouchController reporting touches given by the application.
+ *
+ *        TouchController reporting touches given by the application instead of a touch
+ *        panel, e.g. the steps of a test script. The display is touched at the given
+ *        position from press() until release(), and the HAL turns this into click and drag
+ *        events like for a real touch panel. Until press() is called, it behaves like
+ *        NoTouchController.
+ *
+ * @see NoTouchController
+ */
+class ScriptedTouchController : public TouchController
+{
+public:
+
+    /**
+     * @fn ScriptedTouchController::ScriptedTouchController()
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor. The display is not touched.
+     */
+    ScriptedTouchController()
+        : touched(false),
+          touchX(0),
+          touchY(0)
+    {
+    }
+
+    /**
+     * @fn virtual ScriptedTouchController::~ScriptedTouchController()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor.
+     */
+    virtual ~ScriptedTouchController()
+    {
+    }
+
+    /**
+     * @fn virtual void ScriptedTouchController::init()
+     *
+     * @brief Empty initialization.
+     *
+     *        Empty initialization.
+     */
+    virtual void init()
+    {
+    }
+
+    /**
+     * @fn void ScriptedTouchController::press(int32_t x, int32_t y)
+     *
+     * @brief Touches the display.
+     *
+     *        Touches the display at the given position, or moves the touch there if the
+     *        display is already touched.
+     *
+     * @param x The x coordinate in pixels.
+     * @param y The y coordinate in pixels.
+     */
+    void press(int32_t x, int32_t y)
+    {
+        touched = true;
+        touchX = x;
+        touchY = y;
+    }
+
+    /**
+     * @fn void ScriptedTouchController::release()
+     *
+     * @brief Stops touching the display.
+     *
+     *        Stops touching the display.
+     */
+    void release()
+    {
+        touched = false;
+    }
+
+    /**
+     * @fn bool ScriptedTouchController::isTouched() const
+     *
+     * @brief Query if the display is touched.
+     *
+     *        Query if the display is touched.
+     *
+     * @return true if the display is touched.
+     */
+    bool isTouched() const
+    {
+        return touched;
+    }
+
+    /**
+     * @fn virtual bool ScriptedTouchController::sampleTouch(int32_t& x, int32_t& y)
+     *
+     * @brief Reports the current touch.
+     *
+     *        Reports the current touch, if any.
+     *
+     * @param [out] x The x coordinate of the touch.
+     * @param [out] y The y coordinate of the touch.
+     *
+     * @return true if the display is touched.
+     */
+    virtual bool sampleTouch(int32_t& x, int32_t& y)
+    {
+        if (touched)
+        {
+            x = touchX;
+            y = touchY;
+        }
+        return touched;
+    }
+
+private:
+    bool touched;
+    int32_t touchX;
+    int32_t touchY;
+};
+
+} // namespace touchgfx
+
+#endif // SCRIPTEDTOUCHCONTROLLER_HPP
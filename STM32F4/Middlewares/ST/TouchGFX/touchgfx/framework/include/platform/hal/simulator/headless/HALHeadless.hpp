@@ -0,0 +1,422 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef HALHEADLESS_HPP
+#define HALHEADLESS_HPP
+
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/hal/RenderWorkers.hpp>
+#include <touchgfx/Callback.hpp>
+#include <platform/driver/touch/TouchController.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+
+namespace touchgfx
+{
+/**
+ * @struct FrameStatistics HALHeadless.hpp platform/hal/simulator/headless/HALHeadless.hpp
+ *
+ * @brief Measurements collected by HALHeadless for a single frame.
+ *
+ *        Measurements collected by HALHeadless for a single frame, i.e. from beginFrame() to
+ *        endFrame() of one simulated vsync.
+ */
+struct FrameStatistics
+{
+    uint32_t frameNumber;   ///< Number of the frame, starting at 0 after the last resetFrameCounter().
+    uint32_t frameTimeUS;   ///< Wall clock time spent between beginFrame() and endFrame() in microseconds.
+    uint32_t pixelsFlushed; ///< Total area of the rectangles passed to flushFrameBuffer() during the frame.
+    uint16_t rectsFlushed;  ///< Number of rectangles passed to flushFrameBuffer() during the frame.
+    bool     rendered;      ///< True if beginFrame() allowed rendering in this frame.
+};
+
+/**
+ * @class HALHeadless HALHeadless.hpp platform/hal/simulator/headless/HALHeadless.hpp
+ *
+ * @brief HAL implementation for running TouchGFX on a host without any display.
+ *
+ *        HAL implementation for running TouchGFX on a host without any display. Rendering is
+ *        done into frame buffers in RAM exactly as on target, but vsync is simulated by
+ *        simply advancing the frame as fast as possible. This makes the HAL suitable for
+ *        automated benchmarks and regression tests on build servers, where no window system
+ *        is available.
+ *
+ *        After each frame the registered frame callback (if any) is invoked with the
+ *        statistics collected for the frame. Frames and DMA waits are recorded by the
+ *        RenderProfiler instance, if any. While RenderWorkers are drawing, the DMA is not
+ *        used, so the workers can draw in parallel.
+ *
+ * @see HAL
+ */
+class HALHeadless : public HAL
+{
+public:
+
+    /**
+     * @fn HALHeadless::HALHeadless(DMA_Interface& dma, LCD& lcd, TouchController& touchCtrl, uint16_t width, uint16_t height)
+     *
+     * @brief Constructor. Initializes members.
+     *
+     *        Constructor. Initializes members.
+     *
+     * @param [in] dma       Reference to DMA interface.
+     * @param [in] lcd       Reference to the LCD.
+     * @param [in] touchCtrl Reference to Touch Controller driver.
+     * @param width          Width of the display.
+     * @param height         Height of the display.
+     */
+    HALHeadless(DMA_Interface& dma, LCD& lcd, TouchController& touchCtrl, uint16_t width, uint16_t height) :
+        HAL(dma, lcd, touchCtrl, width, height),
+        tft(0),
+        frameCallback(0),
+        flushCallback(0),
+        frameCounter(0),
+        frameStartUS(0),
+        ticksLeft(0),
+        running(false)
+    {
+        currentFrame.frameNumber = 0;
+        currentFrame.frameTimeUS = 0;
+        currentFrame.pixelsFlushed = 0;
+        currentFrame.rectsFlushed = 0;
+        currentFrame.rendered = false;
+    }
+
+    /**
+     * @fn void HALHeadless::init();
+     *
+     * @brief Initializes the HAL.
+     *
+     *        Allocates frame buffers (including double buffer and animation storage) matching
+     *        the bit depth of the LCD and initializes the LCD. Must be called once before
+     *        taskEntry(), like HALSDL2::sdl_init() for the interactive simulator.
+     */
+    void init();
+
+    /**
+     * @fn virtual void HALHeadless::taskEntry();
+     *
+     * @brief Main event loop.
+     *
+     *        Main event loop. Simulates vsync signals back to back until the number of ticks
+     *        given to setTickLimit() has been processed, or until stop() is called.
+     *
+     * @note Unlike on target, this function returns when the tick limit is reached.
+     */
+    virtual void taskEntry();
+
+    /**
+     * @fn void HALHeadless::simulateVSync();
+     *
+     * @brief Process exactly one frame.
+     *
+     *        Process exactly one frame by simulating a vsync followed by the back and front
+     *        porch signals that drive TouchGFX on target.
+     */
+    void simulateVSync();
+
+    /**
+     * @fn void HALHeadless::setTickLimit(uint32_t ticks)
+     *
+     * @brief Sets the number of frames processed by taskEntry().
+     *
+     *        Sets the number of frames processed by taskEntry() before it returns.
+     *
+     * @param ticks The number of ticks. Zero means run until stop() is called.
+     */
+    void setTickLimit(uint32_t ticks)
+    {
+        ticksLeft = ticks;
+    }
+
+    /**
+     * @fn void HALHeadless::stop()
+     *
+     * @brief Stops the main event loop.
+     *
+     *        Stops the main event loop, taskEntry() will return after the current frame.
+     */
+    void stop()
+    {
+        running = false;
+    }
+
+    /**
+     * @fn void HALHeadless::setFrameCallback(GenericCallback<const FrameStatistics&>& callback)
+     *
+     * @brief Sets a callback to be invoked when a frame has been rendered.
+     *
+     *        Sets a callback to be invoked from endFrame() with the statistics of the frame.
+     *
+     * @param [in] callback The callback.
+     */
+    void setFrameCallback(GenericCallback<const FrameStatistics&>& callback)
+    {
+        frameCallback = &callback;
+    }
+
+    /**
+     * @fn void HALHeadless::setFlushCallback(GenericCallback<const Rect&>& callback)
+     *
+     * @brief Sets a callback to be invoked when an area has been drawn.
+     *
+     *        Sets a callback to be invoked from flushFrameBuffer() with the area drawn, e.g.
+     *        for checking the pixels drawn in each frame. The pixels may still be written by
+     *        the DMA, so lock the frame buffer before reading them.
+     *
+     * @param [in] callback The callback.
+     */
+    void setFlushCallback(GenericCallback<const Rect&>& callback)
+    {
+        flushCallback = &callback;
+    }
+
+    /**
+     * @fn const FrameStatistics& HALHeadless::getFrameStatistics() const
+     *
+     * @brief Gets the statistics of the most recent frame.
+     *
+     *        Gets the statistics of the most recent frame.
+     *
+     * @return The frame statistics.
+     */
+    const FrameStatistics& getFrameStatistics() const
+    {
+        return currentFrame;
+    }
+
+    /**
+     * @fn void HALHeadless::resetFrameCounter()
+     *
+     * @brief Resets the frame counter.
+     *
+     *        Resets the frame counter reported in FrameStatistics::frameNumber.
+     */
+    void resetFrameCounter()
+    {
+        frameCounter = 0;
+    }
+
+    /**
+     * @fn const uint16_t* HALHeadless::getDisplayFrameBuffer() const
+     *
+     * @brief Gets the frame buffer currently being "displayed".
+     *
+     *        Gets the frame buffer currently being "displayed", i.e. the frame buffer that
+     *        would be scanned out by the TFT controller on target.
+     *
+     * @return The frame buffer.
+     */
+    const uint16_t* getDisplayFrameBuffer() const
+    {
+        return tft;
+    }
+
+    /**
+     * @fn static uint32_t HALHeadless::getMicroseconds();
+     *
+     * @brief Gets a monotonic time stamp.
+     *
+     *        Gets a monotonic time stamp in microseconds. The value wraps around after
+     *        approximately 71 minutes, so only use it for measuring time differences.
+     *
+     * @return The time stamp.
+     */
+    static uint32_t getMicroseconds();
+
+    /**
+     * @fn virtual void HALHeadless::flushFrameBuffer();
+     *
+     * @brief This function is called whenever the framework has performed a complete draw.
+     *
+     *        This function is called whenever the framework has performed a complete draw.
+     */
+    virtual void flushFrameBuffer();
+
+    /**
+     * @fn virtual void HALHeadless::flushFrameBuffer(const Rect& rect);
+     *
+     * @brief This function is called whenever the framework has performed a partial draw.
+     *
+     *        This function is called whenever the framework has performed a partial draw.
+     *        The area is added to the statistics of the current frame and passed to the
+     *        flush callback, if any.
+     *
+     * @param rect The area of the screen that has been drawn, expressed in absolute coordinates.
+     */
+    virtual void flushFrameBuffer(const Rect& rect);
+
+    /**
+     * @fn virtual bool HALHeadless::blockCopy(void* RESTRICT dest, const void* RESTRICT src, uint32_t numBytes);
+     *
+     * @brief This function performs a platform-specific memcpy.
+     *
+     *        This function performs a platform-specific memcpy, if supported by the hardware.
+     *
+     * @param [out] dest Pointer to destination memory.
+     * @param src        Pointer to source memory.
+     * @param numBytes   Number of bytes to copy.
+     *
+     * @return true if the copy succeeded, false if copy was not performed.
+     */
+    virtual bool blockCopy(void* RESTRICT dest, const void* RESTRICT src, uint32_t numBytes);
+
+    /**
+     * @fn virtual void HALHeadless::blitSetTransparencyKey(uint16_t key);
+     *
+     * @brief If Blit-operations are supported, transparency-keying support is implicitly assumed.
+     *
+     *        If Blit-operations are supported, transparency-keying support is implicitly
+     *        assumed.
+     *
+     * @param key The "transparent" color value.
+     */
+    virtual void blitSetTransparencyKey(uint16_t key);
+
+    /**
+     * @fn virtual BlitOperations HALHeadless::getBlitCaps()
+     *
+     * @brief Gets the blit capabilities.
+     *
+     *        Gets the blit capabilities of the DMA, or no capabilities while RenderWorkers are
+     *        drawing, since the DMA queue can only be used by one task.
+     *
+     * @return The blit capabilities.
+     */
+    virtual BlitOperations getBlitCaps()
+    {
+        return RenderWorkers::isDrawing() ? static_cast<BlitOperations>(0) : HAL::getBlitCaps();
+    }
+
+    /**
+     * @fn virtual void HALHeadless::flushDMA();
+     *
+     * @brief Waits for all DMA operations to complete.
+     *
+     *        Waits for all DMA operations to complete, recording the wait in the
+     *        RenderProfiler instance, if any.
+     */
+    virtual void flushDMA();
+
+protected:
+
+    /**
+     * @fn virtual uint16_t* HALHeadless::getTFTFrameBuffer() const;
+     *
+     * @brief Gets TFT frame buffer.
+     *
+     *        Gets TFT frame buffer.
+     *
+     * @return null if it fails, else the TFT frame buffer.
+     */
+    virtual uint16_t* getTFTFrameBuffer() const;
+
+    /**
+     * @fn virtual void HALHeadless::setTFTFrameBuffer(uint16_t* addr);
+     *
+     * @brief Sets TFT frame buffer.
+     *
+     *        Sets TFT frame buffer.
+     *
+     * @param [in] addr The address of the TFT frame buffer.
+     */
+    virtual void setTFTFrameBuffer(uint16_t* addr);
+
+    /**
+     * @fn virtual bool HALHeadless::beginFrame();
+     *
+     * @brief Called when beginning to rendering a frame.
+     *
+     *        Called when beginning to rendering a frame. Starts the measurement of the frame,
+     *        and the frame of the RenderProfiler instance, if any.
+     *
+     * @return true if rendering can begin, false otherwise.
+     */
+    virtual bool beginFrame();
+
+    /**
+     * @fn virtual void HALHeadless::endFrame();
+     *
+     * @brief Called when a rendering pass is completed.
+     *
+     *        Called when a rendering pass is completed. Ends the measurement of the frame and
+     *        reports it to the frame callback and the RenderProfiler instance, if any.
+     */
+    virtual void endFrame();
+
+    /**
+     * @fn virtual void HALHeadless::disableInterrupts()
+     *
+     * @brief Disables the DMA and LCD interrupts.
+     *
+     *        Disables the DMA and LCD interrupts.
+     */
+    virtual void disableInterrupts()
+    {
+    }
+
+    /**
+     * @fn virtual void HALHeadless::enableInterrupts()
+     *
+     * @brief Enables the DMA and LCD interrupts.
+     *
+     *        Enables the DMA and LCD interrupts.
+     */
+    virtual void enableInterrupts()
+    {
+    }
+
+    /**
+     * @fn virtual void HALHeadless::configureLCDInterrupt()
+     *
+     * @brief Configures LCD interrupt.
+     *
+     *        Configures LCD interrupt.
+     */
+    virtual void configureLCDInterrupt()
+    {
+    }
+
+    /**
+     * @fn virtual void HALHeadless::enableLCDControllerInterrupt()
+     *
+     * @brief Enables the LCD interrupt.
+     *
+     *        Enables the LCD interrupt.
+     */
+    virtual void enableLCDControllerInterrupt()
+    {
+    }
+
+    /**
+     * @fn virtual void HALHeadless::configureInterrupts()
+     *
+     * @brief Configures the interrupts relevant for TouchGFX.
+     *
+     *        Configures the interrupts relevant for TouchGFX.
+     */
+    virtual void configureInterrupts()
+    {
+    }
+
+    uint16_t* tft;                                     ///< The frame buffer currently being displayed.
+    GenericCallback<const FrameStatistics&>* frameCallback; ///< Callback invoked at the end of each frame.
+    GenericCallback<const Rect&>* flushCallback;       ///< Callback invoked with every area flushed.
+    FrameStatistics currentFrame;                      ///< Statistics for the frame currently being rendered.
+    uint32_t frameCounter;                             ///< Number of frames rendered.
+    uint32_t frameStartUS;                             ///< Time stamp of beginFrame().
+    uint32_t ticksLeft;                                ///< Number of ticks left before taskEntry() returns.
+    bool running;                                      ///< True while taskEntry() is running.
+};
+} // namespace touchgfx
+
+#endif // HALHEADLESS_HPP
@@ -0,0 +1,327 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef HEADLESSDMA_HPP
+#define HEADLESSDMA_HPP
+
+#include <touchgfx/hal/DMA.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class HeadlessDMA HeadlessDMA.hpp platform/hal/simulator/headless/HeadlessDMA.hpp
+ *
+ * @brief A DMA implementation that performs the blit operations in software.
+ *
+ *        A DMA implementation that performs the blit operations in software, synchronously,
+ *        as soon as they are started. This makes it possible to exercise the blit paths of
+ *        the framework (which are normally only used on targets with a hardware graphics
+ *        accelerator) when running on a host, and to count the number of operations issued.
+ *
+ *        Only 16bpp (RGB565) frame buffers are supported. The supported operations can be
+ *        limited using setBlitCaps(), setting the caps to zero makes the framework fall back
+ *        to software rendering for everything, just like NoDMA.
+ *
+ *        The operations are queued in a CoalescingDMA_Queue. Since every operation is
+ *        completed before the next is queued, nothing is merged unless the transfers are
+ *        deferred using setDeferredTransfers(). Deferred transfers behave like a DMA which is
+ *        much slower than the CPU: they are performed when the CPU locks the frame buffer,
+ *        when the DMA is flushed, or when the queue is full.
+ *
+ *        Copying pixels in software costs next to nothing per operation, unlike a hardware
+ *        accelerator which must be set up, started and interrupt the CPU for every transfer.
+ *        That fixed cost can be modeled using setOperationSetupTime().
+ *
+ * @see DMA_Interface
+ */
+class HeadlessDMA : public DMA_Interface
+{
+public:
+
+    /**
+     * @fn HeadlessDMA::HeadlessDMA();
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor. All operations supported by the software implementation
+     *        are enabled.
+     */
+    HeadlessDMA();
+
+    /**
+     * @fn virtual HeadlessDMA::~HeadlessDMA()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor.
+     */
+    virtual ~HeadlessDMA()
+    {
+        if (instance == this)
+        {
+            instance = 0;
+        }
+    }
+
+    /**
+     * @fn virtual BlitOperations HeadlessDMA::getBlitCaps()
+     *
+     * @brief Gets the blit capabilities.
+     *
+     *        Gets the blit capabilities as set by setBlitCaps().
+     *
+     * @return Currently supported blitcaps.
+     */
+    virtual BlitOperations getBlitCaps()
+    {
+        return blitCaps;
+    }
+
+    /**
+     * @fn void HeadlessDMA::setBlitCaps(uint32_t caps)
+     *
+     * @brief Sets the blit capabilities.
+     *
+     *        Sets the blit capabilities reported to the framework. Only operations also
+     *        supported by the software implementation are enabled.
+     *
+     * @param caps The blit capabilities (a combination of BlitOperations).
+     */
+    void setBlitCaps(uint32_t caps)
+    {
+        blitCaps = static_cast<BlitOperations>(caps & SUPPORTED_BLIT_CAPS);
+    }
+
+    /**
+     * @fn virtual void HeadlessDMA::signalDMAInterrupt()
+     *
+     * @brief Does nothing.
+     *
+     *        Does nothing, operations are completed as soon as they are started.
+     */
+    virtual void signalDMAInterrupt()
+    {
+    }
+
+    /**
+     * @fn virtual void HeadlessDMA::addToQueue(const BlitOp& op);
+     *
+     * @brief Inserts a BlitOp for processing.
+     *
+     *        Inserts a BlitOp for processing. If the queue is full, deferred transfers are
+     *        performed to make room, since there is no DMA interrupt to do it.
+     *
+     * @param op The operation to add.
+     */
+    virtual void addToQueue(const BlitOp& op);
+
+    /**
+     * @fn virtual void HeadlessDMA::flush();
+     *
+     * @brief Performs all deferred transfers.
+     *
+     *        Performs all deferred transfers.
+     */
+    virtual void flush();
+
+    /**
+     * @fn void HeadlessDMA::setDeferredTransfers(bool deferred);
+     *
+     * @brief Sets whether transfers are deferred.
+     *
+     *        Sets whether transfers are deferred until the CPU needs the frame buffer, so
+     *        operations pile up in the queue like they would for a busy DMA. When switching
+     *        deferring off, the deferred transfers are performed.
+     *
+     * @param deferred true to defer the transfers.
+     */
+    void setDeferredTransfers(bool deferred);
+
+    /**
+     * @fn void HeadlessDMA::setMergingEnabled(bool enabled)
+     *
+     * @brief Enables or disables merging of queued operations.
+     *
+     *        Enables or disables merging of queued operations. Merging is disabled by default.
+     *
+     * @param enabled true to merge operations.
+     *
+     * @see CoalescingDMA_Queue::setMergingEnabled
+     */
+    void setMergingEnabled(bool enabled)
+    {
+        dmaQueue.setMergingEnabled(enabled);
+    }
+
+    /**
+     * @fn void HeadlessDMA::setOperationSetupTime(uint32_t nanoseconds)
+     *
+     * @brief Sets the fixed time each operation takes before any pixel is written.
+     *
+     *        Sets the fixed time each operation takes before any pixel is written, like the
+     *        register setup, start latency and completion interrupt of a hardware DMA. The
+     *        time is spent waiting, so it is part of the busy time and delays the CPU when
+     *        it waits for the DMA. The default is zero.
+     *
+     * @param nanoseconds The setup time of each operation in nanoseconds.
+     */
+    void setOperationSetupTime(uint32_t nanoseconds)
+    {
+        operationSetupTime = nanoseconds;
+    }
+
+    /**
+     * @fn static void HeadlessDMA::finishDeferredTransfers();
+     *
+     * @brief Performs the deferred transfers of the HeadlessDMA.
+     *
+     *        Performs the deferred transfers of the most recently constructed HeadlessDMA,
+     *        if any. Called when the frame buffer semaphore is taken, which the DMA holds
+     *        while transfers are pending.
+     */
+    static void finishDeferredTransfers();
+
+    /**
+     * @fn uint32_t HeadlessDMA::getNumberOfOperations() const
+     *
+     * @brief Gets the number of operations performed.
+     *
+     *        Gets the number of operations performed since the last call to
+     *        resetStatistics().
+     *
+     * @return The number of operations.
+     */
+    uint32_t getNumberOfOperations() const
+    {
+        return numberOfOperations;
+    }
+
+    /**
+     * @fn uint32_t HeadlessDMA::getNumberOfPixels() const
+     *
+     * @brief Gets the number of pixels written.
+     *
+     *        Gets the number of pixels written by the operations performed since the last
+     *        call to resetStatistics().
+     *
+     * @return The number of pixels.
+     */
+    uint32_t getNumberOfPixels() const
+    {
+        return numberOfPixels;
+    }
+
+    /**
+     * @fn void HeadlessDMA::resetStatistics()
+     *
+     * @brief Resets the operation and pixel counters.
+     *
+     *        Resets the operation and pixel counters, and the DMA_Statistics. The busy time
+     *        of the DMA_Statistics is measured in nanoseconds.
+     */
+    void resetStatistics()
+    {
+        DMA_Interface::resetStatistics();
+        numberOfOperations = 0;
+        numberOfPixels = 0;
+    }
+
+    static const uint32_t SUPPORTED_BLIT_CAPS = BLIT_OP_COPY | BLIT_OP_FILL | BLIT_OP_COPY_WITH_ALPHA | BLIT_OP_FILL_WITH_ALPHA | BLIT_OP_COPY_ARGB8888 | BLIT_OP_COPY_ARGB8888_WITH_ALPHA | BLIT_OP_COPY_A4 | BLIT_OP_COPY_A8; ///< The operations implemented in software
+
+protected:
+
+    /**
+     * @fn virtual void HeadlessDMA::setupDataCopy(const BlitOp& blitOp);
+     *
+     * @brief Starts a copy operation.
+     *
+     *        Starts a copy operation, which is performed immediately unless transfers are
+     *        deferred.
+     *
+     * @param blitOp The blit operation to be performed by this DMA instance.
+     */
+    virtual void setupDataCopy(const BlitOp& blitOp);
+
+    /**
+     * @fn virtual void HeadlessDMA::setupDataFill(const BlitOp& blitOp);
+     *
+     * @brief Starts a fill operation.
+     *
+     *        Starts a fill operation, which is performed immediately unless transfers are
+     *        deferred.
+     *
+     * @param blitOp The blit operation to be performed by this DMA instance.
+     */
+    virtual void setupDataFill(const BlitOp& blitOp);
+
+    /**
+     * @fn virtual void HeadlessDMA::enableAlpha(uint8_t alpha)
+     *
+     * @brief Does nothing.
+     *
+     *        Does nothing, the alpha is read directly from the BlitOp.
+     *
+     * @param alpha The alpha.
+     */
+    virtual void enableAlpha(uint8_t alpha)
+    {
+    }
+
+    /**
+     * @fn virtual void HeadlessDMA::disableAlpha()
+     *
+     * @brief Does nothing.
+     *
+     *        Does nothing, the alpha is read directly from the BlitOp.
+     */
+    virtual void disableAlpha()
+    {
+    }
+
+    /**
+     * @fn virtual void HeadlessDMA::enableCopyWithTransparentPixels(uint8_t alpha)
+     *
+     * @brief Does nothing.
+     *
+     *        Does nothing, the alpha is read directly from the BlitOp.
+     *
+     * @param alpha The alpha.
+     */
+    virtual void enableCopyWithTransparentPixels(uint8_t alpha)
+    {
+    }
+
+private:
+    static const int QUEUE_SIZE = 16;
+
+    void startTransfer(const BlitOp& blitOp);
+    void finishTransfer();
+    void finishTransfers();
+    void copy(const BlitOp& blitOp);
+    void fill(const BlitOp& blitOp);
+
+    static HeadlessDMA* instance;
+
+    CoalescingDMA_Queue dmaQueue;
+    BlitOp              queueStorage[QUEUE_SIZE];
+    BlitOperations      blitCaps;
+    BlitOp              transfer;
+    bool                transferPending;
+    bool                deferTransfers;
+    uint32_t            operationSetupTime;
+    uint32_t            numberOfOperations;
+    uint32_t            numberOfPixels;
+};
+} // namespace touchgfx
+
+#endif // HEADLESSDMA_HPP
@@ -0,0 +1,86 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef HEADLESSINSTRUMENTATION_HPP
+#define HEADLESSINSTRUMENTATION_HPP
+
+#include <platform/core/MCUInstrumentation.hpp>
+#include <time.h>
+
+namespace touchgfx
+{
+/**
+ * @class HeadlessInstrumentation HeadlessInstrumentation.hpp platform/hal/simulator/headless/HeadlessInstrumentation.hpp
+ *
+ * @brief MCU instrumentation for running on a host.
+ *
+ *        MCU instrumentation for running on a host. There is no cycle counter to read, so
+ *        the monotonic clock of the host is used instead, counting CLOCK_FREQUENCY "cycles"
+ *        per microsecond.
+ *
+ * @see RenderProfiler
+ */
+class HeadlessInstrumentation : public MCUInstrumentation
+{
+public:
+    static const unsigned int CLOCK_FREQUENCY = 100; ///< The frequency of the cycles in MHz, i.e. 10 ns per cycle.
+
+    /**
+     * @fn virtual void HeadlessInstrumentation::init()
+     *
+     * @brief Initialize.
+     *
+     *        Initialize. Nothing to do on a host.
+     */
+    virtual void init()
+    {
+    }
+
+    /**
+     * @fn virtual unsigned int HeadlessInstrumentation::getElapsedUS(unsigned int start, unsigned int now, unsigned int clockfrequency)
+     *
+     * @brief Gets elapsed microseconds based on clock frequency.
+     *
+     *        Gets elapsed microseconds based on clock frequency.
+     *
+     * @param start          Start time.
+     * @param now            Current time.
+     * @param clockfrequency Clock frequency of the system expressed in MHz.
+     *
+     * @return Elapsed microseconds start and now.
+     */
+    virtual unsigned int getElapsedUS(unsigned int start, unsigned int now, unsigned int clockfrequency)
+    {
+        return (now - start) / clockfrequency;
+    }
+
+    /**
+     * @fn virtual unsigned int HeadlessInstrumentation::getCPUCycles(void)
+     *
+     * @brief Gets the time of the host clock.
+     *
+     *        Gets the time of the host clock in units of 1 / CLOCK_FREQUENCY microseconds.
+     *        The value wraps around after approximately 43 seconds.
+     *
+     * @return The time stamp.
+     */
+    virtual unsigned int getCPUCycles(void)
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<unsigned int>(now.tv_sec * (1000000ULL * CLOCK_FREQUENCY) + now.tv_nsec / (1000 / CLOCK_FREQUENCY));
+    }
+};
+} // namespace touchgfx
+
+#endif // HEADLESSINSTRUMENTATION_HPP
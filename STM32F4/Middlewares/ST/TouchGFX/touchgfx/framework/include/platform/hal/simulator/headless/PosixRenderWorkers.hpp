@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef POSIXRENDERWORKERS_HPP
+#define POSIXRENDERWORKERS_HPP
+
+#include <touchgfx/hal/RenderWorkers.hpp>
+#include <pthread.h>
+
+namespace touchgfx
+{
+/**
+ * @class PosixRenderWorkers PosixRenderWorkers.hpp platform/hal/simulator/headless/PosixRenderWorkers.hpp
+ *
+ * @brief Render workers running on POSIX threads.
+ *
+ *        Render workers running on POSIX threads, for drawing in parallel on a host. The
+ *        calling task is worker 0, and a thread is started for each of the other workers.
+ *        The threads wait on a condition variable between jobs.
+ *
+ * @see RenderWorkers
+ */
+class PosixRenderWorkers : public RenderWorkers
+{
+public:
+
+    /**
+     * @fn PosixRenderWorkers::PosixRenderWorkers(uint8_t numberOfWorkers);
+     *
+     * @brief Constructor.
+     *
+     *        Constructor. Starts the threads of the workers.
+     *
+     * @param numberOfWorkers The number of workers including the calling task, at most
+     *                        MAX_WORKERS.
+     */
+    explicit PosixRenderWorkers(uint8_t numberOfWorkers);
+
+    /**
+     * @fn virtual PosixRenderWorkers::~PosixRenderWorkers();
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Stops the threads of the workers.
+     */
+    virtual ~PosixRenderWorkers();
+
+    /**
+     * @fn virtual uint8_t PosixRenderWorkers::getNumberOfWorkers() const
+     *
+     * @brief Gets the number of workers.
+     *
+     *        Gets the number of workers, including the calling task.
+     *
+     * @return The number of workers.
+     */
+    virtual uint8_t getNumberOfWorkers() const
+    {
+        return numberOfWorkers;
+    }
+
+protected:
+
+    /**
+     * @fn virtual void PosixRenderWorkers::runJob(GenericCallback<uint8_t>& job);
+     *
+     * @brief Runs a job on all workers.
+     *
+     *        Wakes up the threads, runs the job as worker 0 and waits for the threads to
+     *        finish the job.
+     *
+     * @param [in] job The job.
+     */
+    virtual void runJob(GenericCallback<uint8_t>& job);
+
+    /**
+     * @fn virtual uint8_t PosixRenderWorkers::getWorkerIndex() const;
+     *
+     * @brief Gets the index of the calling worker.
+     *
+     *        Gets the index of the calling worker, stored in thread specific data.
+     *
+     * @return The index of the worker.
+     */
+    virtual uint8_t getWorkerIndex() const;
+
+    /**
+     * @fn virtual void PosixRenderWorkers::lock(uint8_t index);
+     *
+     * @brief Takes a lock.
+     *
+     *        Takes a lock.
+     *
+     * @param index The index of the lock.
+     */
+    virtual void lock(uint8_t index);
+
+    /**
+     * @fn virtual void PosixRenderWorkers::unlock(uint8_t index);
+     *
+     * @brief Releases a lock.
+     *
+     *        Releases a lock.
+     *
+     * @param index The index of the lock.
+     */
+    virtual void unlock(uint8_t index);
+
+private:
+    struct Worker
+    {
+        PosixRenderWorkers* workers; ///< The pool.
+        uint8_t index;               ///< The index of the worker.
+        pthread_t thread;            ///< The thread.
+    };
+
+    static void* threadEntry(void* argument);
+    void workerLoop(uint8_t index);
+
+    uint8_t numberOfWorkers;
+    Worker workerThreads[MAX_WORKERS];
+    pthread_key_t workerKey;
+    pthread_mutex_t mutex;
+    pthread_cond_t jobStarted;
+    pthread_cond_t jobFinished;
+    pthread_mutex_t locks[NUMBER_OF_LOCKS];
+    GenericCallback<uint8_t>* currentJob;
+    uint32_t generation;
+    uint8_t busyWorkers;
+    bool stopping;
+};
+} // namespace touchgfx
+
+#endif // POSIXRENDERWORKERS_HPP
@@ -0,0 +1,258 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef ANIMATIONSCHEDULER_HPP
+#define ANIMATIONSCHEDULER_HPP
+
+#include <touchgfx/hal/Types.hpp>
+#include <touchgfx/Callback.hpp>
+
+namespace touchgfx
+{
+class AnimationScheduler;
+
+/**
+ * @class Animation AnimationScheduler.hpp touchgfx/AnimationScheduler.hpp
+ *
+ * @brief An animation advanced every tick by the AnimationScheduler.
+ *
+ *        An animation advanced every tick by the AnimationScheduler while it is scheduled.
+ *        The animation is a node of the list of scheduled animations, so any number of
+ *        animations can be scheduled without a fixed size table. The animation is
+ *        unscheduled when it is destroyed.
+ *
+ * @see AnimationScheduler
+ */
+class Animation
+{
+public:
+
+    /**
+     * @fn Animation::Animation(GenericCallback<>& tickCallback)
+     *
+     * @brief Constructor.
+     *
+     *        Constructor.
+     *
+     * @param [in] tickCallback The callback advancing the animation one step. It may
+     *                          unschedule the animation, or schedule other animations.
+     */
+    Animation(GenericCallback<>& tickCallback)
+        : tickCallback(tickCallback),
+          scheduler(0),
+          previous(0),
+          next(0),
+          removed(false)
+    {
+    }
+
+    /**
+     * @fn Animation::~Animation()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Unschedules the animation.
+     */
+    ~Animation();
+
+    /**
+     * @fn bool Animation::isScheduled() const
+     *
+     * @brief Query if the animation is scheduled.
+     *
+     *        Query if the animation is scheduled.
+     *
+     * @return true if the animation receives ticks.
+     */
+    bool isScheduled() const
+    {
+        return scheduler != 0 && !removed;
+    }
+
+    /**
+     * @fn void Animation::unschedule();
+     *
+     * @brief Stops the animation from receiving ticks.
+     *
+     *        Stops the animation from receiving ticks, if it is scheduled.
+     */
+    void unschedule();
+
+private:
+    friend class AnimationScheduler;
+
+    GenericCallback<>& tickCallback;
+    AnimationScheduler* scheduler;
+    Animation* previous;
+    Animation* next;
+    bool removed;
+};
+
+/**
+ * @class AnimationScheduler AnimationScheduler.hpp touchgfx/AnimationScheduler.hpp
+ *
+ * @brief Advances all running animations in one pass every tick.
+ *
+ *        Advances all running animations in one pass every tick. Unlike timer widgets, which
+ *        are limited to Application::MAX_TIMER_WIDGETS, the scheduled animations are kept in
+ *        an intrusive list, so there is no limit on the number of animations, and scheduling
+ *        and unscheduling an animation takes constant time.
+ *
+ *        AcceleratedMVPApplication registers its scheduler as the instance, ticks it whenever
+ *        it ticks the timer widgets, i.e. not during screen transitions, and clears it when
+ *        the screen is changed, like the timer widgets. ScheduledMoveAnimator and
+ *        ScheduledFadeAnimator schedule their animations with the instance, and fall back to
+ *        registering as timer widgets when there is no instance.
+ *
+ * @see Animation
+ */
+class AnimationScheduler
+{
+public:
+
+    /**
+     * @fn AnimationScheduler::AnimationScheduler()
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor.
+     */
+    AnimationScheduler()
+        : first(0),
+          last(0),
+          nextToTick(0),
+          numberOfAnimations(0),
+          ticking(false)
+    {
+    }
+
+    /**
+     * @fn virtual AnimationScheduler::~AnimationScheduler()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Unschedules all animations and unregisters the instance.
+     */
+    virtual ~AnimationScheduler()
+    {
+        clear();
+        if (instance == this)
+        {
+            instance = 0;
+        }
+    }
+
+    /**
+     * @fn void AnimationScheduler::schedule(Animation& animation);
+     *
+     * @brief Starts giving an animation ticks.
+     *
+     *        Starts giving an animation ticks. Scheduling an animation which is already
+     *        scheduled does nothing. An animation scheduled while the animations are being
+     *        ticked is ticked in the same pass, unless it was unscheduled earlier in the pass,
+     *        in which case it keeps its place in the order, like a timer widget registered
+     *        again.
+     *
+     * @param [in] animation The animation.
+     */
+    void schedule(Animation& animation);
+
+    /**
+     * @fn void AnimationScheduler::unschedule(Animation& animation);
+     *
+     * @brief Stops giving an animation ticks.
+     *
+     *        Stops giving an animation ticks. The animation may be unscheduled while the
+     *        animations are being ticked, and is then not ticked for the rest of the pass.
+     *
+     * @param [in] animation The animation, which must be scheduled by this scheduler.
+     */
+    void unschedule(Animation& animation);
+
+    /**
+     * @fn void AnimationScheduler::clear();
+     *
+     * @brief Unschedules all animations.
+     *
+     *        Unschedules all animations.
+     */
+    void clear();
+
+    /**
+     * @fn void AnimationScheduler::handleTickEvent();
+     *
+     * @brief Advances all scheduled animations one step.
+     *
+     *        Advances all scheduled animations one step, in the order they were scheduled.
+     */
+    void handleTickEvent();
+
+    /**
+     * @fn uint16_t AnimationScheduler::getNumberOfAnimations() const
+     *
+     * @brief Gets the number of scheduled animations.
+     *
+     *        Gets the number of scheduled animations.
+     *
+     * @return The number of scheduled animations.
+     */
+    uint16_t getNumberOfAnimations() const
+    {
+        return numberOfAnimations;
+    }
+
+    /**
+     * @fn static AnimationScheduler* AnimationScheduler::getInstance()
+     *
+     * @brief Gets the instance.
+     *
+     *        Gets the instance.
+     *
+     * @return The instance, or 0 if animations are ticked as timer widgets.
+     */
+    static AnimationScheduler* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * @fn static void AnimationScheduler::setInstance(AnimationScheduler* scheduler)
+     *
+     * @brief Sets the instance.
+     *
+     *        Sets the instance. The instance must only be changed while no animations are
+     *        running, e.g. before switching screens.
+     *
+     * @param [in] scheduler The instance, or 0 to tick animations as timer widgets.
+     */
+    static void setInstance(AnimationScheduler* scheduler)
+    {
+        instance = scheduler;
+    }
+
+private:
+    friend class Animation;
+
+    void remove(Animation& animation);
+
+    Animation* first;
+    Animation* last;
+    Animation* nextToTick;
+    uint16_t numberOfAnimations;
+    bool ticking;
+
+    static AnimationScheduler* instance;
+};
+} // namespace touchgfx
+
+#endif // ANIMATIONSCHEDULER_HPP
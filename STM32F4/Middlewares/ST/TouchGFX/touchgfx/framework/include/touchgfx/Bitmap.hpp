@@ -68,7 +68,8 @@ public:
         BW,       ///< 1-bit, black / white, no alpha channel
         BW_RLE,   ///< 1-bit, black / white, no alpha channel compressed with horizontal RLE
         GRAY2,    ///< 2-bit grayscale
-        GRAY4     ///< 4.bit grayscale
+        GRAY4,    ///< 4.bit grayscale
+        ENCODED   ///< Palette or compressed data, see EncodedBitmap
     };
 
     /**
@@ -497,6 +498,8 @@ public:
     static void setCache(uint16_t* cachep, uint32_t csize, uint32_t numberOfDynamicBitmaps = 0);
 
 private:
+    friend class BitmapCache; // Compacts the cache a few bitmaps at a time
+
     /**
      * @fn static void Bitmap::compactCache();
      *
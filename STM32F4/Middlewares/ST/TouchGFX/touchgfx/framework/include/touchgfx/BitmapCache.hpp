@@ -0,0 +1,267 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef BITMAPCACHE_HPP
+#define BITMAPCACHE_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/hal/RenderWorkers.hpp>
+
+namespace touchgfx
+{
+/**
+ * @struct BitmapCacheStatistics BitmapCache.hpp touchgfx/BitmapCache.hpp
+ *
+ * @brief Accumulated measurements of the automatic bitmap cache.
+ *
+ *        Accumulated measurements of the automatic bitmap cache since the last call to
+ *        BitmapCache::resetStatistics().
+ */
+struct BitmapCacheStatistics
+{
+    uint32_t hits;           ///< Number of bitmap draws which found the bitmap in the cache.
+    uint32_t misses;         ///< Number of bitmap draws which had to read the bitmap from the bitmap database.
+    uint32_t admissions;     ///< Number of bitmaps copied into the cache.
+    uint32_t evictions;      ///< Number of bitmaps removed from the cache to make room for others.
+    uint32_t deferrals;      ///< Number of misses whose caching was postponed to the end of the frame.
+    uint32_t admittedBytes;  ///< Number of bytes copied into the cache.
+    uint32_t compactedBytes; ///< Number of bytes moved within the cache to close the holes left by removed bitmaps.
+};
+
+/**
+ * @class BitmapCache BitmapCache.hpp touchgfx/BitmapCache.hpp
+ *
+ * @brief Automatic management of the bitmap cache.
+ *
+ *        Automatic management of the bitmap cache. Instead of caching bitmaps explicitly using
+ *        Bitmap::cache(), the bitmaps are cached the first time they are drawn. When the
+ *        cache is full, the least recently drawn bitmaps are removed to make room, except
+ *        bitmaps drawn in the current frame, so a screen using more bitmaps than the cache
+ *        can hold draws the rest from the bitmap database rather than replacing cached
+ *        bitmaps over and over.
+ *
+ *        Removing a bitmap from the cache leaves a hole, which must be closed by moving the
+ *        bitmaps behind it before another bitmap can be cached. Bitmap::cache() would move
+ *        all of them at once, so endFrame() compacts the cache itself, a few bitmaps at a
+ *        time, and resumes after the next frame when the compaction budget has been used.
+ *        This is never done while a frame is being drawn, where it would stall the drawing
+ *        and move bitmaps still being read by the DMA. A miss which requires removing
+ *        bitmaps, or which happens before the cache has been compacted, is drawn from the
+ *        bitmap database, and the bitmap is cached by endFrame(). The number of bytes cached
+ *        per frame is also limited, so the work of changing to a screen with many new
+ *        bitmaps is spread over the following frames, and frames in which no bitmaps are
+ *        drawn are used to catch up. While RenderWorkers are drawing, all misses are cached
+ *        by endFrame(), as the other workers may be reading the cache.
+ *
+ *        The draws are reported using access() by LCD16bppAccelerated and
+ *        LCD24bppAccelerated, through which the bitmap widgets of the library draw, and by
+ *        TextureMapper and ScalableImage, which map the bitmap data themselves. A target
+ *        project must therefore use one of the accelerated LCD classes and compile
+ *        BitmapCache.cpp and the LCD source; TextureMapper.cpp and ScalableImage.cpp must
+ *        also be compiled for texture mapped bitmaps to be cached. The painters of canvas
+ *        widgets do not report draws, as they read the bitmap once per scanline, so their
+ *        bitmaps are only cached if also drawn by a widget. AcceleratedMVPApplication calls
+ *        endFrame() when a frame has been drawn; applications not based on
+ *        AcceleratedMVPApplication must do this themselves.
+ *
+ * @note The cache must not be managed using Bitmap::cache(), Bitmap::cacheRemoveBitmap()
+ *       etc. while the automatic cache is in use. Dynamic bitmaps can be used as usual.
+ *
+ * @see Bitmap
+ */
+class BitmapCache
+{
+public:
+
+    /**
+     * @fn static void BitmapCache::registerBitmapDatabase(const Bitmap::BitmapData* data, const uint16_t n, uint16_t* cachep, uint32_t csize, uint32_t numberOfDynamicBitmaps = 0);
+     *
+     * @brief Registers an array of bitmaps and caches them automatically.
+     *
+     *        Registers an array of bitmaps using Bitmap::registerBitmapDatabase(), and enables
+     *        automatic caching of the bitmaps in the given memory region. The bookkeeping of
+     *        the automatic cache, getBookkeepingSize() bytes, is placed at the beginning of the
+     *        region, the rest is passed on to Bitmap::registerBitmapDatabase().
+     *
+     * @param data                   A reference to the BitmapData storage array.
+     * @param n                      The number of bitmaps in the array.
+     * @param [in,out] cachep        Pointer to memory region in which bitmap data can be
+     *                               cached. 0 disables the automatic cache.
+     * @param csize                  Size of cache memory region in bytes.
+     * @param numberOfDynamicBitmaps Number of dynamic bitmaps to be allowed in the cache.
+     */
+    static void registerBitmapDatabase(const Bitmap::BitmapData* data, const uint16_t n, uint16_t* cachep, uint32_t csize, uint32_t numberOfDynamicBitmaps = 0);
+
+    /**
+     * @fn static uint32_t BitmapCache::getBookkeepingSize(uint16_t n)
+     *
+     * @brief Gets the memory used for keeping track of the bitmaps.
+     *
+     *        Gets the number of bytes of the cache memory region used for keeping track of the
+     *        bitmaps. Add this to the size of the region when configuring the cache.
+     *
+     * @param n The number of bitmaps in the bitmap database.
+     *
+     * @return The number of bytes.
+     */
+    static uint32_t getBookkeepingSize(uint16_t n)
+    {
+        return n * sizeof(Entry);
+    }
+
+    /**
+     * @fn static bool BitmapCache::isEnabled()
+     *
+     * @brief Query if the automatic cache is in use.
+     *
+     *        Query if the automatic cache is in use.
+     *
+     * @return true if bitmaps are cached automatically.
+     */
+    static bool isEnabled()
+    {
+        return entries != 0;
+    }
+
+    /**
+     * @fn static void BitmapCache::access(BitmapId id)
+     *
+     * @brief Reports that a bitmap is about to be drawn.
+     *
+     *        Reports that a bitmap is about to be drawn. If the bitmap is not cached, it is
+     *        cached now if there is room for it, otherwise at the end of the frame. Dynamic
+     *        bitmaps, which are always in the cache, are ignored.
+     *
+     * @param id The id of the bitmap.
+     */
+    static void access(BitmapId id)
+    {
+        if (entries != 0 && id < numberOfBitmaps)
+        {
+            RenderWorkers::lockShared();
+            touch(id);
+            RenderWorkers::unlockShared();
+        }
+    }
+
+    /**
+     * @fn static void BitmapCache::endFrame();
+     *
+     * @brief Compacts the cache and caches the bitmaps missed during the frame.
+     *
+     *        Continues compacting the cache, and caches the bitmaps which were missed during
+     *        the frame, but could not be cached without removing other bitmaps. Must be
+     *        called after a frame has been drawn, when no bitmaps are being drawn.
+     */
+    static void endFrame();
+
+    /**
+     * @fn static void BitmapCache::setFrameBudget(uint32_t bytes)
+     *
+     * @brief Sets the number of bytes cached per frame.
+     *
+     *        Sets the maximum number of bytes cached by endFrame() after a frame in which
+     *        bitmaps were drawn. At least one bitmap is always cached. After a frame in which
+     *        no bitmaps were drawn, all missed bitmaps are cached, as far as the compaction
+     *        budget allows.
+     *
+     * @param bytes The number of bytes.
+     *
+     * @see setCompactionBudget
+     */
+    static void setFrameBudget(uint32_t bytes)
+    {
+        frameBudget = bytes;
+    }
+
+    /**
+     * @fn static void BitmapCache::setCompactionBudget(uint32_t bytes)
+     *
+     * @brief Sets the number of bytes moved per frame when compacting the cache.
+     *
+     *        Sets the maximum number of bytes moved by endFrame() to close the holes left by
+     *        removed bitmaps, including deleted dynamic bitmaps. At least one bitmap is
+     *        always moved. The compaction is resumed after the next frame, and missed bitmaps
+     *        are only cached when the cache has been compacted. Like Bitmap::cache(), the
+     *        compaction moves dynamic bitmaps, so addresses returned by
+     *        Bitmap::dynamicBitmapGetAddress() must be fetched again after endFrame().
+     *
+     * @param bytes The number of bytes.
+     */
+    static void setCompactionBudget(uint32_t bytes)
+    {
+        compactionBudget = bytes;
+    }
+
+    /**
+     * @fn static const BitmapCacheStatistics& BitmapCache::getStatistics()
+     *
+     * @brief Gets the accumulated cache statistics.
+     *
+     *        Gets the accumulated cache statistics.
+     *
+     * @return The statistics.
+     */
+    static const BitmapCacheStatistics& getStatistics()
+    {
+        return statistics;
+    }
+
+    /**
+     * @fn static void BitmapCache::resetStatistics();
+     *
+     * @brief Resets the cache statistics.
+     *
+     *        Resets the cache statistics.
+     */
+    static void resetStatistics();
+
+    static const uint16_t MAX_DEFERRED_BITMAPS = 16; ///< Maximum number of misses cached at the end of a frame. Further misses are cached when drawn again.
+
+private:
+    struct Entry
+    {
+        BitmapId older;    ///< The next less recently drawn cached bitmap.
+        BitmapId newer;    ///< The next more recently drawn cached bitmap.
+        uint16_t frame;    ///< The frame in which the bitmap was last drawn (wraps around).
+        uint8_t  linked;   ///< Non zero if the bitmap is in the list of cached bitmaps.
+        uint8_t  deferred; ///< Non zero if the bitmap will be cached at the end of the frame.
+    };
+
+    static void touch(BitmapId id);
+    static bool admit(BitmapId id, uint16_t protectedFrame);
+    static bool evict(uint32_t bytes, uint16_t protectedFrame);
+    static bool compact(uint32_t& movedBytes);
+    static void link(BitmapId id);
+    static void unlink(BitmapId id);
+    static bool isCacheable(BitmapId id);
+    static uint32_t getSizeOfBitmap(BitmapId id);
+    static uint32_t getTableSize(uint32_t numberOfStaticBitmaps, uint32_t numberOfDynamicBitmaps);
+
+    static Entry*                entries;
+    static uint16_t              numberOfBitmaps;
+    static uint32_t              capacity;
+    static BitmapId              newest;
+    static BitmapId              oldest;
+    static uint16_t              frame;
+    static bool                  frameHasDraws;
+    static bool                  cacheFull;
+    static uint32_t              frameBudget;
+    static uint32_t              compactionBudget;
+    static BitmapId              deferred[MAX_DEFERRED_BITMAPS];
+    static uint16_t              numberOfDeferred;
+    static BitmapCacheStatistics statistics;
+};
+} // namespace touchgfx
+
+#endif // BITMAPCACHE_HPP
@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef CACHEDFONT_HPP
+#define CACHEDFONT_HPP
+
+#include <touchgfx/Font.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class CachedFont CachedFont.hpp touchgfx/CachedFont.hpp
+ *
+ * @brief A Font which looks up its glyphs through the GlyphCache.
+ *
+ *        A Font which looks up its glyphs through the GlyphCache. A CachedFont wraps another
+ *        font, typically a generated ConstFont, and has the same metrics. To use it, let the
+ *        FontProvider of the application return the CachedFont instead of the wrapped font.
+ *
+ * @see GlyphCache
+ */
+class CachedFont : public Font
+{
+public:
+
+    /**
+     * @fn CachedFont::CachedFont(const Font* font);
+     *
+     * @brief Constructor.
+     *
+     *        Construct a CachedFont wrapping the given font.
+     *
+     * @param font The font to cache the glyphs of.
+     */
+    CachedFont(const Font* font);
+
+    using Font::getGlyph;
+
+    /**
+     * @fn virtual const GlyphNode* CachedFont::getGlyph(Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel) const;
+     *
+     * @brief Gets the glyph data associated with the specified unicode.
+     *
+     *        Gets the glyph data associated with the specified unicode, from the GlyphCache
+     *        if the glyph has been cached, otherwise from the wrapped font.
+     *
+     *        Complexity O(1) for cached glyphs.
+     *
+     * @param unicode            The character to look up.
+     * @param pixelData          Pointer to the pixel data for the glyph if the glyph is found.
+     *                           This is set by this method.
+     * @param [out] bitsPerPixel Reference where to place the number of bits per pixel.
+     *
+     * @return A pointer to the glyph node or null if the glyph was not found.
+     */
+    virtual const GlyphNode* getGlyph(Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel) const;
+
+    /**
+     * @fn virtual Unicode::UnicodeChar CachedFont::getFallbackChar() const
+     *
+     * @brief Gets fallback character.
+     *
+     *        Gets the fallback character of the wrapped font.
+     *
+     * @return The default character for the typography in case no glyph is available.
+     */
+    virtual Unicode::UnicodeChar getFallbackChar() const
+    {
+        return font->getFallbackChar();
+    }
+
+    /**
+     * @fn virtual Unicode::UnicodeChar CachedFont::getEllipsisChar() const
+     *
+     * @brief Gets ellipsis character.
+     *
+     *        Gets the ellipsis character of the wrapped font.
+     *
+     * @return The ellipsis character for the typography.
+     */
+    virtual Unicode::UnicodeChar getEllipsisChar() const
+    {
+        return font->getEllipsisChar();
+    }
+
+    /**
+     * @fn virtual int8_t CachedFont::getKerning(Unicode::UnicodeChar prevChar, const GlyphNode* glyph) const
+     *
+     * @brief Gets the kerning distance between two characters.
+     *
+     *        Gets the kerning distance between two characters from the wrapped font. The
+     *        cached glyph nodes are copies of the glyph nodes of the wrapped font, including
+     *        the position of the kerning information.
+     *
+     * @param prevChar The unicode value of the previous character.
+     * @param glyph    the glyph object for the current character.
+     *
+     * @return The kerning distance between prevChar and glyph char.
+     */
+    virtual int8_t getKerning(Unicode::UnicodeChar prevChar, const GlyphNode* glyph) const
+    {
+        return font->getKerning(prevChar, glyph);
+    }
+
+    /**
+     * @fn const Font* CachedFont::getFont() const
+     *
+     * @brief Gets the wrapped font.
+     *
+     *        Gets the wrapped font.
+     *
+     * @return The wrapped font.
+     */
+    const Font* getFont() const
+    {
+        return font;
+    }
+
+private:
+    const Font* font; ///< The wrapped font
+};
+} // namespace touchgfx
+
+#endif // CACHEDFONT_HPP
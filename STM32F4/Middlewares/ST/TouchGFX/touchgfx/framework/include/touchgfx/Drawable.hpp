@@ -534,6 +534,7 @@ public:
 
     friend class Container;
     friend class Screen;
+    friend class AcceleratedMVPApplication;
 
     /**
      * @fn virtual void Drawable::moveRelative(int16_t x, int16_t y);
@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef ENCODEDBITMAP_HPP
+#define ENCODEDBITMAP_HPP
+
+#include <touchgfx/Bitmap.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class EncodedBitmap EncodedBitmap.hpp touchgfx/EncodedBitmap.hpp
+ *
+ * @brief Decoding of bitmaps stored with a palette or compressed.
+ *
+ *        Decoding of bitmaps in the Bitmap::ENCODED format. The data of such a bitmap starts
+ *        with a four byte header telling how the pixels are encoded:
+ *
+ *        - L8: A palette of up to 256 ARGB8888 colors, followed by one byte per pixel
+ *          selecting a color from the palette.
+ *        - RGB565_RLE: RGB565 pixels without alpha, compressed line by line with run length
+ *          encoding. Each line is a number of runs, starting with a byte. If bit 7 of the
+ *          byte is set, the following pixel is repeated 1 + bits 0-6 times, otherwise the
+ *          byte is followed by 1 + bits 0-6 different pixels.
+ *        - ARGB8888_LZ4: ARGB8888 pixels, each line compressed as one LZ4 block.
+ *
+ *        The compressed formats are followed by the offsets of the lines, so drawing can
+ *        start at any line. All values are little endian, and nothing needs to be aligned.
+ *        The pixels are decoded while drawing, by LCD16bppAccelerated, so only the bytes of
+ *        the lines drawn are read from flash, and no memory is needed for a decoded copy of
+ *        the bitmap.
+ *
+ *        Encoded bitmaps are created with the bitmapencoder tool in framework/tools, and
+ *        placed in the bitmap database like other bitmaps, with the format
+ *        Bitmap::ENCODED. They are never cached by BitmapCache. Widgets sampling the
+ *        bitmap at arbitrary positions, like ScalableImage and TextureMapper, cannot draw
+ *        encoded bitmaps. Use decode() to decode such bitmaps into a dynamic bitmap first.
+ *
+ * @note Encoded bitmaps can only be drawn by LCD16bppAccelerated, on displays without
+ *       rotation.
+ */
+class EncodedBitmap
+{
+public:
+
+    /**
+     * @enum Encoding
+     *
+     * @brief The ways the pixels of an encoded bitmap can be stored.
+     *
+     *        The ways the pixels of an encoded bitmap can be stored.
+     */
+    enum Encoding
+    {
+        L8,          ///< 8-bit indices into a palette of up to 256 ARGB8888 colors
+        RGB565_RLE,  ///< 16-bit RGB565 without alpha, run length encoded line by line
+        ARGB8888_LZ4 ///< 32-bit ARGB8888, each line compressed as an LZ4 block
+    };
+
+    static const uint8_t HEADER_SIZE = 4;              ///< The size of the header in bytes: encoding, flags and the 16-bit palette size
+    static const uint8_t TRANSPARENT_PIXELS = 0x01;    ///< Flag set in the header if any pixel is not opaque
+    static const uint16_t MAX_LZ4_WIDTH = 1024;        ///< The maximum width of an ARGB8888_LZ4 bitmap. @remarks Memory impact: x * 4 bytes for decoding a line
+
+    /**
+     * @fn static Encoding EncodedBitmap::getEncoding(const uint8_t* data)
+     *
+     * @brief Gets the encoding of an encoded bitmap.
+     *
+     *        Gets the encoding of an encoded bitmap.
+     *
+     * @param data The data of the bitmap.
+     *
+     * @return The encoding.
+     */
+    static Encoding getEncoding(const uint8_t* data)
+    {
+        return static_cast<Encoding>(data[0]);
+    }
+
+    /**
+     * @fn static bool EncodedBitmap::hasTransparentPixels(const uint8_t* data)
+     *
+     * @brief Query if an encoded bitmap has pixels which are not opaque.
+     *
+     *        Query if an encoded bitmap has pixels which are not opaque.
+     *
+     * @param data The data of the bitmap.
+     *
+     * @return true if any pixel has an alpha below 255.
+     */
+    static bool hasTransparentPixels(const uint8_t* data)
+    {
+        return (data[1] & TRANSPARENT_PIXELS) != 0;
+    }
+
+    /**
+     * @fn static uint16_t EncodedBitmap::getPaletteSize(const uint8_t* data)
+     *
+     * @brief Gets the number of colors in the palette of an L8 bitmap.
+     *
+     *        Gets the number of colors in the palette of an L8 bitmap.
+     *
+     * @param data The data of the bitmap.
+     *
+     * @return The number of colors, 0 if the bitmap has no palette.
+     */
+    static uint16_t getPaletteSize(const uint8_t* data)
+    {
+        return static_cast<uint16_t>(data[2] | (data[3] << 8));
+    }
+
+    /**
+     * @fn static const uint8_t* EncodedBitmap::getPixels(const uint8_t* data)
+     *
+     * @brief Gets the indices of the pixels of an L8 bitmap.
+     *
+     *        Gets the indices of the pixels of an L8 bitmap, one byte per pixel, line by line.
+     *
+     * @param data The data of the bitmap.
+     *
+     * @return The indices.
+     */
+    static const uint8_t* getPixels(const uint8_t* data)
+    {
+        return data + HEADER_SIZE + getPaletteSize(data) * 4;
+    }
+
+    /**
+     * @fn static uint32_t EncodedBitmap::getPaletteColor(const uint8_t* data, uint8_t index)
+     *
+     * @brief Gets a color in the palette of an L8 bitmap.
+     *
+     *        Gets a color in the palette of an L8 bitmap.
+     *
+     * @param data  The data of the bitmap.
+     * @param index The index of the color.
+     *
+     * @return The ARGB8888 color.
+     */
+    static uint32_t getPaletteColor(const uint8_t* data, uint8_t index)
+    {
+        return readUint32(data + HEADER_SIZE + index * 4);
+    }
+
+    /**
+     * @fn static const uint8_t* EncodedBitmap::getLine(const uint8_t* data, uint16_t height, uint16_t y)
+     *
+     * @brief Gets the compressed data of a line of an RGB565_RLE or ARGB8888_LZ4 bitmap.
+     *
+     *        Gets the compressed data of a line of an RGB565_RLE or ARGB8888_LZ4 bitmap.
+     *
+     * @param data   The data of the bitmap.
+     * @param height The height of the bitmap.
+     * @param y      The line.
+     *
+     * @return The compressed line.
+     */
+    static const uint8_t* getLine(const uint8_t* data, uint16_t height, uint16_t y)
+    {
+        const uint8_t* lines = data + HEADER_SIZE + (height + 1) * 4;
+        return lines + readUint32(data + HEADER_SIZE + y * 4);
+    }
+
+    /**
+     * @fn static uint32_t EncodedBitmap::getSize(const uint8_t* data, uint16_t width, uint16_t height);
+     *
+     * @brief Gets the number of bytes used by an encoded bitmap.
+     *
+     *        Gets the number of bytes used by an encoded bitmap, including the header.
+     *
+     * @param data   The data of the bitmap.
+     * @param width  The width of the bitmap.
+     * @param height The height of the bitmap.
+     *
+     * @return The number of bytes.
+     */
+    static uint32_t getSize(const uint8_t* data, uint16_t width, uint16_t height);
+
+    /**
+     * @fn static Bitmap::BitmapFormat EncodedBitmap::getDecodedFormat(const uint8_t* data)
+     *
+     * @brief Gets the format of the decoded pixels of an encoded bitmap.
+     *
+     *        Gets the format of the decoded pixels of an encoded bitmap.
+     *
+     * @param data The data of the bitmap.
+     *
+     * @return Bitmap::RGB565 for RGB565_RLE bitmaps, otherwise Bitmap::ARGB8888.
+     */
+    static Bitmap::BitmapFormat getDecodedFormat(const uint8_t* data)
+    {
+        return getEncoding(data) == RGB565_RLE ? Bitmap::RGB565 : Bitmap::ARGB8888;
+    }
+
+    /**
+     * @fn static void EncodedBitmap::decode(const uint8_t* data, uint16_t width, uint16_t height, uint8_t* destination);
+     *
+     * @brief Decodes all pixels of an encoded bitmap.
+     *
+     *        Decodes all pixels of an encoded bitmap, e.g. into a dynamic bitmap, in the
+     *        format given by getDecodedFormat().
+     *
+     * @param data             The data of the bitmap.
+     * @param width            The width of the bitmap.
+     * @param height           The height of the bitmap.
+     * @param [out] destination The decoded pixels, aligned like the pixels of the format.
+     */
+    static void decode(const uint8_t* data, uint16_t width, uint16_t height, uint8_t* destination);
+
+    /**
+     * @fn static void EncodedBitmap::decodeLZ4(const uint8_t* line, uint32_t* destination, uint16_t pixels);
+     *
+     * @brief Decodes the start of a line of an ARGB8888_LZ4 bitmap.
+     *
+     *        Decodes the start of a line of an ARGB8888_LZ4 bitmap. The line is decoded from
+     *        the left, until the given number of pixels have been decoded.
+     *
+     * @param line              The compressed line.
+     * @param [out] destination The decoded pixels.
+     * @param pixels            The number of pixels to decode, at most the width of the
+     *                          bitmap.
+     */
+    static void decodeLZ4(const uint8_t* line, uint32_t* destination, uint16_t pixels);
+
+    /**
+     * @class RLEDecoder EncodedBitmap.hpp touchgfx/EncodedBitmap.hpp
+     *
+     * @brief Decoder of a line of an RGB565_RLE bitmap.
+     *
+     *        Decoder of a line of an RGB565_RLE bitmap. The line can be decoded in parts,
+     *        skipping pixels that are not drawn.
+     */
+    class RLEDecoder
+    {
+    public:
+
+        /**
+         * @fn EncodedBitmap::RLEDecoder::RLEDecoder(const uint8_t* line)
+         *
+         * @brief Constructor.
+         *
+         *        Constructor.
+         *
+         * @param line The compressed line.
+         */
+        explicit RLEDecoder(const uint8_t* line) :
+            data(line),
+            remaining(0),
+            repeat(false),
+            color(0)
+        {
+        }
+
+        /**
+         * @fn void EncodedBitmap::RLEDecoder::skip(uint16_t pixels);
+         *
+         * @brief Skips pixels.
+         *
+         *        Skips pixels.
+         *
+         * @param pixels The number of pixels to skip.
+         */
+        void skip(uint16_t pixels);
+
+        /**
+         * @fn void EncodedBitmap::RLEDecoder::decode(uint16_t* destination, uint16_t pixels);
+         *
+         * @brief Decodes the next pixels.
+         *
+         *        Decodes the next pixels.
+         *
+         * @param [out] destination The decoded pixels.
+         * @param pixels            The number of pixels to decode.
+         */
+        void decode(uint16_t* destination, uint16_t pixels);
+
+    private:
+        void nextRun();
+
+        const uint8_t* data; ///< The next byte to read
+        uint16_t remaining;  ///< The number of pixels left in the current run
+        bool repeat;         ///< True if the current run repeats a single pixel
+        uint16_t color;      ///< The pixel repeated by the current run
+    };
+
+private:
+    static uint32_t readUint32(const uint8_t* data)
+    {
+        return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+};
+} // namespace touchgfx
+
+#endif // ENCODEDBITMAP_HPP
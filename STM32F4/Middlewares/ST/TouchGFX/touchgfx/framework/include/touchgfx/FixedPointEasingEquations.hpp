@@ -0,0 +1,598 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef FIXEDPOINTEASINGEQUATIONS_HPP
+#define FIXEDPOINTEASINGEQUATIONS_HPP
+
+#include <touchgfx/hal/Types.hpp>
+#include <touchgfx/EasingEquations.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class FixedPointEasingEquations FixedPointEasingEquations.hpp touchgfx/FixedPointEasingEquations.hpp
+ *
+ * @brief The Penner easing functions of EasingEquations, computed without floating point.
+ *
+ *        The Penner easing functions of EasingEquations, computed without floating point.
+ *        The functions have the EasingEquation signature and can be given to the animator
+ *        mixins instead of the EasingEquations they replace, e.g. on an MCU without an FPU
+ *        where every float operation is a library call.
+ *
+ *        The progress t/d is computed in Q15 fixed point. Polynomial, back, bounce and circular
+ *        easing is computed directly in integer arithmetic, while sine, exponential and
+ *        elastic easing interpolate a 257 entry quarter sine table and a 257 entry 2^x
+ *        table. The result differs from the exact curve by less than 1 + |c| / 2048, i.e. at
+ *        most by one for any movement on the display. The first and last step are always
+ *        exactly b and b + c, and t is clamped to d.
+ *
+ * @note The elastic functions follow the documented exponentially decaying sine wave, which
+ *       EasingEquations does not: its elastic oscillation does not scale with c.
+ *
+ * @see EasingEquations
+ */
+class FixedPointEasingEquations
+{
+public:
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::backEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Back easing in: Overshooting cubic easing: (s+1)*t^3 - s*t^2
+     *
+     *        Back easing in: Overshooting cubic easing: (s+1)*t^3 - s*t^2. Backtracking
+     *        slightly, then reversing direction and moving to target.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t backEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::backEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Back easing out: Overshooting cubic easing: (s+1)*t^3 - s*t^2
+     *
+     *        Back easing out: Overshooting cubic easing: (s+1)*t^3 - s*t^2. Moving towards
+     *        target, overshooting it slightly, then reversing and coming back to target.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t backEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::backEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Back easing in/out: Overshooting cubic easing: (s+1)*t^3 - s*t^2
+     *
+     *        Back easing in/out: Overshooting cubic easing: (s+1)*t^3 - s*t^2. Backtracking
+     *        slightly, then reversing direction and moving to target, then overshooting target,
+     *        reversing, and finally coming back to target.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t backEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::bounceEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Bounce easing in - exponentially decaying parabolic bounce.
+     *
+     *        Bounce easing in - exponentially decaying parabolic bounce.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t bounceEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::bounceEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Bounce easing out - exponentially decaying parabolic bounce.
+     *
+     *        Bounce easing out - exponentially decaying parabolic bounce.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t bounceEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::bounceEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Bounce easing in/out - exponentially decaying parabolic bounce.
+     *
+     *        Bounce easing in/out - exponentially decaying parabolic bounce.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t bounceEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::circEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Circular easing in: sqrt(1-t^2)
+     *
+     *        Circular easing in: sqrt(1-t^2). Accelerating from zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t circEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::circEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Circular easing out: sqrt(1-t^2)
+     *
+     *        Circular easing out: sqrt(1-t^2). Decelerating to zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t circEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::circEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Circular easing in/out: sqrt(1-t^2)
+     *
+     *        Circular easing in/out: sqrt(1-t^2). Acceleration until halfway, then
+     *        deceleration.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t circEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::cubicEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Cubic easing in: t^3
+     *
+     *        Cubic easing in: t^3. Accelerating from zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t cubicEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::cubicEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Cubic easing out: t^3
+     *
+     *        Cubic easing out: t^3. Decelerating to zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t cubicEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::cubicEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Cubic easing in/out: t^3
+     *
+     *        Cubic easing in/out: t^3. Acceleration until halfway, then deceleration.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t cubicEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::elasticEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Elastic easing in - exponentially decaying sine wave.
+     *
+     *        Elastic easing in - exponentially decaying sine wave: sin(13*pi/2*t)*2^(10*(t-1)).
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t elasticEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::elasticEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Elastic easing out - exponentially decaying sine wave.
+     *
+     *        Elastic easing out - exponentially decaying sine wave, the reverse of
+     *        elasticEaseIn().
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t elasticEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::elasticEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Elastic easing in/out - exponentially decaying sine wave.
+     *
+     *        Elastic easing in/out - exponentially decaying sine wave, elasticEaseIn() until
+     *        halfway, then elasticEaseOut().
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t elasticEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::expoEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Exponential easing in: 2^t
+     *
+     *        Exponential easing in: 2^t. Accelerating from zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t expoEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::expoEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Exponential easing out: 2^t
+     *
+     *        Exponential easing out: 2^t. Deceleration to zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t expoEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::expoEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Exponential easing in/out: 2^t
+     *
+     *        Exponential easing in/out: 2^t. Accelerating until halfway, then decelerating.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t expoEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::linearEaseNone(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Simple linear tweening - no easing
+     *
+     *        Simple linear tweening - no easing.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t linearEaseNone(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::linearEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Simple linear tweening - no easing
+     *
+     *        Simple linear tweening - no easing.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t linearEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::linearEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Simple linear tweening - no easing.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t linearEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::linearEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Simple linear tweening - no easing
+     *
+     *        Simple linear tweening - no easing.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t linearEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quadEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quadratic easing in: t^2
+     *
+     *        Quadratic easing in: t^2. Accelerating from zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quadEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quadEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quadratic easing out: t^2
+     *
+     *        Quadratic easing out: t^2. Decelerating to zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quadEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quadEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quadratic easing in/out: t^2
+     *
+     *        Quadratic easing in/out: t^2. Acceleration until halfway, then deceleration.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quadEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quartEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quartic easing in: t^4
+     *
+     *        Quartic easing in: t^4. Accelerating from zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quartEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quartEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quartic easing out: t^4
+     *
+     *        Quartic easing out: t^4. Decelerating to zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quartEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quartEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quartic easing in/out: t^4
+     *
+     *        Quartic easing in/out: t^4. Acceleration until halfway, then deceleration.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quartEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quintEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quintic/strong easing in: t^5
+     *
+     *        Quintic/strong easing in: t^5. Accelerating from zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quintEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quintEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quintic/strong easing out: t^5
+     *
+     *        Quintic/strong easing out: t^5. Decelerating to zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quintEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::quintEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Quintic/strong easing in/out: t^5
+     *
+     *        Quintic/strong easing in/out: t^5. Acceleration until halfway, then deceleration.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t quintEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::sineEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Sinusoidal easing in: sin(t)
+     *
+     *        Sinusoidal easing in: sin(t). Accelerating from zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t sineEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::sineEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Sinusoidal easing out: sin(t)
+     *
+     *        Sinusoidal easing out: sin(t). Decelerating to zero velocity.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t sineEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+
+    /**
+     * @fn static int16_t FixedPointEasingEquations::sineEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+     *
+     * @brief Sinusoidal easing in/out: sin(t)
+     *
+     *        Sinusoidal easing in/out: sin(t). Acceleration until halfway, then deceleration.
+     *
+     * @param t Time. The current time or step.
+     * @param b Beginning. The beginning value.
+     * @param c Change. The change between the beginning value and the destination value.
+     * @param d Duration. The total time or total number of steps.
+     *
+     * @return The current value as a function of the current time or step.
+     */
+    static int16_t sineEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d);
+};
+} // namespace touchgfx
+#endif // FIXEDPOINTEASINGEQUATIONS_HPP
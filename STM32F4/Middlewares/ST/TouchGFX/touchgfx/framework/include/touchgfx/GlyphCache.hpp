@@ -0,0 +1,193 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef GLYPHCACHE_HPP
+#define GLYPHCACHE_HPP
+
+#include <touchgfx/Font.hpp>
+
+namespace touchgfx
+{
+/**
+ * @struct GlyphCacheStatistics GlyphCache.hpp touchgfx/GlyphCache.hpp
+ *
+ * @brief Accumulated measurements of the glyph cache.
+ *
+ *        Accumulated measurements of the glyph cache since the last call to
+ *        GlyphCache::resetStatistics().
+ */
+struct GlyphCacheStatistics
+{
+    uint32_t hits;          ///< Number of glyph lookups answered by the cache.
+    uint32_t misses;        ///< Number of glyph lookups passed on to the font.
+    uint32_t admissions;    ///< Number of glyphs copied into the cache.
+    uint32_t rejections;    ///< Number of missed glyphs which did not fit in the cache.
+    uint32_t admittedBytes; ///< Number of bytes of pixel data copied into the cache.
+};
+
+/**
+ * @class GlyphCache GlyphCache.hpp touchgfx/GlyphCache.hpp
+ *
+ * @brief A RAM cache of glyphs used by CachedFont.
+ *
+ *        A RAM cache of glyphs used by CachedFont. The glyphs are kept in a hash table keyed
+ *        by font and unicode, so looking up a cached glyph takes constant time instead of the
+ *        binary search of ConstFont, and the pixel data of the glyph is copied to RAM, so
+ *        drawing it does not read the font from (possibly slow, external) flash.
+ *
+ *        Glyphs are cached the first time they are looked up. Once the cache is full, further
+ *        glyphs are read from the font as usual, until the cache is cleared using clear(). A
+ *        screen which updates numbers frequently can clear the cache and cache the digits of
+ *        its fonts in setupScreen() using cacheDigits().
+ *
+ * @see CachedFont
+ */
+class GlyphCache
+{
+public:
+
+    /**
+     * @fn static void GlyphCache::setCache(uint8_t* memory, uint32_t size, uint16_t numberOfSlots);
+     *
+     * @brief Sets the memory used for caching glyphs.
+     *
+     *        Sets the memory used for caching glyphs. The hash table, getTableSize() bytes, is
+     *        placed at the beginning of the memory region, the rest holds the pixel data of the
+     *        glyphs. At most three quarters of the slots in the table are used, to keep the
+     *        lookups short. Any glyphs already cached are forgotten.
+     *
+     * @param [in] memory   Pointer to memory region in which glyphs can be cached. 0 disables
+     *                      the cache.
+     * @param size          Size of the memory region in bytes.
+     * @param numberOfSlots The number of slots in the hash table, must be a power of two.
+     */
+    static void setCache(uint8_t* memory, uint32_t size, uint16_t numberOfSlots);
+
+    /**
+     * @fn static uint32_t GlyphCache::getTableSize(uint16_t numberOfSlots)
+     *
+     * @brief Gets the memory used by the hash table.
+     *
+     *        Gets the number of bytes of the cache memory region used by the hash table. Add
+     *        the number of bytes needed for the pixel data of the glyphs to this when
+     *        configuring the cache.
+     *
+     * @param numberOfSlots The number of slots in the hash table.
+     *
+     * @return The number of bytes.
+     */
+    static uint32_t getTableSize(uint16_t numberOfSlots)
+    {
+        return numberOfSlots * sizeof(Slot);
+    }
+
+    /**
+     * @fn static void GlyphCache::clear();
+     *
+     * @brief Removes all glyphs from the cache.
+     *
+     *        Removes all glyphs from the cache, making room for new glyphs.
+     */
+    static void clear();
+
+    /**
+     * @fn static const GlyphNode* GlyphCache::getGlyph(const Font* font, Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel);
+     *
+     * @brief Gets a glyph of a font through the cache.
+     *
+     *        Gets a glyph of a font through the cache. If the glyph is not cached, it is looked
+     *        up in the font and cached if there is room for it. The cache is shared by all
+     *        RenderWorkers and is locked while the glyph is looked up.
+     *
+     * @param font               The font to look up the glyph in.
+     * @param unicode            The character to look up.
+     * @param [out] pixelData    Pointer to the pixel data for the glyph if the glyph is found.
+     * @param [out] bitsPerPixel Reference where to place the number of bits per pixel.
+     *
+     * @return A pointer to the glyph node or null if the glyph was not found.
+     */
+    static const GlyphNode* getGlyph(const Font* font, Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel);
+
+    /**
+     * @fn static void GlyphCache::cacheGlyphs(FontId fontId, const Unicode::UnicodeChar* text);
+     *
+     * @brief Caches the glyphs of the given characters.
+     *
+     *        Caches the glyphs of the given characters in the font, if the font is a CachedFont.
+     *
+     * @param fontId The font id of the font.
+     * @param text   A zero-terminated unicode string with the characters to cache.
+     */
+    static void cacheGlyphs(FontId fontId, const Unicode::UnicodeChar* text);
+
+    /**
+     * @fn static void GlyphCache::cacheDigits(FontId fontId);
+     *
+     * @brief Caches the glyphs used for showing numbers.
+     *
+     *        Caches the glyphs of the digits, signs, decimal separators and colon in the font,
+     *        if the font is a CachedFont.
+     *
+     * @param fontId The font id of the font.
+     */
+    static void cacheDigits(FontId fontId);
+
+    /**
+     * @fn static const GlyphCacheStatistics& GlyphCache::getStatistics()
+     *
+     * @brief Gets the accumulated cache statistics.
+     *
+     *        Gets the accumulated cache statistics.
+     *
+     * @return The statistics.
+     */
+    static const GlyphCacheStatistics& getStatistics()
+    {
+        return statistics;
+    }
+
+    /**
+     * @fn static void GlyphCache::resetStatistics();
+     *
+     * @brief Resets the cache statistics.
+     *
+     *        Resets the cache statistics.
+     */
+    static void resetStatistics();
+
+private:
+    struct Slot
+    {
+        const Font*          font;         ///< The font of the glyph, 0 if the slot is free.
+        const uint8_t*       pixelData;    ///< The pixel data of the glyph in the cache.
+        GlyphNode            glyph;        ///< Copy of the glyph node.
+        Unicode::UnicodeChar unicode;      ///< The character the glyph was looked up by.
+        uint8_t              bitsPerPixel; ///< The number of bits per pixel of the glyph.
+    };
+
+    static const GlyphNode* lookUpGlyph(const Font* font, Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel);
+    static uint16_t getIndex(const Font* font, Unicode::UnicodeChar unicode);
+    static uint32_t getSizeOfGlyph(const GlyphNode* glyph, uint8_t bitsPerPixel);
+
+    static Slot*                slots;
+    static uint16_t             slotMask;
+    static uint16_t             numberOfGlyphs;
+    static uint16_t             maxNumberOfGlyphs;
+    static uint8_t*             pixelMemory;
+    static uint32_t             pixelMemorySize;
+    static uint32_t             pixelMemoryUsed;
+    static GlyphCacheStatistics statistics;
+};
+} // namespace touchgfx
+
+#endif // GLYPHCACHE_HPP
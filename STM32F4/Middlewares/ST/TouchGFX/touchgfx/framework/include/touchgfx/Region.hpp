@@ -0,0 +1,266 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef REGION_HPP
+#define REGION_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class Region Region.hpp touchgfx/Region.hpp
+ *
+ * @brief A set of disjoint rectangles describing an area of the screen.
+ *
+ *        A set of disjoint rectangles describing an area of the screen, typically the area
+ *        that needs to be redrawn. Since the rectangles never overlap, no pixel is drawn
+ *        twice when the rectangles are drawn one by one.
+ *
+ *        When a rectangle is added, it is merged with an existing rectangle if the area of
+ *        their bounding box is not much larger than the area they cover. Otherwise the
+ *        rectangle is split into pieces that do not overlap the existing rectangles. This
+ *        keeps the number of rectangles low for many small, scattered updates, without
+ *        collapsing distant updates into one huge rectangle. If the capacity is exhausted,
+ *        the rectangles that waste the least area are merged.
+ *
+ *        The Region does not own the memory for the rectangles, it is supplied by the
+ *        creator of the Region. This allows the capacity to be chosen per use.
+ */
+class Region
+{
+public:
+
+    /**
+     * @fn Region::Region(Rect* storage, uint16_t capacity);
+     *
+     * @brief Constructor.
+     *
+     *        Constructor.
+     *
+     * @param [in] storage Memory for the rectangles of the region.
+     * @param capacity     Number of rectangles the storage has room for. Must be at least 1.
+     */
+    Region(Rect* storage, uint16_t capacity);
+
+    /**
+     * @fn void Region::clear()
+     *
+     * @brief Removes all rectangles.
+     *
+     *        Removes all rectangles and resets the invalidated area.
+     */
+    void clear()
+    {
+        numberOfRects = 0;
+        invalidatedArea = 0;
+    }
+
+    /**
+     * @fn bool Region::isEmpty() const
+     *
+     * @brief Query if this region is empty.
+     *
+     *        Query if this region is empty.
+     *
+     * @return true if the region contains no rectangles.
+     */
+    bool isEmpty() const
+    {
+        return numberOfRects == 0;
+    }
+
+    /**
+     * @fn uint16_t Region::size() const
+     *
+     * @brief Gets the number of rectangles.
+     *
+     *        Gets the number of rectangles in the region.
+     *
+     * @return The number of rectangles.
+     */
+    uint16_t size() const
+    {
+        return numberOfRects;
+    }
+
+    /**
+     * @fn uint16_t Region::getCapacity() const
+     *
+     * @brief Gets the capacity.
+     *
+     *        Gets the maximum number of rectangles in the region.
+     *
+     * @return The capacity.
+     */
+    uint16_t getCapacity() const
+    {
+        return capacity;
+    }
+
+    /**
+     * @fn void Region::setCapacity(uint16_t newCapacity);
+     *
+     * @brief Sets the maximum number of rectangles in the region.
+     *
+     *        Sets the maximum number of rectangles in the region. If the region currently has
+     *        more rectangles, they are merged.
+     *
+     * @param newCapacity The new capacity, between 1 and the size of the storage given to the
+     *                    constructor.
+     */
+    void setCapacity(uint16_t newCapacity);
+
+    /**
+     * @fn const Rect& Region::operator[](uint16_t index) const
+     *
+     * @brief Gets a rectangle of the region.
+     *
+     *        Gets a rectangle of the region.
+     *
+     * @param index Zero-based index of the rectangle, must be less than size().
+     *
+     * @return The rectangle.
+     */
+    const Rect& operator[](uint16_t index) const
+    {
+        assert(index < numberOfRects);
+        return rects[index];
+    }
+
+    /**
+     * @fn void Region::setMergeThreshold(uint32_t pixels)
+     *
+     * @brief Sets the number of wasted pixels accepted when merging two rectangles.
+     *
+     *        Sets the number of wasted pixels accepted when merging two rectangles, i.e. the
+     *        number of pixels in the bounding box of the two rectangles that is not covered
+     *        by either of them. This should reflect the fixed cost of handling an extra
+     *        rectangle compared to drawing a number of pixels. Rectangles are also merged if
+     *        less than 10% of the bounding box is wasted. Default is 512 pixels.
+     *
+     * @param pixels The number of pixels.
+     */
+    void setMergeThreshold(uint32_t pixels)
+    {
+        mergeThreshold = pixels;
+    }
+
+    /**
+     * @fn void Region::add(const Rect& rect);
+     *
+     * @brief Adds a rectangle to the region.
+     *
+     *        Adds a rectangle to the region. The rectangle is merged with or split against the
+     *        existing rectangles, so the rectangles of the region remain disjoint.
+     *
+     * @param rect The rectangle to add.
+     */
+    void add(const Rect& rect);
+
+    /**
+     * @fn void Region::add(const Region& other);
+     *
+     * @brief Adds all rectangles of another region to this region.
+     *
+     *        Adds all rectangles of another region to this region.
+     *
+     * @param other The other region.
+     */
+    void add(const Region& other);
+
+    /**
+     * @fn void Region::assign(const Region& other);
+     *
+     * @brief Makes this region a copy of another region.
+     *
+     *        Makes this region a copy of another region. If the other region has more
+     *        rectangles than the capacity of this region, the rectangles are merged.
+     *
+     * @param other The other region.
+     */
+    void assign(const Region& other);
+
+    /**
+     * @fn bool Region::subtract(const Rect& rect);
+     *
+     * @brief Removes an area from the region.
+     *
+     *        Removes an area from the region. The rectangles overlapping the area are split
+     *        into the parts not covered by the area.
+     *
+     * @param rect The area to remove.
+     *
+     * @return false if there was not room for the resulting rectangles, in which case the
+     *         region is left unchanged.
+     */
+    bool subtract(const Rect& rect);
+
+    /**
+     * @fn uint32_t Region::getArea() const;
+     *
+     * @brief Gets the area of the region.
+     *
+     *        Gets the area of the region, i.e. the number of pixels that will be drawn if
+     *        all rectangles of the region are drawn.
+     *
+     * @return The area in pixels.
+     */
+    uint32_t getArea() const;
+
+    /**
+     * @fn uint32_t Region::getInvalidatedArea() const
+     *
+     * @brief Gets the area actually added to the region.
+     *
+     *        Gets the area actually added to the region since it was last cleared, not
+     *        counting pixels added more than once. The difference between getArea() and
+     *        this is the area wasted by merging rectangles.
+     *
+     * @return The area in pixels.
+     */
+    uint32_t getInvalidatedArea() const
+    {
+        return invalidatedArea;
+    }
+
+    /**
+     * @fn Rect Region::getBoundingRect() const;
+     *
+     * @brief Gets the smallest rectangle containing the entire region.
+     *
+     *        Gets the smallest rectangle containing the entire region.
+     *
+     * @return The bounding rectangle.
+     */
+    Rect getBoundingRect() const;
+
+private:
+    Region(const Region&);
+    Region& operator=(const Region&);
+
+    bool shouldMerge(const Rect& a, const Rect& b) const;
+    uint32_t getWaste(const Rect& a, const Rect& b) const;
+    void merge(Rect rect);
+    bool insert(const Rect& rect, uint16_t first);
+    void removeAt(uint16_t index);
+
+    Rect* rects;
+    uint16_t capacity;
+    uint16_t numberOfRects;
+    uint32_t mergeThreshold;
+    uint32_t invalidatedArea;
+};
+} // namespace touchgfx
+
+#endif // REGION_HPP
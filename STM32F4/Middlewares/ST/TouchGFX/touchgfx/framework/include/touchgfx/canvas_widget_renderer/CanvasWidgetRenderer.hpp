@@ -18,6 +18,7 @@
 
 #include <touchgfx/hal/Types.hpp>
 #include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/hal/RenderWorkers.hpp>
 #include <touchgfx/widgets/Widget.hpp>
 #include <touchgfx/canvas_widget_renderer/Cell.hpp>
 #ifdef SIMULATOR
@@ -38,6 +39,9 @@ namespace touchgfx
  *        simulator, it is also possible to get a report on the actual amount of memory used
  *        for the drawings to help adjusting the buffer size.
  *
+ *        When drawing in parallel with RenderWorkers, each worker needs a buffer of its own,
+ *        and all functions work on the buffer of the calling worker.
+ *
  * @see Widget
  */
 class CanvasWidgetRenderer : public Widget
@@ -56,6 +60,22 @@ public:
      */
     static void setupBuffer(uint8_t* buffer, unsigned bufsize);
 
+    /**
+     * @fn static void CanvasWidgetRenderer::setupBuffer(uint8_t* buffer, unsigned bufsize, uint8_t worker)
+     *
+     * @brief Setup the buffers used by CanvasWidget on a RenderWorkers worker.
+     *
+     *        Setup the buffers used by CanvasWidget when drawing on the given RenderWorkers
+     *        worker. The buffers of the workers must not overlap.
+     *
+     * @param [in] buffer Buffer reserved for CanvasWidget.
+     * @param bufsize     The size of the buffer.
+     * @param worker      The index of the worker, less than RenderWorkers::MAX_WORKERS.
+     *
+     * @see setupBuffer(uint8_t*, unsigned)
+     */
+    static void setupBuffer(uint8_t* buffer, unsigned bufsize, uint8_t worker);
+
     /**
      * @fn static bool CanvasWidgetRenderer::setScanlineWidth(unsigned width)
      *
@@ -253,18 +273,30 @@ public:
 #endif
 
 private:
-    static uint8_t* memoryBuffer;
-    static unsigned int memoryBufferSize;
-    static unsigned int scanlineWidth;
-    static void* scanlineCovers;
-    static void* scanlineStartIndices;
-    static void* scanlineCounts;
-    static Cell* outlineBuffer;
-    static unsigned int outlineBufferSize;
+    struct Context
+    {
+        uint8_t* memoryBuffer;
+        unsigned int memoryBufferSize;
+        unsigned int scanlineWidth;
+        void* scanlineCovers;
+        void* scanlineStartIndices;
+        void* scanlineCounts;
+        Cell* outlineBuffer;
+        unsigned int outlineBufferSize;
+#ifdef SIMULATOR
+        unsigned int scanlineSize;
+        unsigned int maxCellsUsed;
+        unsigned int maxCellsMissing;
+#endif
+    };
+
+    static Context& getContext()
+    {
+        return contexts[RenderWorkers::getCurrentWorker()];
+    }
+
+    static Context contexts[RenderWorkers::MAX_WORKERS];
 #ifdef SIMULATOR
-    static unsigned int scanlineSize;
-    static unsigned int maxCellsUsed;
-    static unsigned int maxCellsMissing;
     static bool writeReport;
 #endif
 }; // class CanvasWidgetRenderer
@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef CELLESTIMATOR_HPP
+#define CELLESTIMATOR_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class CellEstimator CellEstimator.hpp touchgfx/canvas_widget_renderer/CellEstimator.hpp
+ *
+ * @brief Estimates the number of Cell objects an Outline needs per scanline.
+ *
+ *        Estimates the number of Cell objects an Outline needs per scanline. The estimator
+ *        accepts the same moveTo() and lineTo() commands as an Outline and follows the lines
+ *        through the cells exactly like the Outline does, but instead of storing the cells,
+ *        it just counts them for each scanline.
+ *
+ *        The estimate is an upper limit of the number of cells stored by the Outline, as
+ *        cells which end up without any coverage are counted as well. This makes it possible
+ *        to split a shape into horizontal tiles where each tile is known to fit in the
+ *        outline buffer before rendering anything.
+ *
+ * @see Outline
+ */
+class CellEstimator
+{
+public:
+    /**
+     * @fn CellEstimator::CellEstimator(unsigned* cellsPerLine, int numLines);
+     *
+     * @brief Constructor.
+     *
+     *        Constructor. Clears the counters.
+     *
+     * @param [out] cellsPerLine Array receiving the number of cells for each scanline.
+     * @param numLines           Number of scanlines in the array. Cells outside the
+     *                           scanlines are not counted, just like the Outline ignores
+     *                           cells outside the scanlines being rendered.
+     */
+    CellEstimator(unsigned* cellsPerLine, int numLines);
+
+    /**
+     * @fn void CellEstimator::moveTo(int x, int y);
+     *
+     * @brief Move a virtual pen to the specified coordinate.
+     *
+     *        Move a virtual pen to the specified coordinate. If the current path is not
+     *        closed, it is closed first, like Outline::moveTo().
+     *
+     * @param x The x coordinate in poly format.
+     * @param y The y coordinate in poly format.
+     */
+    void moveTo(int x, int y);
+
+    /**
+     * @fn void CellEstimator::lineTo(int x, int y);
+     *
+     * @brief Count the cells of a line from the current virtual pen coordinate.
+     *
+     *        Count the cells of a line from the current virtual pen coordinate to the given
+     *        coordinate.
+     *
+     * @param x The x coordinate in poly format.
+     * @param y The y coordinate in poly format.
+     */
+    void lineTo(int x, int y);
+
+    /**
+     * @fn void CellEstimator::close();
+     *
+     * @brief Closes the current path.
+     *
+     *        Closes the current path, like Outline::getCells() does before rendering.
+     */
+    void close();
+
+private:
+    void countLine(int x1, int y1, int x2, int y2);
+    void countCells(int ey, int x1, int x2);
+
+    unsigned* cellsPerLine;
+    int numLines;
+    int curX;
+    int curY;
+    int closeX;
+    int closeY;
+    int lastCellX;
+    int lastCellY;
+    bool notClosed;
+};
+} // namespace touchgfx
+
+#endif // CELLESTIMATOR_HPP
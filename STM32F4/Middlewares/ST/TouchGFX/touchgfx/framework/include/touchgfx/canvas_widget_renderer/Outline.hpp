@@ -117,7 +117,9 @@ public:
      * @brief Gets a pointer to the the Cell objects in the Outline.
      *
      *        Gets a pointer to the the Cell objects in the Outline. If the Outline is not
-     *        closed, it is closed. If the Outline is unsorted, it will be quick sorted first.
+     *        closed, it is closed. If the Outline is unsorted, it will be sorted first, using
+     *        radixSortCells() if there are enough cells and the unused part of the outline
+     *        buffer can hold the row counters, otherwise qsortCells().
      *
      * @return A pointer to the sorted list of Cell objects in the Outline.
      */
@@ -153,6 +155,39 @@ public:
         return outlineTooComplex;
     }
 
+    /**
+     * @fn static void Outline::qsortCells(Cell* const start, unsigned num);
+     *
+     * @brief Quick sort Outline cells.
+     *
+     *        Quick sort Outline cells.
+     *
+     * @param [in] start The first Cell object in the Cell array to sort.
+     * @param num        Number of Cell objects to sort.
+     */
+    static void qsortCells(Cell* const start, unsigned num);
+
+    /**
+     * @fn static bool Outline::radixSortCells(Cell* const start, unsigned num, void* buffer, unsigned bufferSize);
+     *
+     * @brief Sort Outline cells in linear time.
+     *
+     *        Sort Outline cells in linear time, ordering the cells by y and then by x exactly
+     *        like qsortCells(). The cells are permuted in place into their rows, after which
+     *        each row is sorted on x, so the buffer only needs to hold a 16 bit counter for
+     *        each row covered by the cells.
+     *
+     * @param [in] start  The first Cell object in the Cell array to sort.
+     * @param num         Number of Cell objects to sort.
+     * @param [in] buffer Scratch memory for the row counters, which must not overlap the
+     *                    cells.
+     * @param bufferSize  Size of the scratch memory in bytes.
+     *
+     * @return false if the buffer was too small or there were more than 65535 cells, in which
+     *         case the cells were left untouched.
+     */
+    static bool radixSortCells(Cell* const start, unsigned num, void* buffer, unsigned bufferSize);
+
 private:
     /**
      * @fn void Outline::setCurCell(int x, int y);
@@ -217,17 +252,8 @@ private:
      */
     void renderLine(int x1, int y1, int x2, int y2);
 
-    /**
-     * @fn static void Outline::qsortCells(Cell* const start, unsigned num);
-     *
-     * @brief Quick sort Outline cells.
-     *
-     *        Quick sort Outline cells.
-     *
-     * @param [in] start The first Cell object in the Cell array to sort.
-     * @param num        Number of Cell objects to sort.
-     */
-    static void qsortCells(Cell* const start, unsigned num);
+    static const unsigned RADIX_SORT_THRESHOLD = 1024;       ///< Number of cells below which qsortCells() is faster than radixSortCells().
+    static const unsigned ROW_INSERTION_SORT_THRESHOLD = 16; ///< Number of cells in a row above which radixSortCells() sorts the row using qsortCells().
 
 private:
     unsigned     maxCells;
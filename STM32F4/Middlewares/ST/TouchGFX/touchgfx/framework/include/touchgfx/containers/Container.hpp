@@ -247,6 +247,7 @@ protected:
     Drawable* firstChild; ///< Pointer to the first child of this container. Subsequent children can be found through firstChild->nextSibling.
 
     friend class Screen;
+    friend class AcceleratedMVPApplication;
     virtual void setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement);
 };
 } // namespace touchgfx
@@ -369,6 +369,29 @@ public:
      */
     int16_t getScrolledY() const;
 
+    /**
+     * @fn void ScrollableContainer::setScrollByBlit(bool enable)
+     *
+     * @brief Moves the pixels of the children in the frame buffer instead of redrawing them.
+     *
+     *        Moves the pixels of the children in the frame buffer instead of redrawing them
+     *        when scrolling, so only the newly exposed strip of the container is drawn. The
+     *        scrollbars are redrawn at their old and new positions. Falls back to
+     *        moveChildrenRelative() when the pixels cannot be moved, e.g. if a widget in
+     *        front of the container overlaps it. Disabled by default.
+     *
+     * @note The children must cover the container with opaque pixels, i.e. the pixels must
+     *       not depend on what is behind the ScrollableContainer.
+     *
+     * @param enable true to move the pixels of the children.
+     *
+     * @see FrameBufferScroller
+     */
+    void setScrollByBlit(bool enable)
+    {
+        scrollByBlit = enable;
+    }
+
     /**
     * @fn virtual uint16_t ScrollableContainer::getType() const
     *
@@ -473,6 +496,22 @@ protected:
      */
     virtual bool doScroll(int16_t deltaX, int16_t deltaY);
 
+    /**
+     * @fn bool ScrollableContainer::moveChildrenByBlit(int16_t deltaX, int16_t deltaY);
+     *
+     * @brief Moves the children and their pixels in the frame buffer.
+     *
+     *        Moves the children, except the scrollbars, without invalidating them, and moves
+     *        their pixels in the frame buffer instead. The scrollbars are invalidated where
+     *        their pixels are moved to.
+     *
+     * @param deltaX Horizontal displacement.
+     * @param deltaY Vertical displacement.
+     *
+     * @return false if the pixels cannot be moved, in which case nothing is moved.
+     */
+    bool moveChildrenByBlit(int16_t deltaX, int16_t deltaY);
+
     GestureEvent::GestureType accelDirection; ///< The current direction (horizontal or vertical) of scroll
 
     Box xSlider; ///< The horizontal scrollbar drawable
@@ -509,6 +548,8 @@ protected:
     int16_t fingerAdjustmentY; ///< and how much vertically
 
     bool hasIssuedCancelEvent; ///< true if the pressed drawable has received cancel event
+
+    bool scrollByBlit; ///< true if the pixels of the children are moved when scrolling
 };
 } // namespace touchgfx
 
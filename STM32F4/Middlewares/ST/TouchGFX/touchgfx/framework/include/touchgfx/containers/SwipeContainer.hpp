@@ -152,6 +152,28 @@ public:
      */
     void setSelectedPage(uint8_t pageIndex);
 
+    /**
+     * @fn void SwipeContainer::setScrollByBlit(bool enable)
+     *
+     * @brief Moves the pixels of the pages in the frame buffer instead of redrawing them.
+     *
+     *        Moves the pixels of the pages in the frame buffer instead of redrawing them when
+     *        the pages are dragged or animated, so only the newly exposed strip of the pages
+     *        is drawn. Falls back to redrawing the container when the pixels cannot be moved,
+     *        e.g. if a widget in front of the container overlaps it. Disabled by default.
+     *
+     * @note The pages must be opaque, i.e. their pixels must not depend on what is behind
+     *       the SwipeContainer.
+     *
+     * @param enable true to move the pixels of the pages.
+     *
+     * @see FrameBufferScroller
+     */
+    void setScrollByBlit(bool enable)
+    {
+        scrollByBlit = enable;
+    }
+
 private:
     static const int16_t DRAG_CANCEL_THRESHOLD = 3; //Pixels to drag before sending cancel event.
 
@@ -181,7 +203,10 @@ private:
 
     touchgfx::ListLayout pages;
 
+    bool scrollByBlit;
+
     void adjustPages();
+    bool movePagesByBlit(int16_t x);
 
     void animateSwipeCancelledLeft();
     void animateSwipeCancelledRight();
@@ -200,6 +200,217 @@ protected:
     atomic_t tail;     ///< Index to the tail element.
 };
 
+/**
+ * @class CoalescingDMA_Queue DMA.hpp touchgfx/hal/DMA.hpp
+ *
+ * @brief A lock-free FIFO queue (single producer, single consumer) which merges blit operations.
+ *
+ *        A lock-free FIFO queue (single producer, single consumer) which merges blit operations
+ *        into operations already waiting in the queue. A row of small widgets, or a widget
+ *        drawn in several dirty rectangles, otherwise gives a DMA transfer for each part, each
+ *        paying the setup overhead of the DMA.
+ *
+ *        An operation is merged into a waiting operation with the same parameters if the
+ *        pixels written (and read) by the two are contiguous in memory, i.e. the destination
+ *        continues either at the end of each line or below the last line. Opaque fills with
+ *        the same color are also merged if they overlap. The waiting operation does not have
+ *        to be the last one in the queue, the new operation is moved ahead of operations that
+ *        neither write to the pixels it reads or writes, nor read the pixels it writes.
+ *
+ *        The first operation in the queue may be in progress on the DMA, so it is never
+ *        changed. DMA_Interface::addToQueue() disables the DMA interrupt while pushing, so
+ *        the DMA cannot start the next operation while it is being merged.
+ *
+ * @see DMA_Queue
+ */
+class CoalescingDMA_Queue : public DMA_Queue
+{
+public:
+
+    /**
+     * @fn CoalescingDMA_Queue::CoalescingDMA_Queue(BlitOp* mem, atomic_t n);
+     *
+     * @brief Constructs a coalescing queue.
+     *
+     *        Constructs a coalescing queue. Merging is enabled.
+     *
+     * @param [out] mem Pointer to the memory used by the queue to store elements.
+     * @param n         Number of elements the memory provided can contain.
+     */
+    CoalescingDMA_Queue(BlitOp* mem, atomic_t n);
+
+    /**
+     * @fn virtual bool CoalescingDMA_Queue::isEmpty();
+     *
+     * @brief Query if this object is empty.
+     *
+     *        Query if this object is empty.
+     *
+     * @return true if empty, false if not.
+     */
+    virtual bool isEmpty();
+
+    /**
+     * @fn virtual bool CoalescingDMA_Queue::isFull();
+     *
+     * @brief Query if this object is full.
+     *
+     *        Query if this object is full.
+     *
+     * @return true if full, false if not.
+     */
+    virtual bool isFull();
+
+    /**
+     * @fn virtual void CoalescingDMA_Queue::pushCopyOf(const BlitOp& op);
+     *
+     * @brief Merges the operation into a waiting operation, or pushes a copy of it.
+     *
+     *        Merges the operation into a waiting operation if possible, otherwise pushes a
+     *        copy of it.
+     *
+     * @param op The operation.
+     */
+    virtual void pushCopyOf(const BlitOp& op);
+
+    /**
+     * @fn void CoalescingDMA_Queue::setMergingEnabled(bool enabled)
+     *
+     * @brief Enables or disables merging of operations.
+     *
+     *        Enables or disables merging of operations. When disabled, the queue behaves like
+     *        LockFreeDMA_Queue.
+     *
+     * @param enabled true to merge operations.
+     */
+    void setMergingEnabled(bool enabled)
+    {
+        mergingEnabled = enabled;
+    }
+
+    /**
+     * @fn bool CoalescingDMA_Queue::isMergingEnabled() const
+     *
+     * @brief Query if merging of operations is enabled.
+     *
+     *        Query if merging of operations is enabled.
+     *
+     * @return true if operations are merged.
+     */
+    bool isMergingEnabled() const
+    {
+        return mergingEnabled;
+    }
+
+    /**
+     * @fn uint32_t CoalescingDMA_Queue::getNumberOfQueuedOperations() const
+     *
+     * @brief Gets the number of operations added to the queue.
+     *
+     *        Gets the number of operations added to the queue since the last call to
+     *        resetStatistics(), including the merged operations.
+     *
+     * @return The number of operations.
+     */
+    uint32_t getNumberOfQueuedOperations() const
+    {
+        return queuedOperations;
+    }
+
+    /**
+     * @fn uint32_t CoalescingDMA_Queue::getNumberOfMergedOperations() const
+     *
+     * @brief Gets the number of operations merged into a waiting operation.
+     *
+     *        Gets the number of operations merged into a waiting operation since the last call
+     *        to resetStatistics().
+     *
+     * @return The number of operations.
+     */
+    uint32_t getNumberOfMergedOperations() const
+    {
+        return mergedOperations;
+    }
+
+    /**
+     * @fn void CoalescingDMA_Queue::resetStatistics()
+     *
+     * @brief Resets the operation counters.
+     *
+     *        Resets the operation counters.
+     */
+    void resetStatistics()
+    {
+        queuedOperations = 0;
+        mergedOperations = 0;
+    }
+
+    static const atomic_t MERGE_WINDOW = 4; ///< The number of waiting operations an operation can be merged into
+
+protected:
+
+    /**
+     * @fn virtual void CoalescingDMA_Queue::pop();
+     *
+     * @brief Removes the first element.
+     *
+     *        Removes the first element.
+     */
+    virtual void pop();
+
+    /**
+     * @fn virtual const BlitOp* CoalescingDMA_Queue::first();
+     *
+     * @brief Gets the first blit operation.
+     *
+     *        Gets the first blit operation.
+     *
+     * @return the first blitop.
+     */
+    virtual const BlitOp* first();
+
+    /**
+     * @fn bool CoalescingDMA_Queue::merge(const BlitOp& op);
+     *
+     * @brief Merges the operation into one of the last operations in the queue.
+     *
+     *        Merges the operation into one of the last MERGE_WINDOW operations in the queue,
+     *        except the first. Operations are tried from the end of the queue, until one that
+     *        the operation depends on is found.
+     *
+     * @param op The operation.
+     *
+     * @return true if the operation was merged.
+     */
+    bool merge(const BlitOp& op);
+
+    BlitOp*  q;                ///< Pointer to the queue memory.
+    atomic_t capacity;         ///< The number of elements the queue can contain.
+    atomic_t head;             ///< Index to the head element.
+    atomic_t tail;             ///< Index to the tail element.
+    bool     mergingEnabled;   ///< true if operations are merged.
+    uint32_t queuedOperations; ///< The number of operations added since the statistics were reset.
+    uint32_t mergedOperations; ///< The number of operations merged since the statistics were reset.
+};
+
+/**
+ * @struct DMA_Statistics DMA.hpp touchgfx/hal/DMA.hpp
+ *
+ * @brief Counters for the blit operations handled by a DMA_Interface.
+ *
+ *        Counters for the blit operations handled by a DMA_Interface since the statistics were
+ *        last reset, typically at the start of a frame.
+ *
+ * @see DMA_Interface::getStatistics
+ */
+struct DMA_Statistics
+{
+    uint32_t queuedOperations;   ///< Operations added to the queue.
+    uint32_t mergedOperations;   ///< Operations merged into an operation already in the queue.
+    uint32_t executedOperations; ///< Operations performed by the DMA.
+    uint32_t busyTime;           ///< Time the DMA spent performing operations, in the unit of the DMA implementation.
+};
+
 /**
  * @class DMA_Interface DMA.hpp touchgfx/hal/DMA.hpp
  *
@@ -345,6 +556,53 @@ public:
      */
     uint8_t isDmaQueueFull();
 
+    /**
+     * @fn DMA_Statistics DMA_Interface::getStatistics() const
+     *
+     * @brief Gets the statistics of the operations handled.
+     *
+     *        Gets the statistics of the operations handled since the last call to
+     *        resetStatistics(). The number of executed operations and the busy time are
+     *        updated by the DMA implementation. If the queue is a CoalescingDMA_Queue, the
+     *        number of queued and merged operations are read from it, otherwise every queued
+     *        operation is executed.
+     *
+     * @return The statistics.
+     */
+    DMA_Statistics getStatistics() const
+    {
+        DMA_Statistics result = statistics;
+        if (coalescingQueue)
+        {
+            result.queuedOperations = coalescingQueue->getNumberOfQueuedOperations();
+            result.mergedOperations = coalescingQueue->getNumberOfMergedOperations();
+        }
+        else
+        {
+            result.queuedOperations = result.executedOperations;
+            result.mergedOperations = 0;
+        }
+        return result;
+    }
+
+    /**
+     * @fn void DMA_Interface::resetStatistics()
+     *
+     * @brief Resets the statistics.
+     *
+     *        Resets the statistics. Call this at the start of a frame to get statistics per
+     *        frame.
+     */
+    void resetStatistics()
+    {
+        statistics.executedOperations = 0;
+        statistics.busyTime = 0;
+        if (coalescingQueue)
+        {
+            coalescingQueue->resetStatistics();
+        }
+    }
+
     /**
      * @fn virtual DMA_Interface::~DMA_Interface()
      *
@@ -368,8 +626,27 @@ protected:
      * @param [in] dmaQueue Reference to the queue of DMA operations.
      */
     DMA_Interface(DMA_Queue& dmaQueue)
-        : queue(dmaQueue), isRunning(false), isAllowed(false)
+        : queue(dmaQueue), isRunning(false), isAllowed(false), coalescingQueue(0)
+    {
+        statistics.executedOperations = 0;
+        statistics.busyTime = 0;
+    }
+
+    /**
+     * @fn DMA_Interface::DMA_Interface(CoalescingDMA_Queue& dmaQueue)
+     *
+     * @brief Constructs a DMA Interface object using a coalescing queue.
+     *
+     *        Constructs a DMA Interface object using a coalescing queue, which getStatistics()
+     *        reads the number of queued and merged operations from.
+     *
+     * @param [in] dmaQueue Reference to the queue of DMA operations.
+     */
+    DMA_Interface(CoalescingDMA_Queue& dmaQueue)
+        : queue(dmaQueue), isRunning(false), isAllowed(false), coalescingQueue(&dmaQueue)
     {
+        statistics.executedOperations = 0;
+        statistics.busyTime = 0;
     }
 
     /**
@@ -470,6 +747,9 @@ protected:
     DMA_Queue&    queue;     ///< Reference to the DMA queue
     bool          isRunning; ///< true if a DMA transfer is currently ongoing.
     volatile bool isAllowed; ///< true if DMA transfers are currently allowed.
+
+    CoalescingDMA_Queue* coalescingQueue; ///< The queue if it is a CoalescingDMA_Queue, otherwise 0.
+    DMA_Statistics       statistics;      ///< The executed operations and busy time, updated by the DMA implementation.
 };
 } // namespace touchgfx
 
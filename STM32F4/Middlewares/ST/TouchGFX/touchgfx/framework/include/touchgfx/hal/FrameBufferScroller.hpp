@@ -0,0 +1,136 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef FRAMEBUFFERSCROLLER_HPP
+#define FRAMEBUFFERSCROLLER_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+namespace touchgfx
+{
+class Drawable;
+
+/**
+ * @class FrameBufferScroller FrameBufferScroller.hpp touchgfx/hal/FrameBufferScroller.hpp
+ *
+ * @brief Moves already drawn pixels of the frame buffer instead of redrawing them.
+ *
+ *        Moves already drawn pixels of the frame buffer instead of redrawing them. When the
+ *        contents of a container are moved a few pixels, e.g. while being dragged, most of
+ *        the pixels of the next frame can be copied from the previous frame, and only the
+ *        newly exposed strip needs to be drawn by the widgets.
+ *
+ *        The Application drawing the frames registers itself as the instance, as only it
+ *        knows which pixels of the previous frame are still valid. Without an instance,
+ *        nothing is scrolled and the callers fall back to invalidating the area.
+ *
+ * @see AcceleratedMVPApplication
+ */
+class FrameBufferScroller
+{
+public:
+
+    /**
+     * @fn virtual FrameBufferScroller::~FrameBufferScroller()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Unregisters the instance.
+     */
+    virtual ~FrameBufferScroller()
+    {
+        if (instance == this)
+        {
+            instance = 0;
+        }
+    }
+
+    /**
+     * @fn virtual bool FrameBufferScroller::scrollArea(const Rect& area, int16_t deltaX, int16_t deltaY) = 0;
+     *
+     * @brief Moves the pixels of an area of the display.
+     *
+     *        Moves the pixels of an area of the display when the next frame is drawn. The
+     *        pixels moved outside the area are discarded, and the parts of the area which
+     *        are exposed are drawn like invalidated areas. Areas already invalidated in the
+     *        current frame are moved along with the pixels.
+     *
+     * @param area   The area, in absolute coordinates.
+     * @param deltaX The horizontal distance to move the pixels.
+     * @param deltaY The vertical distance to move the pixels.
+     *
+     * @return false if the pixels cannot be moved, in which case the caller must invalidate
+     *         the area.
+     */
+    virtual bool scrollArea(const Rect& area, int16_t deltaX, int16_t deltaY) = 0;
+
+    /**
+     * @fn static bool FrameBufferScroller::scroll(Drawable& drawable, const Rect& area, int16_t deltaX, int16_t deltaY);
+     *
+     * @brief Moves the pixels of an area of a Drawable.
+     *
+     *        Moves the pixels of an area of a Drawable, clipped to the visible part of the
+     *        Drawable. Nothing is moved if the Drawable is not part of the current screen, or
+     *        if a visible Drawable in front of it overlaps the area, as that Drawable would
+     *        be moved as well.
+     *
+     *        The pixels of the area must only depend on the drawables being moved, i.e. the
+     *        moved drawables must be opaque and cover the area, and drawables behind them
+     *        must not show through. The caller must invalidate the parts of its own
+     *        children which are not moved, e.g. overlays, both at their position and at
+     *        their position moved by the distance.
+     *
+     * @param [in] drawable The Drawable.
+     * @param area          The area, relative to the Drawable.
+     * @param deltaX        The horizontal distance to move the pixels.
+     * @param deltaY        The vertical distance to move the pixels.
+     *
+     * @return false if the pixels cannot be moved, in which case the caller must invalidate
+     *         the area.
+     */
+    static bool scroll(Drawable& drawable, const Rect& area, int16_t deltaX, int16_t deltaY);
+
+    /**
+     * @fn static FrameBufferScroller* FrameBufferScroller::getInstance()
+     *
+     * @brief Gets the instance.
+     *
+     *        Gets the instance.
+     *
+     * @return The instance, or 0 if none is registered.
+     */
+    static FrameBufferScroller* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * @fn static void FrameBufferScroller::setInstance(FrameBufferScroller* scroller)
+     *
+     * @brief Sets the instance.
+     *
+     *        Sets the instance.
+     *
+     * @param [in] scroller The instance, or 0 to disable scrolling.
+     */
+    static void setInstance(FrameBufferScroller* scroller)
+    {
+        instance = scroller;
+    }
+
+private:
+    static FrameBufferScroller* instance;
+};
+} // namespace touchgfx
+
+#endif // FRAMEBUFFERSCROLLER_HPP
@@ -785,6 +785,25 @@ public:
         USE_ANIMATION_STORAGE = animationStorage != 0;
     }
 
+    /**
+     * @fn void HAL::getFrameBufferStartAddresses(uint16_t*& frameBuffer, uint16_t*& doubleBuffer, uint16_t*& animationStorage) const
+     *
+     * @brief Gets the frame buffer start addresses.
+     *
+     *        Gets the frame buffer start addresses, as given to setFrameBufferStartAddresses().
+     *        Used to restore the frame buffers after drawing into another buffer.
+     *
+     * @param [out] frameBuffer      The frame buffer.
+     * @param [out] doubleBuffer     The double buffer, or 0 if double buffering is disabled.
+     * @param [out] animationStorage The animation storage, or 0 if it is disabled.
+     */
+    void getFrameBufferStartAddresses(uint16_t*& frameBuffer, uint16_t*& doubleBuffer, uint16_t*& animationStorage) const
+    {
+        frameBuffer = frameBuffer0;
+        doubleBuffer = frameBuffer1;
+        animationStorage = frameBuffer2;
+    }
+
     /**
      * @fn void HAL::setTouchSampleRate(int8_t sampleRateInTicks)
      *
@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef OFFSCREENRENDERER_HPP
+#define OFFSCREENRENDERER_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+namespace touchgfx
+{
+class Drawable;
+
+/**
+ * @class OffscreenRenderer OffscreenRenderer.hpp touchgfx/hal/OffscreenRenderer.hpp
+ *
+ * @brief Draws a Drawable into a buffer instead of the frame buffer.
+ *
+ *        Draws a Drawable into a buffer instead of the frame buffer, e.g. the memory of a
+ *        dynamic RGB565 bitmap. The drawing is done by the normal draw functions of the
+ *        Drawable and its children, with the frame buffer of the HAL temporarily pointing at
+ *        the buffer, so the result is identical to what the Drawable draws on the display.
+ *        This allows caching the appearance of a Drawable which is expensive to draw, and
+ *        blitting it instead of drawing it again.
+ *
+ * @note Only 16 bpp displays without rotation are supported.
+ *
+ * @see CachedListItem
+ */
+class OffscreenRenderer
+{
+public:
+
+    /**
+     * @fn static void OffscreenRenderer::render(Drawable& drawable, uint16_t* buffer, colortype background);
+     *
+     * @brief Draws a Drawable into a buffer.
+     *
+     *        Draws a Drawable into a buffer, as wide and high as the Drawable. The buffer is
+     *        first filled with the background color, then the Drawable, including all its
+     *        children if it is a Container, is drawn on top. The Drawable is drawn even if it
+     *        is outside the display, but it must not be wider or higher than the display.
+     *
+     *        Must not be called while drawing, i.e. from the draw() function of a Drawable.
+     *        Any blit operations pending on the DMA are completed before returning.
+     *
+     * @param [in] drawable The Drawable to draw.
+     * @param [out] buffer  The buffer for the RGB565 pixels, line by line without padding.
+     * @param background    The color of the pixels not covered by the Drawable.
+     */
+    static void render(Drawable& drawable, uint16_t* buffer, colortype background);
+};
+} // namespace touchgfx
+
+#endif // OFFSCREENRENDERER_HPP
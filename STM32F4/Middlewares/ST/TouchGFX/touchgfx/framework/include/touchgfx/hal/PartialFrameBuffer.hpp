@@ -0,0 +1,213 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef PARTIALFRAMEBUFFER_HPP
+#define PARTIALFRAMEBUFFER_HPP
+
+#include <touchgfx/hal/Types.hpp>
+#include <touchgfx/Callback.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class PartialFrameBuffer PartialFrameBuffer.hpp touchgfx/hal/PartialFrameBuffer.hpp
+ *
+ * @brief A ring of small strip buffers used instead of a full frame buffer.
+ *
+ *        A ring of small strip buffers used instead of a full frame buffer, for displays
+ *        with their own graphics RAM, connected through SPI or an 8080 parallel interface.
+ *        When given to AcceleratedMVPApplication::setPartialFrameBuffer(), each invalidated
+ *        area is drawn as a number of horizontal strips, each fitting in one strip buffer.
+ *        When a strip has been drawn, it is handed to the transmit callback, which must start
+ *        sending it to the display and return. While a strip is being sent, the next strip
+ *        is drawn into the next buffer of the ring. When all buffers are being sent,
+ *        drawing waits until the oldest transmission has completed.
+ *
+ *        The transfer complete interrupt of the display interface must call
+ *        transmitCompleted() once for every strip, in the order the strips were given to
+ *        the transmit callback.
+ *
+ *        The HAL must be set up without double buffering and animation storage, e.g. by
+ *        calling HAL::setFrameBufferStartAddresses(buffer, 0, 0). While a strip is drawn,
+ *        the frame buffer of the HAL points to a virtual frame buffer, as wide as the
+ *        strip, placed such that the strip falls within the strip buffer.
+ *
+ * @note Only 16 bpp displays without rotation are supported.
+ *
+ * @see AcceleratedMVPApplication::setPartialFrameBuffer
+ */
+class PartialFrameBuffer
+{
+public:
+
+    /**
+     * @fn PartialFrameBuffer::PartialFrameBuffer(uint16_t* buffer, uint32_t bufferSize, uint16_t numberOfBuffers, GenericCallback<const Rect&, const uint16_t*>& transmitCallback);
+     *
+     * @brief Constructor.
+     *
+     *        Constructor. The memory is divided into the given number of strip buffers of
+     *        equal size. Each strip buffer must be able to hold at least one line of the
+     *        display.
+     *
+     * @param [in] buffer           The memory used for the strip buffers.
+     * @param bufferSize            The size of the memory in bytes.
+     * @param numberOfBuffers       The number of strip buffers, at least 2 for drawing and
+     *                              sending at the same time.
+     * @param [in] transmitCallback The callback starting the transmission of a strip, with
+     *                              the area of the display and the pixels of the strip, line
+     *                              by line without padding.
+     */
+    PartialFrameBuffer(uint16_t* buffer, uint32_t bufferSize, uint16_t numberOfBuffers, GenericCallback<const Rect&, const uint16_t*>& transmitCallback);
+
+    /**
+     * @fn virtual PartialFrameBuffer::~PartialFrameBuffer()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor.
+     */
+    virtual ~PartialFrameBuffer()
+    {
+    }
+
+    /**
+     * @fn Rect PartialFrameBuffer::beginStrip(const Rect& area);
+     *
+     * @brief Prepares the frame buffer for drawing the top strip of an area.
+     *
+     *        Prepares the frame buffer for drawing the top strip of an area. Waits for a free
+     *        strip buffer, and points the frame buffer of the HAL at it. The strip is as high
+     *        as the strip buffer allows for the width of the area.
+     *
+     * @param area The remaining area to draw, in absolute coordinates.
+     *
+     * @return The strip to draw.
+     */
+    Rect beginStrip(const Rect& area);
+
+    /**
+     * @fn void PartialFrameBuffer::endStrip(const Rect& strip);
+     *
+     * @brief Transmits a strip once it has been drawn.
+     *
+     *        Transmits a strip once it has been drawn. Waits for the DMA to finish drawing
+     *        the strip, and passes it to the transmit callback.
+     *
+     * @param strip The strip returned by beginStrip().
+     */
+    void endStrip(const Rect& strip);
+
+    /**
+     * @fn void PartialFrameBuffer::transmitCompleted()
+     *
+     * @brief Signals that the oldest strip has been sent.
+     *
+     *        Signals that the oldest strip has been sent, and its buffer can be reused.
+     *        Can be called from an interrupt.
+     */
+    void transmitCompleted()
+    {
+        transmitted = transmitted + 1;
+    }
+
+    /**
+     * @fn bool PartialFrameBuffer::isTransmitting() const
+     *
+     * @brief Query if any strips are being sent.
+     *
+     *        Query if any strips are being sent.
+     *
+     * @return true if transmitCompleted() has not been called for all strips.
+     */
+    bool isTransmitting() const
+    {
+        return getNumberOfTransmits() != 0;
+    }
+
+    /**
+     * @fn void PartialFrameBuffer::flush();
+     *
+     * @brief Waits until all strips have been sent.
+     *
+     *        Waits until all strips have been sent.
+     */
+    void flush();
+
+    /**
+     * @fn uint16_t PartialFrameBuffer::getNumberOfBuffers() const
+     *
+     * @brief Gets the number of strip buffers.
+     *
+     *        Gets the number of strip buffers.
+     *
+     * @return The number of strip buffers.
+     */
+    uint16_t getNumberOfBuffers() const
+    {
+        return numberOfBuffers;
+    }
+
+    /**
+     * @fn uint32_t PartialFrameBuffer::getBufferPixels() const
+     *
+     * @brief Gets the number of pixels in each strip buffer.
+     *
+     *        Gets the number of pixels in each strip buffer.
+     *
+     * @return The number of pixels.
+     */
+    uint32_t getBufferPixels() const
+    {
+        return bufferPixels;
+    }
+
+protected:
+
+    /**
+     * @fn virtual void PartialFrameBuffer::waitForTransmit()
+     *
+     * @brief Called repeatedly while waiting for a strip to be sent.
+     *
+     *        Called repeatedly while waiting for transmitCompleted() to be called. The
+     *        default implementation returns immediately, i.e. waiting is busy waiting.
+     */
+    virtual void waitForTransmit()
+    {
+    }
+
+    /**
+     * @fn uint16_t PartialFrameBuffer::getNumberOfTransmits() const
+     *
+     * @brief Gets the number of strips being sent.
+     *
+     *        Gets the number of strips given to the transmit callback, for which
+     *        transmitCompleted() has not yet been called.
+     *
+     * @return The number of strips.
+     */
+    uint16_t getNumberOfTransmits() const
+    {
+        return static_cast<uint16_t>(queued - transmitted);
+    }
+
+    uint16_t* buffers;                                            ///< The strip buffers.
+    uint32_t bufferPixels;                                        ///< The number of pixels in each strip buffer.
+    uint16_t numberOfBuffers;                                     ///< The number of strip buffers.
+    uint16_t nextBuffer;                                          ///< The index of the strip buffer used for the next strip.
+    uint16_t queued;                                              ///< The number of strips given to the transmit callback, wrapping around.
+    volatile uint16_t transmitted;                                ///< The number of strips sent, wrapping around. Only written by transmitCompleted().
+    GenericCallback<const Rect&, const uint16_t*>& transmitCallback; ///< The callback starting the transmission of a strip.
+};
+} // namespace touchgfx
+
+#endif // PARTIALFRAMEBUFFER_HPP
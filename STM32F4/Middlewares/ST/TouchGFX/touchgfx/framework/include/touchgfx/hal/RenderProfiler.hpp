@@ -0,0 +1,347 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef RENDERPROFILER_HPP
+#define RENDERPROFILER_HPP
+
+#include <touchgfx/hal/Types.hpp>
+#include <platform/core/MCUInstrumentation.hpp>
+#ifdef SIMULATOR
+#include <stdio.h>
+#endif
+
+namespace touchgfx
+{
+class Drawable;
+class Screen;
+
+/**
+ * @class RenderProfiler RenderProfiler.hpp touchgfx/hal/RenderProfiler.hpp
+ *
+ * @brief Records where the time of each frame is spent.
+ *
+ *        Records where the time of each frame is spent: the time and pixels of every
+ *        Drawable::draw() issued by AcceleratedMVPApplication, the time spent waiting for the
+ *        DMA, and the area invalidated in each frame. The events are stored in a fixed ring
+ *        buffer, overwriting the oldest events when full, and are read with getEvent() or
+ *        dump().
+ *
+ *        Profiling is opt-in: nothing is recorded until a profiler is registered with
+ *        setInstance(). The time stamps are the CPU cycles of the given MCUInstrumentation,
+ *        e.g. the cycle counter of the MCU on target.
+ *
+ *        AcceleratedMVPApplication records the draws and the invalidated area. The HAL must
+ *        call beginFrame() and endFrame() from its beginFrame() and endFrame(), and time its
+ *        flushDMA() with addDMAWait(), like HALHeadless does. When AcceleratedMVPApplication
+ *        cannot cull the drawables of an area, the whole screen is drawn by the closed
+ *        framework code, and the draw is recorded for the Screen instead.
+ *
+ * @see MCUInstrumentation
+ */
+class RenderProfiler
+{
+public:
+
+    /**
+     * @enum EventType
+     *
+     * @brief Values that represent the kinds of events.
+     *
+     *        Values that represent the kinds of events.
+     */
+    enum EventType
+    {
+        FRAME,   ///< A frame, from HAL::beginFrame() to HAL::endFrame(). The pixels are the invalidated area.
+        DRAW,    ///< A Drawable or Screen drawing part of itself. The pixels are the area drawn.
+        DMA_WAIT ///< Waiting for the DMA in HAL::flushDMA().
+    };
+
+    /**
+     * @struct Event RenderProfiler.hpp touchgfx/hal/RenderProfiler.hpp
+     *
+     * @brief A recorded event.
+     *
+     *        A recorded event.
+     */
+    struct Event
+    {
+        EventType type;       ///< The kind of event.
+        uint32_t frameNumber; ///< The number of the frame the event occurred in.
+        uint32_t start;       ///< The CPU cycles when the event started.
+        uint32_t duration;    ///< The CPU cycles spent.
+        uint32_t pixels;      ///< The number of pixels drawn or invalidated.
+        const void* object;   ///< The Drawable or Screen drawn, 0 for other events.
+        const char* typeName; ///< The type name of the object as given by typeid, or 0 if unknown.
+    };
+
+    /**
+     * @fn RenderProfiler::RenderProfiler(MCUInstrumentation& instrumentation, uint32_t clockFrequency, Event* buffer, uint16_t capacity);
+     *
+     * @brief Constructor.
+     *
+     *        Constructor.
+     *
+     * @param [in] instrumentation The instrumentation giving the CPU cycles.
+     * @param clockFrequency       The clock frequency of the CPU cycles in MHz, as given to
+     *                             MCUInstrumentation::getElapsedUS().
+     * @param [in] buffer          The memory for the ring buffer of events.
+     * @param capacity             The number of events in the buffer.
+     */
+    RenderProfiler(MCUInstrumentation& instrumentation, uint32_t clockFrequency, Event* buffer, uint16_t capacity);
+
+    /**
+     * @fn virtual RenderProfiler::~RenderProfiler()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Unregisters the instance.
+     */
+    virtual ~RenderProfiler()
+    {
+        if (instance == this)
+        {
+            instance = 0;
+        }
+    }
+
+    /**
+     * @fn uint32_t RenderProfiler::getCPUCycles()
+     *
+     * @brief Gets the current CPU cycles.
+     *
+     *        Gets the current CPU cycles, used as the start of an event.
+     *
+     * @return The CPU cycles.
+     */
+    uint32_t getCPUCycles()
+    {
+        return instrumentation.getCPUCycles();
+    }
+
+    /**
+     * @fn void RenderProfiler::beginFrame();
+     *
+     * @brief Starts a frame.
+     *
+     *        Starts a frame. Called by the HAL when it begins a frame.
+     */
+    void beginFrame();
+
+    /**
+     * @fn void RenderProfiler::endFrame();
+     *
+     * @brief Ends a frame.
+     *
+     *        Ends a frame and records it. Called by the HAL when it ends a frame.
+     */
+    void endFrame();
+
+    /**
+     * @fn void RenderProfiler::addInvalidatedArea(uint32_t area)
+     *
+     * @brief Adds to the area invalidated in the current frame.
+     *
+     *        Adds to the area invalidated in the current frame.
+     *
+     * @param area The number of pixels.
+     */
+    void addInvalidatedArea(uint32_t area)
+    {
+        invalidatedArea += area;
+    }
+
+    /**
+     * @fn void RenderProfiler::addDraw(const Drawable& drawable, uint32_t start, uint32_t pixels);
+     *
+     * @brief Records a Drawable drawing part of itself.
+     *
+     *        Records a Drawable drawing part of itself, ending now.
+     *
+     * @param drawable The Drawable.
+     * @param start    The CPU cycles when the draw started.
+     * @param pixels   The number of pixels drawn.
+     */
+    void addDraw(const Drawable& drawable, uint32_t start, uint32_t pixels);
+
+    /**
+     * @fn void RenderProfiler::addDraw(const Screen& screen, uint32_t start, uint32_t pixels);
+     *
+     * @brief Records a Screen drawing an area with all its drawables.
+     *
+     *        Records a Screen drawing an area with all its drawables, ending now.
+     *
+     * @param screen The Screen.
+     * @param start  The CPU cycles when the draw started.
+     * @param pixels The number of pixels drawn.
+     */
+    void addDraw(const Screen& screen, uint32_t start, uint32_t pixels);
+
+    /**
+     * @fn void RenderProfiler::addDMAWait(uint32_t start);
+     *
+     * @brief Records waiting for the DMA.
+     *
+     *        Records waiting for the DMA, ending now.
+     *
+     * @param start The CPU cycles when the wait started.
+     */
+    void addDMAWait(uint32_t start);
+
+    /**
+     * @fn uint16_t RenderProfiler::getNumberOfEvents() const
+     *
+     * @brief Gets the number of events in the buffer.
+     *
+     *        Gets the number of events in the buffer.
+     *
+     * @return The number of events.
+     */
+    uint16_t getNumberOfEvents() const
+    {
+        return numberOfEvents;
+    }
+
+    /**
+     * @fn uint32_t RenderProfiler::getNumberOfLostEvents() const
+     *
+     * @brief Gets the number of events overwritten because the buffer was full.
+     *
+     *        Gets the number of events overwritten because the buffer was full since the
+     *        last clear().
+     *
+     * @return The number of lost events.
+     */
+    uint32_t getNumberOfLostEvents() const
+    {
+        return lostEvents;
+    }
+
+    /**
+     * @fn const Event& RenderProfiler::getEvent(uint16_t index) const;
+     *
+     * @brief Gets an event in the buffer.
+     *
+     *        Gets an event in the buffer, the oldest event first. Events are recorded when
+     *        they end, so a frame is recorded after the events inside it.
+     *
+     * @param index The index of the event, less than getNumberOfEvents().
+     *
+     * @return The event.
+     */
+    const Event& getEvent(uint16_t index) const;
+
+    /**
+     * @fn uint16_t RenderProfiler::dump(Event* events, uint16_t maxEvents);
+     *
+     * @brief Moves the oldest events out of the buffer.
+     *
+     *        Moves the oldest events out of the buffer, making room for new events.
+     *
+     * @param [out] events The events.
+     * @param maxEvents    The maximum number of events to move.
+     *
+     * @return The number of events moved.
+     */
+    uint16_t dump(Event* events, uint16_t maxEvents);
+
+    /**
+     * @fn void RenderProfiler::clear();
+     *
+     * @brief Removes all events.
+     *
+     *        Removes all events and resets the number of lost events.
+     */
+    void clear();
+
+    /**
+     * @fn unsigned int RenderProfiler::getElapsedUS(uint32_t start, uint32_t end)
+     *
+     * @brief Converts CPU cycles to microseconds.
+     *
+     *        Converts the CPU cycles between two time stamps to microseconds.
+     *
+     * @param start The start time stamp.
+     * @param end   The end time stamp.
+     *
+     * @return The microseconds.
+     */
+    unsigned int getElapsedUS(uint32_t start, uint32_t end)
+    {
+        return instrumentation.getElapsedUS(start, end, clockFrequency);
+    }
+
+#ifdef SIMULATOR
+
+    /**
+     * @fn bool RenderProfiler::writeChromeTrace(FILE* file);
+     *
+     * @brief Writes the events in the Chrome trace event format.
+     *
+     *        Writes the events in the buffer as JSON in the Trace Event Format, which can be
+     *        opened in chrome://tracing or Perfetto. Frames, draws and DMA waits are shown as
+     *        three separate tracks, with the draws named by the type of the drawable.
+     *
+     * @param [in] file The file.
+     *
+     * @return false if writing to the file failed.
+     */
+    bool writeChromeTrace(FILE* file);
+#endif
+
+    /**
+     * @fn static RenderProfiler* RenderProfiler::getInstance()
+     *
+     * @brief Gets the instance.
+     *
+     *        Gets the instance.
+     *
+     * @return The instance, or 0 if profiling is disabled.
+     */
+    static RenderProfiler* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * @fn static void RenderProfiler::setInstance(RenderProfiler* profiler)
+     *
+     * @brief Sets the instance.
+     *
+     *        Sets the instance, enabling profiling.
+     *
+     * @param [in] profiler The instance, or 0 to disable profiling.
+     */
+    static void setInstance(RenderProfiler* profiler)
+    {
+        instance = profiler;
+    }
+
+private:
+    void addEvent(EventType type, uint32_t start, uint32_t pixels, const void* object, const char* typeName);
+
+    MCUInstrumentation& instrumentation;
+    uint32_t clockFrequency;
+    Event* events;
+    uint16_t capacity;
+    uint16_t firstEvent;
+    uint16_t numberOfEvents;
+    uint32_t lostEvents;
+    uint32_t frameNumber;
+    uint32_t frameStart;
+    uint32_t invalidatedArea;
+
+    static RenderProfiler* instance;
+};
+} // namespace touchgfx
+
+#endif // RENDERPROFILER_HPP
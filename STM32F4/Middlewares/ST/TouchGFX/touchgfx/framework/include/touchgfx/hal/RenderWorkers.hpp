@@ -0,0 +1,291 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef RENDERWORKERS_HPP
+#define RENDERWORKERS_HPP
+
+#include <touchgfx/hal/Types.hpp>
+#include <touchgfx/Callback.hpp>
+#include <cassert>
+
+namespace touchgfx
+{
+/**
+ * @class RenderWorkers RenderWorkers.hpp touchgfx/hal/RenderWorkers.hpp
+ *
+ * @brief A pool of workers drawing disjoint areas of a frame in parallel.
+ *
+ *        A pool of workers drawing disjoint areas of a frame in parallel, e.g. threads on
+ *        the simulator or the cores of a dual-core MCU. When an instance is registered with
+ *        setInstance(), AcceleratedMVPApplication splits the dirty region of each frame into
+ *        pieces, finds the drawables to draw in each piece on the GUI task, and lets the
+ *        workers draw the pieces. All pieces are drawn before the frame ends.
+ *
+ *        The GUI task is worker 0 and the other workers only draw while execute() runs, so
+ *        the draw chain, timer widgets etc. are never touched concurrently. Shared state
+ *        used while drawing is protected as follows:
+ *        - Each worker has its own CanvasWidgetRenderer buffer, set up with
+ *          CanvasWidgetRenderer::setupBuffer() for every worker.
+ *        - Drawables must not modify shared state while drawing, as the same drawable can be
+ *          drawn by several workers at once. Objects which are modified, such as the painters
+ *          of canvas widgets, are locked with lockObject().
+ *        - The glyph cache, bitmap cache and render profiler are used under a shared lock.
+ *          See lockShared(). An object lock may be held while taking the shared lock, but
+ *          not the other way around.
+ *        - The DMA queue is not thread safe, so the HAL must report no blit capabilities in
+ *          HAL::getBlitCaps() while isDrawing(), making the LCD draw in software, like
+ *          HALHeadless does. AcceleratedMVPApplication flushes the DMA before the workers
+ *          start.
+ *        - Locking the frame buffer must not block the other workers, i.e. the frame buffer
+ *          semaphore of the OSWrappers must allow concurrent drawing while isDrawing().
+ *
+ * @see AcceleratedMVPApplication
+ */
+class RenderWorkers
+{
+public:
+
+    static const uint8_t MAX_WORKERS = 4;      ///< Maximum number of workers, including the GUI task. @remarks Memory impact: one CanvasWidgetRenderer context per worker
+    static const uint8_t NUMBER_OF_LOCKS = 8;  ///< Number of locks: the shared lock and the locks objects are hashed to.
+
+    /**
+     * @fn virtual RenderWorkers::~RenderWorkers()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Unregisters the instance.
+     */
+    virtual ~RenderWorkers()
+    {
+        if (instance == this)
+        {
+            instance = 0;
+        }
+    }
+
+    /**
+     * @fn virtual uint8_t RenderWorkers::getNumberOfWorkers() const = 0;
+     *
+     * @brief Gets the number of workers.
+     *
+     *        Gets the number of workers, including the GUI task.
+     *
+     * @return The number of workers, at most MAX_WORKERS.
+     */
+    virtual uint8_t getNumberOfWorkers() const = 0;
+
+    /**
+     * @fn void RenderWorkers::execute(GenericCallback<uint8_t>& job);
+     *
+     * @brief Runs a job on all workers.
+     *
+     *        Runs a job on all workers at the same time, and returns when all workers have
+     *        finished. The job is called once on each worker with the index of the worker,
+     *        the GUI task calling it with index 0.
+     *
+     * @param [in] job The job.
+     */
+    void execute(GenericCallback<uint8_t>& job);
+
+    /**
+     * @fn static bool RenderWorkers::isDrawing()
+     *
+     * @brief Query if the workers are drawing.
+     *
+     *        Query if the workers are drawing, i.e. if execute() is running.
+     *
+     * @return true if the workers are drawing.
+     */
+    static bool isDrawing()
+    {
+        return drawing;
+    }
+
+    /**
+     * @fn static uint8_t RenderWorkers::getCurrentWorker()
+     *
+     * @brief Gets the index of the calling worker.
+     *
+     *        Gets the index of the calling worker.
+     *
+     * @return The index of the worker, 0 when the workers are not drawing.
+     */
+    static uint8_t getCurrentWorker()
+    {
+        return drawing ? instance->getWorkerIndex() : 0;
+    }
+
+    /**
+     * @fn static void RenderWorkers::lockShared()
+     *
+     * @brief Locks the state shared by all drawables.
+     *
+     *        Locks the state shared by all drawables, such as the glyph and bitmap caches,
+     *        while the workers are drawing. Does nothing when they are not.
+     */
+    static void lockShared()
+    {
+        if (drawing)
+        {
+            instance->lock(0);
+        }
+    }
+
+    /**
+     * @fn static void RenderWorkers::unlockShared()
+     *
+     * @brief Unlocks the state shared by all drawables.
+     *
+     *        Unlocks the state shared by all drawables.
+     *
+     * @see lockShared
+     */
+    static void unlockShared()
+    {
+        if (drawing)
+        {
+            instance->unlock(0);
+        }
+    }
+
+    /**
+     * @fn static void RenderWorkers::lockObject(const void* object)
+     *
+     * @brief Locks an object modified while drawing.
+     *
+     *        Locks an object modified while drawing, which may be used by drawables drawn by
+     *        other workers, e.g. a painter shared by several canvas widgets. Does nothing
+     *        when the workers are not drawing. The objects are hashed to NUMBER_OF_LOCKS - 1
+     *        locks, so a worker must not lock more than one object at a time.
+     *
+     * @param object The object.
+     */
+    static void lockObject(const void* object)
+    {
+        if (drawing)
+        {
+            instance->lock(getLockIndex(object));
+        }
+    }
+
+    /**
+     * @fn static void RenderWorkers::unlockObject(const void* object)
+     *
+     * @brief Unlocks an object.
+     *
+     *        Unlocks an object.
+     *
+     * @param object The object.
+     *
+     * @see lockObject
+     */
+    static void unlockObject(const void* object)
+    {
+        if (drawing)
+        {
+            instance->unlock(getLockIndex(object));
+        }
+    }
+
+    /**
+     * @fn static RenderWorkers* RenderWorkers::getInstance()
+     *
+     * @brief Gets the instance.
+     *
+     *        Gets the instance.
+     *
+     * @return The instance, or 0 if drawing is done by the GUI task alone.
+     */
+    static RenderWorkers* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * @fn static void RenderWorkers::setInstance(RenderWorkers* workers)
+     *
+     * @brief Sets the instance.
+     *
+     *        Sets the instance, enabling parallel drawing. Must not be called while drawing.
+     *
+     * @param [in] workers The instance, or 0 to draw on the GUI task alone.
+     */
+    static void setInstance(RenderWorkers* workers)
+    {
+        assert(!drawing && "Render workers changed while drawing");
+        assert((workers == 0 || (workers->getNumberOfWorkers() > 0 && workers->getNumberOfWorkers() <= MAX_WORKERS)) && "Invalid number of render workers");
+        instance = workers;
+    }
+
+protected:
+
+    /**
+     * @fn virtual void RenderWorkers::runJob(GenericCallback<uint8_t>& job) = 0;
+     *
+     * @brief Runs a job on all workers.
+     *
+     *        Runs a job on all workers, calling it with index 0 on the calling task, and
+     *        waits for all workers to finish.
+     *
+     * @param [in] job The job.
+     *
+     * @see execute
+     */
+    virtual void runJob(GenericCallback<uint8_t>& job) = 0;
+
+    /**
+     * @fn virtual uint8_t RenderWorkers::getWorkerIndex() const = 0;
+     *
+     * @brief Gets the index of the calling worker.
+     *
+     *        Gets the index of the calling worker while a job runs.
+     *
+     * @return The index of the worker.
+     */
+    virtual uint8_t getWorkerIndex() const = 0;
+
+    /**
+     * @fn virtual void RenderWorkers::lock(uint8_t index) = 0;
+     *
+     * @brief Takes a lock.
+     *
+     *        Takes a lock, waiting for other workers holding it.
+     *
+     * @param index The index of the lock, less than NUMBER_OF_LOCKS.
+     */
+    virtual void lock(uint8_t index) = 0;
+
+    /**
+     * @fn virtual void RenderWorkers::unlock(uint8_t index) = 0;
+     *
+     * @brief Releases a lock.
+     *
+     *        Releases a lock.
+     *
+     * @param index The index of the lock, less than NUMBER_OF_LOCKS.
+     */
+    virtual void unlock(uint8_t index) = 0;
+
+private:
+    static uint8_t getLockIndex(const void* object)
+    {
+        // Objects with state are at least word aligned
+        return static_cast<uint8_t>(1 + (reinterpret_cast<uintptr_t>(object) >> 2) % (NUMBER_OF_LOCKS - 1));
+    }
+
+    static RenderWorkers* instance;
+    static bool drawing;
+};
+} // namespace touchgfx
+
+#endif // RENDERWORKERS_HPP
@@ -0,0 +1,269 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef CACHEDLISTITEM_HPP
+#define CACHEDLISTITEM_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/Drawable.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/hal/OffscreenRenderer.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class CachedListItem CachedListItem.hpp touchgfx/mixins/CachedListItem.hpp
+ *
+ * @brief This mixin caches the appearance of an item of a DrawableList in a dynamic bitmap.
+ *
+ *        This mixin caches the appearance of an item of a DrawableList, ScrollList or
+ *        ScrollWheel in a dynamic bitmap. The item, typically a Container with a number of
+ *        widgets, is rendered into the bitmap the first time it is drawn after showing new
+ *        data. While the list scrolls, the bitmap is simply blitted instead of drawing all
+ *        the widgets of the item again in every frame.
+ *
+ *        The data shown is identified by a cache key, consisting of the index of the item
+ *        and a version number, which must be given to setCacheKey() by the update callback
+ *        of the list. The application must change the version, and call itemChanged() on
+ *        the list, when the data of an item changes. When a drawable is reused for an item
+ *        that scrolls into view, or the version changes, the cache is rendered again.
+ *        Drawables reused for the item they already show, e.g. when scrolling back and
+ *        forth, are not rendered again.
+ *
+ *        The cache is opaque: the pixels not covered by the item are filled with the cache
+ *        background color, which should be the color behind the list. If a dynamic bitmap
+ *        cannot be created, the item is drawn normally.
+ *
+ * @note Requires a 16 bpp display without rotation, and a bitmap cache for the dynamic
+ *       bitmaps, one for each drawable of the list.
+ *
+ * @tparam T The type of Drawable to add this functionality to.
+ *
+ * @see OffscreenRenderer
+ */
+template <class T>
+class CachedListItem : public T
+{
+public:
+
+    /**
+     * @fn CachedListItem::CachedListItem()
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor. Initializes the CachedListItem with a black cache
+     *        background color and no cache.
+     */
+    CachedListItem() : T(), cacheBitmap(BITMAP_INVALID), cacheColor(0), itemIndex(-1), version(0), cachedItemIndex(-1), cachedVersion(0), cacheValid(false)
+    {
+    }
+
+    /**
+     * @fn virtual CachedListItem::~CachedListItem()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Deletes the dynamic bitmap holding the cache.
+     */
+    virtual ~CachedListItem()
+    {
+        if (cacheBitmap != BITMAP_INVALID)
+        {
+            Bitmap::dynamicBitmapDelete(cacheBitmap);
+        }
+    }
+
+    /**
+     * @fn void CachedListItem::setCacheKey(int16_t item, uint32_t dataVersion)
+     *
+     * @brief Sets the item and version of the data shown.
+     *
+     *        Sets the item and version of the data shown, to be called from the update
+     *        callback of the list. If they differ from the cached item and version, the
+     *        cache is rendered again before the item is drawn.
+     *
+     * @param item        The index of the item.
+     * @param dataVersion The version of the data of the item.
+     */
+    void setCacheKey(int16_t item, uint32_t dataVersion)
+    {
+        itemIndex = item;
+        version = dataVersion;
+    }
+
+    /**
+     * @fn void CachedListItem::invalidateCache()
+     *
+     * @brief Renders the cache again before the item is drawn.
+     *
+     *        Renders the cache again before the item is drawn, e.g. when the appearance has
+     *        changed without a change of the version of the data.
+     */
+    void invalidateCache()
+    {
+        cacheValid = false;
+    }
+
+    /**
+     * @fn bool CachedListItem::isCached() const
+     *
+     * @brief Query if the cache holds the current appearance of the item.
+     *
+     *        Query if the cache holds the current appearance of the item.
+     *
+     * @return true if the item is drawn from the cache.
+     */
+    bool isCached() const
+    {
+        return cacheValid && cachedItemIndex == itemIndex && cachedVersion == version;
+    }
+
+    /**
+     * @fn void CachedListItem::setCacheBackgroundColor(colortype color)
+     *
+     * @brief Sets the color of the pixels in the cache not covered by the item.
+     *
+     *        Sets the color of the pixels in the cache not covered by the item, and renders
+     *        the cache again before the item is drawn.
+     *
+     * @param color The color.
+     */
+    void setCacheBackgroundColor(colortype color)
+    {
+        cacheColor = color;
+        invalidateCache();
+    }
+
+    /**
+     * @fn virtual void CachedListItem::draw(const Rect& invalidatedArea) const
+     *
+     * @brief Overrides the draw function.
+     *
+     *        Overrides the draw function. If the cache holds the current appearance, the
+     *        invalidated part of it is blitted. If not, the base class version of draw is
+     *        called.
+     *
+     * @param invalidatedArea The subregion of this Drawable which needs to be redrawn.
+     */
+    virtual void draw(const Rect& invalidatedArea) const
+    {
+        if (isCached())
+        {
+            Rect absRect(0, 0, T::getWidth(), T::getHeight());
+            T::translateRectToAbsolute(absRect);
+            HAL::lcd().blitCopy(reinterpret_cast<const uint16_t*>(Bitmap::dynamicBitmapGetAddress(cacheBitmap)), absRect, invalidatedArea, 255, false);
+        }
+        else
+        {
+            T::draw(invalidatedArea);
+        }
+    }
+
+    /**
+     * @fn virtual Rect CachedListItem::getSolidRect() const
+     *
+     * @brief Gets solid rectangle.
+     *
+     *        Gets solid rectangle. The cache is opaque, so the entire item is solid when
+     *        drawn from the cache.
+     *
+     * @return The solid rectangle.
+     */
+    virtual Rect getSolidRect() const
+    {
+        if (isCached())
+        {
+            return Rect(0, 0, T::getWidth(), T::getHeight());
+        }
+        return T::getSolidRect();
+    }
+
+    /**
+     * @fn virtual void CachedListItem::setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+     *
+     * @brief Add to draw chain.
+     *
+     *        Add to draw chain. Renders the cache if it does not hold the current
+     *        appearance, and adds only this item, instead of its children, to the draw chain.
+     *
+     * @note For TouchGFX internal use only.
+     *
+     * @param invalidatedArea              Include drawables that intersect with this area only.
+     * @param [in,out] nextPreviousElement Modifiable element in linked list.
+     */
+    virtual void setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+    {
+        T::resetDrawChainCache();
+        if (!T::isVisible())
+        {
+            return;
+        }
+        if (updateCache())
+        {
+            T::nextDrawChainElement = *nextPreviousElement;
+            *nextPreviousElement = this;
+        }
+        else
+        {
+            T::setupDrawChain(invalidatedArea, nextPreviousElement);
+        }
+    }
+
+private:
+    BitmapId cacheBitmap;
+    colortype cacheColor;
+    int16_t itemIndex;
+    uint32_t version;
+    int16_t cachedItemIndex;
+    uint32_t cachedVersion;
+    bool cacheValid;
+
+    bool updateCache()
+    {
+        if (isCached())
+        {
+            return true;
+        }
+        const int16_t width = T::getWidth();
+        const int16_t height = T::getHeight();
+        if (width <= 0 || height <= 0 || width > HAL::DISPLAY_WIDTH || height > HAL::DISPLAY_HEIGHT)
+        {
+            return false;
+        }
+
+        // The bitmap is kept while the size of the item is unchanged
+        if (cacheBitmap != BITMAP_INVALID && (Bitmap(cacheBitmap).getWidth() != width || Bitmap(cacheBitmap).getHeight() != height))
+        {
+            Bitmap::dynamicBitmapDelete(cacheBitmap);
+            cacheBitmap = BITMAP_INVALID;
+        }
+        if (cacheBitmap == BITMAP_INVALID)
+        {
+            cacheBitmap = Bitmap::dynamicBitmapCreate(width, height, Bitmap::RGB565);
+            if (cacheBitmap == BITMAP_INVALID)
+            {
+                return false;
+            }
+        }
+
+        OffscreenRenderer::render(*this, reinterpret_cast<uint16_t*>(Bitmap::dynamicBitmapGetAddress(cacheBitmap)), cacheColor);
+        T::resetDrawChainCache();
+        cachedItemIndex = itemIndex;
+        cachedVersion = version;
+        cacheValid = true;
+        return true;
+    }
+};
+} // namespace touchgfx
+#endif // CACHEDLISTITEM_HPP
@@ -0,0 +1,196 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCHEDULEDFADEANIMATOR_HPP
+#define SCHEDULEDFADEANIMATOR_HPP
+
+#include <touchgfx/AnimationScheduler.hpp>
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/mixins/FadeAnimator.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class ScheduledFadeAnimator ScheduledFadeAnimator.hpp touchgfx/mixins/ScheduledFadeAnimator.hpp
+ *
+ * @brief A FadeAnimator advanced by the AnimationScheduler.
+ *
+ *        A FadeAnimator whose animation is advanced by the AnimationScheduler instance instead
+ *        of being registered as a timer widget, so the number of running animations is not
+ *        limited by Application::MAX_TIMER_WIDGETS. The animation steps and the callback
+ *        are the same as for FadeAnimator. When there is no AnimationScheduler instance, the
+ *        animation is ticked as a timer widget like a FadeAnimator.
+ *
+ * @tparam T Specifies the type should have the fade animation capability.
+ *
+ * @see FadeAnimator
+ */
+template<class T>
+class ScheduledFadeAnimator : public FadeAnimator<T>
+{
+public:
+
+    /**
+     * @fn ScheduledFadeAnimator::ScheduledFadeAnimator()
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor.
+     */
+    ScheduledFadeAnimator() :
+        FadeAnimator<T>(),
+        fadeAnimationTickCallback(this, &ScheduledFadeAnimator::nextScheduledFadeAnimationStep),
+        fadeAnimation(fadeAnimationTickCallback)
+    {
+    }
+
+    /**
+     * @fn virtual ScheduledFadeAnimator::~ScheduledFadeAnimator()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Unschedules the animation.
+     */
+    virtual ~ScheduledFadeAnimator()
+    {
+    }
+
+    /**
+     * @fn void ScheduledFadeAnimator::startFadeAnimation(uint8_t endAlpha, uint16_t duration, EasingEquation alphaProgressionEquation = &EasingEquations::linearEaseNone)
+     *
+     * @brief Starts the fade animation.
+     *
+     *        Starts the fade animation like FadeAnimator::startFadeAnimation(), scheduling it
+     *        with the AnimationScheduler instance.
+     *
+     * @param endAlpha                 The alpha value of T at animation end.
+     * @param duration                 The duration of the animation measured in ticks.
+     * @param alphaProgressionEquation The equation that describes the development of the alpha
+     *                                 value during the animation.
+     */
+    void startFadeAnimation(uint8_t endAlpha, uint16_t duration, EasingEquation alphaProgressionEquation = &EasingEquations::linearEaseNone)
+    {
+        AnimationScheduler* scheduler = AnimationScheduler::getInstance();
+        if (!scheduler)
+        {
+            FadeAnimator<T>::startFadeAnimation(endAlpha, duration, alphaProgressionEquation);
+            return;
+        }
+
+        scheduler->schedule(fadeAnimation);
+
+        this->fadeAnimationCounter = 0;
+        this->fadeAnimationStartAlpha = T::getAlpha();
+        this->fadeAnimationEndAlpha = endAlpha;
+        this->fadeAnimationDuration = duration;
+        this->fadeAnimationAlphaEquation = alphaProgressionEquation;
+
+        this->fadeAnimationRunning = true;
+
+        if (this->fadeAnimationDelay == 0 && this->fadeAnimationDuration == 0)
+        {
+            nextScheduledFadeAnimationStep(); // Set end alpha and shut down
+        }
+    }
+
+    /**
+     * @fn void ScheduledFadeAnimator::cancelFadeAnimation()
+     *
+     * @brief Cancel fade animation.
+     */
+    void cancelFadeAnimation()
+    {
+        if (!fadeAnimation.isScheduled())
+        {
+            FadeAnimator<T>::cancelFadeAnimation();
+            return;
+        }
+
+        fadeAnimation.unschedule();
+        this->fadeAnimationRunning = false;
+    }
+
+protected:
+
+    /**
+     * @fn virtual void ScheduledFadeAnimator::handleTickEvent()
+     *
+     * @brief The tick handler.
+     *
+     *        The tick handler. Advances the animation only if it was started without an
+     *        AnimationScheduler and is ticked as a timer widget.
+     */
+    virtual void handleTickEvent()
+    {
+        if (fadeAnimation.isScheduled())
+        {
+            T::handleTickEvent();
+        }
+        else
+        {
+            FadeAnimator<T>::handleTickEvent();
+        }
+    }
+
+    /**
+     * @fn void ScheduledFadeAnimator::nextScheduledFadeAnimationStep()
+     *
+     * @brief Execute next step in the scheduled fade animation.
+     *
+     *        Execute next step in the scheduled fade animation and unschedule it if
+     *        necessary. The steps are those of FadeAnimator::nextFadeAnimationStep().
+     */
+    void nextScheduledFadeAnimationStep()
+    {
+        if (this->fadeAnimationRunning)
+        {
+            if (this->fadeAnimationCounter < this->fadeAnimationDelay)
+            {
+                // Just wait for the delay time to pass
+                this->fadeAnimationCounter++;
+            }
+            else
+            {
+                if (this->fadeAnimationCounter <= (uint32_t)(this->fadeAnimationDelay + this->fadeAnimationDuration))
+                {
+                    // Adjust the used animationCounter for the startup delay
+                    uint32_t actualAnimationCounter = this->fadeAnimationCounter - this->fadeAnimationDelay;
+
+                    int16_t deltaAlpha = (int16_t)this->fadeAnimationAlphaEquation(actualAnimationCounter, 0, this->fadeAnimationEndAlpha - this->fadeAnimationStartAlpha, this->fadeAnimationDuration);
+
+                    T::setAlpha(this->fadeAnimationStartAlpha + deltaAlpha);
+                    T::invalidate();
+
+                    this->fadeAnimationCounter++;
+                }
+                if (this->fadeAnimationCounter > (uint32_t)(this->fadeAnimationDelay + this->fadeAnimationDuration))
+                {
+                    // End of animation
+                    this->fadeAnimationRunning = false;
+                    this->fadeAnimationDuration = 0;
+                    fadeAnimation.unschedule();
+
+                    if (this->fadeAnimationEndedCallback && this->fadeAnimationEndedCallback->isValid())
+                    {
+                        this->fadeAnimationEndedCallback->execute(*this);
+                    }
+                }
+            }
+        }
+    }
+
+    Callback<ScheduledFadeAnimator<T> > fadeAnimationTickCallback; ///< Callback advancing the animation, called by the AnimationScheduler.
+    Animation fadeAnimation;                                       ///< The animation scheduled while running.
+};
+} //namespace touchgfx
+#endif // SCHEDULEDFADEANIMATOR_HPP
@@ -0,0 +1,206 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCHEDULEDMOVEANIMATOR_HPP
+#define SCHEDULEDMOVEANIMATOR_HPP
+
+#include <touchgfx/AnimationScheduler.hpp>
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/mixins/MoveAnimator.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class ScheduledMoveAnimator ScheduledMoveAnimator.hpp touchgfx/mixins/ScheduledMoveAnimator.hpp
+ *
+ * @brief A MoveAnimator advanced by the AnimationScheduler.
+ *
+ *        A MoveAnimator whose animation is advanced by the AnimationScheduler instance instead
+ *        of being registered as a timer widget, so the number of running animations is not
+ *        limited by Application::MAX_TIMER_WIDGETS. The animation steps and the callback
+ *        are the same as for MoveAnimator. When there is no AnimationScheduler instance, the
+ *        animation is ticked as a timer widget like a MoveAnimator.
+ *
+ *        MoveAnimator itself is left unchanged, as it is instantiated by precompiled
+ *        library widgets such as SlideMenu.
+ *
+ * @tparam T Specifies the type should have the move animation capability.
+ *
+ * @see MoveAnimator
+ */
+template<class T>
+class ScheduledMoveAnimator : public MoveAnimator<T>
+{
+public:
+
+    /**
+     * @fn ScheduledMoveAnimator::ScheduledMoveAnimator()
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor.
+     */
+    ScheduledMoveAnimator() :
+        MoveAnimator<T>(),
+        moveAnimationTickCallback(this, &ScheduledMoveAnimator::nextScheduledMoveAnimationStep),
+        moveAnimation(moveAnimationTickCallback)
+    {
+    }
+
+    /**
+     * @fn virtual ScheduledMoveAnimator::~ScheduledMoveAnimator()
+     *
+     * @brief Destructor.
+     *
+     *        Destructor. Unschedules the animation.
+     */
+    virtual ~ScheduledMoveAnimator()
+    {
+    }
+
+    /**
+     * @fn void ScheduledMoveAnimator::startMoveAnimation(int16_t endX, int16_t endY, uint16_t duration, EasingEquation xProgressionEquation = &EasingEquations::linearEaseNone, EasingEquation yProgressionEquation = &EasingEquations::linearEaseNone)
+     *
+     * @brief Starts the move animation.
+     *
+     *        Starts the move animation like MoveAnimator::startMoveAnimation(), scheduling it
+     *        with the AnimationScheduler instance.
+     *
+     * @param endX                 The X position of T at animation end.
+     * @param endY                 The Y position of T at animation end.
+     * @param duration             The duration of the animation measured in ticks.
+     * @param xProgressionEquation The equation that describes the development of the X position
+     *                             during the animation.
+     * @param yProgressionEquation The equation that describes the development of the Y position
+     *                             during the animation.
+     */
+    void startMoveAnimation(int16_t endX, int16_t endY, uint16_t duration, EasingEquation xProgressionEquation = &EasingEquations::linearEaseNone, EasingEquation yProgressionEquation = &EasingEquations::linearEaseNone)
+    {
+        AnimationScheduler* scheduler = AnimationScheduler::getInstance();
+        if (!scheduler)
+        {
+            MoveAnimator<T>::startMoveAnimation(endX, endY, duration, xProgressionEquation, yProgressionEquation);
+            return;
+        }
+
+        scheduler->schedule(moveAnimation);
+
+        this->moveAnimationCounter = 0;
+        this->moveAnimationStartX = T::getX();
+        this->moveAnimationStartY = T::getY();
+        this->moveAnimationEndX = endX;
+        this->moveAnimationEndY = endY;
+        this->moveAnimationDuration = duration;
+        this->moveAnimationXEquation = xProgressionEquation;
+        this->moveAnimationYEquation = yProgressionEquation;
+
+        this->moveAnimationRunning = true;
+
+        if (this->moveAnimationDelay == 0 && this->moveAnimationDuration == 0)
+        {
+            nextScheduledMoveAnimationStep(); // Set end position and shut down
+        }
+    }
+
+    /**
+     * @fn void ScheduledMoveAnimator::cancelMoveAnimation()
+     *
+     * @brief Cancel move animation.
+     *
+     *        Cancel move animation.
+     */
+    void cancelMoveAnimation()
+    {
+        if (!moveAnimation.isScheduled())
+        {
+            MoveAnimator<T>::cancelMoveAnimation();
+            return;
+        }
+
+        moveAnimation.unschedule();
+        this->moveAnimationRunning = false;
+    }
+
+protected:
+
+    /**
+     * @fn virtual void ScheduledMoveAnimator::handleTickEvent()
+     *
+     * @brief The tick handler.
+     *
+     *        The tick handler. Advances the animation only if it was started without an
+     *        AnimationScheduler and is ticked as a timer widget.
+     */
+    virtual void handleTickEvent()
+    {
+        if (moveAnimation.isScheduled())
+        {
+            T::handleTickEvent();
+        }
+        else
+        {
+            MoveAnimator<T>::handleTickEvent();
+        }
+    }
+
+    /**
+     * @fn void ScheduledMoveAnimator::nextScheduledMoveAnimationStep()
+     *
+     * @brief Execute next step in the scheduled move animation.
+     *
+     *        Execute next step in the scheduled move animation and unschedule it if
+     *        necessary. The steps are those of MoveAnimator::nextMoveAnimationStep().
+     */
+    void nextScheduledMoveAnimationStep()
+    {
+        if (this->moveAnimationRunning)
+        {
+            if (this->moveAnimationCounter < this->moveAnimationDelay)
+            {
+                // Just wait for the delay time to pass
+                this->moveAnimationCounter++;
+            }
+            else
+            {
+                if (this->moveAnimationCounter <= (uint32_t)(this->moveAnimationDelay + this->moveAnimationDuration))
+                {
+                    // Adjust the used animationCounter for the startup delay
+                    uint32_t actualAnimationCounter = this->moveAnimationCounter - this->moveAnimationDelay;
+
+                    int16_t deltaX = this->moveAnimationXEquation(actualAnimationCounter, 0, this->moveAnimationEndX - this->moveAnimationStartX, this->moveAnimationDuration);
+                    int16_t deltaY = this->moveAnimationYEquation(actualAnimationCounter, 0, this->moveAnimationEndY - this->moveAnimationStartY, this->moveAnimationDuration);
+
+                    T::moveTo(this->moveAnimationStartX + deltaX, this->moveAnimationStartY + deltaY);
+                    this->moveAnimationCounter++;
+                }
+                if (this->moveAnimationCounter > (uint32_t)(this->moveAnimationDelay + this->moveAnimationDuration))
+                {
+                    // End of animation
+                    this->moveAnimationRunning = false;
+                    this->moveAnimationCounter = 0;
+                    moveAnimation.unschedule();
+
+                    if (this->moveAnimationEndedCallback && this->moveAnimationEndedCallback->isValid())
+                    {
+                        this->moveAnimationEndedCallback->execute(*this);
+                    }
+                }
+            }
+        }
+    }
+
+    Callback<ScheduledMoveAnimator<T> > moveAnimationTickCallback; ///< Callback advancing the animation, called by the AnimationScheduler.
+    Animation moveAnimation;                                       ///< The animation scheduled while running.
+};
+} //namespace touchgfx
+#endif // SCHEDULEDMOVEANIMATOR_HPP
@@ -22,6 +22,7 @@
 #include <touchgfx/hal/Types.hpp>
 #include <touchgfx/EasingEquations.hpp>
 #include <touchgfx/widgets/Widget.hpp>
+#include <touchgfx/widgets/Image.hpp>
 
 namespace touchgfx
 {
@@ -33,7 +34,8 @@ class Widget;
  *
  * @brief A Transition that slides from one screen to the next.
  *
- *        A Transition that slides the new screen over the previous.
+ *        A Transition that slides the new screen over the previous. If a screen cache bitmap
+ *        is set, the new screen is drawn into it once, and only the bitmap is moved.
  *
  * @tparam templateDirection Type of the template direction.
  *
@@ -67,7 +69,7 @@ public:
     };
 
     /**
-     * @fn CoverTransition::CoverTransition(const uint8_t transitionSteps = 20) : Transition(), handleTickCallback(this, &CoverTransition::tickMoveDrawable), direction(templateDirection), animationSteps(transitionSteps), animationCounter(0), calculatedValue(0), movedToPos(0)
+     * @fn CoverTransition::CoverTransition(const uint8_t transitionSteps = 20) : Transition(), handleTickCallback(this, &CoverTransition::tickMoveDrawable), direction(templateDirection), animationSteps(transitionSteps), animationCounter(0), calculatedValue(0), movedToPos(0), solid(), cachedScreen(), screenCached(false)
      *
      * @brief Constructor.
      *
@@ -83,7 +85,9 @@ public:
           animationCounter(0),
           calculatedValue(0),
           movedToPos(0),
-          solid()
+          solid(),
+          cachedScreen(),
+          screenCached(false)
     {
         switch (direction)
         {
@@ -126,9 +130,9 @@ public:
      * @brief Handles the tick event when transitioning.
      *
      *        Handles the tick event when transitioning. It moves the
-     *        contents of the Screen's container. The direction of the
-     *        transition determines the direction the contents of the
-     *        container moves.
+     *        contents of the Screen's container, or the Image with the
+     *        cached Screen. The direction of the transition determines
+     *        the direction the contents of the container moves.
      */
     virtual void handleTickEvent()
     {
@@ -153,6 +157,11 @@ public:
             // Final step: stop the animation
             done = true;
             animationCounter = 0;
+            if (screenCached)
+            {
+                removeScreenCache(cachedScreen);
+                screenCached = false;
+            }
             return;
         }
 
@@ -214,7 +223,15 @@ public:
         }
 
         // Move children with delta value for X or Y
-        screenContainer->forEachChild(&handleTickCallback);
+        if (screenCached)
+        {
+            tickMoveDrawable(cachedScreen);
+            tickMoveDrawable(solid);
+        }
+        else
+        {
+            screenContainer->forEachChild(&handleTickCallback);
+        }
     }
 
     /**
@@ -229,6 +246,11 @@ public:
     virtual void tearDown()
     {
         screenContainer->remove(solid);
+        if (screenCached)
+        {
+            screenContainer->remove(cachedScreen);
+            screenCached = false;
+        }
     }
 
     /**
@@ -243,8 +265,18 @@ public:
     virtual void init()
     {
         Transition::init();
-        Callback<CoverTransition, Drawable&> initCallback(this, &CoverTransition::initMoveDrawable);
-        screenContainer->forEachChild(&initCallback);
+        // The widgets stay behind the cached Screen until the transition is done
+        screenCached = drawScreenCache(cachedScreen);
+        if (screenCached)
+        {
+            initMoveDrawable(cachedScreen);
+            screenContainer->add(cachedScreen);
+        }
+        else
+        {
+            Callback<CoverTransition, Drawable&> initCallback(this, &CoverTransition::initMoveDrawable);
+            screenContainer->forEachChild(&initCallback);
+        }
         screenContainer->add(solid);
     }
 
@@ -320,6 +352,8 @@ private:
     int16_t       calculatedValue;  ///< The calculated X or Y value for the snapshot and the children.
     int16_t       movedToPos;
     FullSolidRect solid;            ///< A solid rect that covers the entire screen to avoid copying elements outside
+    Image         cachedScreen;     ///< The Image with the cached Screen transitioning to, moved instead of its widgets.
+    bool          screenCached;     ///< True if the Screen transitioning to is cached.
 };
 } // namespace touchgfx
 #endif // COVERTRANSITION_HPP
@@ -20,6 +20,7 @@
 #include <touchgfx/containers/Container.hpp>
 #include <touchgfx/transitions/Transition.hpp>
 #include <touchgfx/widgets/SnapshotWidget.hpp>
+#include <touchgfx/widgets/Image.hpp>
 #include <touchgfx/hal/Types.hpp>
 #include <touchgfx/EasingEquations.hpp>
 
@@ -34,7 +35,8 @@ class Container;
  *
  *        A Transition that slides from one screen to the next. It does so by moving a
  *        SnapShotWidget with a snapshot of the Screen transitioning away from, and by moving
- *        the contents of Screen transitioning to.
+ *        the contents of Screen transitioning to. If a screen cache bitmap is set, the Screen
+ *        transitioning to is drawn into it once, and only the bitmap is moved.
  *
  * @tparam templateDirection Type of the template direction.
  *
@@ -46,7 +48,7 @@ class SlideTransition : public Transition
 public:
 
     /**
-     * @fn SlideTransition::SlideTransition(const uint8_t transitionSteps = 20) : Transition(), snapshot(), snapshotPtr(&snapshot), handleTickCallback(this, &SlideTransition::tickMoveDrawable), direction(templateDirection), animationSteps(transitionSteps), animationCounter(0), calculatedValue(0)
+     * @fn SlideTransition::SlideTransition(const uint8_t transitionSteps = 20) : Transition(), snapshot(), snapshotPtr(&snapshot), cachedScreen(), screenCached(false), handleTickCallback(this, &SlideTransition::tickMoveDrawable), direction(templateDirection), animationSteps(transitionSteps), animationCounter(0), calculatedValue(0)
      *
      * @brief Constructor.
      *
@@ -58,6 +60,8 @@ public:
         : Transition(),
           snapshot(),
           snapshotPtr(&snapshot),
+          cachedScreen(),
+          screenCached(false),
           handleTickCallback(this, &SlideTransition::tickMoveDrawable),
           direction(templateDirection),
           animationSteps(transitionSteps),
@@ -108,9 +112,9 @@ public:
      * @brief Handles the tick event when transitioning.
      *
      *        Handles the tick event when transitioning. It moves the contents of the Screen's
-     *        container and a SnapshotWidget with a snapshot of the previous Screen. The
-     *        direction of the transition determines the direction the contents of the
-     *        container and the SnapshotWidget moves.
+     *        container, or the Image with the cached Screen, and a SnapshotWidget with a
+     *        snapshot of the previous Screen. The direction of the transition determines the
+     *        direction the contents of the container and the SnapshotWidget moves.
      */
     virtual void handleTickEvent()
     {
@@ -141,6 +145,11 @@ public:
             // Final step: stop the animation
             done = true;
             animationCounter = 0;
+            if (screenCached)
+            {
+                removeScreenCache(cachedScreen);
+                screenCached = false;
+            }
             return;
         }
 
@@ -166,7 +175,14 @@ public:
         }
 
         // Move children with delta value for X or Y
-        screenContainer->forEachChild(&handleTickCallback);
+        if (screenCached)
+        {
+            tickMoveDrawable(cachedScreen);
+        }
+        else
+        {
+            screenContainer->forEachChild(&handleTickCallback);
+        }
     }
 
     /**
@@ -183,6 +199,11 @@ public:
         if (HAL::USE_ANIMATION_STORAGE)
         {
             screenContainer->remove(snapshot);
+            if (screenCached)
+            {
+                screenContainer->remove(cachedScreen);
+                screenCached = false;
+            }
         }
     }
 
@@ -201,8 +222,18 @@ public:
         {
             Transition::init();
 
-            Callback<SlideTransition, Drawable&> initCallback(this, &SlideTransition::initMoveDrawable);
-            screenContainer->forEachChild(&initCallback);
+            // The widgets stay behind the cached Screen until the transition is done
+            screenCached = drawScreenCache(cachedScreen);
+            if (screenCached)
+            {
+                initMoveDrawable(cachedScreen);
+                screenContainer->add(cachedScreen);
+            }
+            else
+            {
+                Callback<SlideTransition, Drawable&> initCallback(this, &SlideTransition::initMoveDrawable);
+                screenContainer->forEachChild(&initCallback);
+            }
 
             screenContainer->add(snapshot);
         }
@@ -276,6 +307,8 @@ protected:
 
     SnapshotWidget  snapshot;    ///< The SnapshotWidget that is moved when transitioning.
     SnapshotWidget* snapshotPtr; ///< Pointer pointing to the snapshot used in this transition.The snapshot pointer
+    Image           cachedScreen; ///< The Image with the cached Screen transitioning to, moved instead of its widgets.
+    bool            screenCached; ///< True if the Screen transitioning to is cached.
 
 private:
     Callback<SlideTransition, Drawable&> handleTickCallback;    ///< Callback used for tickMoveDrawable().
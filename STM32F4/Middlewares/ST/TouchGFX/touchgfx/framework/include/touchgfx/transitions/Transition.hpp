@@ -23,6 +23,7 @@ namespace touchgfx
 {
 class Container;
 class SnapshotWidget;
+class Image;
 
 /**
  * @class Transition Transition.hpp touchgfx/transitions/Transition.hpp
@@ -124,9 +125,78 @@ public:
         screenContainer = &cont;
     }
 
+    /**
+     * @fn static void Transition::setScreenCacheBitmap(BitmapId bitmap)
+     *
+     * @brief Sets the bitmap the Screen transitioning to is drawn into.
+     *
+     *        Sets a dynamic RGB565 bitmap, as large as the display, into which SlideTransition
+     *        and CoverTransition draw the Screen transitioning to once, when the transition
+     *        starts. While transitioning, the bitmap is moved instead of the widgets of the
+     *        Screen, so every tick blits pixels instead of drawing the widgets again. Changes
+     *        to the widgets are not shown until the transition is done, at which point the
+     *        whole Screen is drawn again.
+     *
+     *        The bitmap is only used on 16 bpp displays without rotation.
+     *
+     * @param bitmap The bitmap, or BITMAP_INVALID to move the widgets (default).
+     */
+    static void setScreenCacheBitmap(BitmapId bitmap)
+    {
+        screenCacheBitmap = bitmap;
+    }
+
+    /**
+     * @fn static BitmapId Transition::getScreenCacheBitmap()
+     *
+     * @brief Gets the bitmap the Screen transitioning to is drawn into.
+     *
+     *        Gets the bitmap the Screen transitioning to is drawn into.
+     *
+     * @return The bitmap, or BITMAP_INVALID if the widgets are moved.
+     *
+     * @see setScreenCacheBitmap
+     */
+    static BitmapId getScreenCacheBitmap()
+    {
+        return screenCacheBitmap;
+    }
+
 protected:
+
+    /**
+     * @fn bool Transition::drawScreenCache(Image& image);
+     *
+     * @brief Draws the screen Container into the screen cache bitmap.
+     *
+     *        Draws the screen Container, with the widgets at their final positions, into the
+     *        bitmap set by setScreenCacheBitmap(), and shows the bitmap in the Image at (0, 0).
+     *        The Image is not added to the screen Container.
+     *
+     * @param [out] image The Image showing the bitmap.
+     *
+     * @return false if there is no bitmap or it cannot be used, in which case the widgets
+     *         must be moved instead.
+     */
+    bool drawScreenCache(Image& image);
+
+    /**
+     * @fn void Transition::removeScreenCache(Image& image);
+     *
+     * @brief Removes the Image showing the screen cache bitmap.
+     *
+     *        Removes the Image showing the screen cache bitmap from the screen Container, and
+     *        invalidates the screen Container, so the widgets are drawn again.
+     *
+     * @param [in] image The Image.
+     */
+    void removeScreenCache(Image& image);
+
     Container* screenContainer;   ///< The screen Container of the Screen transitioning to.
     bool       done;            ///< Flag that indicates when the transition is done. This should be set by implementing classes.
+
+private:
+    static BitmapId screenCacheBitmap;
 };
 } // namespace touchgfx
 #endif // TRANSITION_HPP
@@ -165,6 +165,46 @@ public:
         return currentRenderingAlgorithm;
     }
 
+    /**
+     * @fn static void TextureMapper::setAffineDrawingEnabled(bool enabled)
+     *
+     * @brief Enables or disables the affine drawing of TextureMappers.
+     *
+     *        Enables or disables the affine drawing of TextureMappers. When a TextureMapper is
+     *        only scaled and rotated around the z axis, all corners of the transformed image
+     *        have the same depth and the texture coordinates change linearly across the
+     *        display. Such TextureMappers are drawn by stepping the texture coordinates in
+     *        fixed point, without the perspective correction of the general path, if the
+     *        display is 16 bits per pixel and not rotated, and the bitmap is RGB565 or
+     *        ARGB8888. The affine drawing is enabled by default.
+     *
+     *        The affine drawing samples the same texels as the general path except for
+     *        rounding of the texture coordinates, which may select a neighboring texel for a
+     *        few pixels.
+     *
+     * @param enabled true to draw TextureMappers using the affine path when possible.
+     */
+    static void setAffineDrawingEnabled(bool enabled)
+    {
+        affineDrawingEnabled = enabled;
+    }
+
+    /**
+     * @fn static bool TextureMapper::isAffineDrawingEnabled()
+     *
+     * @brief Query if the affine drawing of TextureMappers is enabled.
+     *
+     *        Query if the affine drawing of TextureMappers is enabled.
+     *
+     * @return true if the affine drawing is enabled.
+     *
+     * @see setAffineDrawingEnabled
+     */
+    static bool isAffineDrawingEnabled()
+    {
+        return affineDrawingEnabled;
+    }
+
     /**
      * @fn void TextureMapper::setAlpha(uint8_t a)
      *
@@ -771,6 +811,39 @@ protected:
      */
     RenderingVariant lookupRenderVariant() const;
 
+    /**
+     * @fn bool TextureMapper::isAffine() const;
+     *
+     * @brief Query if the transformed bitmap can be drawn using the affine path.
+     *
+     *        Query if the transformed bitmap can be drawn using the affine path, i.e. if all
+     *        corners have the same depth and the display and bitmap formats are supported.
+     *
+     * @return true if the transformed bitmap can be drawn using the affine path.
+     *
+     * @see setAffineDrawingEnabled
+     */
+    bool isAffine() const;
+
+    /**
+     * @fn void TextureMapper::drawTriangleAffine(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute) const;
+     *
+     * @brief Draw triangle using the affine path.
+     *
+     *        Draw triangle using the affine path. The scan lines covered are the same as
+     *        LCD::drawTextureMapTriangle() covers, but the texture coordinates are stepped
+     *        across each scan line in fixed point.
+     *
+     * @param dest              The description of where the texture is drawn.
+     * @param vertices          The vertices of the triangle.
+     * @param texture           The texture.
+     * @param absoluteRect      The containing rectangle in absolute coordinates.
+     * @param dirtyAreaAbsolute The dirty area in absolute coordinates.
+     */
+    void drawTriangleAffine(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute) const;
+
+    static bool affineDrawingEnabled;               ///< True to draw using the affine path when possible.
+
     RenderingAlgorithm currentRenderingAlgorithm;   ///< The current rendering algorithm.
     Bitmap             bitmap;                      ///< The bitmap to render.
     uint8_t            alpha;                       ///< An alpha value that is applied to the entire image.
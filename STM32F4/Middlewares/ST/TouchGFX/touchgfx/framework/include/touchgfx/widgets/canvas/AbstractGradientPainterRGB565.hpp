@@ -0,0 +1,162 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef ABSTRACTGRADIENTPAINTERRGB565_HPP
+#define ABSTRACTGRADIENTPAINTERRGB565_HPP
+
+#include <stdint.h>
+#include <touchgfx/widgets/canvas/AbstractPainterRGB565.hpp>
+#include <touchgfx/hal/Types.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class AbstractGradientPainterRGB565 AbstractGradientPainterRGB565.hpp touchgfx/widgets/canvas/AbstractGradientPainterRGB565.hpp
+ *
+ * @brief A Painter that will paint using a gradient between two colors.
+ *
+ *        The AbstractGradientPainterRGB565 class holds the start and end colors of a
+ *        gradient, each with its own alpha value. Subclasses decide how far into the
+ *        gradient each pixel is, and produce the colors of a whole run of pixels using
+ *        renderSpan().
+ *
+ * @see PainterRGB565LinearGradient
+ * @see PainterRGB565RadialGradient
+ */
+class AbstractGradientPainterRGB565 : public AbstractPainterRGB565
+{
+public:
+    static const int GRADIENT_END = 256; ///< The position of the end color in the gradient
+
+    /**
+     * @fn AbstractGradientPainterRGB565::AbstractGradientPainterRGB565(colortype startColor, colortype endColor);
+     *
+     * @brief Constructor.
+     *
+     *        Constructor.
+     *
+     * @param startColor The start color.
+     * @param endColor   The end color.
+     */
+    AbstractGradientPainterRGB565(colortype startColor, colortype endColor);
+
+    /**
+     * @fn void AbstractGradientPainterRGB565::setStartColor(colortype color, uint8_t alpha = 255);
+     *
+     * @brief Sets the color and alpha at the start of the gradient.
+     *
+     *        Sets the color and alpha at the start of the gradient.
+     *
+     * @param color The color.
+     * @param alpha The alpha.
+     */
+    void setStartColor(colortype color, uint8_t alpha = 255);
+
+    /**
+     * @fn void AbstractGradientPainterRGB565::setEndColor(colortype color, uint8_t alpha = 255);
+     *
+     * @brief Sets the color and alpha at the end of the gradient.
+     *
+     *        Sets the color and alpha at the end of the gradient.
+     *
+     * @param color The color.
+     * @param alpha The alpha.
+     */
+    void setEndColor(colortype color, uint8_t alpha = 255);
+
+    /**
+     * @fn colortype AbstractGradientPainterRGB565::getStartColor() const;
+     *
+     * @brief Gets the color at the start of the gradient.
+     *
+     *        Gets the color at the start of the gradient.
+     *
+     * @return The start color.
+     */
+    colortype getStartColor() const;
+
+    /**
+     * @fn colortype AbstractGradientPainterRGB565::getEndColor() const;
+     *
+     * @brief Gets the color at the end of the gradient.
+     *
+     *        Gets the color at the end of the gradient.
+     *
+     * @return The end color.
+     */
+    colortype getEndColor() const;
+
+protected:
+
+    /**
+     * @fn FORCE_INLINE_FUNCTION uint32_t AbstractGradientPainterRGB565::getGradientColor(int position) const
+     *
+     * @brief Gets the color at a position in the gradient.
+     *
+     *        Gets the color at a position in the gradient as an ARGB8888 value.
+     *
+     * @param position The position, from 0 at the start color to GRADIENT_END at the end color.
+     *
+     * @return The color.
+     */
+    FORCE_INLINE_FUNCTION uint32_t getGradientColor(int position) const
+    {
+        return (static_cast<uint32_t>(painterAlpha + ((deltaAlpha * position) >> 8)) << 24) |
+               (static_cast<uint32_t>(painterRed + ((deltaRed * position) >> 8)) << 16) |
+               (static_cast<uint32_t>(painterGreen + ((deltaGreen * position) >> 8)) << 8) |
+               static_cast<uint32_t>(painterBlue + ((deltaBlue * position) >> 8));
+    }
+
+    /**
+     * @fn bool AbstractGradientPainterRGB565::renderGradientColor(int position, uint8_t& red, uint8_t& green, uint8_t& blue, uint8_t& alpha) const;
+     *
+     * @brief Gets the color components at a position in the gradient.
+     *
+     *        Gets the color components at a position in the gradient, for use in renderNext().
+     *
+     * @param position    The position, from 0 at the start color to GRADIENT_END at the end
+     *                    color.
+     * @param [out] red   The red.
+     * @param [out] green The green.
+     * @param [out] blue  The blue.
+     * @param [out] alpha The alpha.
+     *
+     * @return true if the pixel should be painted, false otherwise.
+     */
+    bool renderGradientColor(int position, uint8_t& red, uint8_t& green, uint8_t& blue, uint8_t& alpha) const;
+
+    /**
+     * @fn void AbstractGradientPainterRGB565::updateGradient();
+     *
+     * @brief Updates the color components after a change of the start or end color.
+     *
+     *        Updates the color components after a change of the start or end color.
+     */
+    void updateGradient();
+
+    colortype startColor; ///< The start color
+    colortype endColor;   ///< The end color
+    uint8_t startAlpha;   ///< The alpha of the start color
+    uint8_t endAlpha;     ///< The alpha of the end color
+    int painterRed;       ///< The red part of the start color
+    int painterGreen;     ///< The green part of the start color
+    int painterBlue;      ///< The blue part of the start color
+    int painterAlpha;     ///< The alpha of the start color
+    int deltaRed;         ///< The red part of the end color minus that of the start color
+    int deltaGreen;       ///< The green part of the end color minus that of the start color
+    int deltaBlue;        ///< The blue part of the end color minus that of the start color
+    int deltaAlpha;       ///< The alpha of the end color minus that of the start color
+}; // class AbstractGradientPainterRGB565
+} // namespace touchgfx
+
+#endif // ABSTRACTGRADIENTPAINTERRGB565_HPP
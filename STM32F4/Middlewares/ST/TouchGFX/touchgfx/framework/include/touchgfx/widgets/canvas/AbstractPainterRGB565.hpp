@@ -108,6 +108,32 @@ protected:
         return true;
     }
 
+    static const unsigned SPAN_LENGTH = 32; ///< The largest number of colors asked for in a single call to renderSpan()
+
+    /**
+     * @fn virtual bool AbstractPainterRGB565::renderSpan(uint32_t* colors, unsigned count)
+     *
+     * @brief Get the colors of a run of pixels in the scan line.
+     *
+     *        Get the colors of the next count pixels in the scan line, starting at currentX,
+     *        as ARGB8888 values where the alpha is the alpha of the painter. Pixels with an
+     *        alpha of zero are not painted. A painter which can calculate a run of colors at
+     *        once should implement this, so render() blends the run without calling
+     *        renderNext() and renderPixel() for every pixel.
+     *
+     *        The default implementation returns false, which makes render() fall back to
+     *        calling renderNext() and renderPixel() for each pixel.
+     *
+     * @param [out] colors The colors of the pixels.
+     * @param count        Number of pixels, at most SPAN_LENGTH.
+     *
+     * @return true if the colors were written, false if renderNext() should be used instead.
+     */
+    virtual bool renderSpan(uint32_t* colors, unsigned count)
+    {
+        return false;
+    }
+
     /**
      * @fn virtual bool AbstractPainterRGB565::renderNext(uint8_t& red, uint8_t& green, uint8_t& blue, uint8_t& alpha) = 0;
      *
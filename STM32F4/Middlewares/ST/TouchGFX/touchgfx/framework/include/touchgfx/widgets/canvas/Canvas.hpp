@@ -23,7 +23,9 @@
 #include <touchgfx/widgets/canvas/AbstractPainter.hpp>
 #include <touchgfx/widgets/canvas/CanvasWidget.hpp>
 #include <touchgfx/canvas_widget_renderer/Rasterizer.hpp>
+#include <touchgfx/canvas_widget_renderer/CellEstimator.hpp>
 #include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/hal/RenderWorkers.hpp>
 
 namespace touchgfx
 {
@@ -159,7 +161,54 @@ public:
      */
     bool render();
 
+    /**
+     * @fn static void Canvas::setCellEstimator(CellEstimator* estimator)
+     *
+     * @brief Makes all Canvas objects count cells instead of rendering.
+     *
+     *        Makes all Canvas objects count cells instead of rendering. While an estimator is
+     *        set, the outline given by moveTo() and lineTo() is passed to the estimator
+     *        instead of the Rasterizer, render() does not draw anything, and the frame buffer
+     *        is not locked. Used by CanvasWidget::draw() to plan how to split a shape which is
+     *        too complex to be drawn in one go. The estimator only applies to Canvas objects
+     *        used by the calling RenderWorkers worker.
+     *
+     * @param [in] estimator The estimator, or null to go back to rendering.
+     *
+     * @see CellEstimator
+     */
+    static void setCellEstimator(CellEstimator* estimator)
+    {
+        cellEstimator[RenderWorkers::getCurrentWorker()] = estimator;
+    }
+
+    /**
+     * @fn static void Canvas::setVerticalClipping(bool enable)
+     *
+     * @brief Enables or disables skipping lines above and below the invalidated area.
+     *
+     *        Enables or disables skipping lines above and below the invalidated area. By
+     *        default, lines completely above or below the invalidated area are replaced by
+     *        shorter lines. When disabled, all lines above and below are passed on and the
+     *        Outline discards the cells outside the invalidated area instead. The lines
+     *        crossing a horizontal band of the frame buffer are then the same no matter how
+     *        high the invalidated area is, which makes it possible to count the cells needed
+     *        for any band of an area in one go. The rendered image is the same either way. The
+     *        setting only applies to Canvas objects used by the calling RenderWorkers worker.
+     *
+     * @param enable true to skip lines above and below, false to pass them on.
+     *
+     * @see setCellEstimator()
+     */
+    static void setVerticalClipping(bool enable)
+    {
+        verticalClippingDisabled[RenderWorkers::getCurrentWorker()] = !enable;
+    }
+
 private:
+    static CellEstimator* cellEstimator[RenderWorkers::MAX_WORKERS];
+    static bool verticalClippingDisabled[RenderWorkers::MAX_WORKERS];
+
     // Pointer to the widget using the Canvas
     const CanvasWidget* widget;
 
@@ -193,6 +242,16 @@ private:
 
     uint8_t isOutside(const CWRUtil::Q5& x, const CWRUtil::Q5& y, const CWRUtil::Q5& width, const CWRUtil::Q5& height) const;
 
+    void outlineMoveTo(int x, int y);
+    void outlineLineTo(int x, int y);
+
+    // The estimator of the calling worker. Looked up when needed rather than kept in the
+    // Canvas, as Canvas objects are allocated by widgets in precompiled libraries.
+    static CellEstimator* getCellEstimator()
+    {
+        return cellEstimator[RenderWorkers::getCurrentWorker()];
+    }
+
     /**
      * @fn void Canvas::transformFrameBufferToDisplay(CWRUtil::Q5& x, CWRUtil::Q5& y) const;
      *
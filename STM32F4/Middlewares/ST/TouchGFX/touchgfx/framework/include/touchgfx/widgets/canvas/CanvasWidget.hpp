@@ -119,10 +119,13 @@ public:
      * @brief Draws the given invalidated area.
      *
      *        Draws the given invalidated area. If the underlying CanvasWidgetRenderer fail to
-     *        render the widget (due to memory limitations), the invalidated area is cut into
-     *        smaller slices which are then drawn separately. If drawing a single raster line
-     *        fails, that line is skipped (left blank/transparent) and drawing continues on the
-     *        next raster line.
+     *        render the widget (due to memory limitations), the number of outline cells needed
+     *        for each raster line is estimated by letting the widget draw its shape into a
+     *        CellEstimator. The invalidated area is then cut into tiles which are known to fit
+     *        in the outline buffer, and the tiles are drawn separately. If the estimate cannot
+     *        be made, or a tile fails anyway, the area is cut into smaller and smaller slices
+     *        instead. If drawing a single raster line fails, that line is skipped (left
+     *        blank/transparent) and drawing continues on the next raster line.
      *
      *        If drawing has failed at least once, the number of successfully drawn lines is
      *        remembered for the next time. If a future draw would need to draw more lines, the
@@ -195,6 +198,63 @@ public:
     virtual bool drawCanvasWidget(const Rect& invalidatedArea) const = 0;
 
 private:
+    static const int MAX_TILES = 32; ///< Tiles planned from one estimate
+
+    /**
+     * @fn void CanvasWidget::drawArea(const Rect& area) const;
+     *
+     * @brief Draws an area of the widget, splitting it if needed.
+     *
+     *        Draws an area of the widget, as tiles or slices if it is too complex to be drawn
+     *        in one go.
+     *
+     * @param area The area to draw, inside the minimal rectangle.
+     */
+    void drawArea(const Rect& area) const;
+
+    /**
+     * @fn bool CanvasWidget::drawTiles(const Rect& area) const;
+     *
+     * @brief Draws the area as tiles planned from an estimate of the outline cells.
+     *
+     *        Draws the area as tiles planned from an estimate of the outline cells needed
+     *        for each raster line. The estimate is kept in the outline buffer while the tiles
+     *        are planned. Each tile leaves room in the outline buffer for the row counters
+     *        needed to sort its cells in linear time.
+     *
+     * @param area The area to draw.
+     *
+     * @return false if no estimate could be made and nothing was drawn.
+     */
+    bool drawTiles(const Rect& area) const;
+
+    /**
+     * @fn void CanvasWidget::drawSlices(const Rect& area) const;
+     *
+     * @brief Draws the area as slices which are halved until they can be drawn.
+     *
+     *        Draws the area as slices which are halved until they can be drawn.
+     *
+     * @param area The area to draw.
+     */
+    void drawSlices(const Rect& area) const;
+
+    /**
+     * @fn Rect CanvasWidget::getLines(const Rect& area, int16_t firstLine, int16_t numLines) const;
+     *
+     * @brief Gets the part of an area covered by a range of frame buffer lines.
+     *
+     *        Gets the part of an area covered by a range of frame buffer lines, taking the
+     *        display rotation into account.
+     *
+     * @param area      The area.
+     * @param firstLine The first frame buffer line, relative to the area.
+     * @param numLines  Number of frame buffer lines.
+     *
+     * @return The part of the area.
+     */
+    Rect getLines(const Rect& area, int16_t firstLine, int16_t numLines) const;
+
     AbstractPainter* canvasPainter;
     mutable int16_t maxRenderLines;
     uint8_t alpha;
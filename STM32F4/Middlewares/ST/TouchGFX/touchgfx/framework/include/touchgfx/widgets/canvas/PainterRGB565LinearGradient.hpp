@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef PAINTERRGB565LINEARGRADIENT_HPP
+#define PAINTERRGB565LINEARGRADIENT_HPP
+
+#include <stdint.h>
+#include <touchgfx/widgets/canvas/AbstractGradientPainterRGB565.hpp>
+#include <touchgfx/hal/Types.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class PainterRGB565LinearGradient PainterRGB565LinearGradient.hpp touchgfx/widgets/canvas/PainterRGB565LinearGradient.hpp
+ *
+ * @brief A Painter that will paint using a linear gradient.
+ *
+ *        The PainterRGB565LinearGradient class fills a shape with a gradient along a line
+ *        from a start point to an end point. Pixels before the start point get the start
+ *        color, and pixels after the end point get the end color. The position in the
+ *        gradient is stepped in fixed point along each scan line, so no division is needed
+ *        per pixel.
+ *
+ * @see AbstractGradientPainterRGB565
+ */
+class PainterRGB565LinearGradient : public AbstractGradientPainterRGB565
+{
+public:
+
+    /**
+     * @fn PainterRGB565LinearGradient::PainterRGB565LinearGradient(colortype startColor = 0, colortype endColor = 0);
+     *
+     * @brief Constructor.
+     *
+     *        Constructor. The gradient goes from left to right across the first 256 pixels
+     *        until setGradient() is called.
+     *
+     * @param startColor The start color.
+     * @param endColor   The end color.
+     */
+    PainterRGB565LinearGradient(colortype startColor = 0, colortype endColor = 0);
+
+    /**
+     * @fn void PainterRGB565LinearGradient::setGradient(int16_t startX, int16_t startY, int16_t endX, int16_t endY);
+     *
+     * @brief Sets the line along which the gradient goes.
+     *
+     *        Sets the line along which the gradient goes. The coordinates are relative to the
+     *        canvas widget. If the start and end points are the same, the shape is filled
+     *        with the start color.
+     *
+     * @param startX The x coordinate of the start color.
+     * @param startY The y coordinate of the start color.
+     * @param endX   The x coordinate of the end color.
+     * @param endY   The y coordinate of the end color.
+     */
+    void setGradient(int16_t startX, int16_t startY, int16_t endX, int16_t endY);
+
+protected:
+    virtual bool renderNext(uint8_t& red, uint8_t& green, uint8_t& blue, uint8_t& alpha);
+    virtual bool renderSpan(uint32_t* colors, unsigned count);
+
+    /**
+     * @fn FORCE_INLINE_FUNCTION int32_t PainterRGB565LinearGradient::getPosition(int x, int y) const
+     *
+     * @brief Gets the position in the gradient of a pixel.
+     *
+     *        Gets the position in the gradient of a pixel, in 1/65536 of the gradient.
+     *
+     * @param x The x coordinate relative to the canvas widget.
+     * @param y The y coordinate relative to the canvas widget.
+     *
+     * @return The position, not limited to the gradient.
+     */
+    FORCE_INLINE_FUNCTION int32_t getPosition(int x, int y) const
+    {
+        return (x - gradientStartX) * stepX + (y - gradientStartY) * stepY;
+    }
+
+    int16_t gradientStartX; ///< The x coordinate of the start color
+    int16_t gradientStartY; ///< The y coordinate of the start color
+    int32_t stepX;          ///< The change of the position in the gradient per pixel to the right, in 1/65536 of the gradient
+    int32_t stepY;          ///< The change of the position in the gradient per pixel down, in 1/65536 of the gradient
+}; // class PainterRGB565LinearGradient
+} // namespace touchgfx
+
+#endif // PAINTERRGB565LINEARGRADIENT_HPP
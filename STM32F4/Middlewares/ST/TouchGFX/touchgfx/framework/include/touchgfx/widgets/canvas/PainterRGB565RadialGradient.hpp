@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef PAINTERRGB565RADIALGRADIENT_HPP
+#define PAINTERRGB565RADIALGRADIENT_HPP
+
+#include <stdint.h>
+#include <touchgfx/widgets/canvas/AbstractGradientPainterRGB565.hpp>
+#include <touchgfx/hal/Types.hpp>
+
+namespace touchgfx
+{
+/**
+ * @class PainterRGB565RadialGradient PainterRGB565RadialGradient.hpp touchgfx/widgets/canvas/PainterRGB565RadialGradient.hpp
+ *
+ * @brief A Painter that will paint using a radial gradient.
+ *
+ *        The PainterRGB565RadialGradient class fills a shape with a gradient from the start
+ *        color in a center point to the end color at a given radius. Pixels outside the
+ *        radius get the end color. Scan lines further from the center than the radius are
+ *        filled with the end color without calculating any distances.
+ *
+ * @see AbstractGradientPainterRGB565
+ */
+class PainterRGB565RadialGradient : public AbstractGradientPainterRGB565
+{
+public:
+    static const uint16_t MAX_RADIUS = 0x7FFF; ///< The largest supported radius, which keeps squared distances within 31 bits
+
+    /**
+     * @fn PainterRGB565RadialGradient::PainterRGB565RadialGradient(colortype startColor = 0, colortype endColor = 0);
+     *
+     * @brief Constructor.
+     *
+     *        Constructor. The gradient has its center in (0, 0) and a radius of 256 until
+     *        setGradient() is called.
+     *
+     * @param startColor The color in the center.
+     * @param endColor   The color at the radius.
+     */
+    PainterRGB565RadialGradient(colortype startColor = 0, colortype endColor = 0);
+
+    /**
+     * @fn void PainterRGB565RadialGradient::setGradient(int16_t centerX, int16_t centerY, uint16_t radius);
+     *
+     * @brief Sets the center and radius of the gradient.
+     *
+     *        Sets the center and radius of the gradient. The coordinates are relative to the
+     *        canvas widget. A radius of 0 fills the shape with the end color.
+     *
+     * @param centerX The x coordinate of the center.
+     * @param centerY The y coordinate of the center.
+     * @param radius  The radius, at most MAX_RADIUS.
+     */
+    void setGradient(int16_t centerX, int16_t centerY, uint16_t radius);
+
+protected:
+    virtual bool renderNext(uint8_t& red, uint8_t& green, uint8_t& blue, uint8_t& alpha);
+    virtual bool renderSpan(uint32_t* colors, unsigned count);
+
+    /**
+     * @fn int PainterRGB565RadialGradient::getPosition(uint32_t distanceSquared) const;
+     *
+     * @brief Gets the position in the gradient of a pixel.
+     *
+     *        Gets the position in the gradient of a pixel at the given squared distance from
+     *        the center.
+     *
+     * @param distanceSquared The squared distance from the center.
+     *
+     * @return The position, from 0 in the center to GRADIENT_END at the radius and beyond.
+     */
+    int getPosition(uint32_t distanceSquared) const;
+
+    int16_t gradientCenterX;  ///< The x coordinate of the center
+    int16_t gradientCenterY;  ///< The y coordinate of the center
+    uint32_t radiusSquared;   ///< The squared radius
+    float positionScale;      ///< GRADIENT_END divided by the radius
+}; // class PainterRGB565RadialGradient
+} // namespace touchgfx
+
+#endif // PAINTERRGB565RADIALGRADIENT_HPP
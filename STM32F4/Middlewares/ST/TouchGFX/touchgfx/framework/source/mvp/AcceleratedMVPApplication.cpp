@@ -0,0 +1,573 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <mvp/AcceleratedMVPApplication.hpp>
+#include <touchgfx/Screen.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <touchgfx/BitmapCache.hpp>
+#include <touchgfx/hal/RenderProfiler.hpp>
+#include <touchgfx/transitions/Transition.hpp>
+
+namespace touchgfx
+{
+void AcceleratedMVPApplication::handlePendingScreenTransition()
+{
+    // The animations of the current screen must not be advanced once it has been destroyed
+    if (pendingScreenTransitionCallback && pendingScreenTransitionCallback->isValid())
+    {
+        animationScheduler.clear();
+    }
+    MVPApplication::handlePendingScreenTransition();
+}
+
+void AcceleratedMVPApplication::handleTickEvent()
+{
+    // Application does not tick the timer widgets while the transition runs, including the
+    // tick in which it finishes
+    const bool transitionRunning = currentTransition && !currentTransition->isDone();
+    Application::handleTickEvent();
+    if (!transitionRunning)
+    {
+        animationScheduler.handleTickEvent();
+    }
+}
+
+void AcceleratedMVPApplication::draw(Rect& rect)
+{
+    if (!drawCacheEnabled)
+    {
+        RenderProfiler* profiler = RenderProfiler::getInstance();
+        if (profiler)
+        {
+            profiler->addInvalidatedArea((rect & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT)).area());
+        }
+        drawArea(rect, false);
+        if (HAL::USE_DOUBLE_BUFFERING && HAL::getInstance()->getFrameRefreshStrategy() == HAL::REFRESH_STRATEGY_DEFAULT)
+        {
+            // Drawn outside a frame, e.g. when switching screens, but must be brought up to
+            // date in the other frame buffer like the dirty region
+            lastDirtyRegion.add(rect & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT));
+        }
+        return;
+    }
+    if (HAL::getInstance()->getFrameRefreshStrategy() != HAL::REFRESH_STRATEGY_DEFAULT)
+    {
+        Application::draw(rect);
+        return;
+    }
+
+    rect &= Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    dirtyRegion.add(rect);
+}
+
+void AcceleratedMVPApplication::cacheDrawOperations(bool enableCache)
+{
+    HAL* hal = HAL::getInstance();
+    if (enableCache || !drawCacheEnabled || hal->getFrameRefreshStrategy() != HAL::REFRESH_STRATEGY_DEFAULT)
+    {
+        numberOfScrollOperations = 0;
+        Application::cacheDrawOperations(enableCache);
+        if (!enableCache)
+        {
+            BitmapCache::endFrame();
+        }
+        return;
+    }
+
+    // From here on, draw(Rect&) draws directly
+    drawCacheEnabled = false;
+
+    // The area drawn into the other frame buffer since the current frame buffer was last
+    // drawn must be brought up to date, except where it is about to be redrawn anyway
+    Rect copyRects[MAX_DIRTY_RECTS];
+    Region copyRegion(copyRects, MAX_DIRTY_RECTS);
+    uint16_t* tftFrameBuffer = hal->getTFTFrameBuffer();
+    const bool swapped = HAL::USE_DOUBLE_BUFFERING && tftFrameBuffer != lastTFTFrameBuffer;
+
+    // Scrolled pixels are copied from the displayed frame buffer, which is outdated if the
+    // current frame buffer has been drawn into since the frame buffers were last swapped
+    if (!swapped && !lastDirtyRegion.isEmpty())
+    {
+        for (uint16_t i = 0; i < numberOfScrollOperations; i++)
+        {
+            dirtyRegion.add(scrollOperations[i].area);
+        }
+        numberOfScrollOperations = 0;
+    }
+
+    if (swapped)
+    {
+        copyRegion.assign(lastDirtyRegion);
+        for (uint16_t i = 0; i < dirtyRegion.size(); i++)
+        {
+            if (!copyRegion.subtract(dirtyRegion[i]))
+            {
+                break;
+            }
+        }
+        for (uint16_t i = 0; i < numberOfScrollOperations; i++)
+        {
+            copyRegion.subtract(scrollOperations[i].getDestination());
+        }
+    }
+
+    const Rect display(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    const bool copyFromTFT = HAL::lcd().bitDepth() == 16 && HAL::DISPLAY_ROTATION == rotate0;
+    for (uint16_t i = 0; i < copyRegion.size(); i++)
+    {
+        Rect rect = copyRegion[i];
+        if (copyFromTFT)
+        {
+            HAL::lcd().blitCopy(tftFrameBuffer, display, rect, 255, false);
+            hal->flushFrameBuffer(rect);
+        }
+        else
+        {
+            drawArea(rect, true);
+        }
+    }
+
+    // The source of the moved pixels is the displayed frame buffer shifted by the distance
+    uint32_t scrolledArea = 0;
+    for (uint16_t i = 0; i < numberOfScrollOperations; i++)
+    {
+        const ScrollOperation& operation = scrollOperations[i];
+        Rect destination = operation.getDestination();
+        if (!destination.isEmpty())
+        {
+            const Rect source(operation.deltaX, operation.deltaY, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+            HAL::lcd().blitCopy(tftFrameBuffer, source, Rect(destination.x - operation.deltaX, destination.y - operation.deltaY, destination.width, destination.height), 255, false);
+            hal->flushFrameBuffer(destination);
+            scrolledArea += destination.area();
+        }
+    }
+
+    if (!drawDirtyRegionInParallel())
+    {
+        for (uint16_t i = 0; i < dirtyRegion.size(); i++)
+        {
+            Rect rect = dirtyRegion[i];
+            drawArea(rect, true);
+        }
+    }
+
+    if (swapped)
+    {
+        lastDirtyRegion.assign(dirtyRegion);
+    }
+    else if (HAL::USE_DOUBLE_BUFFERING)
+    {
+        lastDirtyRegion.add(dirtyRegion);
+    }
+    for (uint16_t i = 0; i < numberOfScrollOperations; i++)
+    {
+        lastDirtyRegion.add(scrollOperations[i].getDestination());
+    }
+    numberOfScrollOperations = 0;
+    lastTFTFrameBuffer = tftFrameBuffer;
+
+    if (!dirtyRegion.isEmpty() || scrolledArea > 0)
+    {
+        const uint32_t copiedArea = copyRegion.getArea();
+        invalidationStatistics.scrolledArea += scrolledArea;
+        invalidationStatistics.numberOfFrames++;
+        invalidationStatistics.numberOfRects += dirtyRegion.size();
+        invalidationStatistics.invalidatedArea += dirtyRegion.getInvalidatedArea();
+        invalidationStatistics.redrawnArea += dirtyRegion.getArea() + (copyFromTFT ? 0 : copiedArea);
+        invalidationStatistics.copiedArea += copyFromTFT ? copiedArea : 0;
+    }
+    RenderProfiler* profiler = RenderProfiler::getInstance();
+    if (profiler)
+    {
+        profiler->addInvalidatedArea(dirtyRegion.getArea());
+    }
+    dirtyRegion.clear();
+    BitmapCache::endFrame();
+}
+
+void AcceleratedMVPApplication::setDirtyRegionCapacity(uint16_t capacity)
+{
+    assert(capacity > 0 && capacity <= MAX_DIRTY_RECTS && "Dirty region capacity out of range");
+    dirtyRegion.setCapacity(capacity);
+    lastDirtyRegion.setCapacity(capacity);
+}
+
+void AcceleratedMVPApplication::resetInvalidationStatistics()
+{
+    invalidationStatistics.numberOfFrames = 0;
+    invalidationStatistics.numberOfRects = 0;
+    invalidationStatistics.invalidatedArea = 0;
+    invalidationStatistics.redrawnArea = 0;
+    invalidationStatistics.copiedArea = 0;
+    invalidationStatistics.drawnArea = 0;
+    invalidationStatistics.culledDrawables = 0;
+    invalidationStatistics.scrolledArea = 0;
+}
+
+bool AcceleratedMVPApplication::scrollArea(const Rect& area, int16_t deltaX, int16_t deltaY)
+{
+    // The pixels are copied from the other frame buffer when the dirty region is drawn
+    if (!drawCacheEnabled || !HAL::USE_DOUBLE_BUFFERING || partialFrameBuffer != 0 ||
+            HAL::getInstance()->getFrameRefreshStrategy() != HAL::REFRESH_STRATEGY_DEFAULT ||
+            HAL::lcd().bitDepth() != 16 || HAL::DISPLAY_ROTATION != rotate0)
+    {
+        return false;
+    }
+    const Rect clipped = area & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (clipped.isEmpty())
+    {
+        return false;
+    }
+
+    ScrollOperation* operation = 0;
+    for (uint16_t i = 0; i < numberOfScrollOperations; i++)
+    {
+        if (scrollOperations[i].area == clipped)
+        {
+            operation = &scrollOperations[i];
+        }
+        else if (scrollOperations[i].area.intersect(clipped))
+        {
+            return false;
+        }
+    }
+    if (operation == 0)
+    {
+        if (numberOfScrollOperations == MAX_SCROLL_OPERATIONS)
+        {
+            return false;
+        }
+        operation = &scrollOperations[numberOfScrollOperations++];
+        operation->area = clipped;
+        operation->deltaX = 0;
+        operation->deltaY = 0;
+    }
+    operation->deltaX += deltaX;
+    operation->deltaY += deltaY;
+
+    // What has been invalidated in the area must be drawn where it is moved to
+    Rect moved[MAX_DIRTY_RECTS];
+    uint16_t numberOfMoved = 0;
+    for (uint16_t i = 0; i < dirtyRegion.size(); i++)
+    {
+        Rect rect = dirtyRegion[i] & clipped;
+        if (!rect.isEmpty())
+        {
+            rect.x += deltaX;
+            rect.y += deltaY;
+            moved[numberOfMoved++] = rect & clipped;
+        }
+    }
+    for (uint16_t i = 0; i < numberOfMoved; i++)
+    {
+        if (!moved[i].isEmpty())
+        {
+            dirtyRegion.add(moved[i]);
+        }
+    }
+
+    // The parts of the area not covered by the moved pixels
+    const int16_t exposedWidth = MIN(deltaX < 0 ? -deltaX : deltaX, clipped.width);
+    const int16_t exposedHeight = MIN(deltaY < 0 ? -deltaY : deltaY, clipped.height);
+    if (exposedWidth > 0)
+    {
+        dirtyRegion.add(Rect(deltaX > 0 ? clipped.x : clipped.right() - exposedWidth, clipped.y, exposedWidth, clipped.height));
+    }
+    if (exposedHeight > 0)
+    {
+        dirtyRegion.add(Rect(clipped.x, deltaY > 0 ? clipped.y : clipped.bottom() - exposedHeight, clipped.width, exposedHeight));
+    }
+    return true;
+}
+
+void AcceleratedMVPApplication::drawArea(Rect& rect, bool culling)
+{
+    if (partialFrameBuffer == 0)
+    {
+        drawFrameBufferArea(rect, culling);
+        return;
+    }
+
+    Rect remaining = rect & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    while (!remaining.isEmpty())
+    {
+        Rect strip = partialFrameBuffer->beginStrip(remaining);
+        drawFrameBufferArea(strip, culling);
+        partialFrameBuffer->endStrip(strip);
+        remaining.y += strip.height;
+        remaining.height -= strip.height;
+    }
+}
+
+void AcceleratedMVPApplication::drawFrameBufferArea(Rect& rect, bool culling)
+{
+    if (culling && currentScreen && currentScreen->usingSMOC() && drawCulled(rect))
+    {
+        HAL::getInstance()->flushFrameBuffer(rect);
+        return;
+    }
+    if (culling)
+    {
+        // Painter's algorithm requested, or too many parts to draw, let the screen handle it
+        invalidationStatistics.drawnArea += rect.area();
+    }
+
+    // The drawables are drawn by the screen, so the time is recorded for the whole screen
+    RenderProfiler* profiler = currentScreen ? RenderProfiler::getInstance() : 0;
+    const uint32_t start = profiler ? profiler->getCPUCycles() : 0;
+    const uint32_t pixels = (rect & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT)).area();
+    Application::draw(rect);
+    if (profiler)
+    {
+        profiler->addDraw(*currentScreen, start, pixels);
+    }
+}
+
+bool AcceleratedMVPApplication::drawCulled(const Rect& rect)
+{
+    uint16_t numberOfOperations = 0;
+    if (!planCulled(rect, 0, numberOfOperations))
+    {
+        return false;
+    }
+    drawPlanned(0, numberOfOperations);
+    return true;
+}
+
+bool AcceleratedMVPApplication::planCulled(const Rect& rect, uint16_t firstOperation, uint16_t& numberOfOperations)
+{
+    numberOfOperations = 0;
+    Container& root = currentScreen->getRootContainer();
+    const Rect area = rect & root.getRect();
+    if (area.isEmpty())
+    {
+        return true;
+    }
+
+    Drawable* head = 0;
+    root.setupDrawChain(area, &head);
+
+    // The part of the area not yet covered by a solid rectangle
+    Rect uncoveredRects[MAX_VISIBLE_RECTS];
+    Region uncovered(uncoveredRects, MAX_VISIBLE_RECTS);
+    uncovered.add(area);
+
+    uint16_t operation = firstOperation;
+    uint32_t drawnArea = 0;
+    uint32_t culledDrawables = 0;
+    Drawable* d = head;
+    for (; d != 0 && !uncovered.isEmpty(); d = d->nextDrawChainElement)
+    {
+        const Rect visible = d->getCachedVisibleRect() & area;
+        if (visible.isEmpty())
+        {
+            continue;
+        }
+        const uint16_t firstPart = operation;
+        for (uint16_t i = 0; i < uncovered.size(); i++)
+        {
+            Rect part = uncovered[i] & visible;
+            if (!part.isEmpty())
+            {
+                if (operation == MAX_DRAW_OPERATIONS)
+                {
+                    return false;
+                }
+                drawnArea += part.area();
+                // The cached position is reset by the next setupDrawChain(), so the part is
+                // made relative now
+                part.x -= d->getCachedAbsX();
+                part.y -= d->getCachedAbsY();
+                drawOperations[operation].drawable = d;
+                drawOperations[operation].area = part;
+                operation++;
+            }
+        }
+        if (operation == firstPart)
+        {
+            culledDrawables++;
+            continue;
+        }
+        if (d->nextDrawChainElement != 0)
+        {
+            Rect solid = d->getSolidRect();
+            solid.x += d->getCachedAbsX();
+            solid.y += d->getCachedAbsY();
+            // If there is no room for splitting the uncovered area, drawables behind will
+            // just draw a bit more than necessary
+            uncovered.subtract(solid & visible);
+        }
+    }
+    for (; d != 0; d = d->nextDrawChainElement)
+    {
+        culledDrawables++;
+    }
+
+    numberOfOperations = operation - firstOperation;
+    invalidationStatistics.drawnArea += drawnArea;
+    invalidationStatistics.culledDrawables += culledDrawables;
+    return true;
+}
+
+void AcceleratedMVPApplication::drawPlanned(uint16_t firstOperation, uint16_t numberOfOperations)
+{
+    RenderProfiler* profiler = RenderProfiler::getInstance();
+    uint16_t operation = firstOperation + numberOfOperations;
+    while (operation > firstOperation)
+    {
+        const DrawOperation& drawOperation = drawOperations[--operation];
+        const uint32_t start = profiler ? profiler->getCPUCycles() : 0;
+        drawOperation.drawable->draw(drawOperation.area);
+        if (profiler)
+        {
+            RenderWorkers::lockShared();
+            profiler->addDraw(*drawOperation.drawable, start, drawOperation.area.area());
+            RenderWorkers::unlockShared();
+        }
+    }
+}
+
+bool AcceleratedMVPApplication::drawDirtyRegionInParallel()
+{
+    RenderWorkers* workers = RenderWorkers::getInstance();
+    if (workers == 0 || partialFrameBuffer != 0 ||
+            currentScreen == 0 || !currentScreen->usingSMOC())
+    {
+        return false;
+    }
+
+    // Aim for two pieces per worker, so a slow piece can be balanced by the others
+    Rect pieces[MAX_RENDER_PIECES];
+    const uint16_t numberOfPieces = splitDirtyRegion(pieces, 2 * workers->getNumberOfWorkers());
+
+    uint16_t numberOfOperations = 0;
+    numberOfRenderPieces = 0;
+    for (uint16_t i = 0; i < numberOfPieces; i++)
+    {
+        uint16_t pieceOperations = 0;
+        bool planned = planCulled(pieces[i], numberOfOperations, pieceOperations);
+        if (!planned && numberOfRenderPieces > 0)
+        {
+            // Make room by drawing the pieces planned so far
+            drawRenderPieces(*workers);
+            numberOfOperations = 0;
+            planned = planCulled(pieces[i], 0, pieceOperations);
+        }
+        if (!planned)
+        {
+            // Too many parts to draw, let the screen handle it
+            drawFrameBufferArea(pieces[i], true);
+            continue;
+        }
+        if (pieceOperations == 0)
+        {
+            HAL::getInstance()->flushFrameBuffer(pieces[i]);
+            continue;
+        }
+
+        RenderPiece& piece = renderPieces[numberOfRenderPieces++];
+        piece.area = pieces[i];
+        piece.firstOperation = numberOfOperations;
+        piece.numberOfOperations = pieceOperations;
+        piece.drawnArea = 0;
+        for (uint16_t op = numberOfOperations; op < numberOfOperations + pieceOperations; op++)
+        {
+            piece.drawnArea += drawOperations[op].area.area();
+        }
+        numberOfOperations += pieceOperations;
+    }
+    if (numberOfRenderPieces > 0)
+    {
+        drawRenderPieces(*workers);
+    }
+    return true;
+}
+
+uint16_t AcceleratedMVPApplication::splitDirtyRegion(Rect* pieces, uint16_t numberOfPieces) const
+{
+    const uint32_t pieceArea = MAX(dirtyRegion.getArea() / numberOfPieces, 1U);
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < dirtyRegion.size(); i++)
+    {
+        const Rect& rect = dirtyRegion[i];
+        // Leave room for at least one piece per remaining rectangle
+        const uint32_t room = MAX_RENDER_PIECES - count - (dirtyRegion.size() - 1 - i);
+        uint32_t bands = (rect.area() + pieceArea - 1) / pieceArea;
+        bands = MIN(bands, static_cast<uint32_t>(rect.height / MIN_RENDER_PIECE_HEIGHT));
+        bands = MAX(MIN(bands, room), 1U);
+        for (uint32_t band = 0; band < bands; band++)
+        {
+            const int16_t top = static_cast<int16_t>(rect.y + rect.height * band / bands);
+            const int16_t bottom = static_cast<int16_t>(rect.y + rect.height * (band + 1) / bands);
+            pieces[count++] = Rect(rect.x, top, rect.width, bottom - top);
+        }
+    }
+    return count;
+}
+
+void AcceleratedMVPApplication::drawRenderPieces(RenderWorkers& workers)
+{
+    // Largest piece first to the least loaded worker, ties going to the first piece and
+    // the first worker
+    uint32_t load[RenderWorkers::MAX_WORKERS] = { 0 };
+    bool assigned[MAX_RENDER_PIECES] = { false };
+    const uint8_t numberOfWorkers = workers.getNumberOfWorkers();
+    for (uint16_t n = 0; n < numberOfRenderPieces; n++)
+    {
+        uint16_t largest = 0;
+        while (assigned[largest])
+        {
+            largest++;
+        }
+        for (uint16_t i = largest + 1; i < numberOfRenderPieces; i++)
+        {
+            if (!assigned[i] && renderPieces[i].drawnArea > renderPieces[largest].drawnArea)
+            {
+                largest = i;
+            }
+        }
+        uint8_t worker = 0;
+        for (uint8_t w = 1; w < numberOfWorkers; w++)
+        {
+            if (load[w] < load[worker])
+            {
+                worker = w;
+            }
+        }
+        assigned[largest] = true;
+        renderPieces[largest].worker = worker;
+        load[worker] += renderPieces[largest].drawnArea;
+    }
+
+    // The workers draw without the DMA
+    HAL::getInstance()->flushDMA();
+    workers.execute(renderJob);
+    for (uint16_t i = 0; i < numberOfRenderPieces; i++)
+    {
+        HAL::getInstance()->flushFrameBuffer(renderPieces[i].area);
+    }
+    numberOfRenderPieces = 0;
+}
+
+void AcceleratedMVPApplication::drawWorkerPieces(uint8_t worker)
+{
+    for (uint16_t i = 0; i < numberOfRenderPieces; i++)
+    {
+        const RenderPiece& piece = renderPieces[i];
+        if (piece.worker == worker)
+        {
+            drawPlanned(piece.firstOperation, piece.numberOfOperations);
+        }
+    }
+}
+} // namespace touchgfx
@@ -0,0 +1,512 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <platform/driver/lcd/BlitKernels.hpp>
+#include <string.h>
+
+namespace touchgfx
+{
+namespace
+{
+// Single pixel versions, used for the pixels the wide kernels cannot handle
+
+inline uint16_t blendRGB565(uint16_t fg, uint16_t bg, uint32_t alpha)
+{
+    const uint32_t ialpha = 256 - alpha;
+    return static_cast<uint16_t>(((((fg & 0xF800) * alpha + (bg & 0xF800) * ialpha) >> 8) & 0xF800) |
+                                 ((((fg & 0x07E0) * alpha + (bg & 0x07E0) * ialpha) >> 8) & 0x07E0) |
+                                 ((((fg & 0x001F) * alpha + (bg & 0x001F) * ialpha) >> 8) & 0x001F));
+}
+
+inline uint16_t convertARGB8888ToRGB565(uint32_t argb)
+{
+    return static_cast<uint16_t>(((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F));
+}
+
+inline uint16_t blendARGB8888(uint32_t argb, uint16_t bg, uint32_t alpha)
+{
+    // (fg * a + bg * (65536 - a)) >> 16 is the same as bg + (((fg - bg) * a) >> 16)
+    const int32_t a = static_cast<int32_t>(argb >> 24) * alpha;
+    if (a == 0xFF * 0xFF)
+    {
+        return convertARGB8888ToRGB565(argb);
+    }
+    const int32_t r = bg >> 11;
+    const int32_t g = (bg >> 5) & 0x3F;
+    const int32_t b = bg & 0x1F;
+    return static_cast<uint16_t>(((r + (((static_cast<int32_t>((argb >> 19) & 0x1F) - r) * a) >> 16)) << 11) |
+                                 ((g + (((static_cast<int32_t>((argb >> 10) & 0x3F) - g) * a) >> 16)) << 5) |
+                                 (b + (((static_cast<int32_t>((argb >> 3) & 0x1F) - b) * a) >> 16)));
+}
+
+inline uint8_t blendByte(uint8_t fg, uint8_t bg, uint32_t alpha)
+{
+    return static_cast<uint8_t>((fg * alpha + bg * (256 - alpha)) >> 8);
+}
+
+inline void copyARGB8888Line(uint16_t* dst, const uint32_t* src, int16_t width, uint32_t alpha)
+{
+    for (int16_t x = 0; x < width; x++)
+    {
+        if (src[x] >> 24)
+        {
+            dst[x] = blendARGB8888(src[x], dst[x], alpha);
+        }
+    }
+}
+
+#if defined(BLIT_KERNELS_VECTOR)
+
+// Vectors of 16 bytes hold 8 RGB565 pixels, which leaves room for blending the 5 and 6 bit
+// channels in 16 bit lanes. ARGB8888 pixels are blended in 32 bit lanes, 4 at a time.
+typedef uint8_t Vec8x8 __attribute__((vector_size(8)));
+typedef uint16_t Vec16x4 __attribute__((vector_size(8)));
+typedef uint16_t Vec16x8 __attribute__((vector_size(16)));
+typedef int32_t Vec32x4 __attribute__((vector_size(16)));
+typedef uint32_t VecU32x4 __attribute__((vector_size(16)));
+
+template <class T>
+inline T load(const void* src)
+{
+    T v;
+    memcpy(&v, src, sizeof(T));
+    return v;
+}
+
+template <class T>
+inline void store(void* dst, const T& v)
+{
+    memcpy(dst, &v, sizeof(T));
+}
+
+inline Vec16x8 blendRGB565(const Vec16x8& fgR, const Vec16x8& fgG, const Vec16x8& fgB, const Vec16x8& bg, const Vec16x8& ialpha)
+{
+    const Vec16x8 r = (fgR + (bg >> 11) * ialpha) >> 8;
+    const Vec16x8 g = (fgG + ((bg >> 5) & 0x3F) * ialpha) >> 8;
+    const Vec16x8 b = (fgB + (bg & 0x1F) * ialpha) >> 8;
+    return (r << 11) | (g << 5) | b;
+}
+
+void fillLine16(uint16_t* dst, int16_t width, uint16_t color)
+{
+    const Vec16x8 v = Vec16x8() + color;
+    for (; width >= 8; width -= 8, dst += 8)
+    {
+        store(dst, v);
+    }
+    for (; width > 0; width--)
+    {
+        *dst++ = color;
+    }
+}
+
+void fillLine16(uint16_t* dst, int16_t width, uint16_t color, uint32_t alpha)
+{
+    const Vec16x8 r = Vec16x8() + static_cast<uint16_t>((color >> 11) * alpha);
+    const Vec16x8 g = Vec16x8() + static_cast<uint16_t>(((color >> 5) & 0x3F) * alpha);
+    const Vec16x8 b = Vec16x8() + static_cast<uint16_t>((color & 0x1F) * alpha);
+    const Vec16x8 ialpha = Vec16x8() + static_cast<uint16_t>(256 - alpha);
+    for (; width >= 8; width -= 8, dst += 8)
+    {
+        store(dst, blendRGB565(r, g, b, load<Vec16x8>(dst), ialpha));
+    }
+    for (; width > 0; width--, dst++)
+    {
+        *dst = blendRGB565(color, *dst, alpha);
+    }
+}
+
+void copyLine16(uint16_t* dst, const uint16_t* src, int16_t width, uint32_t alpha)
+{
+    const Vec16x8 valpha = Vec16x8() + static_cast<uint16_t>(alpha);
+    const Vec16x8 ialpha = Vec16x8() + static_cast<uint16_t>(256 - alpha);
+    for (; width >= 8; width -= 8, dst += 8, src += 8)
+    {
+        const Vec16x8 fg = load<Vec16x8>(src);
+        store(dst, blendRGB565((fg >> 11) * valpha, ((fg >> 5) & 0x3F) * valpha, (fg & 0x1F) * valpha, load<Vec16x8>(dst), ialpha));
+    }
+    for (; width > 0; width--, dst++, src++)
+    {
+        *dst = blendRGB565(*src, *dst, alpha);
+    }
+}
+
+void copyARGB8888Line16(uint16_t* dst, const uint32_t* src, int16_t width, uint32_t alpha)
+{
+    const VecU32x4 valpha = VecU32x4() + alpha;
+    for (; width >= 4; width -= 4, dst += 4, src += 4)
+    {
+        const VecU32x4 argb = load<VecU32x4>(src);
+        const Vec32x4 a = __builtin_convertvector((argb >> 24) * valpha, Vec32x4);
+        if ((a[0] | a[1] | a[2] | a[3]) == 0)
+        {
+            continue; // Transparent pixels are common, e.g. around icons
+        }
+        const Vec32x4 fgR = __builtin_convertvector((argb >> 19) & 0x1F, Vec32x4);
+        const Vec32x4 fgG = __builtin_convertvector((argb >> 10) & 0x3F, Vec32x4);
+        const Vec32x4 fgB = __builtin_convertvector((argb >> 3) & 0x1F, Vec32x4);
+        const Vec32x4 bg = __builtin_convertvector(load<Vec16x4>(dst), Vec32x4);
+        const Vec32x4 bgR = bg >> 11;
+        const Vec32x4 bgG = (bg >> 5) & 0x3F;
+        const Vec32x4 bgB = bg & 0x1F;
+        const Vec32x4 blended = ((bgR + (((fgR - bgR) * a) >> 16)) << 11) |
+                                ((bgG + (((fgG - bgG) * a) >> 16)) << 5) |
+                                (bgB + (((fgB - bgB) * a) >> 16));
+        const Vec32x4 opaque = a == 0xFF * 0xFF;
+        const Vec32x4 result = (blended & ~opaque) | (((fgR << 11) | (fgG << 5) | fgB) & opaque);
+        store(dst, __builtin_convertvector(result, Vec16x4));
+    }
+    copyARGB8888Line(dst, src, width, alpha);
+}
+
+void fillLine24(uint8_t* dst, int16_t width, const uint8_t* color)
+{
+    // The 48 bytes of 16 pixels line up with three vectors
+    uint8_t pattern[48];
+    for (int i = 0; i < 48; i++)
+    {
+        pattern[i] = color[i % 3];
+    }
+    for (; width >= 16; width -= 16, dst += 48)
+    {
+        memcpy(dst, pattern, 48);
+    }
+    memcpy(dst, pattern, width * 3);
+}
+
+void fillLine24(uint8_t* dst, int16_t width, const uint8_t* color, uint32_t alpha)
+{
+    // The 24 bytes of 8 pixels line up with three vectors of 8 bytes
+    Vec16x8 fg[3];
+    for (int i = 0; i < 24; i++)
+    {
+        fg[i / 8][i % 8] = static_cast<uint16_t>(color[i % 3] * alpha);
+    }
+    const Vec16x8 ialpha = Vec16x8() + static_cast<uint16_t>(256 - alpha);
+    for (; width >= 8; width -= 8)
+    {
+        for (int i = 0; i < 3; i++, dst += 8)
+        {
+            const Vec16x8 bg = __builtin_convertvector(load<Vec8x8>(dst), Vec16x8);
+            store(dst, __builtin_convertvector((fg[i] + bg * ialpha) >> 8, Vec8x8));
+        }
+    }
+    for (int i = 0; i < width * 3; i++)
+    {
+        dst[i] = blendByte(color[i % 3], dst[i], alpha);
+    }
+}
+
+void copyLine24(uint8_t* dst, const uint8_t* src, int16_t width, uint32_t alpha)
+{
+    const Vec16x8 valpha = Vec16x8() + static_cast<uint16_t>(alpha);
+    const Vec16x8 ialpha = Vec16x8() + static_cast<uint16_t>(256 - alpha);
+    int bytes = width * 3;
+    for (; bytes >= 8; bytes -= 8, dst += 8, src += 8)
+    {
+        const Vec16x8 fg = __builtin_convertvector(load<Vec8x8>(src), Vec16x8);
+        const Vec16x8 bg = __builtin_convertvector(load<Vec8x8>(dst), Vec16x8);
+        store(dst, __builtin_convertvector((fg * valpha + bg * ialpha) >> 8, Vec8x8));
+    }
+    for (int i = 0; i < bytes; i++)
+    {
+        dst[i] = blendByte(src[i], dst[i], alpha);
+    }
+}
+
+#else // BLIT_KERNELS_WORD
+
+// Two RGB565 pixels, or four bytes, are loaded into a 32 bit word. Each color channel is
+// masked into a 16 bit lane, so one multiplication scales the channel of both pixels, or two
+// of the bytes. A lane never exceeds 255 * 256, so there is no carry into the next lane.
+
+inline uint32_t load32(const void* src)
+{
+    uint32_t w;
+    memcpy(&w, src, sizeof(w));
+    return w;
+}
+
+inline void store32(void* dst, uint32_t w)
+{
+    memcpy(dst, &w, sizeof(w));
+}
+
+#if defined(__ARM_FEATURE_DSP) && defined(__GNUC__)
+// Cortex-M4/M7 extract both even or both odd bytes of a word in one instruction
+inline uint32_t evenBytes(uint32_t w)
+{
+    uint32_t result;
+    __asm("uxtb16 %0, %1" : "=r"(result) : "r"(w));
+    return result;
+}
+
+inline uint32_t oddBytes(uint32_t w)
+{
+    uint32_t result;
+    __asm("uxtb16 %0, %1, ror #8" : "=r"(result) : "r"(w));
+    return result;
+}
+#else
+inline uint32_t evenBytes(uint32_t w)
+{
+    return w & 0x00FF00FF;
+}
+
+inline uint32_t oddBytes(uint32_t w)
+{
+    return (w >> 8) & 0x00FF00FF;
+}
+#endif
+
+inline uint32_t blendRGB565Pair(uint32_t fgR, uint32_t fgG, uint32_t fgB, uint32_t bg, uint32_t ialpha)
+{
+    const uint32_t r = ((fgR + ((bg >> 11) & 0x001F001F) * ialpha) >> 8) & 0x001F001F;
+    const uint32_t g = ((fgG + ((bg >> 5) & 0x003F003F) * ialpha) >> 8) & 0x003F003F;
+    const uint32_t b = ((fgB + (bg & 0x001F001F) * ialpha) >> 8) & 0x001F001F;
+    return (r << 11) | (g << 5) | b;
+}
+
+inline uint32_t blendBytes(uint32_t fgEven, uint32_t fgOdd, uint32_t bg, uint32_t ialpha)
+{
+    return (((fgEven + evenBytes(bg) * ialpha) >> 8) & 0x00FF00FF) | ((fgOdd + oddBytes(bg) * ialpha) & 0xFF00FF00);
+}
+
+void fillLine16(uint16_t* dst, int16_t width, uint16_t color)
+{
+    if (width > 0 && (reinterpret_cast<uintptr_t>(dst) & 2))
+    {
+        *dst++ = color;
+        width--;
+    }
+    const uint32_t pair = color * 0x00010001U;
+    for (; width >= 2; width -= 2, dst += 2)
+    {
+        store32(dst, pair);
+    }
+    if (width > 0)
+    {
+        *dst = color;
+    }
+}
+
+void fillLine16(uint16_t* dst, int16_t width, uint16_t color, uint32_t alpha)
+{
+    if (width > 0 && (reinterpret_cast<uintptr_t>(dst) & 2))
+    {
+        *dst = blendRGB565(color, *dst, alpha);
+        dst++;
+        width--;
+    }
+    const uint32_t r = (color >> 11) * alpha * 0x00010001U;
+    const uint32_t g = ((color >> 5) & 0x3F) * alpha * 0x00010001U;
+    const uint32_t b = (color & 0x1F) * alpha * 0x00010001U;
+    const uint32_t ialpha = 256 - alpha;
+    for (; width >= 2; width -= 2, dst += 2)
+    {
+        store32(dst, blendRGB565Pair(r, g, b, load32(dst), ialpha));
+    }
+    if (width > 0)
+    {
+        *dst = blendRGB565(color, *dst, alpha);
+    }
+}
+
+void copyLine16(uint16_t* dst, const uint16_t* src, int16_t width, uint32_t alpha)
+{
+    if (width > 0 && (reinterpret_cast<uintptr_t>(dst) & 2))
+    {
+        *dst = blendRGB565(*src++, *dst, alpha);
+        dst++;
+        width--;
+    }
+    const uint32_t ialpha = 256 - alpha;
+    for (; width >= 2; width -= 2, dst += 2, src += 2)
+    {
+        const uint32_t fg = load32(src);
+        store32(dst, blendRGB565Pair(((fg >> 11) & 0x001F001F) * alpha, ((fg >> 5) & 0x003F003F) * alpha, (fg & 0x001F001F) * alpha, load32(dst), ialpha));
+    }
+    if (width > 0)
+    {
+        *dst = blendRGB565(*src, *dst, alpha);
+    }
+}
+
+void copyARGB8888Line16(uint16_t* dst, const uint32_t* src, int16_t width, uint32_t alpha)
+{
+    // The alpha differs from pixel to pixel, so pixels cannot share a multiplication
+    copyARGB8888Line(dst, src, width, alpha);
+}
+
+void fillLine24(uint8_t* dst, int16_t width, const uint8_t* color)
+{
+    for (; width > 0 && (reinterpret_cast<uintptr_t>(dst) & 3); width--, dst += 3)
+    {
+        dst[0] = color[0];
+        dst[1] = color[1];
+        dst[2] = color[2];
+    }
+    // Four pixels fill three words
+    const uint32_t w0 = color[0] | (color[1] << 8) | (color[2] << 16) | (color[0] << 24);
+    const uint32_t w1 = color[1] | (color[2] << 8) | (color[0] << 16) | (color[1] << 24);
+    const uint32_t w2 = color[2] | (color[0] << 8) | (color[1] << 16) | (color[2] << 24);
+    for (; width >= 4; width -= 4, dst += 12)
+    {
+        store32(dst, w0);
+        store32(dst + 4, w1);
+        store32(dst + 8, w2);
+    }
+    for (; width > 0; width--, dst += 3)
+    {
+        dst[0] = color[0];
+        dst[1] = color[1];
+        dst[2] = color[2];
+    }
+}
+
+void fillLine24(uint8_t* dst, int16_t width, const uint8_t* color, uint32_t alpha)
+{
+    for (; width > 0 && (reinterpret_cast<uintptr_t>(dst) & 3); width--, dst += 3)
+    {
+        dst[0] = blendByte(color[0], dst[0], alpha);
+        dst[1] = blendByte(color[1], dst[1], alpha);
+        dst[2] = blendByte(color[2], dst[2], alpha);
+    }
+    const uint32_t w[3] =
+    {
+        static_cast<uint32_t>(color[0] | (color[1] << 8) | (color[2] << 16) | (color[0] << 24)),
+        static_cast<uint32_t>(color[1] | (color[2] << 8) | (color[0] << 16) | (color[1] << 24)),
+        static_cast<uint32_t>(color[2] | (color[0] << 8) | (color[1] << 16) | (color[2] << 24))
+    };
+    uint32_t fgEven[3];
+    uint32_t fgOdd[3];
+    for (int i = 0; i < 3; i++)
+    {
+        fgEven[i] = evenBytes(w[i]) * alpha;
+        fgOdd[i] = oddBytes(w[i]) * alpha;
+    }
+    const uint32_t ialpha = 256 - alpha;
+    for (; width >= 4; width -= 4)
+    {
+        for (int i = 0; i < 3; i++, dst += 4)
+        {
+            store32(dst, blendBytes(fgEven[i], fgOdd[i], load32(dst), ialpha));
+        }
+    }
+    for (int i = 0; i < width * 3; i++)
+    {
+        dst[i] = blendByte(color[i % 3], dst[i], alpha);
+    }
+}
+
+void copyLine24(uint8_t* dst, const uint8_t* src, int16_t width, uint32_t alpha)
+{
+    int bytes = width * 3;
+    for (; bytes > 0 && (reinterpret_cast<uintptr_t>(dst) & 3); bytes--)
+    {
+        *dst = blendByte(*src++, *dst, alpha);
+        dst++;
+    }
+    const uint32_t ialpha = 256 - alpha;
+    for (; bytes >= 4; bytes -= 4, dst += 4, src += 4)
+    {
+        const uint32_t fg = load32(src);
+        store32(dst, blendBytes(evenBytes(fg) * alpha, oddBytes(fg) * alpha, load32(dst), ialpha));
+    }
+    for (int i = 0; i < bytes; i++)
+    {
+        dst[i] = blendByte(src[i], dst[i], alpha);
+    }
+}
+
+#endif // BLIT_KERNELS_VECTOR
+} // namespace
+
+const char* BlitKernels::getName()
+{
+#if defined(BLIT_KERNELS_VECTOR)
+    return "vector";
+#else
+    return "word";
+#endif
+}
+
+void BlitKernels::fill16(uint16_t* dst, int16_t width, int16_t height, int16_t dstStride, uint16_t color, uint8_t alpha)
+{
+    for (int16_t y = 0; y < height; y++, dst += dstStride)
+    {
+        if (alpha == 255)
+        {
+            fillLine16(dst, width, color);
+        }
+        else
+        {
+            fillLine16(dst, width, color, alpha);
+        }
+    }
+}
+
+void BlitKernels::copy16(uint16_t* dst, const uint16_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha)
+{
+    for (int16_t y = 0; y < height; y++, dst += dstStride, src += srcStride)
+    {
+        if (alpha == 255)
+        {
+            memcpy(dst, src, width * sizeof(uint16_t));
+        }
+        else
+        {
+            copyLine16(dst, src, width, alpha);
+        }
+    }
+}
+
+void BlitKernels::copyARGB8888To16(uint16_t* dst, const uint32_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha)
+{
+    for (int16_t y = 0; y < height; y++, dst += dstStride, src += srcStride)
+    {
+        copyARGB8888Line16(dst, src, width, alpha);
+    }
+}
+
+void BlitKernels::fill24(uint8_t* dst, int16_t width, int16_t height, int16_t dstStride, uint32_t color, uint8_t alpha)
+{
+    const uint8_t bytes[3] = { static_cast<uint8_t>(color), static_cast<uint8_t>(color >> 8), static_cast<uint8_t>(color >> 16) };
+    for (int16_t y = 0; y < height; y++, dst += dstStride * 3)
+    {
+        if (alpha == 255)
+        {
+            fillLine24(dst, width, bytes);
+        }
+        else
+        {
+            fillLine24(dst, width, bytes, alpha);
+        }
+    }
+}
+
+void BlitKernels::copy24(uint8_t* dst, const uint8_t* src, int16_t width, int16_t height, int16_t dstStride, int16_t srcStride, uint8_t alpha)
+{
+    for (int16_t y = 0; y < height; y++, dst += dstStride * 3, src += srcStride * 3)
+    {
+        if (alpha == 255)
+        {
+            memcpy(dst, src, width * 3);
+        }
+        else
+        {
+            copyLine24(dst, src, width, alpha);
+        }
+    }
+}
+} // namespace touchgfx
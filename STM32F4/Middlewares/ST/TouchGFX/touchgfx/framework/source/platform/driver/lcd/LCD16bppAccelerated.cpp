@@ -0,0 +1,235 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <platform/driver/lcd/LCD16bppAccelerated.hpp>
+#include <platform/driver/lcd/BlitKernels.hpp>
+#include <touchgfx/BitmapCache.hpp>
+#include <touchgfx/EncodedBitmap.hpp>
+#include <cassert>
+
+namespace touchgfx
+{
+namespace
+{
+// Gets the part of the frame buffer covered by blitRect, which is relative to source
+Rect getDestination(const Rect& source, const Rect& blitRect)
+{
+    Rect destination(source.x + blitRect.x, source.y + blitRect.y, blitRect.width, blitRect.height);
+    destination &= source;
+    destination &= Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    return destination;
+}
+
+// Decoded pixels of one line of an encoded bitmap, or the RGB565 palette of an L8 bitmap
+union
+{
+    uint32_t argb8888[EncodedBitmap::MAX_LZ4_WIDTH];
+    uint16_t rgb565[EncodedBitmap::MAX_LZ4_WIDTH * 2];
+} lineBuffer;
+
+const int16_t LINE_BUFFER_ARGB8888_PIXELS = EncodedBitmap::MAX_LZ4_WIDTH;
+const int16_t LINE_BUFFER_RGB565_PIXELS = EncodedBitmap::MAX_LZ4_WIDTH * 2;
+
+void drawL8(const uint8_t* data, const Rect& source, const Rect& destination, uint16_t* dst, uint8_t alpha)
+{
+    const uint8_t* pixels = EncodedBitmap::getPixels(data) + (destination.y - source.y) * source.width + (destination.x - source.x);
+    if (alpha == 255 && !EncodedBitmap::hasTransparentPixels(data))
+    {
+        // Convert the palette once, then every pixel is a lookup
+        uint16_t* palette = lineBuffer.rgb565;
+        const uint16_t paletteSize = EncodedBitmap::getPaletteSize(data);
+        for (uint16_t i = 0; i < paletteSize; i++)
+        {
+            const uint32_t color = EncodedBitmap::getPaletteColor(data, static_cast<uint8_t>(i));
+            palette[i] = static_cast<uint16_t>(((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F));
+        }
+        for (int16_t y = 0; y < destination.height; y++, dst += HAL::FRAME_BUFFER_WIDTH, pixels += source.width)
+        {
+            for (int16_t x = 0; x < destination.width; x++)
+            {
+                dst[x] = palette[pixels[x]];
+            }
+        }
+        return;
+    }
+
+    for (int16_t y = 0; y < destination.height; y++, dst += HAL::FRAME_BUFFER_WIDTH, pixels += source.width)
+    {
+        for (int16_t x = 0; x < destination.width; x += LINE_BUFFER_ARGB8888_PIXELS)
+        {
+            const int16_t count = MIN(static_cast<int16_t>(destination.width - x), LINE_BUFFER_ARGB8888_PIXELS);
+            for (int16_t i = 0; i < count; i++)
+            {
+                lineBuffer.argb8888[i] = EncodedBitmap::getPaletteColor(data, pixels[x + i]);
+            }
+            BlitKernels::copyARGB8888To16(dst + x, lineBuffer.argb8888, count, 1, HAL::FRAME_BUFFER_WIDTH, count, alpha);
+        }
+    }
+}
+
+void drawRGB565RLE(const uint8_t* data, const Rect& source, const Rect& destination, uint16_t* dst, uint8_t alpha)
+{
+    for (int16_t y = 0; y < destination.height; y++, dst += HAL::FRAME_BUFFER_WIDTH)
+    {
+        EncodedBitmap::RLEDecoder decoder(EncodedBitmap::getLine(data, source.height, destination.y - source.y + y));
+        decoder.skip(destination.x - source.x);
+        if (alpha == 255)
+        {
+            decoder.decode(dst, destination.width);
+            continue;
+        }
+        for (int16_t x = 0; x < destination.width; x += LINE_BUFFER_RGB565_PIXELS)
+        {
+            const int16_t count = MIN(static_cast<int16_t>(destination.width - x), LINE_BUFFER_RGB565_PIXELS);
+            decoder.decode(lineBuffer.rgb565, count);
+            BlitKernels::copy16(dst + x, lineBuffer.rgb565, count, 1, HAL::FRAME_BUFFER_WIDTH, count, alpha);
+        }
+    }
+}
+
+void drawARGB8888LZ4(const uint8_t* data, const Rect& source, const Rect& destination, uint16_t* dst, uint8_t alpha)
+{
+    assert(source.width <= EncodedBitmap::MAX_LZ4_WIDTH && "LZ4 encoded bitmap too wide");
+    // An LZ4 block can only be decoded from the start, so the pixels left of the
+    // destination are decoded as well
+    const int16_t srcX = destination.x - source.x;
+    for (int16_t y = 0; y < destination.height; y++, dst += HAL::FRAME_BUFFER_WIDTH)
+    {
+        EncodedBitmap::decodeLZ4(EncodedBitmap::getLine(data, source.height, destination.y - source.y + y), lineBuffer.argb8888, srcX + destination.width);
+        BlitKernels::copyARGB8888To16(dst, lineBuffer.argb8888 + srcX, destination.width, 1, HAL::FRAME_BUFFER_WIDTH, destination.width, alpha);
+    }
+}
+} // namespace
+
+void LCD16bppAccelerated::drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha, bool useOptimized)
+{
+    // All bitmap widgets draw through here, also when they come from the library
+    BitmapCache::access(bitmap.getId());
+
+    if (bitmap.getFormat() == Bitmap::ENCODED)
+    {
+        const Rect source(x, y, bitmap.getWidth(), bitmap.getHeight());
+        blitCopyEncoded(bitmap.getData(), source, rect & bitmap.getRect(), alpha);
+        return;
+    }
+    if (bitmap.getFormat() != Bitmap::ARGB8888 || !useBlitKernels(alpha == 255 ? BLIT_OP_COPY_ARGB8888 : BLIT_OP_COPY_ARGB8888_WITH_ALPHA))
+    {
+        LCD16bpp::drawPartialBitmap(bitmap, x, y, rect, alpha, useOptimized);
+        return;
+    }
+
+    // The solid parts of the bitmap are opaque, so they come out the same as with
+    // the fill substitutions made by LCD16bpp
+    const Rect source(x, y, bitmap.getWidth(), bitmap.getHeight());
+    blitCopyARGB8888(reinterpret_cast<const uint32_t*>(bitmap.getData()), source, rect & bitmap.getRect(), alpha);
+}
+
+void LCD16bppAccelerated::blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    if (hasTransparentPixels || !useBlitKernels(alpha == 255 ? BLIT_OP_COPY : BLIT_OP_COPY_WITH_ALPHA))
+    {
+        LCD16bpp::blitCopy(sourceData, source, blitRect, alpha, hasTransparentPixels);
+        return;
+    }
+
+    const Rect destination = getDestination(source, blitRect);
+    if (alpha == 0 || destination.isEmpty())
+    {
+        return;
+    }
+    uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    BlitKernels::copy16(frameBuffer + destination.y * HAL::FRAME_BUFFER_WIDTH + destination.x,
+                        sourceData + (destination.y - source.y) * source.width + (destination.x - source.x),
+                        destination.width, destination.height, HAL::FRAME_BUFFER_WIDTH, source.width, alpha);
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+void LCD16bppAccelerated::blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    if (sourceFormat == Bitmap::ENCODED)
+    {
+        blitCopyEncoded(sourceData, source, blitRect, alpha);
+        return;
+    }
+    if (sourceFormat != Bitmap::ARGB8888 || !useBlitKernels(alpha == 255 ? BLIT_OP_COPY_ARGB8888 : BLIT_OP_COPY_ARGB8888_WITH_ALPHA))
+    {
+        LCD16bpp::blitCopy(sourceData, sourceFormat, source, blitRect, alpha, hasTransparentPixels);
+        return;
+    }
+    blitCopyARGB8888(reinterpret_cast<const uint32_t*>(sourceData), source, blitRect, alpha);
+}
+
+void LCD16bppAccelerated::fillRect(const Rect& rect, colortype color, uint8_t alpha)
+{
+    if (!useBlitKernels(alpha == 255 ? BLIT_OP_FILL : BLIT_OP_FILL_WITH_ALPHA))
+    {
+        LCD16bpp::fillRect(rect, color, alpha);
+        return;
+    }
+
+    const Rect destination = rect & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (alpha == 0 || destination.isEmpty())
+    {
+        return;
+    }
+    uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    BlitKernels::fill16(frameBuffer + destination.y * HAL::FRAME_BUFFER_WIDTH + destination.x,
+                        destination.width, destination.height, HAL::FRAME_BUFFER_WIDTH, static_cast<uint16_t>(color), alpha);
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+bool LCD16bppAccelerated::useBlitKernels(BlitOperations operation)
+{
+    return HAL::DISPLAY_ROTATION == rotate0 && (HAL::getInstance()->getBlitCaps() & operation) == 0;
+}
+
+void LCD16bppAccelerated::blitCopyARGB8888(const uint32_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha)
+{
+    const Rect destination = getDestination(source, blitRect);
+    if (alpha == 0 || destination.isEmpty())
+    {
+        return;
+    }
+    uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    BlitKernels::copyARGB8888To16(frameBuffer + destination.y * HAL::FRAME_BUFFER_WIDTH + destination.x,
+                                  sourceData + (destination.y - source.y) * source.width + (destination.x - source.x),
+                                  destination.width, destination.height, HAL::FRAME_BUFFER_WIDTH, source.width, alpha);
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+void LCD16bppAccelerated::blitCopyEncoded(const uint8_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha)
+{
+    // No blit accelerator can decode the pixels, so they are always drawn here
+    assert(HAL::DISPLAY_ROTATION == rotate0 && "Encoded bitmaps cannot be drawn on a rotated display");
+    const Rect destination = getDestination(source, blitRect);
+    if (alpha == 0 || destination.isEmpty())
+    {
+        return;
+    }
+    uint16_t* frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    uint16_t* dst = frameBuffer + destination.y * HAL::FRAME_BUFFER_WIDTH + destination.x;
+    switch (EncodedBitmap::getEncoding(sourceData))
+    {
+    case EncodedBitmap::L8:
+        drawL8(sourceData, source, destination, dst, alpha);
+        break;
+    case EncodedBitmap::RGB565_RLE:
+        drawRGB565RLE(sourceData, source, destination, dst, alpha);
+        break;
+    case EncodedBitmap::ARGB8888_LZ4:
+        drawARGB8888LZ4(sourceData, source, destination, dst, alpha);
+        break;
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+}
+} // namespace touchgfx
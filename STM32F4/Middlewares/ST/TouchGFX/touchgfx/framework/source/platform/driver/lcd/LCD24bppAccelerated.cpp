@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <platform/driver/lcd/LCD24bppAccelerated.hpp>
+#include <platform/driver/lcd/BlitKernels.hpp>
+#include <touchgfx/BitmapCache.hpp>
+
+namespace touchgfx
+{
+void LCD24bppAccelerated::drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha, bool useOptimized)
+{
+    // All bitmap widgets draw through here, also when they come from the library
+    BitmapCache::access(bitmap.getId());
+
+    LCD24bpp::drawPartialBitmap(bitmap, x, y, rect, alpha, useOptimized);
+}
+
+void LCD24bppAccelerated::blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    if (hasTransparentPixels || !useBlitKernels(alpha == 255 ? BLIT_OP_COPY : BLIT_OP_COPY_WITH_ALPHA))
+    {
+        LCD24bpp::blitCopy(sourceData, source, blitRect, alpha, hasTransparentPixels);
+        return;
+    }
+    // LCD24bpp passes RGB888 data, e.g. of bitmaps, as 16 bit pointers
+    blitCopyRGB888(reinterpret_cast<const uint8_t*>(sourceData), source, blitRect, alpha);
+}
+
+void LCD24bppAccelerated::blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    if (sourceFormat != Bitmap::RGB888 || hasTransparentPixels || !useBlitKernels(alpha == 255 ? BLIT_OP_COPY : BLIT_OP_COPY_WITH_ALPHA))
+    {
+        LCD24bpp::blitCopy(sourceData, sourceFormat, source, blitRect, alpha, hasTransparentPixels);
+        return;
+    }
+    blitCopyRGB888(sourceData, source, blitRect, alpha);
+}
+
+void LCD24bppAccelerated::fillRect(const Rect& rect, colortype color, uint8_t alpha)
+{
+    if (!useBlitKernels(alpha == 255 ? BLIT_OP_FILL : BLIT_OP_FILL_WITH_ALPHA))
+    {
+        LCD24bpp::fillRect(rect, color, alpha);
+        return;
+    }
+
+    const Rect destination = rect & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (alpha == 0 || destination.isEmpty())
+    {
+        return;
+    }
+    uint8_t* frameBuffer = reinterpret_cast<uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    BlitKernels::fill24(frameBuffer + (destination.y * HAL::FRAME_BUFFER_WIDTH + destination.x) * 3,
+                        destination.width, destination.height, HAL::FRAME_BUFFER_WIDTH, color.getColor32(), alpha);
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+bool LCD24bppAccelerated::useBlitKernels(BlitOperations operation)
+{
+    return HAL::DISPLAY_ROTATION == rotate0 && (HAL::getInstance()->getBlitCaps() & operation) == 0;
+}
+
+void LCD24bppAccelerated::blitCopyRGB888(const uint8_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha)
+{
+    // blitRect is relative to source
+    Rect destination(source.x + blitRect.x, source.y + blitRect.y, blitRect.width, blitRect.height);
+    destination &= source;
+    destination &= Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (alpha == 0 || destination.isEmpty())
+    {
+        return;
+    }
+    uint8_t* frameBuffer = reinterpret_cast<uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    BlitKernels::copy24(frameBuffer + (destination.y * HAL::FRAME_BUFFER_WIDTH + destination.x) * 3,
+                        sourceData + ((destination.y - source.y) * source.width + (destination.x - source.x)) * 3,
+                        destination.width, destination.height, HAL::FRAME_BUFFER_WIDTH, source.width, alpha);
+    HAL::getInstance()->unlockFrameBuffer();
+}
+} // namespace touchgfx
@@ -0,0 +1,146 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <platform/hal/simulator/headless/HALHeadless.hpp>
+#include <touchgfx/hal/RenderProfiler.hpp>
+#include <string.h>
+#include <time.h>
+
+namespace touchgfx
+{
+uint32_t HALHeadless::getMicroseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint32_t>(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+void HALHeadless::init()
+{
+    const uint32_t bytesPerBuffer = ((FRAME_BUFFER_WIDTH * lcd().bitDepth() + 7) / 8) * FRAME_BUFFER_HEIGHT;
+    // Allocate size for three frame buffers, rounded up to whole uint16's
+    uint16_t* buffers = new uint16_t[(bytesPerBuffer * 3 + 1) / 2];
+    setFrameBufferStartAddress(buffers, lcd().bitDepth());
+    tft = buffers;
+
+    lcd().init();
+    lockDMAToFrontPorch(false);
+}
+
+void HALHeadless::taskEntry()
+{
+    running = true;
+    const bool limited = ticksLeft > 0;
+    while (running && (!limited || ticksLeft > 0))
+    {
+        simulateVSync();
+        if (limited)
+        {
+            ticksLeft--;
+        }
+    }
+    running = false;
+}
+
+void HALHeadless::simulateVSync()
+{
+    vSync();
+    backPorchExited();
+    frontPorchEntered();
+}
+
+void HALHeadless::flushFrameBuffer()
+{
+    Rect display(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    flushFrameBuffer(display);
+}
+
+void HALHeadless::flushFrameBuffer(const Rect& rect)
+{
+    currentFrame.pixelsFlushed += rect.width * rect.height;
+    currentFrame.rectsFlushed++;
+    HAL::flushFrameBuffer(rect);
+    if (flushCallback && flushCallback->isValid())
+    {
+        flushCallback->execute(rect);
+    }
+}
+
+bool HALHeadless::blockCopy(void* RESTRICT dest, const void* RESTRICT src, uint32_t numBytes)
+{
+    if (RenderWorkers::isDrawing())
+    {
+        // Keep the DMA out of the way of the workers
+        memcpy(dest, src, numBytes);
+        return true;
+    }
+    return HAL::blockCopy(dest, src, numBytes);
+}
+
+void HALHeadless::blitSetTransparencyKey(uint16_t key)
+{
+    (void)key; // Unused
+}
+
+void HALHeadless::flushDMA()
+{
+    RenderProfiler* profiler = RenderProfiler::getInstance();
+    const uint32_t start = profiler ? profiler->getCPUCycles() : 0;
+    HAL::flushDMA();
+    if (profiler)
+    {
+        profiler->addDMAWait(start);
+    }
+}
+
+uint16_t* HALHeadless::getTFTFrameBuffer() const
+{
+    return tft;
+}
+
+void HALHeadless::setTFTFrameBuffer(uint16_t* addr)
+{
+    tft = addr;
+}
+
+bool HALHeadless::beginFrame()
+{
+    currentFrame.frameNumber = frameCounter;
+    currentFrame.pixelsFlushed = 0;
+    currentFrame.rectsFlushed = 0;
+    frameStartUS = getMicroseconds();
+    RenderProfiler* profiler = RenderProfiler::getInstance();
+    if (profiler)
+    {
+        profiler->beginFrame();
+    }
+    currentFrame.rendered = HAL::beginFrame();
+    return currentFrame.rendered;
+}
+
+void HALHeadless::endFrame()
+{
+    HAL::endFrame();
+    currentFrame.frameTimeUS = getMicroseconds() - frameStartUS;
+    RenderProfiler* profiler = RenderProfiler::getInstance();
+    if (profiler)
+    {
+        profiler->endFrame();
+    }
+    frameCounter++;
+    if (frameCallback && frameCallback->isValid())
+    {
+        frameCallback->execute(currentFrame);
+    }
+}
+} // namespace touchgfx
@@ -0,0 +1,241 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+#include <string.h>
+#include <time.h>
+
+namespace touchgfx
+{
+namespace
+{
+inline uint16_t blendRGB565(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+    const uint32_t ialpha = 0xFF - alpha;
+    return static_cast<uint16_t>(((((fg & 0xF800) * alpha + (bg & 0xF800) * ialpha) / 255) & 0xF800) |
+                                 ((((fg & 0x07E0) * alpha + (bg & 0x07E0) * ialpha) / 255) & 0x07E0) |
+                                 ((((fg & 0x001F) * alpha + (bg & 0x001F) * ialpha) / 255) & 0x001F));
+}
+
+inline uint16_t convertARGB8888ToRGB565(uint32_t argb)
+{
+    return static_cast<uint16_t>(((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F));
+}
+
+inline uint8_t multiplyAlpha(uint8_t a, uint8_t b)
+{
+    return static_cast<uint8_t>((a * b) / 255);
+}
+
+uint64_t getNanoseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+} // namespace
+
+HeadlessDMA* HeadlessDMA::instance = 0;
+
+HeadlessDMA::HeadlessDMA()
+    : DMA_Interface(dmaQueue),
+      dmaQueue(queueStorage, QUEUE_SIZE),
+      blitCaps(static_cast<BlitOperations>(SUPPORTED_BLIT_CAPS)),
+      transferPending(false),
+      deferTransfers(false),
+      operationSetupTime(0),
+      numberOfOperations(0),
+      numberOfPixels(0)
+{
+    dmaQueue.setMergingEnabled(false);
+    instance = this;
+}
+
+void HeadlessDMA::addToQueue(const BlitOp& op)
+{
+    while (transferPending && isDmaQueueFull())
+    {
+        finishTransfer();
+    }
+    DMA_Interface::addToQueue(op);
+}
+
+void HeadlessDMA::flush()
+{
+    finishTransfers();
+    DMA_Interface::flush();
+}
+
+void HeadlessDMA::setDeferredTransfers(bool deferred)
+{
+    deferTransfers = deferred;
+    if (!deferred)
+    {
+        finishTransfers();
+    }
+}
+
+void HeadlessDMA::finishDeferredTransfers()
+{
+    if (instance)
+    {
+        instance->finishTransfers();
+    }
+}
+
+void HeadlessDMA::setupDataCopy(const BlitOp& blitOp)
+{
+    startTransfer(blitOp);
+}
+
+void HeadlessDMA::setupDataFill(const BlitOp& blitOp)
+{
+    startTransfer(blitOp);
+}
+
+void HeadlessDMA::startTransfer(const BlitOp& blitOp)
+{
+    // The operation stays first in the queue until it is completed, but is copied like a
+    // DMA controller would copy it to its registers
+    transfer = blitOp;
+    transferPending = true;
+    if (!deferTransfers)
+    {
+        finishTransfer();
+    }
+}
+
+void HeadlessDMA::finishTransfer()
+{
+    transferPending = false;
+    const uint64_t start = getNanoseconds();
+    while (getNanoseconds() - start < operationSetupTime)
+    {
+        // Setting up the transfer
+    }
+    if (transfer.operation == BLIT_OP_FILL || transfer.operation == BLIT_OP_FILL_WITH_ALPHA)
+    {
+        fill(transfer);
+    }
+    else
+    {
+        copy(transfer);
+    }
+    statistics.busyTime += static_cast<uint32_t>(getNanoseconds() - start);
+    statistics.executedOperations++;
+    numberOfOperations++;
+    numberOfPixels += transfer.nSteps * transfer.nLoops;
+    // The operation is done, proceed to the next one just like the DMA interrupt would.
+    executeCompleted();
+}
+
+void HeadlessDMA::finishTransfers()
+{
+    while (transferPending)
+    {
+        finishTransfer();
+    }
+}
+
+void HeadlessDMA::copy(const BlitOp& blitOp)
+{
+    uint16_t* dst = blitOp.pDst;
+    for (uint16_t line = 0; line < blitOp.nLoops; line++)
+    {
+        switch (blitOp.operation)
+        {
+        case BLIT_OP_COPY:
+            memcpy(dst, blitOp.pSrc + line * blitOp.srcLoopStride, blitOp.nSteps * sizeof(uint16_t));
+            break;
+        case BLIT_OP_COPY_WITH_ALPHA:
+            {
+                const uint16_t* src = blitOp.pSrc + line * blitOp.srcLoopStride;
+                for (uint16_t i = 0; i < blitOp.nSteps; i++)
+                {
+                    dst[i] = blendRGB565(src[i], dst[i], blitOp.alpha);
+                }
+                break;
+            }
+        case BLIT_OP_COPY_ARGB8888:
+        case BLIT_OP_COPY_ARGB8888_WITH_ALPHA:
+            {
+                const uint32_t* src = reinterpret_cast<const uint32_t*>(blitOp.pSrc) + line * blitOp.srcLoopStride;
+                const uint8_t alpha = (blitOp.operation == BLIT_OP_COPY_ARGB8888) ? 0xFF : blitOp.alpha;
+                for (uint16_t i = 0; i < blitOp.nSteps; i++)
+                {
+                    const uint8_t a = multiplyAlpha(static_cast<uint8_t>(src[i] >> 24), alpha);
+                    if (a)
+                    {
+                        dst[i] = blendRGB565(convertARGB8888ToRGB565(src[i]), dst[i], a);
+                    }
+                }
+                break;
+            }
+        case BLIT_OP_COPY_A4:
+        case BLIT_OP_COPY_A8:
+            {
+                const uint8_t* src = reinterpret_cast<const uint8_t*>(blitOp.pSrc);
+                const uint16_t color = static_cast<uint16_t>(blitOp.color);
+                for (uint16_t i = 0; i < blitOp.nSteps; i++)
+                {
+                    const uint32_t pixel = line * blitOp.srcLoopStride + i;
+                    uint8_t a;
+                    if (blitOp.operation == BLIT_OP_COPY_A4)
+                    {
+                        const uint8_t nibble = (pixel & 1) ? (src[pixel >> 1] >> 4) : (src[pixel >> 1] & 0x0F);
+                        a = static_cast<uint8_t>(nibble * 0x11);
+                    }
+                    else
+                    {
+                        a = src[pixel];
+                    }
+                    a = multiplyAlpha(a, blitOp.alpha);
+                    if (a)
+                    {
+                        dst[i] = blendRGB565(color, dst[i], a);
+                    }
+                }
+                break;
+            }
+        default:
+            assert(0 && "Unsupported blit operation");
+            break;
+        }
+        dst += blitOp.dstLoopStride;
+    }
+}
+
+void HeadlessDMA::fill(const BlitOp& blitOp)
+{
+    const uint16_t color = static_cast<uint16_t>(blitOp.color);
+    uint16_t* dst = blitOp.pDst;
+    for (uint16_t line = 0; line < blitOp.nLoops; line++)
+    {
+        if (blitOp.operation == BLIT_OP_FILL_WITH_ALPHA)
+        {
+            for (uint16_t i = 0; i < blitOp.nSteps; i++)
+            {
+                dst[i] = blendRGB565(color, dst[i], blitOp.alpha);
+            }
+        }
+        else
+        {
+            for (uint16_t i = 0; i < blitOp.nSteps; i++)
+            {
+                dst[i] = color;
+            }
+        }
+        dst += blitOp.dstLoopStride;
+    }
+}
+} // namespace touchgfx
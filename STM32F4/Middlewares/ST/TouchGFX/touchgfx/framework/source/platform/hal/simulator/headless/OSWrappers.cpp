@@ -0,0 +1,46 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/hal/OSWrappers.hpp>
+#include <platform/hal/simulator/headless/HeadlessDMA.hpp>
+
+namespace touchgfx
+{
+// The headless HAL renders and "transmits" frames from a single thread, so the frame
+// buffer never needs to be protected. Only a HeadlessDMA deferring its transfers holds on
+// to it, until the transfers are performed. RenderWorkers draw in parallel from several
+// threads, but the DMA is flushed before they start and not used until they are done.
+
+void OSWrappers::initialize()
+{}
+
+void OSWrappers::takeFrameBufferSemaphore()
+{
+    HeadlessDMA::finishDeferredTransfers();
+}
+
+void OSWrappers::giveFrameBufferSemaphore()
+{}
+
+void OSWrappers::waitForVSync()
+{}
+
+void OSWrappers::tryTakeFrameBufferSemaphore()
+{}
+
+void OSWrappers::giveFrameBufferSemaphoreFromISR()
+{}
+} // namespace touchgfx
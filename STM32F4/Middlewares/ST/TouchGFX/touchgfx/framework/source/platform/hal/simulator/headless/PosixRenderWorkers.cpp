@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <platform/hal/simulator/headless/PosixRenderWorkers.hpp>
+#include <cassert>
+
+namespace touchgfx
+{
+PosixRenderWorkers::PosixRenderWorkers(uint8_t numberOfWorkers_)
+    : numberOfWorkers(numberOfWorkers_),
+      currentJob(0),
+      generation(0),
+      busyWorkers(0),
+      stopping(false)
+{
+    assert(numberOfWorkers > 0 && numberOfWorkers <= MAX_WORKERS && "Invalid number of render workers");
+    pthread_key_create(&workerKey, 0);
+    pthread_mutex_init(&mutex, 0);
+    pthread_cond_init(&jobStarted, 0);
+    pthread_cond_init(&jobFinished, 0);
+    for (uint8_t i = 0; i < NUMBER_OF_LOCKS; i++)
+    {
+        pthread_mutex_init(&locks[i], 0);
+    }
+    for (uint8_t i = 1; i < numberOfWorkers; i++)
+    {
+        workerThreads[i].workers = this;
+        workerThreads[i].index = i;
+        const int result = pthread_create(&workerThreads[i].thread, 0, threadEntry, &workerThreads[i]);
+        assert(result == 0 && "Unable to start render worker thread");
+        (void)result;
+    }
+}
+
+PosixRenderWorkers::~PosixRenderWorkers()
+{
+    pthread_mutex_lock(&mutex);
+    stopping = true;
+    pthread_cond_broadcast(&jobStarted);
+    pthread_mutex_unlock(&mutex);
+    for (uint8_t i = 1; i < numberOfWorkers; i++)
+    {
+        pthread_join(workerThreads[i].thread, 0);
+    }
+    for (uint8_t i = 0; i < NUMBER_OF_LOCKS; i++)
+    {
+        pthread_mutex_destroy(&locks[i]);
+    }
+    pthread_cond_destroy(&jobFinished);
+    pthread_cond_destroy(&jobStarted);
+    pthread_mutex_destroy(&mutex);
+    pthread_key_delete(workerKey);
+}
+
+void PosixRenderWorkers::runJob(GenericCallback<uint8_t>& job)
+{
+    pthread_mutex_lock(&mutex);
+    currentJob = &job;
+    busyWorkers = numberOfWorkers - 1;
+    generation++;
+    pthread_cond_broadcast(&jobStarted);
+    pthread_mutex_unlock(&mutex);
+
+    job.execute(0);
+
+    pthread_mutex_lock(&mutex);
+    while (busyWorkers > 0)
+    {
+        pthread_cond_wait(&jobFinished, &mutex);
+    }
+    currentJob = 0;
+    pthread_mutex_unlock(&mutex);
+}
+
+uint8_t PosixRenderWorkers::getWorkerIndex() const
+{
+    // The calling task has no index stored, and is worker 0
+    return static_cast<uint8_t>(reinterpret_cast<uintptr_t>(pthread_getspecific(workerKey)));
+}
+
+void PosixRenderWorkers::lock(uint8_t index)
+{
+    pthread_mutex_lock(&locks[index]);
+}
+
+void PosixRenderWorkers::unlock(uint8_t index)
+{
+    pthread_mutex_unlock(&locks[index]);
+}
+
+void* PosixRenderWorkers::threadEntry(void* argument)
+{
+    Worker* worker = static_cast<Worker*>(argument);
+    pthread_setspecific(worker->workers->workerKey, reinterpret_cast<void*>(static_cast<uintptr_t>(worker->index)));
+    worker->workers->workerLoop(worker->index);
+    return 0;
+}
+
+void PosixRenderWorkers::workerLoop(uint8_t index)
+{
+    uint32_t lastGeneration = 0;
+    pthread_mutex_lock(&mutex);
+    for (;;)
+    {
+        while (!stopping && generation == lastGeneration)
+        {
+            pthread_cond_wait(&jobStarted, &mutex);
+        }
+        if (stopping)
+        {
+            break;
+        }
+        lastGeneration = generation;
+        GenericCallback<uint8_t>* job = currentJob;
+        pthread_mutex_unlock(&mutex);
+
+        job->execute(index);
+
+        pthread_mutex_lock(&mutex);
+        if (--busyWorkers == 0)
+        {
+            pthread_cond_signal(&jobFinished);
+        }
+    }
+    pthread_mutex_unlock(&mutex);
+}
+} // namespace touchgfx
@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/AnimationScheduler.hpp>
+#include <cassert>
+
+namespace touchgfx
+{
+AnimationScheduler* AnimationScheduler::instance = 0;
+
+Animation::~Animation()
+{
+    if (scheduler)
+    {
+        scheduler->remove(*this);
+    }
+}
+
+void Animation::unschedule()
+{
+    if (isScheduled())
+    {
+        scheduler->unschedule(*this);
+    }
+}
+
+void AnimationScheduler::schedule(Animation& animation)
+{
+    if (animation.scheduler == this && !animation.removed)
+    {
+        return;
+    }
+    assert((animation.scheduler == 0 || animation.scheduler == this) && "Animation is scheduled by another scheduler");
+    assert(numberOfAnimations < 0xFFFF && "Too many animations");
+
+    numberOfAnimations++;
+    if (animation.removed)
+    {
+        // Unscheduled earlier in this pass and still in the list
+        animation.removed = false;
+        return;
+    }
+    animation.scheduler = this;
+    animation.previous = last;
+    animation.next = 0;
+    if (last)
+    {
+        last->next = &animation;
+    }
+    else
+    {
+        first = &animation;
+    }
+    last = &animation;
+
+    if (ticking && nextToTick == 0)
+    {
+        // Appended after the animation being ticked
+        nextToTick = &animation;
+    }
+}
+
+void AnimationScheduler::unschedule(Animation& animation)
+{
+    assert(animation.scheduler == this && !animation.removed && "Animation is not scheduled by this scheduler");
+
+    if (ticking)
+    {
+        // Removed from the list after the pass, like the timer widgets of Application
+        animation.removed = true;
+        numberOfAnimations--;
+    }
+    else
+    {
+        remove(animation);
+    }
+}
+
+void AnimationScheduler::remove(Animation& animation)
+{
+    if (!animation.removed)
+    {
+        numberOfAnimations--;
+    }
+    if (nextToTick == &animation)
+    {
+        nextToTick = animation.next;
+    }
+    if (animation.previous)
+    {
+        animation.previous->next = animation.next;
+    }
+    else
+    {
+        first = animation.next;
+    }
+    if (animation.next)
+    {
+        animation.next->previous = animation.previous;
+    }
+    else
+    {
+        last = animation.previous;
+    }
+    animation.scheduler = 0;
+    animation.previous = 0;
+    animation.next = 0;
+    animation.removed = false;
+}
+
+void AnimationScheduler::clear()
+{
+    while (first)
+    {
+        remove(*first);
+    }
+}
+
+void AnimationScheduler::handleTickEvent()
+{
+    ticking = true;
+    nextToTick = first;
+    while (nextToTick)
+    {
+        Animation* animation = nextToTick;
+        nextToTick = animation->next;
+        if (!animation->removed)
+        {
+            animation->tickCallback.execute();
+        }
+    }
+    ticking = false;
+
+    Animation* animation = first;
+    while (animation)
+    {
+        Animation* next = animation->next;
+        if (animation->removed)
+        {
+            remove(*animation);
+        }
+        animation = next;
+    }
+}
+} // namespace touchgfx
@@ -0,0 +1,364 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/BitmapCache.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+namespace touchgfx
+{
+BitmapCache::Entry* BitmapCache::entries = 0;
+uint16_t BitmapCache::numberOfBitmaps = 0;
+uint32_t BitmapCache::capacity = 0;
+BitmapId BitmapCache::newest = BITMAP_INVALID;
+BitmapId BitmapCache::oldest = BITMAP_INVALID;
+uint16_t BitmapCache::frame = 0;
+bool BitmapCache::frameHasDraws = false;
+bool BitmapCache::cacheFull = false;
+uint32_t BitmapCache::frameBudget = 64 * 1024;
+uint32_t BitmapCache::compactionBudget = 32 * 1024;
+BitmapId BitmapCache::deferred[MAX_DEFERRED_BITMAPS];
+uint16_t BitmapCache::numberOfDeferred = 0;
+BitmapCacheStatistics BitmapCache::statistics = { 0, 0, 0, 0, 0, 0, 0 };
+
+void BitmapCache::registerBitmapDatabase(const Bitmap::BitmapData* data, const uint16_t n, uint16_t* cachep, uint32_t csize, uint32_t numberOfDynamicBitmaps)
+{
+    entries = 0;
+    numberOfBitmaps = 0;
+    newest = BITMAP_INVALID;
+    oldest = BITMAP_INVALID;
+    numberOfDeferred = 0;
+    cacheFull = false;
+    if (cachep == 0 || csize == 0)
+    {
+        Bitmap::registerBitmapDatabase(data, n, cachep, csize, numberOfDynamicBitmaps);
+        return;
+    }
+
+    const uint32_t bookkeepingSize = getBookkeepingSize(n);
+    assert(csize > bookkeepingSize && "Bitmap cache too small for the bookkeeping");
+    entries = reinterpret_cast<Entry*>(cachep);
+    numberOfBitmaps = n;
+    for (uint16_t id = 0; id < n; id++)
+    {
+        entries[id].older = BITMAP_INVALID;
+        entries[id].newer = BITMAP_INVALID;
+        entries[id].frame = 0;
+        entries[id].linked = 0;
+        entries[id].deferred = 0;
+    }
+    cachep += bookkeepingSize / sizeof(uint16_t);
+    csize -= bookkeepingSize;
+
+    // Bitmap places its tables at the beginning of the region, like above
+    const uint32_t tableSize = getTableSize(n, numberOfDynamicBitmaps);
+    capacity = csize > tableSize ? csize - tableSize : 0;
+
+    Bitmap::registerBitmapDatabase(data, n, cachep, csize, numberOfDynamicBitmaps);
+}
+
+void BitmapCache::endFrame()
+{
+    if (entries == 0)
+    {
+        return;
+    }
+    const bool idle = !frameHasDraws;
+    const uint16_t drawnFrame = frame;
+    frameHasDraws = false;
+    frame++;
+    if (numberOfDeferred == 0 && Bitmap::uncachedCount == 0)
+    {
+        return;
+    }
+
+    // Compacting moves bitmaps the DMA could be reading
+    HAL::getInstance()->flushDMA();
+
+    // Removing bitmaps to make room leaves holes, which are compacted before the next bitmap
+    // is cached. If the compaction budget runs out, it is resumed after the next frame.
+    uint32_t movedBytes = 0;
+    uint32_t admittedBytes = 0;
+    uint16_t handled = 0;
+    while (compact(movedBytes) && handled < numberOfDeferred)
+    {
+        const BitmapId id = deferred[handled];
+        const uint32_t size = getSizeOfBitmap(id);
+        if (!idle && admittedBytes > 0 && admittedBytes + size > frameBudget)
+        {
+            break;
+        }
+        if (admit(id, drawnFrame))
+        {
+            entries[id].deferred = 0;
+            if (Bitmap::cacheIsCached(id))
+            {
+                admittedBytes += size;
+            }
+            handled++;
+        }
+    }
+
+    // The rest is cached after the next frame
+    for (uint16_t i = handled; i < numberOfDeferred; i++)
+    {
+        deferred[i - handled] = deferred[i];
+    }
+    numberOfDeferred -= handled;
+}
+
+void BitmapCache::resetStatistics()
+{
+    statistics.hits = 0;
+    statistics.misses = 0;
+    statistics.admissions = 0;
+    statistics.evictions = 0;
+    statistics.deferrals = 0;
+    statistics.admittedBytes = 0;
+    statistics.compactedBytes = 0;
+}
+
+void BitmapCache::touch(BitmapId id)
+{
+    frameHasDraws = true;
+    Entry& entry = entries[id];
+    entry.frame = frame;
+    if (Bitmap::cacheIsCached(id))
+    {
+        statistics.hits++;
+        if (newest != id)
+        {
+            if (entry.linked)
+            {
+                unlink(id);
+            }
+            link(id);
+        }
+        return;
+    }
+
+    statistics.misses++;
+    if (entry.linked)
+    {
+        // Removed from the cache by someone else
+        unlink(id);
+    }
+    if (entry.deferred || !isCacheable(id))
+    {
+        return;
+    }
+
+    if (!cacheFull && Bitmap::uncachedCount == 0 && !RenderWorkers::isDrawing())
+    {
+        // Without holes left by removed bitmaps, caching a bitmap only appends it to the
+        // cache, otherwise Bitmap::cache() would compact all of the cache
+        HAL::getInstance()->flushDMA();
+        if (Bitmap::cache(id))
+        {
+            statistics.admissions++;
+            statistics.admittedBytes += getSizeOfBitmap(id);
+            link(id);
+            return;
+        }
+        cacheFull = true;
+    }
+
+    // Making room requires removing bitmaps, which is left to endFrame(), like compacting
+    // and caching while other workers may be reading the cache
+    if (numberOfDeferred < MAX_DEFERRED_BITMAPS && getSizeOfBitmap(id) <= capacity)
+    {
+        entry.deferred = 1;
+        deferred[numberOfDeferred++] = id;
+        statistics.deferrals++;
+    }
+}
+
+bool BitmapCache::admit(BitmapId id, uint16_t protectedFrame)
+{
+    if (Bitmap::cacheIsCached(id))
+    {
+        return true;
+    }
+
+    const uint32_t size = getSizeOfBitmap(id);
+    if (Bitmap::cache(id))
+    {
+        statistics.admissions++;
+        statistics.admittedBytes += size;
+        link(id);
+        return true;
+    }
+    // The holes left by the removed bitmaps must be compacted before trying again. If
+    // nothing can be removed, the bitmap is drawn from the bitmap database.
+    return !evict(size, protectedFrame);
+}
+
+bool BitmapCache::compact(uint32_t& movedBytes)
+{
+    if (Bitmap::uncachedCount == 0)
+    {
+        return true;
+    }
+
+    // Like Bitmap::compactCache(), but one bitmap at a time. The first bitmap behind the
+    // first hole is moved to the start of the hole, which moves the hole behind the bitmap
+    // in the allocation order, until the holes are at the end and can be freed.
+    BitmapId* const allocations = Bitmap::allocationTable;
+    uint8_t* const tables = reinterpret_cast<uint8_t*>(Bitmap::cacheTable);
+    uint16_t hole = 0;
+    uint8_t* holeStart = tables + getTableSize(Bitmap::numberOfBitmaps, Bitmap::numberOfDynamicBitmaps);
+    for (;;)
+    {
+        while (hole < Bitmap::nextAllocationIndex && Bitmap::cacheTable[allocations[hole]].data != 0)
+        {
+            holeStart = Bitmap::cacheTable[allocations[hole]].data + Bitmap::getSizeOfBitmap(allocations[hole]);
+            hole++;
+        }
+        uint16_t next = hole;
+        while (next < Bitmap::nextAllocationIndex && Bitmap::cacheTable[allocations[next]].data == 0)
+        {
+            next++;
+        }
+        if (next == Bitmap::nextAllocationIndex)
+        {
+            break;
+        }
+
+        const BitmapId id = allocations[next];
+        const uint32_t size = Bitmap::getSizeOfBitmap(id);
+        if (movedBytes > 0 && movedBytes + size > compactionBudget)
+        {
+            return false;
+        }
+        memmove(holeStart, Bitmap::cacheTable[id].data, size);
+        Bitmap::cacheTable[id].data = holeStart;
+        for (uint16_t i = next; i > hole; i--)
+        {
+            allocations[i] = allocations[i - 1];
+        }
+        allocations[hole] = id;
+        movedBytes += size;
+        statistics.compactedBytes += size;
+    }
+
+    // Free the holes at the end, Bitmap keeps the tables at the start of the region
+    Bitmap::nextAllocationIndex = hole;
+    Bitmap::nextFreeData = holeStart;
+    Bitmap::memoryRemaining = Bitmap::totalMemory - static_cast<uint32_t>(holeStart - tables);
+    Bitmap::uncachedCount = 0;
+    return true;
+}
+
+bool BitmapCache::evict(uint32_t bytes, uint16_t protectedFrame)
+{
+    uint32_t freed = 0;
+    while (freed < bytes && oldest != BITMAP_INVALID && entries[oldest].frame != protectedFrame)
+    {
+        const BitmapId id = oldest;
+        unlink(id);
+        if (Bitmap::cacheRemoveBitmap(id))
+        {
+            freed += getSizeOfBitmap(id);
+            statistics.evictions++;
+        }
+    }
+    if (freed > 0)
+    {
+        cacheFull = false;
+    }
+    return freed > 0;
+}
+
+void BitmapCache::link(BitmapId id)
+{
+    Entry& entry = entries[id];
+    entry.older = newest;
+    entry.newer = BITMAP_INVALID;
+    entry.linked = 1;
+    if (newest != BITMAP_INVALID)
+    {
+        entries[newest].newer = id;
+    }
+    else
+    {
+        oldest = id;
+    }
+    newest = id;
+}
+
+void BitmapCache::unlink(BitmapId id)
+{
+    Entry& entry = entries[id];
+    if (entry.older != BITMAP_INVALID)
+    {
+        entries[entry.older].newer = entry.newer;
+    }
+    else
+    {
+        oldest = entry.newer;
+    }
+    if (entry.newer != BITMAP_INVALID)
+    {
+        entries[entry.newer].older = entry.older;
+    }
+    else
+    {
+        newest = entry.older;
+    }
+    entry.older = BITMAP_INVALID;
+    entry.newer = BITMAP_INVALID;
+    entry.linked = 0;
+}
+
+uint32_t BitmapCache::getTableSize(uint32_t numberOfStaticBitmaps, uint32_t numberOfDynamicBitmaps)
+{
+    const uint32_t numberOfIds = numberOfStaticBitmaps + numberOfDynamicBitmaps;
+    return numberOfIds * sizeof(Bitmap::CacheTableEntry) + ((numberOfIds + 1) & ~1U) * sizeof(BitmapId) +
+           numberOfDynamicBitmaps * sizeof(Bitmap::DynamicBitmapData);
+}
+
+bool BitmapCache::isCacheable(BitmapId id)
+{
+    // Compressed bitmaps are drawn directly from the bitmap database
+    const Bitmap::BitmapFormat format = Bitmap(id).getFormat();
+    return format != Bitmap::BW_RLE && format != Bitmap::ENCODED;
+}
+
+uint32_t BitmapCache::getSizeOfBitmap(BitmapId id)
+{
+    // The space used in the cache, rounded to whole words like Bitmap does
+    const Bitmap bitmap(id);
+    const uint32_t width = bitmap.getWidth();
+    const uint32_t height = bitmap.getHeight();
+    const uint32_t pixels = width * height;
+    switch (bitmap.getFormat())
+    {
+    case Bitmap::RGB565:
+        return ((pixels * 2 + 3) & ~3U) + (bitmap.getAlphaData() != 0 ? ((pixels + 3) & ~3U) : 0);
+    case Bitmap::RGB888:
+        return ((pixels + 1) * 3) & ~3U;
+    case Bitmap::ARGB8888:
+        return pixels * 4;
+    case Bitmap::BW:
+        return (((width + 7) / 8) * height + 3) & ~3U;
+    case Bitmap::GRAY2:
+        return (((width + 3) / 4) * height + 3) & ~3U;
+    case Bitmap::GRAY4:
+        return (((width + 1) / 2) * height + 3) & ~3U;
+    case Bitmap::BW_RLE:
+    case Bitmap::ENCODED:
+        break;
+    }
+    return 0;
+}
+} // namespace touchgfx
@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/CachedFont.hpp>
+#include <touchgfx/GlyphCache.hpp>
+
+namespace touchgfx
+{
+CachedFont::CachedFont(const Font* font_)
+    : Font(font_->getFontHeight(), static_cast<uint8_t>(font_->getMinimumTextHeight() - font_->getFontHeight()), font_->getBitsPerPixel(),
+           font_->getMaxPixelsLeft(), font_->getMaxPixelsRight(), font_->getFallbackChar(), font_->getEllipsisChar()),
+      font(font_)
+{
+}
+
+const GlyphNode* CachedFont::getGlyph(Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel) const
+{
+    return GlyphCache::getGlyph(font, unicode, pixelData, bitsPerPixel);
+}
+} // namespace touchgfx
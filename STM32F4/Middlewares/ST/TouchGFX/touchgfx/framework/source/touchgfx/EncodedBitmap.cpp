@@ -0,0 +1,173 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/EncodedBitmap.hpp>
+#include <string.h>
+
+namespace touchgfx
+{
+uint32_t EncodedBitmap::getSize(const uint8_t* data, uint16_t width, uint16_t height)
+{
+    if (getEncoding(data) == L8)
+    {
+        return HEADER_SIZE + getPaletteSize(data) * 4 + static_cast<uint32_t>(width) * height;
+    }
+    // The offset after the last line is the size of the lines
+    return HEADER_SIZE + (height + 1) * 4 + readUint32(data + HEADER_SIZE + height * 4);
+}
+
+void EncodedBitmap::decode(const uint8_t* data, uint16_t width, uint16_t height, uint8_t* destination)
+{
+    switch (getEncoding(data))
+    {
+    case L8:
+        {
+            const uint8_t* pixels = getPixels(data);
+            uint32_t* argb = reinterpret_cast<uint32_t*>(destination);
+            for (uint32_t i = 0; i < static_cast<uint32_t>(width) * height; i++)
+            {
+                argb[i] = getPaletteColor(data, pixels[i]);
+            }
+            break;
+        }
+    case RGB565_RLE:
+        for (uint16_t y = 0; y < height; y++)
+        {
+            RLEDecoder decoder(getLine(data, height, y));
+            decoder.decode(reinterpret_cast<uint16_t*>(destination) + y * width, width);
+        }
+        break;
+    case ARGB8888_LZ4:
+        for (uint16_t y = 0; y < height; y++)
+        {
+            decodeLZ4(getLine(data, height, y), reinterpret_cast<uint32_t*>(destination) + y * width, width);
+        }
+        break;
+    }
+}
+
+void EncodedBitmap::decodeLZ4(const uint8_t* line, uint32_t* destination, uint16_t pixels)
+{
+    uint8_t* out = reinterpret_cast<uint8_t*>(destination);
+    uint8_t* const end = out + pixels * 4;
+    while (out < end)
+    {
+        // A sequence is a token, the literals and a match copied from the decoded bytes
+        const uint8_t token = *line++;
+        uint32_t literals = token >> 4;
+        if (literals == 15)
+        {
+            uint8_t length;
+            do
+            {
+                length = *line++;
+                literals += length;
+            }
+            while (length == 255);
+        }
+        const uint32_t literalsToCopy = MIN(literals, static_cast<uint32_t>(end - out));
+        memcpy(out, line, literalsToCopy);
+        out += literalsToCopy;
+        line += literals;
+        if (out >= end)
+        {
+            // The last sequence of a block has no match
+            break;
+        }
+
+        const uint32_t offset = line[0] | (line[1] << 8);
+        line += 2;
+        uint32_t matchLength = (token & 0x0F) + 4;
+        if ((token & 0x0F) == 15)
+        {
+            uint8_t length;
+            do
+            {
+                length = *line++;
+                matchLength += length;
+            }
+            while (length == 255);
+        }
+        matchLength = MIN(matchLength, static_cast<uint32_t>(end - out));
+        // A match overlapping the bytes being written repeats them, so copy the repeated
+        // bytes in chunks that double in size
+        const uint8_t* match = out - offset;
+        while (matchLength > 0)
+        {
+            const uint32_t chunk = MIN(matchLength, static_cast<uint32_t>(out - match));
+            memcpy(out, match, chunk);
+            out += chunk;
+            matchLength -= chunk;
+        }
+    }
+}
+
+void EncodedBitmap::RLEDecoder::skip(uint16_t pixels)
+{
+    while (pixels > 0)
+    {
+        if (remaining == 0)
+        {
+            nextRun();
+        }
+        const uint16_t count = MIN(remaining, pixels);
+        if (!repeat)
+        {
+            data += count * 2;
+        }
+        remaining -= count;
+        pixels -= count;
+    }
+}
+
+void EncodedBitmap::RLEDecoder::decode(uint16_t* destination, uint16_t pixels)
+{
+    while (pixels > 0)
+    {
+        if (remaining == 0)
+        {
+            nextRun();
+        }
+        const uint16_t count = MIN(remaining, pixels);
+        if (repeat)
+        {
+            for (uint16_t i = 0; i < count; i++)
+            {
+                destination[i] = color;
+            }
+        }
+        else
+        {
+            for (uint16_t i = 0; i < count; i++, data += 2)
+            {
+                destination[i] = static_cast<uint16_t>(data[0] | (data[1] << 8));
+            }
+        }
+        destination += count;
+        remaining -= count;
+        pixels -= count;
+    }
+}
+
+void EncodedBitmap::RLEDecoder::nextRun()
+{
+    const uint8_t run = *data++;
+    remaining = (run & 0x7F) + 1;
+    repeat = (run & 0x80) != 0;
+    if (repeat)
+    {
+        color = static_cast<uint16_t>(data[0] | (data[1] << 8));
+        data += 2;
+    }
+}
+} // namespace touchgfx
@@ -0,0 +1,470 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/FixedPointEasingEquations.hpp>
+
+namespace touchgfx
+{
+namespace
+{
+const int32_t ONE = 1 << 15; ///< 1.0 in the Q15 fixed point format used for progress and curves
+
+// sin(i * pi / 512) in Q15, a quarter of a sine wave
+const uint16_t sineTable[257] =
+{
+    0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210,
+    2411, 2611, 2811, 3012, 3212, 3412, 3612, 3812, 4011, 4211, 4410, 4609,
+    4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195, 6393, 6590, 6787, 6983,
+    7180, 7376, 7571, 7767, 7962, 8157, 8351, 8546, 8740, 8933, 9127, 9319,
+    9512, 9704, 9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605,
+    11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828,
+    14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269, 15447, 15624, 15800, 15976,
+    16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+    18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001,
+    20160, 20318, 20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+    22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312, 23453, 23593,
+    23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+    25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320, 26439, 26557, 26674,
+    26791, 26906, 27020, 27133, 27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002,
+    28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178,
+    29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+    30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050,
+    31114, 31177, 31238, 31298, 31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737,
+    31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251,
+    32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+    32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738, 32746, 32753,
+    32758, 32762, 32766, 32767, 32768
+};
+
+// 2^(i / 256) - 1 in Q15
+const uint16_t exp2Table[257] =
+{
+    0, 89, 178, 267, 357, 447, 537, 627, 718, 808, 899, 991,
+    1082, 1174, 1266, 1358, 1451, 1544, 1637, 1730, 1823, 1917, 2011, 2106,
+    2200, 2295, 2390, 2485, 2581, 2677, 2773, 2869, 2966, 3063, 3160, 3257,
+    3355, 3453, 3551, 3649, 3748, 3847, 3947, 4046, 4146, 4246, 4346, 4447,
+    4548, 4649, 4750, 4852, 4954, 5056, 5159, 5262, 5365, 5468, 5572, 5676,
+    5780, 5885, 5989, 6095, 6200, 6306, 6412, 6518, 6624, 6731, 6838, 6946,
+    7053, 7161, 7269, 7378, 7487, 7596, 7705, 7815, 7925, 8036, 8146, 8257,
+    8368, 8480, 8592, 8704, 8816, 8929, 9042, 9155, 9269, 9383, 9497, 9612,
+    9727, 9842, 9958, 10073, 10190, 10306, 10423, 10540, 10657, 10775, 10893, 11012,
+    11130, 11249, 11369, 11488, 11608, 11729, 11849, 11970, 12091, 12213, 12335, 12457,
+    12580, 12703, 12826, 12950, 13074, 13198, 13323, 13448, 13573, 13699, 13825, 13951,
+    14078, 14205, 14332, 14460, 14588, 14716, 14845, 14974, 15103, 15233, 15363, 15494,
+    15625, 15756, 15887, 16019, 16152, 16284, 16417, 16551, 16684, 16818, 16953, 17088,
+    17223, 17358, 17494, 17631, 17767, 17904, 18042, 18179, 18317, 18456, 18595, 18734,
+    18874, 19014, 19154, 19295, 19436, 19578, 19720, 19862, 20005, 20148, 20291, 20435,
+    20579, 20724, 20869, 21014, 21160, 21306, 21453, 21600, 21747, 21895, 22043, 22192,
+    22341, 22490, 22640, 22790, 22941, 23092, 23244, 23395, 23548, 23700, 23854, 24007,
+    24161, 24315, 24470, 24625, 24781, 24937, 25093, 25250, 25408, 25565, 25723, 25882,
+    26041, 26200, 26360, 26521, 26681, 26843, 27004, 27166, 27329, 27492, 27655, 27819,
+    27983, 28148, 28313, 28479, 28645, 28811, 28978, 29146, 29313, 29482, 29651, 29820,
+    29989, 30160, 30330, 30501, 30673, 30845, 31017, 31190, 31364, 31538, 31712, 31887,
+    32062, 32238, 32414, 32591, 32768
+};
+
+inline int32_t roundedShift(int32_t value, uint8_t shift)
+{
+    // Rounds half away from zero like EasingEquations
+    const int32_t half = (1 << shift) >> 1;
+    return value >= 0 ? (value + half) >> shift : -((half - value) >> shift);
+}
+
+inline int32_t multiply(int32_t a, int32_t b)
+{
+    return roundedShift(a * b, 15);
+}
+
+inline int32_t interpolate(const uint16_t* table, uint16_t index, uint16_t fraction, uint8_t fractionBits)
+{
+    if (fraction == 0)
+    {
+        return table[index];
+    }
+    return table[index] + roundedShift((table[index + 1] - table[index]) * fraction, fractionBits);
+}
+
+/**
+ * Gets the sine of an angle.
+ *
+ * @param phase The angle in 1/65536 of a turn.
+ *
+ * @return The sine in Q15.
+ */
+int32_t sinePhase(uint32_t phase)
+{
+    const uint8_t quadrant = (phase >> 14) & 3;
+    uint16_t position = phase & 0x3FFF;
+    if (quadrant & 1)
+    {
+        position = 0x4000 - position;
+    }
+    const int32_t value = interpolate(sineTable, position >> 6, position & 0x3F, 6);
+    return quadrant & 2 ? -value : value;
+}
+
+/**
+ * Gets 2^x for x <= 0.
+ *
+ * @param x The exponent in Q15.
+ *
+ * @return 2^x in Q15.
+ */
+int32_t power2(int32_t x)
+{
+    // 2^x = 2^fraction / 2^shift, where x = fraction - shift and 0 <= fraction < 1
+    const uint32_t shift = (static_cast<uint32_t>(-x) + ONE - 1) >> 15;
+    if (shift > 16)
+    {
+        return 0;
+    }
+    const uint16_t fraction = static_cast<uint16_t>(x + static_cast<int32_t>(shift << 15));
+    const int32_t value = ONE + interpolate(exp2Table, fraction >> 7, fraction & 0x7F, 7);
+    return shift == 0 ? value : roundedShift(value, static_cast<uint8_t>(shift));
+}
+
+uint32_t squareRoot(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    // Round to nearest
+    return value > root ? root + 1 : root;
+}
+
+// The ease in curves, mapping progress to position in Q15. The ease out and ease in/out
+// curves are derived from them.
+
+int32_t quad(int32_t p)
+{
+    return multiply(p, p);
+}
+
+int32_t cubic(int32_t p)
+{
+    return multiply(quad(p), p);
+}
+
+int32_t quart(int32_t p)
+{
+    const int32_t p2 = quad(p);
+    return multiply(p2, p2);
+}
+
+int32_t quint(int32_t p)
+{
+    return multiply(quart(p), p);
+}
+
+template <int32_t S>
+int32_t back(int32_t p)
+{
+    // (s+1)*p - s, written as 2*p + (s-1)*p - s to stay within 32 bits
+    return multiply(quad(p), 2 * p + multiply(S - ONE, p) - S);
+}
+
+const int32_t BACK_OVERSHOOT = 55757;       ///< 1.70158 in Q15
+const int32_t BACK_OVERSHOOT_IN_OUT = 85031; ///< 1.70158 * 1.525 in Q15
+
+int32_t bounceOut(int32_t p)
+{
+    int32_t offset;
+    int32_t base;
+    if (p * 11 < 4 * ONE)
+    {
+        offset = 0;
+        base = 0;
+    }
+    else if (p * 11 < 8 * ONE)
+    {
+        offset = 6 * ONE / 11;
+        base = 3 * ONE / 4;
+    }
+    else if (p * 11 < 10 * ONE)
+    {
+        offset = 9 * ONE / 11;
+        base = 15 * ONE / 16;
+    }
+    else
+    {
+        offset = 21 * ONE / 22;
+        base = 63 * ONE / 64;
+    }
+    // 7.5625 * (p - offset)^2 + base
+    return roundedShift(121 * quad(p - offset), 4) + base;
+}
+
+int32_t bounce(int32_t p)
+{
+    return ONE - bounceOut(ONE - p);
+}
+
+int32_t circ(int32_t p)
+{
+    return ONE - static_cast<int32_t>(squareRoot(static_cast<uint32_t>(ONE * ONE - p * p)));
+}
+
+int32_t sine(int32_t p)
+{
+    // 1 - cos(p * pi / 2), where the angle p * pi / 2 is p / 4 turn
+    return ONE - sinePhase(static_cast<uint32_t>(p / 2 + 0x4000));
+}
+
+int32_t expo(int32_t p)
+{
+    return p == 0 ? 0 : power2(10 * (p - ONE));
+}
+
+int32_t elastic(int32_t p)
+{
+    // sin(13 * pi / 2 * p) * 2^(10 * (p - 1)), where the angle is 13 / 4 * p turn
+    return multiply(sinePhase(static_cast<uint32_t>(13 * p / 2)), power2(10 * (p - ONE)));
+}
+
+int32_t linear(int32_t p)
+{
+    return p;
+}
+
+typedef int32_t (*Curve)(int32_t);
+
+inline int32_t progress(uint16_t t, uint16_t d)
+{
+    if (t >= d)
+    {
+        return ONE;
+    }
+    return static_cast<int32_t>(((static_cast<uint32_t>(t) << 15) + d / 2) / d);
+}
+
+inline int16_t scale(int32_t p, int32_t position, int16_t b, int16_t c)
+{
+    if (p == 0)
+    {
+        return b;
+    }
+    if (p == ONE)
+    {
+        return b + c;
+    }
+    // Saturate where rounding overshoots a value at the limit of the range
+    const int32_t value = b + roundedShift(c * position, 15);
+    return static_cast<int16_t>(MAX(-32768, MIN(value, 32767)));
+}
+
+inline int16_t easeIn(Curve curve, uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    const int32_t p = progress(t, d);
+    return scale(p, curve(p), b, c);
+}
+
+inline int16_t easeOut(Curve curve, uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    const int32_t p = progress(t, d);
+    return scale(p, ONE - curve(ONE - p), b, c);
+}
+
+inline int16_t easeInOut(Curve curve, uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    const int32_t p = progress(t, d);
+    const int32_t position = p < ONE / 2 ? roundedShift(curve(2 * p), 1) : ONE - roundedShift(curve(2 * (ONE - p)), 1);
+    return scale(p, position, b, c);
+}
+} // namespace
+
+int16_t FixedPointEasingEquations::backEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&back<BACK_OVERSHOOT>, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::backEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&back<BACK_OVERSHOOT>, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::backEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&back<BACK_OVERSHOOT_IN_OUT>, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::bounceEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&bounce, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::bounceEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&bounce, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::bounceEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&bounce, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::circEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&circ, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::circEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&circ, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::circEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&circ, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::cubicEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&cubic, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::cubicEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&cubic, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::cubicEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&cubic, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::elasticEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&elastic, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::elasticEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&elastic, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::elasticEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&elastic, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::expoEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&expo, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::expoEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&expo, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::expoEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&expo, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::linearEaseNone(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&linear, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::linearEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&linear, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::linearEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&linear, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::linearEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&linear, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quadEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&quad, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quadEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&quad, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quadEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&quad, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quartEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&quart, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quartEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&quart, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quartEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&quart, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quintEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&quint, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quintEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&quint, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::quintEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&quint, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::sineEaseIn(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeIn(&sine, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::sineEaseOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeOut(&sine, t, b, c, d);
+}
+
+int16_t FixedPointEasingEquations::sineEaseInOut(uint16_t t, int16_t b, int16_t c, uint16_t d)
+{
+    return easeInOut(&sine, t, b, c, d);
+}
+} // namespace touchgfx
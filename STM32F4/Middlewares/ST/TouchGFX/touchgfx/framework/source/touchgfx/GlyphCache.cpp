@@ -0,0 +1,179 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/GlyphCache.hpp>
+#include <touchgfx/FontManager.hpp>
+#include <touchgfx/hal/RenderWorkers.hpp>
+#include <string.h>
+
+namespace touchgfx
+{
+GlyphCache::Slot* GlyphCache::slots = 0;
+uint16_t GlyphCache::slotMask = 0;
+uint16_t GlyphCache::numberOfGlyphs = 0;
+uint16_t GlyphCache::maxNumberOfGlyphs = 0;
+uint8_t* GlyphCache::pixelMemory = 0;
+uint32_t GlyphCache::pixelMemorySize = 0;
+uint32_t GlyphCache::pixelMemoryUsed = 0;
+GlyphCacheStatistics GlyphCache::statistics = { 0, 0, 0, 0, 0 };
+
+void GlyphCache::setCache(uint8_t* memory, uint32_t size, uint16_t numberOfSlots)
+{
+    slots = 0;
+    slotMask = 0;
+    maxNumberOfGlyphs = 0;
+    pixelMemory = 0;
+    pixelMemorySize = 0;
+    if (memory == 0 || size == 0 || numberOfSlots == 0)
+    {
+        return;
+    }
+
+    assert((numberOfSlots & (numberOfSlots - 1)) == 0 && "The number of glyph cache slots must be a power of two");
+    assert(reinterpret_cast<uintptr_t>(memory) % sizeof(void*) == 0 && "Glyph cache memory must be pointer aligned");
+    const uint32_t tableSize = getTableSize(numberOfSlots);
+    assert(size > tableSize && "Glyph cache too small for the hash table");
+    slots = reinterpret_cast<Slot*>(memory);
+    slotMask = numberOfSlots - 1;
+    // A free slot always ends the search for a glyph which is not cached
+    maxNumberOfGlyphs = numberOfSlots - (numberOfSlots + 3) / 4;
+    pixelMemory = memory + tableSize;
+    pixelMemorySize = size - tableSize;
+    clear();
+}
+
+void GlyphCache::clear()
+{
+    for (uint16_t i = 0; slots != 0 && i <= slotMask; i++)
+    {
+        slots[i].font = 0;
+    }
+    numberOfGlyphs = 0;
+    pixelMemoryUsed = 0;
+}
+
+const GlyphNode* GlyphCache::getGlyph(const Font* font, Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel)
+{
+    if (slots == 0)
+    {
+        return font->getGlyph(unicode, pixelData, bitsPerPixel);
+    }
+
+    // Glyphs are never evicted while drawing, so the slot stays valid after unlocking
+    RenderWorkers::lockShared();
+    const GlyphNode* glyph = lookUpGlyph(font, unicode, pixelData, bitsPerPixel);
+    RenderWorkers::unlockShared();
+    return glyph;
+}
+
+const GlyphNode* GlyphCache::lookUpGlyph(const Font* font, Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel)
+{
+    uint16_t index = getIndex(font, unicode);
+    while (slots[index].font != 0)
+    {
+        const Slot& slot = slots[index];
+        if (slot.font == font && slot.unicode == unicode)
+        {
+            statistics.hits++;
+            pixelData = slot.pixelData;
+            bitsPerPixel = slot.bitsPerPixel;
+            return &slot.glyph;
+        }
+        index = (index + 1) & slotMask;
+    }
+
+    statistics.misses++;
+    const GlyphNode* glyph = font->getGlyph(unicode, pixelData, bitsPerPixel);
+    if (glyph == 0)
+    {
+        return 0;
+    }
+    const uint32_t size = getSizeOfGlyph(glyph, bitsPerPixel);
+    if (numberOfGlyphs >= maxNumberOfGlyphs || size > pixelMemorySize - pixelMemoryUsed)
+    {
+        statistics.rejections++;
+        return glyph;
+    }
+
+    // The free slot ending the search is where the glyph belongs
+    Slot& slot = slots[index];
+    uint8_t* cachedPixelData = pixelMemory + pixelMemoryUsed;
+    if (size > 0)
+    {
+        memcpy(cachedPixelData, pixelData, size);
+    }
+    slot.font = font;
+    slot.unicode = unicode;
+    slot.pixelData = cachedPixelData;
+    slot.glyph = *glyph;
+    slot.bitsPerPixel = bitsPerPixel;
+    pixelMemoryUsed += size;
+    numberOfGlyphs++;
+    statistics.admissions++;
+    statistics.admittedBytes += size;
+
+    pixelData = slot.pixelData;
+    return &slot.glyph;
+}
+
+void GlyphCache::cacheGlyphs(FontId fontId, const Unicode::UnicodeChar* text)
+{
+    // Looking up the glyphs in a CachedFont caches them
+    const Font* font = FontManager::getFont(fontId);
+    if (font == 0 || text == 0)
+    {
+        return;
+    }
+    for (; *text != 0; text++)
+    {
+        const uint8_t* pixelData = 0;
+        uint8_t bitsPerPixel = 0;
+        font->getGlyph(*text, pixelData, bitsPerPixel);
+    }
+}
+
+void GlyphCache::cacheDigits(FontId fontId)
+{
+    static const Unicode::UnicodeChar digits[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '-', '.', ',', ':', 0 };
+    cacheGlyphs(fontId, digits);
+}
+
+void GlyphCache::resetStatistics()
+{
+    statistics.hits = 0;
+    statistics.misses = 0;
+    statistics.admissions = 0;
+    statistics.rejections = 0;
+    statistics.admittedBytes = 0;
+}
+
+uint16_t GlyphCache::getIndex(const Font* font, Unicode::UnicodeChar unicode)
+{
+    // Fonts are at least word aligned, so the lowest bits of the address carry no information
+    uint32_t key = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(font) >> 2) ^ (unicode * 2654435761U);
+    key ^= key >> 16;
+    return static_cast<uint16_t>(key & slotMask);
+}
+
+uint32_t GlyphCache::getSizeOfGlyph(const GlyphNode* glyph, uint8_t bitsPerPixel)
+{
+    // 4 bpp glyphs in the A4 format start every row on a new byte, other glyphs are packed
+    const uint32_t width = glyph->width();
+    const uint32_t height = glyph->height();
+    if (bitsPerPixel == 4 && (glyph->flags & GLYPH_DATA_FORMAT_A4) != 0)
+    {
+        return ((width + 1) / 2) * height;
+    }
+    return (width * height * bitsPerPixel + 7) / 8;
+}
+} // namespace touchgfx
@@ -0,0 +1,275 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/Region.hpp>
+
+namespace touchgfx
+{
+Region::Region(Rect* storage, uint16_t capacity_)
+    : rects(storage),
+      capacity(capacity_),
+      numberOfRects(0),
+      mergeThreshold(512),
+      invalidatedArea(0)
+{
+    assert(storage != 0 && capacity_ > 0 && "A region must have room for at least one rectangle");
+}
+
+void Region::setCapacity(uint16_t newCapacity)
+{
+    assert(newCapacity > 0 && "A region must have room for at least one rectangle");
+    capacity = newCapacity;
+    while (numberOfRects > capacity)
+    {
+        merge(rects[--numberOfRects]);
+    }
+}
+
+void Region::add(const Rect& rect)
+{
+    if (rect.isEmpty())
+    {
+        return;
+    }
+
+    // The rectangles are disjoint, so the area not already covered is exact
+    uint32_t uncovered = rect.area();
+    for (uint16_t i = 0; i < numberOfRects; i++)
+    {
+        uncovered -= (rects[i] & rect).area();
+    }
+    if (uncovered == 0)
+    {
+        return;
+    }
+    invalidatedArea += uncovered;
+
+    merge(rect);
+}
+
+void Region::add(const Region& other)
+{
+    for (uint16_t i = 0; i < other.numberOfRects; i++)
+    {
+        add(other.rects[i]);
+    }
+}
+
+void Region::assign(const Region& other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+    if (other.numberOfRects <= capacity)
+    {
+        for (uint16_t i = 0; i < other.numberOfRects; i++)
+        {
+            rects[i] = other.rects[i];
+        }
+        numberOfRects = other.numberOfRects;
+        invalidatedArea = other.invalidatedArea;
+    }
+    else
+    {
+        clear();
+        add(other);
+    }
+}
+
+bool Region::subtract(const Rect& rect)
+{
+    if (rect.isEmpty())
+    {
+        return true;
+    }
+
+    // Count the rectangles needed before changing anything. The rectangles are split in
+    // order, so the most rectangles are needed before later ones are removed completely.
+    uint16_t count = numberOfRects;
+    uint16_t needed = numberOfRects;
+    for (uint16_t i = 0; i < numberOfRects; i++)
+    {
+        const Rect& r = rects[i];
+        if (r.intersect(rect))
+        {
+            count += (r.y < rect.y ? 1 : 0) + (r.bottom() > rect.bottom() ? 1 : 0) +
+                     (r.x < rect.x ? 1 : 0) + (r.right() > rect.right() ? 1 : 0) - 1;
+            needed = MAX(needed, count);
+        }
+    }
+    if (needed > capacity)
+    {
+        return false;
+    }
+
+    uint16_t remaining = numberOfRects;
+    uint16_t i = 0;
+    while (i < remaining)
+    {
+        const Rect r = rects[i];
+        if (!r.intersect(rect))
+        {
+            i++;
+            continue;
+        }
+        removeAt(i);
+        remaining--;
+
+        const int16_t top = MAX(r.y, rect.y);
+        const int16_t bottom = MIN(r.bottom(), rect.bottom());
+        if (r.y < rect.y)
+        {
+            rects[numberOfRects++] = Rect(r.x, r.y, r.width, rect.y - r.y);
+        }
+        if (r.bottom() > rect.bottom())
+        {
+            rects[numberOfRects++] = Rect(r.x, rect.bottom(), r.width, r.bottom() - rect.bottom());
+        }
+        if (r.x < rect.x)
+        {
+            rects[numberOfRects++] = Rect(r.x, top, rect.x - r.x, bottom - top);
+        }
+        if (r.right() > rect.right())
+        {
+            rects[numberOfRects++] = Rect(rect.right(), top, r.right() - rect.right(), bottom - top);
+        }
+    }
+    return true;
+}
+
+uint32_t Region::getArea() const
+{
+    uint32_t area = 0;
+    for (uint16_t i = 0; i < numberOfRects; i++)
+    {
+        area += rects[i].area();
+    }
+    return area;
+}
+
+Rect Region::getBoundingRect() const
+{
+    Rect boundingRect;
+    for (uint16_t i = 0; i < numberOfRects; i++)
+    {
+        boundingRect.expandToFit(rects[i]);
+    }
+    return boundingRect;
+}
+
+uint32_t Region::getWaste(const Rect& a, const Rect& b) const
+{
+    Rect boundingRect(a);
+    boundingRect.expandToFit(b);
+    return boundingRect.area() - (a.area() + b.area() - (a & b).area());
+}
+
+bool Region::shouldMerge(const Rect& a, const Rect& b) const
+{
+    const uint32_t waste = getWaste(a, b);
+    return waste <= mergeThreshold || waste * 10 <= a.area() + b.area() - (a & b).area();
+}
+
+void Region::merge(Rect rect)
+{
+    for (;;)
+    {
+        // Absorb rectangles that are covered by, or cheap to merge with, the new rectangle
+        uint16_t i = 0;
+        while (i < numberOfRects)
+        {
+            const Rect& r = rects[i];
+            if (r.includes(rect))
+            {
+                return;
+            }
+            if (rect.includes(r))
+            {
+                removeAt(i);
+            }
+            else if (shouldMerge(r, rect))
+            {
+                // The grown rectangle may now touch rectangles already passed, start over
+                rect.expandToFit(r);
+                removeAt(i);
+                i = 0;
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (insert(rect, 0))
+        {
+            return;
+        }
+
+        // Not enough room for the rectangle, or the pieces it was split into. Grow it to
+        // include the rectangle that wastes the least area, which will then be absorbed. Any
+        // pieces inserted before running out of room are inside the rectangle, and are
+        // absorbed as well.
+        uint16_t best = numberOfRects;
+        uint32_t bestWaste = 0xFFFFFFFF;
+        for (i = 0; i < numberOfRects; i++)
+        {
+            if (!rect.includes(rects[i]))
+            {
+                const uint32_t waste = getWaste(rects[i], rect);
+                if (waste < bestWaste)
+                {
+                    best = i;
+                    bestWaste = waste;
+                }
+            }
+        }
+        assert(best < numberOfRects);
+        rect.expandToFit(rects[best]);
+    }
+}
+
+bool Region::insert(const Rect& rect, uint16_t first)
+{
+    for (uint16_t i = first; i < numberOfRects; i++)
+    {
+        const Rect r = rects[i];
+        if (r.intersect(rect))
+        {
+            // Insert the parts of the rectangle not covered by r. They cannot overlap any of
+            // the rectangles before r, so only the rectangles after r need to be checked.
+            const int16_t top = MAX(rect.y, r.y);
+            const int16_t bottom = MIN(rect.bottom(), r.bottom());
+            return (rect.y >= r.y || insert(Rect(rect.x, rect.y, rect.width, r.y - rect.y), i + 1)) &&
+                   (rect.bottom() <= r.bottom() || insert(Rect(rect.x, r.bottom(), rect.width, rect.bottom() - r.bottom()), i + 1)) &&
+                   (rect.x >= r.x || insert(Rect(rect.x, top, r.x - rect.x, bottom - top), i + 1)) &&
+                   (rect.right() <= r.right() || insert(Rect(r.right(), top, rect.right() - r.right(), bottom - top), i + 1));
+        }
+    }
+    if (numberOfRects == capacity)
+    {
+        return false;
+    }
+    rects[numberOfRects++] = rect;
+    return true;
+}
+
+void Region::removeAt(uint16_t index)
+{
+    numberOfRects--;
+    for (uint16_t i = index; i < numberOfRects; i++)
+    {
+        rects[i] = rects[i + 1];
+    }
+}
+} // namespace touchgfx
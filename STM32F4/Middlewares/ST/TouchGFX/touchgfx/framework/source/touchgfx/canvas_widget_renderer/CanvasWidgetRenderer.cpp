@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/canvas_widget_renderer/CanvasWidgetRenderer.hpp>
+#include <touchgfx/Utils.hpp>
+
+namespace touchgfx
+{
+CanvasWidgetRenderer::Context CanvasWidgetRenderer::contexts[RenderWorkers::MAX_WORKERS];
+#ifdef SIMULATOR
+bool CanvasWidgetRenderer::writeReport = false;
+#endif
+
+void CanvasWidgetRenderer::setupBuffer(uint8_t* buffer, unsigned bufsize)
+{
+    setupBuffer(buffer, bufsize, 0);
+}
+
+void CanvasWidgetRenderer::setupBuffer(uint8_t* buffer, unsigned bufsize, uint8_t worker)
+{
+    assert(worker < RenderWorkers::MAX_WORKERS && "Invalid render worker");
+    Context& context = contexts[worker];
+    context.memoryBuffer = buffer;
+    context.memoryBufferSize = bufsize;
+    context.scanlineWidth = 0;
+    context.scanlineCovers = 0;
+#ifdef SIMULATOR
+    context.scanlineSize = 0;
+    context.maxCellsUsed = 0;
+    context.maxCellsMissing = 0;
+#endif
+}
+
+namespace
+{
+// Takes an array from the buffer, keeping the next array word aligned
+bool allocate(uint8_t*& buf, unsigned int& bufsize, unsigned int size, void*& array)
+{
+    array = buf;
+    if (bufsize < size)
+    {
+        assert(0 && "Not enough memory allocated for CWR");
+        return false;
+    }
+    const unsigned int misalignment = size & 3;
+    if (misalignment)
+    {
+        size += 4 - misalignment;
+    }
+    buf += size;
+    bufsize = size < bufsize ? bufsize - size : 0;
+    return true;
+}
+} // namespace
+
+bool CanvasWidgetRenderer::setScanlineWidth(unsigned width)
+{
+    Context& context = getContext();
+    if (width == context.scanlineWidth && context.scanlineCovers == context.memoryBuffer)
+    {
+        // Buffers already set up for this width
+        return context.outlineBufferSize >= 2 * sizeof(Cell);
+    }
+
+    uint8_t* buf = context.memoryBuffer;
+    unsigned int bufsize = context.memoryBufferSize;
+    context.scanlineWidth = width;
+    context.outlineBuffer = 0;
+    context.outlineBufferSize = 0;
+
+    const unsigned int coversSize = width * sizeof(uint8_t);
+    const unsigned int indicesSize = (width + 1) / 2 * sizeof(int16_t);
+    if (!allocate(buf, bufsize, coversSize, context.scanlineCovers)
+            || !allocate(buf, bufsize, indicesSize, context.scanlineStartIndices)
+            || !allocate(buf, bufsize, indicesSize, context.scanlineCounts))
+    {
+        return false;
+    }
+#ifdef SIMULATOR
+    context.scanlineSize = coversSize + 2 * indicesSize;
+#endif
+
+    context.outlineBuffer = reinterpret_cast<Cell*>(buf);
+    context.outlineBufferSize = bufsize;
+    assert(bufsize >= 2 * sizeof(Cell) && "Not enough memory allocated for CWR");
+    return context.outlineBufferSize >= 2 * sizeof(Cell);
+}
+
+bool CanvasWidgetRenderer::hasBuffer()
+{
+    const Context& context = getContext();
+    return context.memoryBuffer != 0 && context.memoryBufferSize != 0;
+}
+
+unsigned CanvasWidgetRenderer::getScanlineWidth()
+{
+    return getContext().scanlineWidth;
+}
+
+void* CanvasWidgetRenderer::getScanlineCovers()
+{
+    return getContext().scanlineCovers;
+}
+
+void* CanvasWidgetRenderer::getScanlineStartIndices()
+{
+    return getContext().scanlineStartIndices;
+}
+
+void* CanvasWidgetRenderer::getScanlineCounts()
+{
+    return getContext().scanlineCounts;
+}
+
+Cell* CanvasWidgetRenderer::getOutlineBuffer()
+{
+    return getContext().outlineBuffer;
+}
+
+unsigned int CanvasWidgetRenderer::getOutlineBufferSize()
+{
+    return getContext().outlineBufferSize;
+}
+
+#ifdef SIMULATOR
+void CanvasWidgetRenderer::setWriteMemoryUsageReport(bool writeUsageReport)
+{
+    writeReport = writeUsageReport;
+}
+
+bool CanvasWidgetRenderer::getWriteMemoryUsageReport()
+{
+    return writeReport;
+}
+
+void CanvasWidgetRenderer::numCellsUsed(unsigned used)
+{
+    Context& context = getContext();
+    if (used > context.maxCellsUsed)
+    {
+        context.maxCellsUsed = used;
+        if (writeReport)
+        {
+            touchgfx_printf("CWR requires %u bytes\n", getUsedBufferSize());
+        }
+    }
+}
+
+void CanvasWidgetRenderer::numCellsMissing(unsigned missing)
+{
+    Context& context = getContext();
+    if (missing > context.maxCellsMissing)
+    {
+        context.maxCellsMissing = missing;
+        if (writeReport)
+        {
+            touchgfx_printf("CWR requires %u bytes (%u bytes missing)\n", getUsedBufferSize() + getMissingBufferSize(), getMissingBufferSize());
+        }
+    }
+}
+
+unsigned CanvasWidgetRenderer::getUsedBufferSize()
+{
+    const Context& context = getContext();
+    return ((context.scanlineSize + 3) & ~3U) + (context.maxCellsUsed + 1) * sizeof(Cell);
+}
+
+unsigned CanvasWidgetRenderer::getMissingBufferSize()
+{
+    return getContext().maxCellsMissing * sizeof(Cell);
+}
+#endif
+} // namespace touchgfx
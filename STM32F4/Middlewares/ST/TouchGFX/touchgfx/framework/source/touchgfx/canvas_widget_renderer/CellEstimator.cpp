@@ -0,0 +1,162 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/canvas_widget_renderer/CellEstimator.hpp>
+#include <touchgfx/canvas_widget_renderer/Rasterizer.hpp>
+
+namespace touchgfx
+{
+CellEstimator::CellEstimator(unsigned* cellsPerLine_, int numLines_)
+    : cellsPerLine(cellsPerLine_),
+      numLines(numLines_),
+      curX(0),
+      curY(0),
+      closeX(0),
+      closeY(0),
+      lastCellX(0x7FFF),
+      lastCellY(0x7FFF),
+      notClosed(false)
+{
+    for (int i = 0; i < numLines; i++)
+    {
+        cellsPerLine[i] = 0;
+    }
+}
+
+void CellEstimator::moveTo(int x, int y)
+{
+    close();
+    // The pen stays in the last cell, or starts a new cell which has not been counted yet
+    if ((x >> Rasterizer::POLY_BASE_SHIFT) != lastCellX || (y >> Rasterizer::POLY_BASE_SHIFT) != lastCellY)
+    {
+        lastCellX = 0x7FFF;
+        lastCellY = 0x7FFF;
+    }
+    closeX = curX = x;
+    closeY = curY = y;
+}
+
+void CellEstimator::lineTo(int x, int y)
+{
+    if ((curX ^ x) | (curY ^ y))
+    {
+        countLine(curX, curY, x, y);
+        curX = x;
+        curY = y;
+        notClosed = true;
+    }
+}
+
+void CellEstimator::close()
+{
+    if (notClosed)
+    {
+        lineTo(closeX, closeY);
+        notClosed = false;
+    }
+}
+
+void CellEstimator::countLine(int x1, int y1, int x2, int y2)
+{
+    int ey1 = y1 >> Rasterizer::POLY_BASE_SHIFT;
+    const int ey2 = y2 >> Rasterizer::POLY_BASE_SHIFT;
+
+    // Lines above or below the scanlines are not counted, like Outline::renderLine()
+    if ((ey1 < 0 && ey2 < 0) || (ey1 >= numLines && ey2 >= numLines))
+    {
+        lastCellX = x2 >> Rasterizer::POLY_BASE_SHIFT;
+        lastCellY = ey2;
+        return;
+    }
+
+    if (ey1 == ey2)
+    {
+        countCells(ey1, x1, x2);
+        return;
+    }
+
+    // Find the x coordinate where the line crosses each scanline exactly like
+    // Outline::renderLine(), so the same cells are visited
+    const int fy1 = y1 & Rasterizer::POLY_BASE_MASK;
+    const int dx = x2 - x1;
+    int dy = y2 - y1;
+    int p = (Rasterizer::POLY_BASE_SIZE - fy1) * dx;
+    int incr = 1;
+    if (dy < 0)
+    {
+        p = fy1 * dx;
+        incr = -1;
+        dy = -dy;
+    }
+
+    int delta = p / dy;
+    int mod = p % dy;
+    if (mod < 0)
+    {
+        delta--;
+        mod += dy;
+    }
+
+    int xFrom = x1 + delta;
+    countCells(ey1, x1, xFrom);
+    ey1 += incr;
+
+    if (ey1 != ey2)
+    {
+        p = Rasterizer::POLY_BASE_SIZE * dx;
+        int lift = p / dy;
+        int rem = p % dy;
+        if (rem < 0)
+        {
+            lift--;
+            rem += dy;
+        }
+        mod -= dy;
+
+        while (ey1 != ey2)
+        {
+            delta = lift;
+            mod += rem;
+            if (mod >= 0)
+            {
+                mod -= dy;
+                delta++;
+            }
+            countCells(ey1, xFrom, xFrom + delta);
+            xFrom += delta;
+            ey1 += incr;
+        }
+    }
+    countCells(ey1, xFrom, x2);
+}
+
+void CellEstimator::countCells(int ey, int x1, int x2)
+{
+    const int ex1 = x1 >> Rasterizer::POLY_BASE_SHIFT;
+    const int ex2 = x2 >> Rasterizer::POLY_BASE_SHIFT;
+    unsigned numCells = ex1 < ex2 ? ex2 - ex1 + 1 : ex1 - ex2 + 1;
+
+    // A line continues in the cell where the previous line ended
+    if (ex1 == lastCellX && ey == lastCellY)
+    {
+        numCells--;
+    }
+    lastCellX = ex2;
+    lastCellY = ey;
+
+    if (ey >= 0 && ey < numLines)
+    {
+        cellsPerLine[ey] += numCells;
+    }
+}
+} // namespace touchgfx
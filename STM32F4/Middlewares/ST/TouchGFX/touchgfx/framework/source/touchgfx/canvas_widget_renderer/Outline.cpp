@@ -0,0 +1,661 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/canvas_widget_renderer/Outline.hpp>
+#include <touchgfx/canvas_widget_renderer/CanvasWidgetRenderer.hpp>
+
+namespace touchgfx
+{
+enum
+{
+    POLY_BASE_SHIFT = 5,
+    POLY_BASE_SIZE = 1 << POLY_BASE_SHIFT,
+    POLY_BASE_MASK = POLY_BASE_SIZE - 1
+};
+
+Outline::Outline()
+    : maxCells(0),
+      numCells(0),
+      cells(0),
+      curCellPtr(0),
+      curCell(),
+      curX(0),
+      curY(0),
+      closeX(0),
+      closeY(0),
+      minX(0x7FFFFFFF),
+      minY(0x7FFFFFFF),
+      maxX(-0x7FFFFFFF - 1),
+      maxY(-0x7FFFFFFF - 1),
+      flags(0),
+      maxRenderY(0x7FFFFFFF),
+      outlineTooComplex(false)
+#ifdef SIMULATOR
+      , numCellsMissing(0),
+      numCellsUsed(0)
+#endif
+{
+    reset();
+}
+
+Outline::~Outline()
+{
+    cells = 0;
+    curCellPtr = 0;
+#ifdef SIMULATOR
+    CanvasWidgetRenderer::numCellsUsed(numCellsUsed);
+    CanvasWidgetRenderer::numCellsMissing(numCellsMissing);
+#endif
+}
+
+void Outline::reset()
+{
+    cells = CanvasWidgetRenderer::getOutlineBuffer();
+    maxCells = CanvasWidgetRenderer::getOutlineBufferSize() / sizeof(Cell);
+    numCells = 0;
+    curCellPtr = cells;
+    curCell.set(0x7FFF, 0x7FFF, 0, 0);
+    flags |= OUTLINE_SORT_REQUIRED;
+    flags &= ~OUTLINE_NOT_CLOSED;
+    minX = 0x7FFFFFFF;
+    minY = 0x7FFFFFFF;
+    maxX = -0x7FFFFFFF - 1;
+    maxY = -0x7FFFFFFF - 1;
+    outlineTooComplex = false;
+}
+
+void Outline::setCurCell(int x, int y)
+{
+    if (curCell.packedCoord() != (y << 16) + x)
+    {
+        addCurCell();
+        curCell.set(x, y, 0, 0);
+    }
+}
+
+void Outline::addCurCell()
+{
+    if (curCell.area | curCell.cover)
+    {
+        if (curCell.y < 0 || curCell.y >= maxRenderY)
+        {
+            return;
+        }
+        if (numCells >= maxCells)
+        {
+            outlineTooComplex = true;
+#ifdef SIMULATOR
+            numCellsMissing++;
+#endif
+            return;
+        }
+        *curCellPtr++ = curCell;
+        numCells++;
+#ifdef SIMULATOR
+        if (numCells > numCellsUsed)
+        {
+            numCellsUsed = numCells;
+        }
+#endif
+    }
+}
+
+void Outline::moveTo(int x, int y)
+{
+    if ((flags & OUTLINE_SORT_REQUIRED) == 0)
+    {
+        reset();
+    }
+    if (flags & OUTLINE_NOT_CLOSED)
+    {
+        lineTo(closeX, closeY);
+    }
+    setCurCell(x >> POLY_BASE_SHIFT, y >> POLY_BASE_SHIFT);
+    closeX = curX = x;
+    closeY = curY = y;
+}
+
+void Outline::lineTo(int x, int y)
+{
+    if ((flags & OUTLINE_SORT_REQUIRED) && ((curX ^ x) | (curY ^ y)))
+    {
+        int c;
+
+        c = curX >> POLY_BASE_SHIFT;
+        if (c < minX)
+        {
+            minX = c;
+        }
+        ++c;
+        if (c > maxX)
+        {
+            maxX = c;
+        }
+
+        c = x >> POLY_BASE_SHIFT;
+        if (c < minX)
+        {
+            minX = c;
+        }
+        ++c;
+        if (c > maxX)
+        {
+            maxX = c;
+        }
+
+        renderLine(curX, curY, x, y);
+        curX = x;
+        curY = y;
+        flags |= OUTLINE_NOT_CLOSED;
+    }
+}
+
+void Outline::renderScanline(int ey, int x1, int y1, int x2, int y2)
+{
+    int ex1 = x1 >> POLY_BASE_SHIFT;
+    int ex2 = x2 >> POLY_BASE_SHIFT;
+    int fx1 = x1 & POLY_BASE_MASK;
+    int fx2 = x2 & POLY_BASE_MASK;
+
+    int delta, p, first, dx;
+    int incr, lift, mod, rem;
+
+    // Trivial case. Happens often
+    if (y1 == y2)
+    {
+        setCurCell(ex2, ey);
+        return;
+    }
+
+    // Everything is located in a single cell. That is easy!
+    if (ex1 == ex2)
+    {
+        delta = y2 - y1;
+        curCell.addCover(delta, (fx1 + fx2) * delta);
+        return;
+    }
+
+    // Ok, we'll have to render a run of adjacent cells on the same scanline...
+    p = (POLY_BASE_SIZE - fx1) * (y2 - y1);
+    first = POLY_BASE_SIZE;
+    incr = 1;
+
+    dx = x2 - x1;
+
+    if (dx < 0)
+    {
+        p = fx1 * (y2 - y1);
+        first = 0;
+        incr = -1;
+        dx = -dx;
+    }
+
+    delta = p / dx;
+    mod = p % dx;
+
+    if (mod < 0)
+    {
+        delta--;
+        mod += dx;
+    }
+
+    curCell.addCover(delta, (fx1 + first) * delta);
+
+    ex1 += incr;
+    setCurCell(ex1, ey);
+    y1 += delta;
+
+    if (ex1 != ex2)
+    {
+        p = POLY_BASE_SIZE * (y2 - y1 + delta);
+        lift = p / dx;
+        rem = p % dx;
+
+        if (rem < 0)
+        {
+            lift--;
+            rem += dx;
+        }
+
+        mod -= dx;
+
+        while (ex1 != ex2)
+        {
+            delta = lift;
+            mod += rem;
+            if (mod >= 0)
+            {
+                mod -= dx;
+                delta++;
+            }
+
+            curCell.addCover(delta, POLY_BASE_SIZE * delta);
+            y1 += delta;
+            ex1 += incr;
+            setCurCell(ex1, ey);
+        }
+    }
+    delta = y2 - y1;
+    curCell.addCover(delta, (fx2 + POLY_BASE_SIZE - first) * delta);
+}
+
+void Outline::renderLine(int x1, int y1, int x2, int y2)
+{
+    int ey1 = y1 >> POLY_BASE_SHIFT;
+    int ey2 = y2 >> POLY_BASE_SHIFT;
+    int fy1 = y1 & POLY_BASE_MASK;
+    int fy2 = y2 & POLY_BASE_MASK;
+
+    int dx, dy, x_from, x_to;
+    int p, rem, mod, lift, delta, first, incr;
+
+    if (ey1 < minY)
+    {
+        minY = ey1;
+    }
+    if (ey1 + 1 > maxY)
+    {
+        maxY = ey1 + 1;
+    }
+    if (ey2 < minY)
+    {
+        minY = ey2;
+    }
+    if (ey2 + 1 > maxY)
+    {
+        maxY = ey2 + 1;
+    }
+
+    // Cells above or below the rendered scanlines are discarded anyway
+    if ((ey1 < 0 && ey2 < 0) || (ey1 >= maxRenderY && ey2 >= maxRenderY))
+    {
+        setCurCell(x2 >> POLY_BASE_SHIFT, ey2);
+        return;
+    }
+
+    dx = x2 - x1;
+    dy = y2 - y1;
+
+    // Everything is on a single scanline
+    if (ey1 == ey2)
+    {
+        renderScanline(ey1, x1, fy1, x2, fy2);
+        return;
+    }
+
+    // Vertical line - we have to calculate start and end cells, and then - the common values of
+    // the area and coverage for all cells of the line. We know exactly there's only one cell, so,
+    // we don't have to call renderScanline().
+    incr = 1;
+    if (dx == 0)
+    {
+        int ex = x1 >> POLY_BASE_SHIFT;
+        int two_fx = (x1 - (ex << POLY_BASE_SHIFT)) << 1;
+        int area;
+
+        first = POLY_BASE_SIZE;
+        if (dy < 0)
+        {
+            first = 0;
+            incr = -1;
+        }
+
+        delta = first - fy1;
+        curCell.addCover(delta, two_fx * delta);
+
+        ey1 += incr;
+        setCurCell(ex, ey1);
+
+        delta = first + first - POLY_BASE_SIZE;
+        area = two_fx * delta;
+        while (ey1 != ey2)
+        {
+            curCell.setCover(delta, area);
+            ey1 += incr;
+            setCurCell(ex, ey1);
+        }
+        delta = fy2 - POLY_BASE_SIZE + first;
+        curCell.addCover(delta, two_fx * delta);
+        return;
+    }
+
+    // Ok, we have to render several scanlines
+    p = (POLY_BASE_SIZE - fy1) * dx;
+    first = POLY_BASE_SIZE;
+
+    if (dy < 0)
+    {
+        p = fy1 * dx;
+        first = 0;
+        incr = -1;
+        dy = -dy;
+    }
+
+    delta = p / dy;
+    mod = p % dy;
+
+    if (mod < 0)
+    {
+        delta--;
+        mod += dy;
+    }
+
+    x_from = x1 + delta;
+    renderScanline(ey1, x1, fy1, x_from, first);
+
+    ey1 += incr;
+    setCurCell(x_from >> POLY_BASE_SHIFT, ey1);
+
+    if (ey1 != ey2)
+    {
+        p = POLY_BASE_SIZE * dx;
+        lift = p / dy;
+        rem = p % dy;
+
+        if (rem < 0)
+        {
+            lift--;
+            rem += dy;
+        }
+        mod -= dy;
+
+        while (ey1 != ey2)
+        {
+            delta = lift;
+            mod += rem;
+            if (mod >= 0)
+            {
+                mod -= dy;
+                delta++;
+            }
+
+            x_to = x_from + delta;
+            renderScanline(ey1, x_from, POLY_BASE_SIZE - first, x_to, first);
+            x_from = x_to;
+
+            ey1 += incr;
+            setCurCell(x_from >> POLY_BASE_SHIFT, ey1);
+        }
+    }
+    renderScanline(ey1, x_from, POLY_BASE_SIZE - first, x2, fy2);
+}
+
+static inline bool lessThan(const Cell& a, const Cell& b)
+{
+    return a.packedCoord() < b.packedCoord();
+}
+
+static inline void swapCells(Cell& a, Cell& b)
+{
+    const Cell temp = a;
+    a = b;
+    b = temp;
+}
+
+void Outline::qsortCells(Cell* const start, unsigned num)
+{
+    const int QSORT_THRESHOLD = 9;
+
+    Cell* stack[80];
+    Cell** top;
+    Cell* limit;
+    Cell* base;
+
+    limit = start + num;
+    base = start;
+    top = stack;
+
+    for (;;)
+    {
+        int len = int(limit - base);
+
+        Cell* i;
+        Cell* j;
+        Cell* pivot;
+
+        if (len > QSORT_THRESHOLD)
+        {
+            // We use base + len/2 as the pivot
+            pivot = base + len / 2;
+            swapCells(*base, *pivot);
+
+            i = base + 1;
+            j = limit - 1;
+
+            // Now ensure that *i <= *base <= *j
+            if (lessThan(*j, *i))
+            {
+                swapCells(*i, *j);
+            }
+
+            if (lessThan(*base, *i))
+            {
+                swapCells(*base, *i);
+            }
+
+            if (lessThan(*j, *base))
+            {
+                swapCells(*base, *j);
+            }
+
+            for (;;)
+            {
+                do
+                {
+                    i++;
+                }
+                while (lessThan(*i, *base));
+                do
+                {
+                    j--;
+                }
+                while (lessThan(*base, *j));
+
+                if (i > j)
+                {
+                    break;
+                }
+
+                swapCells(*i, *j);
+            }
+
+            swapCells(*base, *j);
+
+            // Now, push the largest sub-array
+            if (j - base > limit - i)
+            {
+                top[0] = base;
+                top[1] = j;
+                base = i;
+            }
+            else
+            {
+                top[0] = i;
+                top[1] = limit;
+                limit = j;
+            }
+            top += 2;
+        }
+        else
+        {
+            // The sub-array is small, perform insertion sort
+            j = base;
+            i = j + 1;
+
+            for (; i < limit; j = i, i++)
+            {
+                for (; lessThan(*(j + 1), *j); j--)
+                {
+                    swapCells(*(j + 1), *j);
+                    if (j == base)
+                    {
+                        break;
+                    }
+                }
+            }
+            if (top > stack)
+            {
+                top -= 2;
+                base = top[0];
+                limit = top[1];
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+}
+
+bool Outline::radixSortCells(Cell* const start, unsigned num, void* buffer, unsigned bufferSize)
+{
+    if (num < 2)
+    {
+        return true;
+    }
+    if (num > 0xFFFF)
+    {
+        return false;
+    }
+
+    int minCellY = start[0].y;
+    int maxCellY = start[0].y;
+    for (unsigned i = 1; i < num; i++)
+    {
+        const int y = start[i].y;
+        if (y < minCellY)
+        {
+            minCellY = y;
+        }
+        else if (y > maxCellY)
+        {
+            maxCellY = y;
+        }
+    }
+    const unsigned height = unsigned(maxCellY - minCellY) + 1;
+
+    // The buffer must hold a counter for each row
+    const uintptr_t bufferAddress = reinterpret_cast<uintptr_t>(buffer);
+    const uintptr_t countsAddress = (bufferAddress + sizeof(uint16_t) - 1) & ~uintptr_t(sizeof(uint16_t) - 1);
+    if (countsAddress - bufferAddress + height * sizeof(uint16_t) > bufferSize)
+    {
+        return false;
+    }
+    uint16_t* const rowEnd = reinterpret_cast<uint16_t*>(countsAddress);
+
+    // Count the cells in each row and turn the counts into the end of each row
+    for (unsigned y = 0; y < height; y++)
+    {
+        rowEnd[y] = 0;
+    }
+    for (unsigned i = 0; i < num; i++)
+    {
+        rowEnd[start[i].y - minCellY]++;
+    }
+    for (unsigned y = 1; y < height; y++)
+    {
+        rowEnd[y] += rowEnd[y - 1];
+    }
+
+    // Permute the cells into their rows in place, one row after the other. The unfilled part
+    // of a row is below rowEnd, so the cell at the end of the unfilled part is picked up and
+    // moved to its row, displacing a cell that is moved on until the hole has been filled.
+    unsigned first = 0;
+    for (unsigned y = 0; y < height; y++)
+    {
+        while (rowEnd[y] > first)
+        {
+            const unsigned hole = rowEnd[y] - 1;
+            Cell cell = start[hole];
+            for (;;)
+            {
+                Cell& dest = start[--rowEnd[cell.y - minCellY]];
+                if (&dest == &start[hole])
+                {
+                    dest = cell;
+                    break;
+                }
+                swapCells(cell, dest);
+            }
+        }
+
+        // The row is complete, so it ends at the first cell of a later row
+        unsigned last = first;
+        while (last < num && start[last].y - minCellY == int(y))
+        {
+            last++;
+        }
+
+        // Sort the row on x, rows are usually short
+        if (last - first > ROW_INSERTION_SORT_THRESHOLD)
+        {
+            qsortCells(start + first, last - first);
+        }
+        else
+        {
+            for (unsigned i = first + 1; i < last; i++)
+            {
+                const Cell cell = start[i];
+                unsigned j = i;
+                for (; j > first && start[j - 1].x > cell.x; j--)
+                {
+                    start[j] = start[j - 1];
+                }
+                start[j] = cell;
+            }
+        }
+        first = last;
+    }
+    return true;
+}
+
+void Outline::sortCells()
+{
+    if (numCells == 0)
+    {
+        return;
+    }
+
+    // The unused part of the outline buffer holds the row counters of the linear sort
+    if (numCells < RADIX_SORT_THRESHOLD ||
+            !radixSortCells(cells, numCells, cells + numCells, (maxCells - numCells) * sizeof(Cell)))
+    {
+        qsortCells(cells, numCells);
+    }
+}
+
+const Cell* Outline::getCells()
+{
+    if (flags & OUTLINE_NOT_CLOSED)
+    {
+        lineTo(closeX, closeY);
+        flags &= ~OUTLINE_NOT_CLOSED;
+    }
+
+    // Perform sort only the first time.
+    if (flags & OUTLINE_SORT_REQUIRED)
+    {
+        addCurCell();
+        if (numCells == 0)
+        {
+            return 0;
+        }
+        sortCells();
+        flags &= ~OUTLINE_SORT_REQUIRED;
+    }
+    return cells;
+}
+} // namespace touchgfx
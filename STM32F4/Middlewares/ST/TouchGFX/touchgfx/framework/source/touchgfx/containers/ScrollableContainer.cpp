@@ -16,6 +16,7 @@
 #include <touchgfx/containers/ScrollableContainer.hpp>
 #include <touchgfx/EasingEquations.hpp>
 #include <touchgfx/Color.hpp>
+#include <touchgfx/hal/FrameBufferScroller.hpp>
 
 namespace touchgfx
 {
@@ -48,7 +49,8 @@ ScrollableContainer::ScrollableContainer()
       animate(false),
       fingerAdjustmentX(0),
       fingerAdjustmentY(0),
-      hasIssuedCancelEvent(false)
+      hasIssuedCancelEvent(false),
+      scrollByBlit(false)
 {
     xSlider.setVisible(false);
     ySlider.setVisible(false);
@@ -524,7 +526,10 @@ bool ScrollableContainer::doScroll(int16_t deltaX, int16_t deltaY)
     {
         scrolledXDistance += deltaX;
         scrolledYDistance += deltaY;
-        moveChildrenRelative(deltaX, deltaY);
+        if (!scrollByBlit || !moveChildrenByBlit(deltaX, deltaY))
+        {
+            moveChildrenRelative(deltaX, deltaY);
+        }
 
         invalidateScrollbars();
         couldScroll = true;
@@ -532,6 +537,39 @@ bool ScrollableContainer::doScroll(int16_t deltaX, int16_t deltaY)
     return couldScroll;
 }
 
+bool ScrollableContainer::moveChildrenByBlit(int16_t deltaX, int16_t deltaY)
+{
+    Rect area(0, 0, rect.width, rect.height);
+    if (!FrameBufferScroller::scroll(*this, area, deltaX, deltaY))
+    {
+        return false;
+    }
+
+    // The scrollbars stay in place, but their pixels are moved with the children
+    Box* sliders[2] = { &xSlider, &ySlider };
+    for (int i = 0; i < 2; i++)
+    {
+        if (sliders[i]->isVisible())
+        {
+            Rect moved = sliders[i]->getRect();
+            moved.x += deltaX;
+            moved.y += deltaY;
+            invalidateRect(moved);
+        }
+    }
+
+    Drawable* d = firstChild;
+    while (d)
+    {
+        if ((d != &xSlider) && (d != &ySlider))
+        {
+            d->setXY(d->getX() + deltaX, d->getY() + deltaY);
+        }
+        d = d->getNextSibling();
+    }
+    return true;
+}
+
 void ScrollableContainer::childGeometryChanged()
 {
     Rect contained = getContainedArea();
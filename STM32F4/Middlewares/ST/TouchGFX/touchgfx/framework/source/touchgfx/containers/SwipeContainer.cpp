@@ -15,6 +15,7 @@
 
 #include <touchgfx/containers/SwipeContainer.hpp>
 #include <touchgfx/EasingEquations.hpp>
+#include <touchgfx/hal/FrameBufferScroller.hpp>
 
 namespace touchgfx
 {
@@ -30,6 +31,7 @@ SwipeContainer::SwipeContainer() :
     currentPage(0),
     endElasticWidth(30),
     pages(EAST),
+    scrollByBlit(false),
     pageIndicator()
 {
     touchgfx::Application::getInstance()->registerTimerWidget(this);
@@ -235,7 +237,46 @@ void SwipeContainer::handleGestureEvent(const GestureEvent& evt)
 
 void SwipeContainer::adjustPages()
 {
-    pages.moveTo(-static_cast<int16_t>(currentPage * getWidth()) + dragX, 0);
+    const int16_t x = -static_cast<int16_t>(currentPage * getWidth()) + dragX;
+    if (!scrollByBlit || !movePagesByBlit(x))
+    {
+        pages.moveTo(x, 0);
+    }
+}
+
+bool SwipeContainer::movePagesByBlit(int16_t x)
+{
+    const int16_t deltaX = x - pages.getX();
+    if (deltaX == 0 || pages.getY() != 0)
+    {
+        return false;
+    }
+
+    // Only the pixels of the pages are moved, not the background next to the end pages
+    const Rect area = Rect(0, 0, getWidth(), getHeight()) & Rect(x, 0, pages.getWidth(), pages.getHeight());
+    if (!FrameBufferScroller::scroll(*this, area, deltaX, 0))
+    {
+        return false;
+    }
+    pages.setX(x);
+
+    Rect background(0, 0, area.x, getHeight());
+    if (!background.isEmpty())
+    {
+        invalidateRect(background);
+    }
+    background = Rect(area.right(), 0, getWidth() - area.right(), getHeight());
+    if (!background.isEmpty())
+    {
+        invalidateRect(background);
+    }
+
+    // The page indicator stays in place, but its pixels are moved with the pages
+    Rect indicator = pageIndicator.getRect();
+    Rect movedIndicator(indicator.x + deltaX, indicator.y, indicator.width, indicator.height);
+    invalidateRect(indicator);
+    invalidateRect(movedIndicator);
+    return true;
 }
 
 void SwipeContainer::animateSwipeCancelledLeft()
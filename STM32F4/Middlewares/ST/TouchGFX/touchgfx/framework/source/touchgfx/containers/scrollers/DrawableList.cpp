@@ -370,6 +370,7 @@ void DrawableList::itemChanged(int16_t itemIndex)
         while ((drawableIndex = getDrawableIndex(itemIndex, drawableIndex)) != -1)
         {
             updateDrawable->execute(drawableItems, drawableIndex + firstDrawableIndex, itemIndex);
+            drawableItems->getDrawable(drawableIndex + firstDrawableIndex)->invalidate();
         }
     }
 }
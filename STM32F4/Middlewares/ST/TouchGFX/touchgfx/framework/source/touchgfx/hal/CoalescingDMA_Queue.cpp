@@ -0,0 +1,324 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/hal/DMA.hpp>
+
+namespace touchgfx
+{
+namespace
+{
+bool usesColor(uint32_t operation)
+{
+    return operation == BLIT_OP_FILL || operation == BLIT_OP_FILL_WITH_ALPHA || operation == BLIT_OP_COPY_A4 || operation == BLIT_OP_COPY_A8;
+}
+
+bool usesAlpha(uint32_t operation)
+{
+    return operation == BLIT_OP_COPY_WITH_ALPHA || operation == BLIT_OP_FILL_WITH_ALPHA || operation == BLIT_OP_COPY_ARGB8888_WITH_ALPHA || operation == BLIT_OP_COPY_A4 || operation == BLIT_OP_COPY_A8;
+}
+
+/**
+ * The size of a source pixel in bits, or zero if the operation has no source.
+ */
+intptr_t sourceBitsPerPixel(uint32_t operation)
+{
+    switch (operation)
+    {
+    case BLIT_OP_COPY:
+    case BLIT_OP_COPY_WITH_ALPHA:
+        return 16;
+    case BLIT_OP_COPY_ARGB8888:
+    case BLIT_OP_COPY_ARGB8888_WITH_ALPHA:
+        return 32;
+    case BLIT_OP_COPY_A8:
+        return 8;
+    case BLIT_OP_COPY_A4:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+intptr_t floorDiv(intptr_t a, intptr_t b)
+{
+    const intptr_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+/**
+ * The memory touched by an operation, as a number of lines of the same width. All values
+ * are in bytes.
+ */
+struct Area
+{
+    intptr_t start;
+    intptr_t width;
+    intptr_t stride;
+    intptr_t lines;
+};
+
+Area destinationArea(const BlitOp& op)
+{
+    const Area area = { reinterpret_cast<intptr_t>(op.pDst), op.nSteps * 2, op.dstLoopStride * 2, op.nLoops };
+    return area;
+}
+
+Area sourceArea(const BlitOp& op)
+{
+    // A4 lines can start in the middle of a byte, so the source is taken as a single
+    // line covering everything read
+    const intptr_t bits = sourceBitsPerPixel(op.operation);
+    const Area area = { reinterpret_cast<intptr_t>(op.pSrc), ((op.nLoops - 1) * op.srcLoopStride + op.nSteps) * bits / 8 + 1, 0, 1 };
+    return area;
+}
+
+bool overlaps(const Area& a, const Area& b)
+{
+    if (a.lines == 0 || b.lines == 0 || a.width == 0 || b.width == 0)
+    {
+        return false;
+    }
+    const intptr_t stride = a.lines > 1 ? a.stride : b.stride;
+    if ((a.lines > 1 && b.lines > 1 && a.stride != b.stride) || stride <= 0)
+    {
+        // Compare the full extents
+        const intptr_t aEnd = a.start + (a.lines - 1) * a.stride + a.width;
+        const intptr_t bEnd = b.start + (b.lines - 1) * b.stride + b.width;
+        return a.start < bEnd && b.start < aEnd;
+    }
+
+    // Line i of a and line j of b overlap if -b.width < d + (j - i) * stride < a.width
+    const intptr_t d = b.start - a.start;
+    const intptr_t kMin = MAX(floorDiv(-b.width - d, stride) + 1, -(a.lines - 1));
+    const intptr_t kMax = MIN(-floorDiv(d - a.width, stride) - 1, b.lines - 1);
+    return kMin <= kMax;
+}
+
+/**
+ * Checks if op must be performed after waiting, because one of them writes pixels that the
+ * other reads or writes.
+ */
+bool dependsOn(const BlitOp& op, const BlitOp& waiting)
+{
+    const Area opDestination = destinationArea(op);
+    const Area waitingDestination = destinationArea(waiting);
+    return overlaps(opDestination, waitingDestination) ||
+           (sourceBitsPerPixel(op.operation) && overlaps(sourceArea(op), waitingDestination)) ||
+           (sourceBitsPerPixel(waiting.operation) && overlaps(opDestination, sourceArea(waiting)));
+}
+
+bool sourceContinues(const BlitOp& first, const BlitOp& second, intptr_t pixels)
+{
+    const intptr_t bits = sourceBitsPerPixel(first.operation);
+    return bits == 0 || (reinterpret_cast<const uint8_t*>(second.pSrc) - reinterpret_cast<const uint8_t*>(first.pSrc)) * 8 == pixels * bits;
+}
+
+/**
+ * Checks if second continues first, either below the last line or after the end of each
+ * line, and if so sets merged to the operation covering both.
+ */
+bool continues(const BlitOp& first, const BlitOp& second, BlitOp& merged)
+{
+    const intptr_t offset = second.pDst - first.pDst;
+    if (first.nSteps == second.nSteps && offset == first.nLoops * first.dstLoopStride &&
+            first.nLoops + second.nLoops <= 0xFFFF && sourceContinues(first, second, first.nLoops * first.srcLoopStride))
+    {
+        merged = first;
+        merged.nLoops += second.nLoops;
+        return true;
+    }
+    if (first.nLoops == second.nLoops && offset == first.nSteps &&
+            first.nSteps + second.nSteps <= first.dstLoopStride && sourceContinues(first, second, first.nSteps) &&
+            (sourceBitsPerPixel(first.operation) == 0 || first.nSteps + second.nSteps <= first.srcLoopStride))
+    {
+        merged = first;
+        merged.nSteps += second.nSteps;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Checks if all pixels of inner are inside outer.
+ */
+bool contains(const BlitOp& outer, const BlitOp& inner)
+{
+    if (inner.nSteps > outer.nSteps || inner.nLoops > outer.nLoops)
+    {
+        return false;
+    }
+    const intptr_t stride = outer.dstLoopStride;
+    const intptr_t offset = inner.pDst - outer.pDst;
+    const intptr_t line = floorDiv(offset, stride);
+    const intptr_t column = offset - line * stride;
+    return line >= 0 && line <= outer.nLoops - inner.nLoops && column <= outer.nSteps - inner.nSteps;
+}
+
+/**
+ * Merges overlapping opaque fills with the same color, which write the same color to the
+ * pixels they have in common.
+ */
+bool mergeFills(BlitOp& waiting, const BlitOp& op)
+{
+    if (contains(waiting, op))
+    {
+        return true;
+    }
+    if (contains(op, waiting))
+    {
+        waiting = op;
+        return true;
+    }
+
+    const intptr_t stride = waiting.dstLoopStride;
+    const intptr_t offset = op.pDst - waiting.pDst;
+    if (op.nSteps == waiting.nSteps && offset % stride == 0)
+    {
+        // Overlapping lines of the same columns
+        const intptr_t line = offset / stride;
+        const intptr_t first = MIN(0, line);
+        const intptr_t last = MAX(waiting.nLoops, line + op.nLoops);
+        if (line >= -op.nLoops && line <= waiting.nLoops && last - first <= 0xFFFF)
+        {
+            waiting.pDst += first * stride;
+            waiting.nLoops = static_cast<uint16_t>(last - first);
+            return true;
+        }
+    }
+    if (op.nLoops == waiting.nLoops && offset >= -op.nSteps && offset <= waiting.nSteps)
+    {
+        // Overlapping columns of the same lines
+        const intptr_t first = MIN(0, offset);
+        const intptr_t last = MAX(waiting.nSteps, offset + op.nSteps);
+        if (last - first <= stride)
+        {
+            waiting.pDst += first;
+            waiting.nSteps = static_cast<uint16_t>(last - first);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Merges op into waiting if they have the same parameters and together write a set of
+ * pixels that a single operation can write.
+ */
+bool mergeOperations(BlitOp& waiting, const BlitOp& op)
+{
+    if (waiting.operation != op.operation || waiting.dstLoopStride != op.dstLoopStride || waiting.dstLoopStride == 0 ||
+            (usesColor(op.operation) && waiting.color != op.color) ||
+            (usesAlpha(op.operation) && waiting.alpha != op.alpha) ||
+            (sourceBitsPerPixel(op.operation) && waiting.srcLoopStride != op.srcLoopStride))
+    {
+        return false;
+    }
+
+    BlitOp merged;
+    if (continues(waiting, op, merged) || continues(op, waiting, merged))
+    {
+        waiting = merged;
+        return true;
+    }
+    return op.operation == BLIT_OP_FILL && mergeFills(waiting, op);
+}
+} // namespace
+
+CoalescingDMA_Queue::CoalescingDMA_Queue(BlitOp* mem, atomic_t n)
+    : q(mem),
+      capacity(n),
+      head(0),
+      tail(0),
+      mergingEnabled(true),
+      queuedOperations(0),
+      mergedOperations(0)
+{
+}
+
+bool CoalescingDMA_Queue::isEmpty()
+{
+    return head == tail;
+}
+
+bool CoalescingDMA_Queue::isFull()
+{
+    atomic_t diff = head - tail;
+    if (diff <= 0)
+    {
+        diff += capacity;
+    }
+    return diff <= 1;
+}
+
+void CoalescingDMA_Queue::pushCopyOf(const BlitOp& op)
+{
+    queuedOperations++;
+    if (mergingEnabled && merge(op))
+    {
+        mergedOperations++;
+        return;
+    }
+
+    assert(!isFull() && "Cannot add to a full DMA queue");
+    q[tail] = op;
+    const atomic_t next = tail + 1;
+    atomic_set(tail, next < capacity ? next : next - capacity);
+}
+
+void CoalescingDMA_Queue::pop()
+{
+    assert(!isEmpty() && "Cannot pop from an empty DMA queue");
+    const atomic_t next = head + 1;
+    atomic_set(head, next < capacity ? next : next - capacity);
+}
+
+const BlitOp* CoalescingDMA_Queue::first()
+{
+    return &q[head];
+}
+
+bool CoalescingDMA_Queue::merge(const BlitOp& op)
+{
+    atomic_t waiting = tail - head;
+    if (waiting < 0)
+    {
+        waiting += capacity;
+    }
+    // The first operation may be in progress, so it is left alone
+    for (atomic_t i = 1; i < waiting && i <= MERGE_WINDOW; i++)
+    {
+        BlitOp& candidate = q[(tail - i + capacity) % capacity];
+        if (mergeOperations(candidate, op))
+        {
+            // The last operation may now continue the one before it, like the second half
+            // of a line of parts continuing the line above
+            while (i == 1 && waiting > 2)
+            {
+                const atomic_t last = (tail - 1 + capacity) % capacity;
+                if (!mergeOperations(q[(last - 1 + capacity) % capacity], q[last]))
+                {
+                    break;
+                }
+                atomic_set(tail, last);
+                waiting--;
+            }
+            return true;
+        }
+        if (dependsOn(op, candidate))
+        {
+            return false;
+        }
+    }
+    return false;
+}
+} // namespace touchgfx
@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/hal/FrameBufferScroller.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/Application.hpp>
+#include <touchgfx/Screen.hpp>
+#include <touchgfx/Drawable.hpp>
+
+namespace touchgfx
+{
+FrameBufferScroller* FrameBufferScroller::instance = 0;
+
+bool FrameBufferScroller::scroll(Drawable& drawable, const Rect& area, int16_t deltaX, int16_t deltaY)
+{
+    Screen* screen = Application::getInstance()->getCurrentScreen();
+    if (instance == 0 || screen == 0)
+    {
+        return false;
+    }
+
+    Rect absolute = area;
+    drawable.translateRectToAbsolute(absolute);
+    absolute &= Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+
+    // Clip to the parents, and make sure that nothing in front covers the area
+    Drawable* d = &drawable;
+    for (; d->getParent() != 0; d = d->getParent())
+    {
+        if (!d->isVisible())
+        {
+            return false;
+        }
+        absolute &= d->getAbsoluteRect();
+        for (Drawable* sibling = d->getNextSibling(); sibling != 0; sibling = sibling->getNextSibling())
+        {
+            if (sibling->isVisible() && sibling->getAbsoluteRect().intersect(absolute))
+            {
+                return false;
+            }
+        }
+    }
+    if (d != &screen->getRootContainer() || absolute.isEmpty())
+    {
+        return false;
+    }
+    return instance->scrollArea(absolute, deltaX, deltaY);
+}
+} // namespace touchgfx
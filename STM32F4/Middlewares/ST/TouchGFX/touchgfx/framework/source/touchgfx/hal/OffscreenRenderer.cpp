@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/hal/OffscreenRenderer.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <touchgfx/Drawable.hpp>
+#include <cassert>
+
+namespace touchgfx
+{
+void OffscreenRenderer::render(Drawable& drawable, uint16_t* buffer, colortype background)
+{
+    assert(HAL::lcd().bitDepth() == 16 && HAL::DISPLAY_ROTATION == rotate0 && "Offscreen rendering requires a 16 bpp display without rotation");
+    assert(buffer != 0 && drawable.getWidth() <= HAL::DISPLAY_WIDTH && drawable.getHeight() <= HAL::DISPLAY_HEIGHT && "Drawable cannot be rendered offscreen");
+
+    HAL* hal = HAL::getInstance();
+    // Operations on the DMA were set up for the current frame buffer
+    hal->flushDMA();
+
+    uint16_t* frameBuffer;
+    uint16_t* doubleBuffer;
+    uint16_t* animationStorage;
+    hal->getFrameBufferStartAddresses(frameBuffer, doubleBuffer, animationStorage);
+    const uint16_t frameBufferWidth = HAL::FRAME_BUFFER_WIDTH;
+
+    // Draw into a frame buffer as wide as the drawable, moved so it appears at (0, 0). As
+    // nothing is drawn outside the drawable, the frame buffer is no higher than the buffer.
+    const int16_t x = drawable.getX();
+    const int16_t y = drawable.getY();
+    const Rect area(0, 0, drawable.getWidth(), drawable.getHeight());
+    Rect absolute = area;
+    drawable.translateRectToAbsolute(absolute);
+    drawable.setXY(x - absolute.x, y - absolute.y);
+    HAL::FRAME_BUFFER_WIDTH = area.width;
+    hal->setFrameBufferStartAddresses(buffer, 0, animationStorage);
+
+    HAL::lcd().fillRect(area, background);
+    drawable.draw(area);
+    hal->flushDMA();
+
+    drawable.setXY(x, y);
+    HAL::FRAME_BUFFER_WIDTH = frameBufferWidth;
+    hal->setFrameBufferStartAddresses(frameBuffer, doubleBuffer, animationStorage);
+}
+} // namespace touchgfx
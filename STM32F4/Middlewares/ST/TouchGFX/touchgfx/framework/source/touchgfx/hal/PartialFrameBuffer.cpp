@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/hal/PartialFrameBuffer.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <cassert>
+
+namespace touchgfx
+{
+PartialFrameBuffer::PartialFrameBuffer(uint16_t* buffer, uint32_t bufferSize, uint16_t numberOfBuffers, GenericCallback<const Rect&, const uint16_t*>& transmitCallback) :
+    buffers(buffer),
+    bufferPixels(numberOfBuffers > 0 ? bufferSize / numberOfBuffers / sizeof(uint16_t) : 0),
+    numberOfBuffers(numberOfBuffers),
+    nextBuffer(0),
+    queued(0),
+    transmitted(0),
+    transmitCallback(transmitCallback)
+{
+    assert(buffer != 0 && numberOfBuffers > 0 && "Partial frame buffer requires at least one strip buffer");
+}
+
+Rect PartialFrameBuffer::beginStrip(const Rect& area)
+{
+    assert(HAL::lcd().bitDepth() == 16 && HAL::DISPLAY_ROTATION == rotate0 && "Partial frame buffer requires a 16 bpp display without rotation");
+    assert(area.width > 0 && static_cast<uint32_t>(area.width) <= bufferPixels && "Strip buffer cannot hold a line of the area");
+
+    while (getNumberOfTransmits() >= numberOfBuffers)
+    {
+        waitForTransmit();
+    }
+
+    const uint32_t lines = bufferPixels / area.width;
+    Rect strip = area;
+    if (static_cast<uint32_t>(strip.height) > lines)
+    {
+        strip.height = static_cast<int16_t>(lines);
+    }
+
+    // Place a frame buffer as wide as the strip, such that the strip starts at the start of
+    // the strip buffer. Drawing only accesses the strip, so the rest of the frame buffer
+    // need not exist.
+    uint16_t* const buffer = buffers + nextBuffer * bufferPixels;
+    const uintptr_t offset = (static_cast<uint32_t>(strip.y) * strip.width + strip.x) * sizeof(uint16_t);
+    HAL::FRAME_BUFFER_WIDTH = strip.width;
+    HAL::getInstance()->setFrameBufferStartAddresses(reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(buffer) - offset), 0, 0);
+    return strip;
+}
+
+void PartialFrameBuffer::endStrip(const Rect& strip)
+{
+    HAL* hal = HAL::getInstance();
+    hal->flushDMA();
+
+    // Leave the frame buffer as the HAL would expect it outside of drawing
+    HAL::FRAME_BUFFER_WIDTH = HAL::DISPLAY_WIDTH;
+    hal->setFrameBufferStartAddresses(buffers, 0, 0);
+
+    // Counted before transmitting, the transmission may complete before the callback returns
+    const uint16_t* buffer = buffers + nextBuffer * bufferPixels;
+    nextBuffer = (nextBuffer + 1) % numberOfBuffers;
+    queued++;
+    transmitCallback.execute(strip, buffer);
+}
+
+void PartialFrameBuffer::flush()
+{
+    while (isTransmitting())
+    {
+        waitForTransmit();
+    }
+}
+} // namespace touchgfx
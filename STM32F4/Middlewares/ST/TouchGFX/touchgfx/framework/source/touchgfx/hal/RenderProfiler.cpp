@@ -0,0 +1,182 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/hal/RenderProfiler.hpp>
+#include <touchgfx/Drawable.hpp>
+#include <touchgfx/Screen.hpp>
+#include <cassert>
+#if defined(SIMULATOR) && defined(__GXX_RTTI)
+#include <typeinfo>
+#include <cxxabi.h>
+#include <stdlib.h>
+#endif
+
+namespace touchgfx
+{
+RenderProfiler* RenderProfiler::instance = 0;
+
+RenderProfiler::RenderProfiler(MCUInstrumentation& instrumentation, uint32_t clockFrequency, Event* buffer, uint16_t capacity)
+    : instrumentation(instrumentation),
+      clockFrequency(clockFrequency),
+      events(buffer),
+      capacity(capacity),
+      firstEvent(0),
+      numberOfEvents(0),
+      lostEvents(0),
+      frameNumber(0),
+      frameStart(0),
+      invalidatedArea(0)
+{
+    assert(buffer != 0 && capacity > 0 && clockFrequency > 0 && "Invalid render profiler buffer");
+}
+
+void RenderProfiler::beginFrame()
+{
+    frameStart = getCPUCycles();
+    invalidatedArea = 0;
+}
+
+void RenderProfiler::endFrame()
+{
+    addEvent(FRAME, frameStart, invalidatedArea, 0, 0);
+    frameNumber++;
+}
+
+void RenderProfiler::addDraw(const Drawable& drawable, uint32_t start, uint32_t pixels)
+{
+#if defined(SIMULATOR) && defined(__GXX_RTTI)
+    addEvent(DRAW, start, pixels, &drawable, typeid(drawable).name());
+#else
+    addEvent(DRAW, start, pixels, &drawable, 0);
+#endif
+}
+
+void RenderProfiler::addDraw(const Screen& screen, uint32_t start, uint32_t pixels)
+{
+#if defined(SIMULATOR) && defined(__GXX_RTTI)
+    addEvent(DRAW, start, pixels, &screen, typeid(screen).name());
+#else
+    addEvent(DRAW, start, pixels, &screen, 0);
+#endif
+}
+
+void RenderProfiler::addDMAWait(uint32_t start)
+{
+    addEvent(DMA_WAIT, start, 0, 0, 0);
+}
+
+const RenderProfiler::Event& RenderProfiler::getEvent(uint16_t index) const
+{
+    assert(index < numberOfEvents && "Render profiler event index out of range");
+    return events[(firstEvent + index) % capacity];
+}
+
+uint16_t RenderProfiler::dump(Event* destination, uint16_t maxEvents)
+{
+    uint16_t count = 0;
+    while (count < maxEvents && numberOfEvents > 0)
+    {
+        destination[count++] = events[firstEvent];
+        firstEvent = (firstEvent + 1) % capacity;
+        numberOfEvents--;
+    }
+    return count;
+}
+
+void RenderProfiler::clear()
+{
+    firstEvent = 0;
+    numberOfEvents = 0;
+    lostEvents = 0;
+}
+
+void RenderProfiler::addEvent(EventType type, uint32_t start, uint32_t pixels, const void* object, const char* typeName)
+{
+    const uint32_t now = getCPUCycles();
+    if (numberOfEvents == capacity)
+    {
+        // Overwrite the oldest event
+        firstEvent = (firstEvent + 1) % capacity;
+        numberOfEvents--;
+        lostEvents++;
+    }
+    Event& event = events[(firstEvent + numberOfEvents) % capacity];
+    event.type = type;
+    event.frameNumber = frameNumber;
+    event.start = start;
+    event.duration = now - start;
+    event.pixels = pixels;
+    event.object = object;
+    event.typeName = typeName;
+    numberOfEvents++;
+}
+
+#ifdef SIMULATOR
+bool RenderProfiler::writeChromeTrace(FILE* file)
+{
+    static const char* const trackNames[] = { "Frames", "Draws", "DMA waits" };
+
+    // The time stamps wrap around, so they are made relative to the earliest event
+    uint32_t origin = numberOfEvents > 0 ? getEvent(0).start : 0;
+    for (uint16_t i = 1; i < numberOfEvents; i++)
+    {
+        if (static_cast<int32_t>(getEvent(i).start - origin) < 0)
+        {
+            origin = getEvent(i).start;
+        }
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (int track = FRAME; track <= DMA_WAIT; track++)
+    {
+        fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n", track, trackNames[track]);
+    }
+    for (uint16_t i = 0; i < numberOfEvents; i++)
+    {
+        const Event& event = getEvent(i);
+        const double ts = static_cast<double>(event.start - origin) / clockFrequency;
+        const double dur = static_cast<double>(event.duration) / clockFrequency;
+        fprintf(file, "{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,", event.type, ts, dur);
+        switch (event.type)
+        {
+        case FRAME:
+            fprintf(file, "\"name\":\"Frame %u\",\"args\":{\"invalidated_pixels\":%u}}", static_cast<unsigned int>(event.frameNumber), static_cast<unsigned int>(event.pixels));
+            break;
+        case DRAW:
+            {
+                const char* name = event.typeName ? event.typeName : "Drawable";
+#if defined(__GXX_RTTI)
+                int status = 0;
+                char* demangled = event.typeName ? abi::__cxa_demangle(event.typeName, 0, 0, &status) : 0;
+                if (demangled && status == 0)
+                {
+                    name = demangled;
+                }
+#endif
+                fprintf(file, "\"name\":\"%s\",\"args\":{\"frame\":%u,\"drawable\":\"%p\",\"pixels\":%u}}", name, static_cast<unsigned int>(event.frameNumber), event.object, static_cast<unsigned int>(event.pixels));
+#if defined(__GXX_RTTI)
+                free(demangled);
+#endif
+            }
+            break;
+        case DMA_WAIT:
+            fprintf(file, "\"name\":\"DMA wait\",\"args\":{\"frame\":%u}}", static_cast<unsigned int>(event.frameNumber));
+            break;
+        }
+        fprintf(file, i + 1 < numberOfEvents ? ",\n" : "\n");
+    }
+    fprintf(file, "]}\n");
+    return ferror(file) == 0;
+}
+#endif
+} // namespace touchgfx
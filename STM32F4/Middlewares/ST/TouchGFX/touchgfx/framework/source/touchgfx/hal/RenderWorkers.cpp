@@ -0,0 +1,28 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/hal/RenderWorkers.hpp>
+
+namespace touchgfx
+{
+RenderWorkers* RenderWorkers::instance = 0;
+bool RenderWorkers::drawing = false;
+
+void RenderWorkers::execute(GenericCallback<uint8_t>& job)
+{
+    assert(!drawing && "Render workers are already drawing");
+    drawing = true;
+    runJob(job);
+    drawing = false;
+}
+} // namespace touchgfx
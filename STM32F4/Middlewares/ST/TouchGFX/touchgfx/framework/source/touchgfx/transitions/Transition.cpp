@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * This file is part of the TouchGFX 4.10.0 distribution.
+  * Modified by the contributors of this repository.
+  *
+  * <h2><center>&copy; Copyright (c) 2018 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/transitions/Transition.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/hal/OffscreenRenderer.hpp>
+#include <touchgfx/containers/Container.hpp>
+#include <touchgfx/widgets/Image.hpp>
+
+namespace touchgfx
+{
+BitmapId Transition::screenCacheBitmap = BITMAP_INVALID;
+
+bool Transition::drawScreenCache(Image& image)
+{
+    if (screenCacheBitmap == BITMAP_INVALID || HAL::lcd().bitDepth() != 16 || HAL::DISPLAY_ROTATION != rotate0)
+    {
+        return false;
+    }
+    const Bitmap bitmap(screenCacheBitmap);
+    uint16_t* buffer = reinterpret_cast<uint16_t*>(Bitmap::dynamicBitmapGetAddress(screenCacheBitmap));
+    if (buffer == 0 || bitmap.getFormat() != Bitmap::RGB565 ||
+            bitmap.getWidth() != screenContainer->getWidth() || bitmap.getHeight() != screenContainer->getHeight())
+    {
+        return false;
+    }
+
+    OffscreenRenderer::render(*screenContainer, buffer, 0);
+    // Covers the widgets, so they are not drawn while transitioning
+    Bitmap::dynamicBitmapSetSolidRect(screenCacheBitmap, Rect(0, 0, bitmap.getWidth(), bitmap.getHeight()));
+    image.setBitmap(bitmap);
+    image.setXY(0, 0);
+    return true;
+}
+
+void Transition::removeScreenCache(Image& image)
+{
+    screenContainer->remove(image);
+    screenContainer->invalidate();
+}
+} // namespace touchgfx
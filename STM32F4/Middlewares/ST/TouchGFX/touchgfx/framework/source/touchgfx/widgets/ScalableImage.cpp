@@ -14,6 +14,7 @@
   */
 
 #include <touchgfx/widgets/ScalableImage.hpp>
+#include <touchgfx/BitmapCache.hpp>
 #include <touchgfx/transforms/DisplayTransformation.hpp>
 #include <touchgfx/TextureMapTypes.hpp>
 
@@ -64,7 +65,11 @@ void ScalableImage::drawTriangle(const Rect& invalidatedArea, uint16_t* fb, cons
     DisplayTransformation::transformDisplayToFrameBuffer(dirtyArea, this->getRect());
     DisplayTransformation::transformDisplayToFrameBuffer(dirtyAreaAbsolute);
 
+    // Encoded bitmaps must be decoded into a dynamic bitmap, see EncodedBitmap::decode()
+    assert(bitmap.getFormat() != Bitmap::ENCODED && "ScalableImage cannot sample an encoded bitmap");
+
     // Get a pointer to the bitmap data, return if no bitmap found
+    BitmapCache::access(bitmap.getId());
     const uint16_t* textmap = (const uint16_t*)bitmap.getData();
     if (!textmap)
     {
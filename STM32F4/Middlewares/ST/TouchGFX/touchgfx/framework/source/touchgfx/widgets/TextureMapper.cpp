@@ -14,12 +14,287 @@
   */
 
 #include <touchgfx/widgets/TextureMapper.hpp>
+#include <touchgfx/BitmapCache.hpp>
 #include <touchgfx/transforms/DisplayTransformation.hpp>
 #include <touchgfx/Math3D.hpp>
 #include <touchgfx/TextureMapTypes.hpp>
 
 namespace touchgfx
 {
+namespace
+{
+// Pixel operations of the affine path, using the same arithmetic as LCD16bpp. The alpha of
+// the TextureMapper alone is blended against 256, the product of the alpha of a texel and the
+// alpha of the TextureMapper against 65536.
+
+const int32_t OPAQUE = 0xFF * 0xFF;
+
+inline uint16_t blendRGB565(uint16_t fg, uint16_t bg, int32_t alpha)
+{
+    const int32_t ialpha = 256 - alpha;
+    return static_cast<uint16_t>(((((fg & 0xF800) * alpha + (bg & 0xF800) * ialpha) >> 8) & 0xF800) |
+                                 ((((fg & 0x07E0) * alpha + (bg & 0x07E0) * ialpha) >> 8) & 0x07E0) |
+                                 ((((fg & 0x001F) * alpha + (bg & 0x001F) * ialpha) >> 8) & 0x001F));
+}
+
+inline uint16_t blendRGB565Product(uint16_t fg, uint16_t bg, int32_t alpha)
+{
+    if (alpha >= OPAQUE)
+    {
+        return fg;
+    }
+    const int32_t r = bg >> 11;
+    const int32_t g = (bg >> 5) & 0x3F;
+    const int32_t b = bg & 0x1F;
+    return static_cast<uint16_t>(((r + ((((fg >> 11) - r) * alpha) >> 16)) << 11) |
+                                 ((g + (((((fg >> 5) & 0x3F) - g) * alpha) >> 16)) << 5) |
+                                 (b + ((((fg & 0x1F) - b) * alpha) >> 16)));
+}
+
+inline uint16_t convertARGB8888ToRGB565(uint32_t argb)
+{
+    return static_cast<uint16_t>(((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F));
+}
+
+inline uint32_t expandRGB565(uint16_t color)
+{
+    // Spread the channels, leaving room for multiplying them by 5 bit weights
+    return (color | (static_cast<uint32_t>(color) << 16)) & 0x07E0F81F;
+}
+
+/**
+ * The four texels used by the bilinear interpolation at (x, y) and their weights, derived from
+ * the fractions of the texture coordinates with 4 bits of precision. The weights total 256.
+ */
+struct Texels
+{
+    int32_t offset;
+    int32_t nextColumn;
+    int32_t nextRow;
+    int32_t fractionX;
+    int32_t fractionY;
+    int32_t w00;
+    int32_t w10;
+    int32_t w01;
+    int32_t w11;
+
+    Texels(const TextureSurface& texture, int32_t x, int32_t y, fixed16_16 U, fixed16_16 V)
+        : offset(y * texture.stride + x),
+          nextColumn(x + 1 < texture.width ? 1 : 0),
+          nextRow(y + 1 < texture.height ? texture.stride : 0),
+          fractionX((U & 0xFFFF) >> 12),
+          fractionY((V & 0xFFFF) >> 12),
+          w00((16 - fractionX) * (16 - fractionY)),
+          w10(fractionX * (16 - fractionY)),
+          w01((16 - fractionX) * fractionY),
+          w11(fractionX * fractionY)
+    {
+    }
+};
+
+/**
+ * Interpolates premultiplied channels of the four texels and divides by the interpolated
+ * alpha, like LCD16bpp does for textures with alpha. The channels are premultiplied as
+ * channel * alpha / 256.
+ */
+struct PremultipliedTexels
+{
+    int32_t alpha;
+    int32_t channels[3];
+
+    PremultipliedTexels(const Texels& texels, const int32_t (&values)[4][4])
+        : alpha((values[0][3] * texels.w00 + values[1][3] * texels.w10 + values[2][3] * texels.w01 + values[3][3] * texels.w11) >> 8)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            const int32_t sum = ((values[0][c] * values[0][3]) >> 8) * texels.w00 + ((values[1][c] * values[1][3]) >> 8) * texels.w10 +
+                                ((values[2][c] * values[2][3]) >> 8) * texels.w01 + ((values[3][c] * values[3][3]) >> 8) * texels.w11;
+            channels[c] = (alpha == 0xFF || alpha == 0) ? sum >> 8 : MIN((sum * 0xFF) / (alpha << 8), 0xFF);
+        }
+    }
+};
+
+struct NearestNeighborRGB565
+{
+    static void draw(uint16_t& pixel, const TextureSurface& texture, int32_t x, int32_t y, fixed16_16, fixed16_16, int32_t alpha)
+    {
+        const uint16_t color = texture.data[y * texture.stride + x];
+        pixel = (alpha == 0xFF) ? color : blendRGB565(color, pixel, alpha);
+    }
+};
+
+struct NearestNeighborRGB565Alpha
+{
+    static void draw(uint16_t& pixel, const TextureSurface& texture, int32_t x, int32_t y, fixed16_16, fixed16_16, int32_t alpha)
+    {
+        const int32_t offset = y * texture.stride + x;
+        pixel = blendRGB565Product(texture.data[offset], pixel, texture.alphaChannel[offset] * alpha);
+    }
+};
+
+struct NearestNeighborARGB8888
+{
+    static void draw(uint16_t& pixel, const TextureSurface& texture, int32_t x, int32_t y, fixed16_16, fixed16_16, int32_t alpha)
+    {
+        const uint32_t argb = reinterpret_cast<const uint32_t*>(texture.data)[y * texture.stride + x];
+        pixel = blendRGB565Product(convertARGB8888ToRGB565(argb), pixel, static_cast<int32_t>(argb >> 24) * alpha);
+    }
+};
+
+struct BilinearRGB565
+{
+    static void draw(uint16_t& pixel, const TextureSurface& texture, int32_t x, int32_t y, fixed16_16 U, fixed16_16 V, int32_t alpha)
+    {
+        // Weights with a total of 32, so the spread channels do not overflow into each other
+        const Texels texels(texture, x, y, U, V);
+        const int32_t xy = (texels.fractionX * texels.fractionY) >> 3;
+        const int32_t w00 = 32 - 2 * texels.fractionX - 2 * texels.fractionY + xy;
+        const int32_t w10 = 2 * texels.fractionX - xy;
+        const int32_t w01 = 2 * texels.fractionY - xy;
+        const uint16_t* p = texture.data + texels.offset;
+        const uint32_t spread = ((expandRGB565(p[0]) * w00 + expandRGB565(p[texels.nextColumn]) * w10 +
+                                  expandRGB565(p[texels.nextRow]) * w01 + expandRGB565(p[texels.nextRow + texels.nextColumn]) * xy) >> 5) & 0x07E0F81F;
+        const uint16_t color = static_cast<uint16_t>(spread | (spread >> 16));
+        pixel = (alpha == 0xFF) ? color : blendRGB565(color, pixel, alpha);
+    }
+};
+
+struct BilinearRGB565Alpha
+{
+    static void draw(uint16_t& pixel, const TextureSurface& texture, int32_t x, int32_t y, fixed16_16 U, fixed16_16 V, int32_t alpha)
+    {
+        const Texels texels(texture, x, y, U, V);
+        const uint16_t* p = texture.data + texels.offset;
+        const uint8_t* a = texture.alphaChannel + texels.offset;
+        const int32_t offsets[4] = { 0, texels.nextColumn, texels.nextRow, texels.nextRow + texels.nextColumn };
+        int32_t values[4][4];
+        for (int i = 0; i < 4; i++)
+        {
+            const uint16_t color = p[offsets[i]];
+            values[i][0] = color >> 11;
+            values[i][1] = (color >> 5) & 0x3F;
+            values[i][2] = color & 0x1F;
+            values[i][3] = a[offsets[i]];
+        }
+        const PremultipliedTexels result(texels, values);
+        if (result.alpha != 0)
+        {
+            const uint16_t color = static_cast<uint16_t>(((result.channels[0] & 0x1F) << 11) | ((result.channels[1] & 0x3F) << 5) | (result.channels[2] & 0x1F));
+            pixel = blendRGB565Product(color, pixel, result.alpha * alpha);
+        }
+    }
+};
+
+struct BilinearARGB8888
+{
+    static void draw(uint16_t& pixel, const TextureSurface& texture, int32_t x, int32_t y, fixed16_16 U, fixed16_16 V, int32_t alpha)
+    {
+        const Texels texels(texture, x, y, U, V);
+        const uint32_t* p = reinterpret_cast<const uint32_t*>(texture.data) + texels.offset;
+        const int32_t offsets[4] = { 0, texels.nextColumn, texels.nextRow, texels.nextRow + texels.nextColumn };
+        int32_t values[4][4];
+        for (int i = 0; i < 4; i++)
+        {
+            const uint32_t argb = p[offsets[i]];
+            values[i][0] = (argb >> 16) & 0xFF;
+            values[i][1] = (argb >> 8) & 0xFF;
+            values[i][2] = argb & 0xFF;
+            values[i][3] = argb >> 24;
+        }
+        const PremultipliedTexels result(texels, values);
+        if (result.alpha != 0)
+        {
+            const uint16_t color = static_cast<uint16_t>(((result.channels[0] >> 3) << 11) | ((result.channels[1] >> 2) << 5) | (result.channels[2] >> 3));
+            pixel = blendRGB565Product(color, pixel, result.alpha * alpha);
+        }
+    }
+};
+
+typedef void (*DrawAffineSpanFunction)(uint16_t* dst, int32_t width, fixed16_16 U, fixed16_16 V, fixed16_16 dUdX, fixed16_16 dVdX, const TextureSurface& texture, int32_t alpha);
+
+template <class Sampler, bool checked>
+void drawAffineSpan(uint16_t* dst, int32_t width, fixed16_16 U, fixed16_16 V, fixed16_16 dUdX, fixed16_16 dVdX, const TextureSurface& texture, int32_t alpha)
+{
+    for (; width > 0; width--, dst++, U += dUdX, V += dVdX)
+    {
+        const int32_t x = U >> 16;
+        const int32_t y = V >> 16;
+        if (checked && (x < 0 || x >= texture.width || y < 0 || y >= texture.height))
+        {
+            continue;
+        }
+        Sampler::draw(*dst, texture, x, y, U, V, alpha);
+    }
+}
+
+/**
+ * The texture coordinates of an affine triangle change by the same amount for every pixel, so
+ * they are stepped in fixed point. The depth is the same for all pixels.
+ */
+struct AffineScanLine
+{
+    float z;
+    float dUdX;
+    float dVdX;
+    fixed16_16 fixedDUdX;
+    fixed16_16 fixedDVdX;
+    DrawAffineSpanFunction drawInside;
+    DrawAffineSpanFunction drawChecked;
+};
+
+bool isInside(const TextureSurface& texture, fixed16_16 U, fixed16_16 V)
+{
+    const int32_t x = U >> 16;
+    const int32_t y = V >> 16;
+    return x >= 0 && x < texture.width && y >= 0 && y < texture.height;
+}
+
+void drawAffineScanLine(const DrawingSurface& dest, const AffineScanLine& scanLine, const Edge& left, const Edge& right, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, int32_t alpha)
+{
+    // Clip against the dirty area like LCD16bpp::drawTextureMapScanLine does
+    int32_t x = left.X;
+    int32_t width = right.X - x;
+    const int32_t skip = dirtyAreaAbsolute.x - (absoluteRect.x + x);
+    if (skip >= width || absoluteRect.x + x > dirtyAreaAbsolute.right())
+    {
+        return;
+    }
+    float u = left.UOverZ * scanLine.z;
+    float v = left.VOverZ * scanLine.z;
+    if (skip > 0)
+    {
+        x += skip;
+        width -= skip;
+        u += skip * scanLine.dUdX;
+        v += skip * scanLine.dVdX;
+    }
+    if (absoluteRect.x + x + width > dirtyAreaAbsolute.right())
+    {
+        width = dirtyAreaAbsolute.right() - absoluteRect.x - x;
+    }
+    if (width <= 0)
+    {
+        return;
+    }
+
+    uint16_t* dst = dest.address + (absoluteRect.y + left.Y) * dest.stride + absoluteRect.x + x;
+    const fixed16_16 U = floatToFixed16_16(u);
+    const fixed16_16 V = floatToFixed16_16(v);
+
+    // The texture coordinates are linear, so all texels are inside if the first and last are
+    if (isInside(texture, U, V) && isInside(texture, U + (width - 1) * scanLine.fixedDUdX, V + (width - 1) * scanLine.fixedDVdX))
+    {
+        scanLine.drawInside(dst, width, U, V, scanLine.fixedDUdX, scanLine.fixedDVdX, texture, alpha);
+    }
+    else
+    {
+        scanLine.drawChecked(dst, width, U, V, scanLine.fixedDUdX, scanLine.fixedDVdX, texture, alpha);
+    }
+}
+} // namespace
+
+bool TextureMapper::affineDrawingEnabled = true;
+
 TextureMapper::TextureMapper() :
     Widget(),
     currentRenderingAlgorithm(NEAREST_NEIGHBOR),
@@ -323,7 +598,11 @@ void TextureMapper::drawTriangle(const Rect& invalidatedArea, uint16_t* fb, cons
     DisplayTransformation::transformDisplayToFrameBuffer(dirtyArea, this->getRect());
     DisplayTransformation::transformDisplayToFrameBuffer(dirtyAreaAbsolute);
 
+    // Encoded bitmaps must be decoded into a dynamic bitmap, see EncodedBitmap::decode()
+    assert(bitmap.getFormat() != Bitmap::ENCODED && "TextureMapper cannot sample an encoded bitmap");
+
     // Get a pointer to the bitmap data, return if no bitmap found
+    BitmapCache::access(bitmap.getId());
     const uint16_t* textmap = (const uint16_t*)bitmap.getData();
     if (!textmap)
     {
@@ -353,7 +632,173 @@ void TextureMapper::drawTriangle(const Rect& invalidatedArea, uint16_t* fb, cons
     DrawingSurface dest = { fb, HAL::FRAME_BUFFER_WIDTH };
     TextureSurface src = { textmap, bitmap.getAlphaData(), bitmap.getWidth(), bitmap.getHeight(), bitmap.getWidth() };
 
-    HAL::lcd().drawTextureMapTriangle(dest, vertices, src, absoluteRect, dirtyAreaAbsolute, lookupRenderVariant(), alpha, subDivisionSize);
+    if (affineDrawingEnabled && isAffine())
+    {
+        drawTriangleAffine(dest, vertices, src, absoluteRect, dirtyAreaAbsolute);
+    }
+    else
+    {
+        HAL::lcd().drawTextureMapTriangle(dest, vertices, src, absoluteRect, dirtyAreaAbsolute, lookupRenderVariant(), alpha, subDivisionSize);
+    }
+}
+
+bool TextureMapper::isAffine() const
+{
+    // Without rotation around the x and y axes all corners have the same depth
+    if (imageZ0 != imageZ1 || imageZ0 != imageZ2 || imageZ0 != imageZ3)
+    {
+        return false;
+    }
+    if (HAL::DISPLAY_ROTATION != rotate0 || HAL::lcd().bitDepth() != 16)
+    {
+        return false;
+    }
+    const Bitmap::BitmapFormat format = bitmap.getFormat();
+    return format == Bitmap::RGB565 || format == Bitmap::ARGB8888;
+}
+
+void TextureMapper::drawTriangleAffine(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute) const
+{
+    // Reject the same triangles as LCD::drawTextureMapTriangle does
+    const fixed28_4 limit = 10000 * 16;
+    for (int i = 0; i < 3; i++)
+    {
+        if (vertices[i].Z <= 10.0f || vertices[i].X < -limit || vertices[i].X > limit || vertices[i].Y < -limit || vertices[i].Y > limit)
+        {
+            return;
+        }
+    }
+
+    // Sort the vertices in y. The edges and the scan lines covered are exactly those of
+    // LCD::drawTextureMapTriangle.
+    const fixed28_4 y0 = vertices[0].Y;
+    const fixed28_4 y1 = vertices[1].Y;
+    const fixed28_4 y2 = vertices[2].Y;
+    int top, middle, bottom, middleForCompare, bottomForCompare;
+    if (y0 < y1)
+    {
+        if (y2 < y0)
+        {
+            top = 2;
+            middle = 0;
+            bottom = 1;
+            middleForCompare = 0;
+            bottomForCompare = 1;
+        }
+        else
+        {
+            top = 0;
+            if (y1 < y2)
+            {
+                middle = 1;
+                bottom = 2;
+                middleForCompare = 1;
+                bottomForCompare = 2;
+            }
+            else
+            {
+                middle = 2;
+                bottom = 1;
+                middleForCompare = 2;
+                bottomForCompare = 1;
+            }
+        }
+    }
+    else
+    {
+        if (y2 < y1)
+        {
+            top = 2;
+            middle = 1;
+            bottom = 0;
+            middleForCompare = 1;
+            bottomForCompare = 0;
+        }
+        else
+        {
+            top = 1;
+            if (y0 < y2)
+            {
+                middle = 0;
+                bottom = 2;
+                middleForCompare = 3;
+                bottomForCompare = 2;
+            }
+            else
+            {
+                middle = 2;
+                bottom = 0;
+                middleForCompare = 2;
+                bottomForCompare = 3;
+            }
+        }
+    }
+
+    const Gradients gradients(vertices);
+    Edge topToBottom(gradients, vertices, top, bottom);
+    Edge topToMiddle(gradients, vertices, top, middle);
+    Edge middleToBottom(gradients, vertices, middle, bottom);
+    const bool middleIsLeft = bottomForCompare <= middleForCompare;
+
+    // The depth is constant, so u/z and v/z only need scaling by z
+    AffineScanLine scanLine;
+    scanLine.z = vertices[0].Z;
+    scanLine.dUdX = gradients.dUOverZdX * scanLine.z;
+    scanLine.dVdX = gradients.dVOverZdX * scanLine.z;
+    scanLine.fixedDUdX = floatToFixed16_16(scanLine.dUdX);
+    scanLine.fixedDVdX = floatToFixed16_16(scanLine.dVdX);
+    const bool bilinear = currentRenderingAlgorithm == BILINEAR_INTERPOLATION;
+    if (bitmap.getFormat() == Bitmap::ARGB8888)
+    {
+        scanLine.drawInside = bilinear ? drawAffineSpan<BilinearARGB8888, false> : drawAffineSpan<NearestNeighborARGB8888, false>;
+        scanLine.drawChecked = bilinear ? drawAffineSpan<BilinearARGB8888, true> : drawAffineSpan<NearestNeighborARGB8888, true>;
+    }
+    else if (texture.alphaChannel != 0)
+    {
+        scanLine.drawInside = bilinear ? drawAffineSpan<BilinearRGB565Alpha, false> : drawAffineSpan<NearestNeighborRGB565Alpha, false>;
+        scanLine.drawChecked = bilinear ? drawAffineSpan<BilinearRGB565Alpha, true> : drawAffineSpan<NearestNeighborRGB565Alpha, true>;
+    }
+    else
+    {
+        scanLine.drawInside = bilinear ? drawAffineSpan<BilinearRGB565, false> : drawAffineSpan<NearestNeighborRGB565, false>;
+        scanLine.drawChecked = bilinear ? drawAffineSpan<BilinearRGB565, true> : drawAffineSpan<NearestNeighborRGB565, true>;
+    }
+
+    for (int part = 0; part < 2; part++)
+    {
+        Edge& shortEdge = (part == 0) ? topToMiddle : middleToBottom;
+        Edge& left = middleIsLeft ? shortEdge : topToBottom;
+        Edge& right = middleIsLeft ? topToBottom : shortEdge;
+
+        // Skip the scan lines above the dirty area
+        int height = shortEdge.height;
+        int skip = 0;
+        if (left.Y + absoluteRect.y >= dirtyAreaAbsolute.bottom())
+        {
+            skip = height;
+        }
+        else if (left.Y + absoluteRect.y < dirtyAreaAbsolute.y && height > 0)
+        {
+            skip = MIN(dirtyAreaAbsolute.y - (absoluteRect.y + left.Y), height);
+        }
+        if (skip > 0)
+        {
+            shortEdge.step(skip);
+            topToBottom.step(skip);
+            height -= skip;
+        }
+
+        while (height-- > 0)
+        {
+            drawAffineScanLine(dest, scanLine, left, right, texture, absoluteRect, dirtyAreaAbsolute, alpha);
+            if (left.Y + absoluteRect.y + 1 >= dirtyAreaAbsolute.bottom())
+            {
+                return;
+            }
+            shortEdge.step();
+            topToBottom.step();
+        }
+    }
 }
 
 RenderingVariant TextureMapper::lookupRenderVariant() const
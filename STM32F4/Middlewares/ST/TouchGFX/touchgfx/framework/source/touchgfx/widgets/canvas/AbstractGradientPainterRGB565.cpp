@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/widgets/canvas/AbstractGradientPainterRGB565.hpp>
+
+namespace touchgfx
+{
+AbstractGradientPainterRGB565::AbstractGradientPainterRGB565(colortype startColor, colortype endColor) :
+    AbstractPainterRGB565(), startColor(startColor), endColor(endColor), startAlpha(255), endAlpha(255)
+{
+    updateGradient();
+}
+
+void AbstractGradientPainterRGB565::setStartColor(colortype color, uint8_t alpha)
+{
+    startColor = color;
+    startAlpha = alpha;
+    updateGradient();
+}
+
+void AbstractGradientPainterRGB565::setEndColor(colortype color, uint8_t alpha)
+{
+    endColor = color;
+    endAlpha = alpha;
+    updateGradient();
+}
+
+touchgfx::colortype AbstractGradientPainterRGB565::getStartColor() const
+{
+    return startColor;
+}
+
+touchgfx::colortype AbstractGradientPainterRGB565::getEndColor() const
+{
+    return endColor;
+}
+
+bool AbstractGradientPainterRGB565::renderGradientColor(int position, uint8_t& red, uint8_t& green, uint8_t& blue, uint8_t& alpha) const
+{
+    const uint32_t color = getGradientColor(position);
+    red = static_cast<uint8_t>(color >> 16);
+    green = static_cast<uint8_t>(color >> 8);
+    blue = static_cast<uint8_t>(color);
+    alpha = static_cast<uint8_t>(color >> 24);
+    return true;
+}
+
+void AbstractGradientPainterRGB565::updateGradient()
+{
+    const uint16_t start = static_cast<uint16_t>(startColor);
+    const uint16_t end = static_cast<uint16_t>(endColor);
+    painterRed = (start & RMASK) >> 8;
+    painterGreen = (start & GMASK) >> 3;
+    painterBlue = (start & BMASK) << 3;
+    painterAlpha = startAlpha;
+    deltaRed = ((end & RMASK) >> 8) - painterRed;
+    deltaGreen = ((end & GMASK) >> 3) - painterGreen;
+    deltaBlue = ((end & BMASK) << 3) - painterBlue;
+    deltaAlpha = endAlpha - painterAlpha;
+}
+} // namespace touchgfx
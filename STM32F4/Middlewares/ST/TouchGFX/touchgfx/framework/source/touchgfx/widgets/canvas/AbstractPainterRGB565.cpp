@@ -29,44 +29,99 @@ void AbstractPainterRGB565::render(uint8_t* ptr,
 
     currentX = x + areaOffsetX;
     currentY = y + areaOffsetY;
-    if (renderInit())
+    if (!renderInit())
     {
-        do
+        return;
+    }
+
+    uint32_t colors[SPAN_LENGTH];
+    unsigned length = MIN(count, SPAN_LENGTH);
+    if (renderSpan(colors, length))
+    {
+        for (;;)
         {
-            uint8_t red, green, blue, alpha;
-            if (renderNext(red, green, blue, alpha))
+            for (unsigned i = 0; i < length; i++)
             {
+                const uint32_t color = colors[i];
+                uint32_t alpha = color >> 24;
                 if (widgetAlpha < 255)
                 {
-                    alpha = static_cast<uint8_t>((alpha * widgetAlpha) / 255);
+                    alpha = (alpha * widgetAlpha) / 255;
                 }
-                uint32_t combinedAlpha = (*covers) * alpha;
-                covers++;
+                const uint32_t combinedAlpha = covers[i] * alpha;
 
-                if (combinedAlpha == (255u * 255u)) // max alpha=255 on "*covers" and max alpha=255 on "widgetAlpha"
+                if (combinedAlpha == (255u * 255u))
                 {
                     // Render a solid pixel
-                    renderPixel(p, red, green, blue);
+                    p[i] = static_cast<uint16_t>(((color >> 8) & RMASK) | ((color >> 5) & GMASK) | ((color >> 3) & BMASK));
                 }
-                else
+                else if (combinedAlpha != 0)
                 {
-                    uint8_t p_red = (*p & 0xF800) >> 8;
+                    // Same blend as renderNext() followed by renderPixel()
+                    const int red = (color >> 16) & 0xFF;
+                    const int green = (color >> 8) & 0xFF;
+                    const int blue = color & 0xFF;
+                    int p_red = (p[i] & 0xF800) >> 8;
                     p_red |= p_red >> 5;
-                    uint8_t p_green = (*p & 0x07E0) >> 3;
+                    int p_green = (p[i] & 0x07E0) >> 3;
                     p_green |= p_green >> 6;
-                    uint8_t p_blue = (*p & 0x001F) << 3;
+                    int p_blue = (p[i] & 0x001F) << 3;
                     p_blue |= p_blue >> 5;
-                    renderPixel(p,
-                                static_cast<uint8_t>((((red - p_red)   * combinedAlpha) + (p_red << 16)) >> 16),
-                                static_cast<uint8_t>((((green - p_green) * combinedAlpha) + (p_green << 16)) >> 16),
-                                static_cast<uint8_t>((((blue - p_blue)  * combinedAlpha) + (p_blue << 16)) >> 16));
+                    p_red = (((red - p_red) * static_cast<int>(combinedAlpha)) + (p_red << 16)) >> 16;
+                    p_green = (((green - p_green) * static_cast<int>(combinedAlpha)) + (p_green << 16)) >> 16;
+                    p_blue = (((blue - p_blue) * static_cast<int>(combinedAlpha)) + (p_blue << 16)) >> 16;
+                    p[i] = static_cast<uint16_t>(((p_red << 8) & RMASK) | ((p_green << 3) & GMASK) | ((p_blue >> 3) & BMASK));
                 }
             }
-            p++;
-            currentX++;
+            count -= length;
+            if (count == 0)
+            {
+                break;
+            }
+            p += length;
+            covers += length;
+            currentX += length;
+            length = MIN(count, SPAN_LENGTH);
+            renderSpan(colors, length);
+        }
+        return;
+    }
+
+    do
+    {
+        uint8_t red, green, blue, alpha;
+        if (renderNext(red, green, blue, alpha))
+        {
+            if (widgetAlpha < 255)
+            {
+                alpha = static_cast<uint8_t>((alpha * widgetAlpha) / 255);
+            }
+            uint32_t combinedAlpha = (*covers) * alpha;
+
+            if (combinedAlpha == (255u * 255u)) // max alpha=255 on "*covers" and max alpha=255 on "widgetAlpha"
+            {
+                // Render a solid pixel
+                renderPixel(p, red, green, blue);
+            }
+            else
+            {
+                uint8_t p_red = (*p & 0xF800) >> 8;
+                p_red |= p_red >> 5;
+                uint8_t p_green = (*p & 0x07E0) >> 3;
+                p_green |= p_green >> 6;
+                uint8_t p_blue = (*p & 0x001F) << 3;
+                p_blue |= p_blue >> 5;
+                renderPixel(p,
+                            static_cast<uint8_t>((((red - p_red)   * combinedAlpha) + (p_red << 16)) >> 16),
+                            static_cast<uint8_t>((((green - p_green) * combinedAlpha) + (p_green << 16)) >> 16),
+                            static_cast<uint8_t>((((blue - p_blue)  * combinedAlpha) + (p_blue << 16)) >> 16));
+            }
         }
-        while (--count != 0);
+        covers++;
+        p++;
+        currentX++;
     }
+    while (--count != 0);
 }
 
 void AbstractPainterRGB565::renderPixel(uint16_t* p, uint8_t red, uint8_t green, uint8_t blue)
@@ -29,41 +29,93 @@ void AbstractPainterRGB888::render(uint8_t* ptr,
 
     currentX = x + areaOffsetX;
     currentY = y + areaOffsetY;
-    if (renderInit())
+    if (!renderInit())
     {
-        do
+        return;
+    }
+
+    uint32_t colors[SPAN_LENGTH];
+    unsigned length = MIN(count, SPAN_LENGTH);
+    if (renderSpan(colors, length))
+    {
+        for (;;)
         {
-            uint8_t red, green, blue, alpha;
-            if (renderNext(red, green, blue, alpha))
+            for (unsigned i = 0; i < length; i++, p += 3)
             {
+                const uint32_t color = colors[i];
+                uint32_t alpha = color >> 24;
                 if (widgetAlpha < 255)
                 {
-                    alpha = static_cast<uint8_t>((alpha * widgetAlpha) / 255);
+                    alpha = (alpha * widgetAlpha) / 255;
                 }
-                uint32_t combinedAlpha = (*covers) * alpha;
-                covers++;
+                const uint32_t combinedAlpha = covers[i] * alpha;
 
-                if (combinedAlpha == (255u * 255u)) // max alpha=255 on "*covers" and max alpha=255 on "widgetAlpha"
+                if (combinedAlpha == (255u * 255u))
                 {
                     // Render a solid pixel
-                    renderPixel(reinterpret_cast<uint16_t*>(p), red, green, blue);
+                    p[0] = static_cast<uint8_t>(color);
+                    p[1] = static_cast<uint8_t>(color >> 8);
+                    p[2] = static_cast<uint8_t>(color >> 16);
                 }
-                else
+                else if (combinedAlpha != 0)
                 {
-                    uint8_t p_blue = p[0];
-                    uint8_t p_green = p[1];
-                    uint8_t p_red = p[2];
-                    renderPixel(reinterpret_cast<uint16_t*>(p),
-                                static_cast<uint8_t>((((red - p_red)   * combinedAlpha) + (p_red << 16)) >> 16),
-                                static_cast<uint8_t>((((green - p_green) * combinedAlpha) + (p_green << 16)) >> 16),
-                                static_cast<uint8_t>((((blue - p_blue)  * combinedAlpha) + (p_blue << 16)) >> 16));
+                    // Same blend as renderNext() followed by renderPixel()
+                    const int red = (color >> 16) & 0xFF;
+                    const int green = (color >> 8) & 0xFF;
+                    const int blue = color & 0xFF;
+                    const int p_blue = p[0];
+                    const int p_green = p[1];
+                    const int p_red = p[2];
+                    p[0] = static_cast<uint8_t>((((blue - p_blue) * static_cast<int>(combinedAlpha)) + (p_blue << 16)) >> 16);
+                    p[1] = static_cast<uint8_t>((((green - p_green) * static_cast<int>(combinedAlpha)) + (p_green << 16)) >> 16);
+                    p[2] = static_cast<uint8_t>((((red - p_red) * static_cast<int>(combinedAlpha)) + (p_red << 16)) >> 16);
                 }
             }
-            p += 3;
-            currentX++;
+            count -= length;
+            if (count == 0)
+            {
+                break;
+            }
+            covers += length;
+            currentX += length;
+            length = MIN(count, SPAN_LENGTH);
+            renderSpan(colors, length);
+        }
+        return;
+    }
+
+    do
+    {
+        uint8_t red, green, blue, alpha;
+        if (renderNext(red, green, blue, alpha))
+        {
+            if (widgetAlpha < 255)
+            {
+                alpha = static_cast<uint8_t>((alpha * widgetAlpha) / 255);
+            }
+            uint32_t combinedAlpha = (*covers) * alpha;
+
+            if (combinedAlpha == (255u * 255u)) // max alpha=255 on "*covers" and max alpha=255 on "widgetAlpha"
+            {
+                // Render a solid pixel
+                renderPixel(reinterpret_cast<uint16_t*>(p), red, green, blue);
+            }
+            else
+            {
+                uint8_t p_blue = p[0];
+                uint8_t p_green = p[1];
+                uint8_t p_red = p[2];
+                renderPixel(reinterpret_cast<uint16_t*>(p),
+                            static_cast<uint8_t>((((red - p_red)   * combinedAlpha) + (p_red << 16)) >> 16),
+                            static_cast<uint8_t>((((green - p_green) * combinedAlpha) + (p_green << 16)) >> 16),
+                            static_cast<uint8_t>((((blue - p_blue)  * combinedAlpha) + (p_blue << 16)) >> 16));
+            }
         }
-        while (--count != 0);
+        covers++;
+        p += 3;
+        currentX++;
     }
+    while (--count != 0);
 }
 
 void AbstractPainterRGB888::renderPixel(uint16_t* p, uint8_t red, uint8_t green, uint8_t blue)
@@ -17,6 +17,9 @@
 
 namespace touchgfx
 {
+CellEstimator* Canvas::cellEstimator[RenderWorkers::MAX_WORKERS] = { 0 };
+bool Canvas::verticalClippingDisabled[RenderWorkers::MAX_WORKERS] = { false };
+
 Canvas::Canvas(const CanvasWidget* _widget, const Rect& invalidatedArea) : widget(_widget),
     enoughMemory(false), penUp(true), penHasBeenDown(false), previousOutside(0), penDownOutside(0)
 {
@@ -46,6 +49,12 @@ Canvas::Canvas(const CanvasWidget* _widget, const Rect& invalidatedArea) : widge
     invalidatedAreaWidth = CWRUtil::toQ5<int>(dirtyArea.width);
     invalidatedAreaHeight = CWRUtil::toQ5<int>(dirtyArea.height);
 
+    if (getCellEstimator())
+    {
+        // Only the outline is needed for estimating the number of cells
+        return;
+    }
+
     // Create the rendering buffer
     uint8_t* RESTRICT buf = reinterpret_cast<uint8_t*>(HAL::getInstance()->lockFrameBuffer());
     int stride = 0;
@@ -79,7 +88,10 @@ Canvas::Canvas(const CanvasWidget* _widget, const Rect& invalidatedArea) : widge
 
 Canvas::~Canvas()
 {
-    HAL::getInstance()->unlockFrameBuffer(); //lint !e1551
+    if (!getCellEstimator())
+    {
+        HAL::getInstance()->unlockFrameBuffer(); //lint !e1551
+    }
 }
 
 void Canvas::moveTo(CWRUtil::Q5 x, CWRUtil::Q5 y)
@@ -107,7 +119,7 @@ void Canvas::moveTo(CWRUtil::Q5 x, CWRUtil::Q5 y)
     else
     {
         penDownOutside = outside;
-        ras.moveTo(x, y);
+        outlineMoveTo(x, y);
         penUp = false;
         penHasBeenDown = true;
     }
@@ -135,7 +147,7 @@ void Canvas::lineTo(CWRUtil::Q5 x, CWRUtil::Q5 y)
 
     if (!previousOutside)
     {
-        ras.lineTo(x, y);
+        outlineLineTo(x, y);
     }
     else
     {
@@ -145,15 +157,15 @@ void Canvas::lineTo(CWRUtil::Q5 x, CWRUtil::Q5 y)
             if (penUp)
             {
                 penDownOutside = previousOutside;
-                ras.moveTo(previousX, previousY);
+                outlineMoveTo(previousX, previousY);
                 penUp = false;
                 penHasBeenDown = true;
             }
             else
             {
-                ras.lineTo(previousX, previousY);
+                outlineLineTo(previousX, previousY);
             }
-            ras.lineTo(x, y);
+            outlineLineTo(x, y);
         }
         else
         {
@@ -187,6 +199,14 @@ bool Canvas::render()
         return true; // Nothing drawn. Done
     }
 
+    CellEstimator* estimator = getCellEstimator();
+    if (estimator)
+    {
+        close();
+        estimator->close();
+        return true; // Cells counted. Done
+    }
+
     if (widget->getAlpha() == 0)
     {
         return true; // Invisible. Done
@@ -204,7 +224,11 @@ uint8_t Canvas::isOutside(const CWRUtil::Q5& x, const CWRUtil::Q5& y, const CWRU
 {
     uint8_t outside = 0;
     // Find out if (x,y) is above/below of current area
-    if (y < 0)
+    if (verticalClippingDisabled[RenderWorkers::getCurrentWorker()])
+    {
+        // Let the Outline discard the cells above/below
+    }
+    else if (y < 0)
     {
         outside = POINT_IS_ABOVE;
     }
@@ -238,6 +262,32 @@ void Canvas::transformFrameBufferToDisplay(CWRUtil::Q5& x, CWRUtil::Q5& y) const
     }
 }
 
+void Canvas::outlineMoveTo(int x, int y)
+{
+    CellEstimator* estimator = getCellEstimator();
+    if (estimator)
+    {
+        estimator->moveTo(x, y);
+    }
+    else
+    {
+        ras.moveTo(x, y);
+    }
+}
+
+void Canvas::outlineLineTo(int x, int y)
+{
+    CellEstimator* estimator = getCellEstimator();
+    if (estimator)
+    {
+        estimator->lineTo(x, y);
+    }
+    else
+    {
+        ras.lineTo(x, y);
+    }
+}
+
 void Canvas::close()
 {
     if (!penUp)
@@ -252,9 +302,9 @@ void Canvas::close()
         {
             if (previousOutside)
             {
-                ras.lineTo(previousX, previousY);
+                outlineLineTo(previousX, previousY);
             }
-            ras.lineTo(initialX, initialY);
+            outlineLineTo(initialX, initialY);
         }
     }
     penUp = false;
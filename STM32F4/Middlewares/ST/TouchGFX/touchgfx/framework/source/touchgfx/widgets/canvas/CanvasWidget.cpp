@@ -14,7 +14,11 @@
   */
 
 #include <touchgfx/widgets/canvas/CanvasWidget.hpp>
+#include <touchgfx/widgets/canvas/Canvas.hpp>
+#include <touchgfx/canvas_widget_renderer/CanvasWidgetRenderer.hpp>
+#include <touchgfx/canvas_widget_renderer/CellEstimator.hpp>
 #include <touchgfx/Utils.hpp>
+#include <touchgfx/hal/RenderWorkers.hpp>
 
 namespace touchgfx
 {
@@ -43,88 +47,150 @@ AbstractPainter& CanvasWidget::getPainter() const
 
 void CanvasWidget::draw(const Rect& invalidatedArea) const
 {
-    Rect area = invalidatedArea;
+    Rect area = invalidatedArea & getMinimalRect();
+    if (area.isEmpty())
+    {
+        return;
+    }
 
-    int16_t* offset;
-    int16_t* lines;
-    int16_t* width;
-    int16_t* height;
+    // The painter may be shared with canvas widgets drawn by other render workers
+    RenderWorkers::lockObject(canvasPainter);
+    drawArea(area);
+    RenderWorkers::unlockObject(canvasPainter);
+}
 
-    int16_t wantedRenderLines;
+void CanvasWidget::drawArea(const Rect& area) const
+{
+    // Unless the widget has been too complex to draw in this many lines before, just draw it
+    const int16_t numLines = (HAL::DISPLAY_ROTATION == rotate90) ? area.width : area.height;
+    if (numLines <= maxRenderLines && drawCanvasWidget(area))
+    {
+        return;
+    }
+
+#ifdef SIMULATOR
+    if (CanvasWidgetRenderer::getWriteMemoryUsageReport())
+    {
+        touchgfx_printf("CWR will split draw into multiple draws due to limited memory.\n");
+    }
+#endif
+    if (!drawTiles(area))
+    {
+        drawSlices(area);
+    }
+}
 
-    switch (HAL::DISPLAY_ROTATION)
+bool CanvasWidget::drawTiles(const Rect& area) const
+{
+    // All tiles have the same scanline width and thereby room for the same number of cells
+    const bool rotated = HAL::DISPLAY_ROTATION == rotate90;
+    const int16_t numLines = rotated ? area.width : area.height;
+    if (!CanvasWidgetRenderer::setScanlineWidth(rotated ? area.height : area.width))
+    {
+        return false;
+    }
+    const unsigned outlineBufferSize = CanvasWidgetRenderer::getOutlineBufferSize();
+    if (numLines * sizeof(unsigned) > outlineBufferSize)
     {
-    default:
-    case rotate0:
-        offset = &area.y;
-        lines = &area.height;
-        width = &area.width;
-        height = &wantedRenderLines;
-        break;
-    case rotate90:
-        offset = &area.x;
-        lines = &area.width;
-        width = &wantedRenderLines;
-        height = &area.height;
-        break;
+        return false;
     }
+    const unsigned maxCells = outlineBufferSize / sizeof(Cell);
 
-    Rect minimalRect = getMinimalRect();
+    // The outline buffer is not used before the tiles are drawn, so the estimate is kept there
+    unsigned* cellsPerLine = reinterpret_cast<unsigned*>(CanvasWidgetRenderer::getOutlineBuffer());
 
-    bool failedAtLeastOnce = false;
-    while (*lines)
+    // Without vertical clipping, each tile gets exactly the lines counted by the estimate
+    Canvas::setVerticalClipping(false);
+    int16_t line = 0;
+    while (line < numLines)
     {
-        wantedRenderLines = MIN(maxRenderLines, *lines);
+        const int16_t remainingLines = numLines - line;
+        CellEstimator estimator(cellsPerLine, remainingLines);
+        Canvas::setCellEstimator(&estimator);
+        drawCanvasWidget(getLines(area, line, remainingLines));
+        Canvas::setCellEstimator(0);
 
-        while (wantedRenderLines > 0)
+        // Plan as many tiles as possible before drawing destroys the estimate. Room is left
+        // after the cells of a tile for the row counters of Outline::radixSortCells().
+        int16_t tileLines[MAX_TILES];
+        int numTiles = 0;
+        int16_t tileStart = 0;
+        unsigned tileCells = 0;
+        for (int16_t i = 0; i < remainingLines && numTiles < MAX_TILES; i++)
         {
-            Rect smallArea(area.x, area.y, *width, *height);
-            if (!smallArea.intersect(minimalRect))
+            const unsigned counterCells = ((i - tileStart + 1) * sizeof(uint16_t) + sizeof(Cell) - 1) / sizeof(Cell);
+            if (i > tileStart && tileCells + cellsPerLine[i] + counterCells > maxCells)
             {
-                break;
+                // Drawing more lines than this would not have worked
+                maxRenderLines = MIN(maxRenderLines, i - tileStart);
+                tileLines[numTiles++] = i - tileStart;
+                tileStart = i;
+                tileCells = 0;
             }
-            if (drawCanvasWidget(smallArea))
+            tileCells += cellsPerLine[i];
+        }
+        if (numTiles < MAX_TILES)
+        {
+            tileLines[numTiles++] = remainingLines - tileStart;
+        }
+
+        for (int i = 0; i < numTiles; i++)
+        {
+            const Rect tile = getLines(area, line, tileLines[i]);
+            if (!drawCanvasWidget(tile))
             {
-                break;
+                // A single line with too many cells, or a very unlucky estimate
+                drawSlices(tile);
             }
+            line += tileLines[i];
+        }
+    }
+    Canvas::setVerticalClipping(true);
+    return true;
+}
+
+void CanvasWidget::drawSlices(const Rect& area) const
+{
+    const bool rotated = HAL::DISPLAY_ROTATION == rotate90;
+    const int16_t numLines = rotated ? area.width : area.height;
+    int16_t line = 0;
+    while (line < numLines)
+    {
+        int16_t wantedRenderLines = MIN(maxRenderLines, numLines - line);
+        bool failed = false;
+        while (wantedRenderLines > 0 && !drawCanvasWidget(getLines(area, line, wantedRenderLines)))
+        {
 #ifdef SIMULATOR
-            if (CanvasWidgetRenderer::getWriteMemoryUsageReport())
+            if (CanvasWidgetRenderer::getWriteMemoryUsageReport() && wantedRenderLines == 1)
             {
-                if (wantedRenderLines > 1)
-                {
-                    touchgfx_printf("CWR will split draw into multiple draws due to limited memory.\n");
-                }
-                else
-                {
-                    touchgfx_printf("CWR was unable to complete a draw operation due to limited memory.\n");
-                }
+                touchgfx_printf("CWR was unable to complete a draw operation due to limited memory.\n");
             }
 #endif
             wantedRenderLines >>= 1;
-            failedAtLeastOnce = true;
+            failed = true;
         }
         if (wantedRenderLines == 0)
         {
-            // We did not manage to draw anything. Set wantedHeight to
-            // one to skip a single raster line and try to render the
-            // rest of the CanvasWidget.
+            // We did not manage to draw anything. Skip a single raster
+            // line and try to render the rest of the CanvasWidget.
             wantedRenderLines = 1;
         }
-        else
+        else if (failed)
         {
-            if (failedAtLeastOnce && maxRenderLines == 0x7FFF)
-            {
-                // Only adjust maxRenderLines if it is the first draw for the CanvasWidget
-                maxRenderLines = wantedRenderLines;
-            }
+            maxRenderLines = wantedRenderLines;
         }
-        *offset += wantedRenderLines;
-        *lines -= wantedRenderLines;
+        line += wantedRenderLines;
     }
-    if (maxRenderLines == 0x7FFF)
+}
+
+Rect CanvasWidget::getLines(const Rect& area, int16_t firstLine, int16_t numLines) const
+{
+    if (HAL::DISPLAY_ROTATION == rotate90)
     {
-        maxRenderLines--;    // 0x7FFF means first draw
+        // Frame buffer lines run from right to left on the display
+        return Rect(area.right() - firstLine - numLines, area.y, numLines, area.height);
     }
+    return Rect(area.x, area.y + firstLine, area.width, numLines);
 }
 
 void CanvasWidget::invalidate() const
@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/widgets/canvas/PainterRGB565LinearGradient.hpp>
+
+namespace touchgfx
+{
+namespace
+{
+/**
+ * Limits a position in 1/65536 of the gradient to the gradient, and converts it to
+ * 0..GRADIENT_END.
+ */
+FORCE_INLINE_FUNCTION int gradientPosition(int32_t position)
+{
+    if (position <= 0)
+    {
+        return 0;
+    }
+    if (position >= 0x10000)
+    {
+        return AbstractGradientPainterRGB565::GRADIENT_END;
+    }
+    return (position + 0x80) >> 8;
+}
+} // namespace
+
+PainterRGB565LinearGradient::PainterRGB565LinearGradient(colortype startColor, colortype endColor) :
+    AbstractGradientPainterRGB565(startColor, endColor)
+{
+    setGradient(0, 0, GRADIENT_END, 0);
+}
+
+void PainterRGB565LinearGradient::setGradient(int16_t startX, int16_t startY, int16_t endX, int16_t endY)
+{
+    gradientStartX = startX;
+    gradientStartY = startY;
+
+    // The position of (x, y) is the projection of (x - startX, y - startY) on the line,
+    // divided by the length of the line, which is linear in both x and y
+    const int64_t dx = endX - startX;
+    const int64_t dy = endY - startY;
+    const int64_t lengthSquared = dx * dx + dy * dy;
+    stepX = lengthSquared == 0 ? 0 : static_cast<int32_t>((dx << 16) / lengthSquared);
+    stepY = lengthSquared == 0 ? 0 : static_cast<int32_t>((dy << 16) / lengthSquared);
+}
+
+bool PainterRGB565LinearGradient::renderNext(uint8_t& red, uint8_t& green, uint8_t& blue, uint8_t& alpha)
+{
+    return renderGradientColor(gradientPosition(getPosition(currentX, currentY)), red, green, blue, alpha);
+}
+
+bool PainterRGB565LinearGradient::renderSpan(uint32_t* colors, unsigned count)
+{
+    int32_t position = getPosition(currentX, currentY);
+    const int32_t last = position + stepX * static_cast<int32_t>(count - 1);
+    if ((position <= 0 && last <= 0) || (position >= 0x10000 && last >= 0x10000))
+    {
+        // The whole span is outside the gradient
+        const uint32_t color = getGradientColor(gradientPosition(position));
+        for (unsigned i = 0; i < count; i++)
+        {
+            colors[i] = color;
+        }
+        return true;
+    }
+
+    for (unsigned i = 0; i < count; i++)
+    {
+        colors[i] = getGradientColor(gradientPosition(position));
+        position += stepX;
+    }
+    return true;
+}
+} // namespace touchgfx
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <touchgfx/widgets/canvas/PainterRGB565RadialGradient.hpp>
+#include <math.h>
+#include <stdlib.h>
+
+namespace touchgfx
+{
+PainterRGB565RadialGradient::PainterRGB565RadialGradient(colortype startColor, colortype endColor) :
+    AbstractGradientPainterRGB565(startColor, endColor)
+{
+    setGradient(0, 0, GRADIENT_END);
+}
+
+void PainterRGB565RadialGradient::setGradient(int16_t centerX, int16_t centerY, uint16_t radius)
+{
+    assert(radius <= MAX_RADIUS && "The radius of the gradient is too large");
+    gradientCenterX = centerX;
+    gradientCenterY = centerY;
+    radiusSquared = static_cast<uint32_t>(radius) * radius;
+    positionScale = radius == 0 ? 0.0f : static_cast<float>(GRADIENT_END) / radius;
+}
+
+int PainterRGB565RadialGradient::getPosition(uint32_t distanceSquared) const
+{
+    if (distanceSquared >= radiusSquared)
+    {
+        return GRADIENT_END;
+    }
+    return static_cast<int>(sqrtf(static_cast<float>(distanceSquared)) * positionScale + 0.5f);
+}
+
+bool PainterRGB565RadialGradient::renderNext(uint8_t& red, uint8_t& green, uint8_t& blue, uint8_t& alpha)
+{
+    const int dx = abs(currentX - gradientCenterX);
+    const int dy = abs(currentY - gradientCenterY);
+    const int position = (dx > MAX_RADIUS || dy > MAX_RADIUS) ? static_cast<int>(GRADIENT_END) : getPosition(dx * dx + dy * dy);
+    return renderGradientColor(position, red, green, blue, alpha);
+}
+
+bool PainterRGB565RadialGradient::renderSpan(uint32_t* colors, unsigned count)
+{
+    const uint32_t outsideColor = getGradientColor(GRADIENT_END);
+    const int dy = abs(currentY - gradientCenterY);
+    if (dy > MAX_RADIUS || static_cast<uint32_t>(dy * dy) >= radiusSquared)
+    {
+        // The whole span is outside the radius
+        for (unsigned i = 0; i < count; i++)
+        {
+            colors[i] = outsideColor;
+        }
+        return true;
+    }
+
+    const uint32_t dySquared = dy * dy;
+    int dx = currentX - gradientCenterX;
+    for (unsigned i = 0; i < count; i++, dx++)
+    {
+        const int distanceX = abs(dx);
+        colors[i] = distanceX > MAX_RADIUS ? outsideColor : getGradientColor(getPosition(distanceX * distanceX + dySquared));
+    }
+    return true;
+}
+} // namespace touchgfx
@@ -0,0 +1,291 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#include <BitmapEncoder.hpp>
+#include <map>
+#include <string.h>
+
+namespace touchgfx
+{
+namespace
+{
+const uint32_t LZ4_MIN_MATCH = 4;
+const uint32_t LZ4_LAST_LITERALS = 5;  // The last bytes of a block are always literals
+const uint32_t LZ4_MATCH_LIMIT = 12;   // The last match starts at least this far from the end
+const uint32_t LZ4_MAX_OFFSET = 65535;
+const int LZ4_HASH_BITS = 12;
+
+uint32_t read32(const uint8_t* bytes)
+{
+    uint32_t value;
+    memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+uint32_t hash(uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32 - LZ4_HASH_BITS);
+}
+
+uint16_t toRGB565(uint32_t argb)
+{
+    return static_cast<uint16_t>(((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F));
+}
+
+bool isOpaque(const uint32_t* pixels, uint32_t numberOfPixels)
+{
+    for (uint32_t i = 0; i < numberOfPixels; i++)
+    {
+        if ((pixels[i] >> 24) != 0xFF)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t countColors(const uint32_t* pixels, uint32_t numberOfPixels, uint32_t maxColors)
+{
+    std::map<uint32_t, uint8_t> colors;
+    for (uint32_t i = 0; i < numberOfPixels && colors.size() <= maxColors; i++)
+    {
+        colors[pixels[i]] = 0;
+    }
+    return static_cast<uint32_t>(colors.size());
+}
+} // namespace
+
+bool BitmapEncoder::canEncode(const uint32_t* pixels, uint16_t width, uint16_t height, EncodedBitmap::Encoding encoding)
+{
+    const uint32_t numberOfPixels = static_cast<uint32_t>(width) * height;
+    switch (encoding)
+    {
+    case EncodedBitmap::L8:
+        return countColors(pixels, numberOfPixels, 256) <= 256;
+    case EncodedBitmap::RGB565_RLE:
+        return isOpaque(pixels, numberOfPixels);
+    case EncodedBitmap::ARGB8888_LZ4:
+        return width <= EncodedBitmap::MAX_LZ4_WIDTH;
+    }
+    return false;
+}
+
+bool BitmapEncoder::encode(const uint32_t* pixels, uint16_t width, uint16_t height, EncodedBitmap::Encoding encoding, std::vector<uint8_t>& data)
+{
+    if (!canEncode(pixels, width, height, encoding))
+    {
+        return false;
+    }
+
+    const uint32_t numberOfPixels = static_cast<uint32_t>(width) * height;
+    data.clear();
+    data.push_back(static_cast<uint8_t>(encoding));
+    data.push_back(isOpaque(pixels, numberOfPixels) ? 0 : EncodedBitmap::TRANSPARENT_PIXELS);
+    data.push_back(0); // The palette size, set by encodeL8()
+    data.push_back(0);
+
+    if (encoding == EncodedBitmap::L8)
+    {
+        encodeL8(pixels, numberOfPixels, data);
+        return true;
+    }
+
+    // The line offsets are relative to the first line, which follows the offsets
+    std::vector<uint8_t> lines;
+    std::vector<uint32_t> offsets;
+    for (uint16_t y = 0; y < height; y++)
+    {
+        offsets.push_back(lines.size());
+        if (encoding == EncodedBitmap::RGB565_RLE)
+        {
+            encodeRGB565RLE(pixels + y * width, width, lines);
+        }
+        else
+        {
+            encodeARGB8888LZ4(pixels + y * width, width, lines);
+        }
+    }
+    offsets.push_back(lines.size());
+    for (uint32_t i = 0; i < offsets.size(); i++)
+    {
+        writeUint32(data, offsets[i]);
+    }
+    data.insert(data.end(), lines.begin(), lines.end());
+    return true;
+}
+
+EncodedBitmap::Encoding BitmapEncoder::encodeSmallest(const uint32_t* pixels, uint16_t width, uint16_t height, std::vector<uint8_t>& data)
+{
+    static const EncodedBitmap::Encoding encodings[] = { EncodedBitmap::L8, EncodedBitmap::RGB565_RLE, EncodedBitmap::ARGB8888_LZ4 };
+    EncodedBitmap::Encoding smallest = EncodedBitmap::ARGB8888_LZ4;
+    data.clear();
+    std::vector<uint8_t> encoded;
+    for (unsigned i = 0; i < sizeof(encodings) / sizeof(encodings[0]); i++)
+    {
+        if (encode(pixels, width, height, encodings[i], encoded) && (data.empty() || encoded.size() < data.size()))
+        {
+            data.swap(encoded);
+            smallest = encodings[i];
+        }
+    }
+    return smallest;
+}
+
+void BitmapEncoder::encodeL8(const uint32_t* pixels, uint32_t numberOfPixels, std::vector<uint8_t>& data)
+{
+    // The colors are numbered in the order they first appear
+    std::map<uint32_t, uint8_t> indices;
+    std::vector<uint32_t> palette;
+    for (uint32_t i = 0; i < numberOfPixels; i++)
+    {
+        if (indices.find(pixels[i]) == indices.end())
+        {
+            indices[pixels[i]] = static_cast<uint8_t>(palette.size());
+            palette.push_back(pixels[i]);
+        }
+    }
+
+    data[2] = static_cast<uint8_t>(palette.size());
+    data[3] = static_cast<uint8_t>(palette.size() >> 8);
+    for (uint32_t i = 0; i < palette.size(); i++)
+    {
+        writeUint32(data, palette[i]);
+    }
+    for (uint32_t i = 0; i < numberOfPixels; i++)
+    {
+        data.push_back(indices[pixels[i]]);
+    }
+}
+
+void BitmapEncoder::encodeRGB565RLE(const uint32_t* line, uint16_t width, std::vector<uint8_t>& data)
+{
+    uint16_t x = 0;
+    while (x < width)
+    {
+        // A repeated pixel takes three bytes, so a run of two is as small as two literals
+        uint16_t run = 1;
+        while (x + run < width && run < 128 && toRGB565(line[x + run]) == toRGB565(line[x]))
+        {
+            run++;
+        }
+        if (run >= 2)
+        {
+            const uint16_t color = toRGB565(line[x]);
+            data.push_back(static_cast<uint8_t>(0x80 | (run - 1)));
+            data.push_back(static_cast<uint8_t>(color));
+            data.push_back(static_cast<uint8_t>(color >> 8));
+            x += run;
+            continue;
+        }
+
+        // Literals until the next repeated pixel
+        uint16_t literals = 1;
+        while (x + literals < width && literals < 128 &&
+                !(x + literals + 1 < width && toRGB565(line[x + literals]) == toRGB565(line[x + literals + 1])))
+        {
+            literals++;
+        }
+        data.push_back(static_cast<uint8_t>(literals - 1));
+        for (uint16_t i = 0; i < literals; i++)
+        {
+            const uint16_t color = toRGB565(line[x + i]);
+            data.push_back(static_cast<uint8_t>(color));
+            data.push_back(static_cast<uint8_t>(color >> 8));
+        }
+        x += literals;
+    }
+}
+
+void BitmapEncoder::encodeARGB8888LZ4(const uint32_t* line, uint16_t width, std::vector<uint8_t>& data)
+{
+    // The pixels are compressed as little endian bytes, which is how they are decoded
+    const uint32_t size = width * 4;
+    std::vector<uint8_t> bytes(size);
+    for (uint16_t x = 0; x < width; x++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            bytes[x * 4 + i] = static_cast<uint8_t>(line[x] >> (i * 8));
+        }
+    }
+    const uint8_t* in = &bytes[0];
+
+    // Greedy compression, using the latest position of each hashed sequence of four bytes
+    std::vector<int32_t> table(1 << LZ4_HASH_BITS, -1);
+    uint32_t anchor = 0;
+    uint32_t pos = 0;
+    while (pos + LZ4_MATCH_LIMIT <= size)
+    {
+        const uint32_t sequence = read32(in + pos);
+        const uint32_t h = hash(sequence);
+        const int32_t candidate = table[h];
+        table[h] = pos;
+        if (candidate < 0 || pos - candidate > LZ4_MAX_OFFSET || read32(in + candidate) != sequence)
+        {
+            pos++;
+            continue;
+        }
+
+        uint32_t matchLength = LZ4_MIN_MATCH;
+        while (pos + matchLength < size - LZ4_LAST_LITERALS && in[candidate + matchLength] == in[pos + matchLength])
+        {
+            matchLength++;
+        }
+
+        const uint32_t literals = pos - anchor;
+        const uint32_t extraLength = matchLength - LZ4_MIN_MATCH;
+        data.push_back(static_cast<uint8_t>((MIN(literals, 15U) << 4) | MIN(extraLength, 15U)));
+        if (literals >= 15)
+        {
+            writeLength(data, literals - 15);
+        }
+        data.insert(data.end(), in + anchor, in + pos);
+        const uint32_t offset = pos - candidate;
+        data.push_back(static_cast<uint8_t>(offset));
+        data.push_back(static_cast<uint8_t>(offset >> 8));
+        if (extraLength >= 15)
+        {
+            writeLength(data, extraLength - 15);
+        }
+
+        pos += matchLength;
+        anchor = pos;
+    }
+
+    // The last sequence has only literals
+    const uint32_t literals = size - anchor;
+    data.push_back(static_cast<uint8_t>(MIN(literals, 15U) << 4));
+    if (literals >= 15)
+    {
+        writeLength(data, literals - 15);
+    }
+    data.insert(data.end(), in + anchor, in + size);
+}
+
+void BitmapEncoder::writeUint32(std::vector<uint8_t>& data, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        data.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+void BitmapEncoder::writeLength(std::vector<uint8_t>& data, uint32_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        data.push_back(255);
+    }
+    data.push_back(static_cast<uint8_t>(length));
+}
+} // namespace touchgfx
@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+#ifndef BITMAPENCODER_HPP
+#define BITMAPENCODER_HPP
+
+#include <touchgfx/EncodedBitmap.hpp>
+#include <vector>
+
+namespace touchgfx
+{
+/**
+ * @class BitmapEncoder BitmapEncoder.hpp BitmapEncoder.hpp
+ *
+ * @brief Encoding of ARGB8888 pixels into the formats of EncodedBitmap.
+ *
+ *        Encoding of ARGB8888 pixels into the formats of EncodedBitmap. Used by the
+ *        bitmapencoder tool on the host, and by benchmarks encoding generated images.
+ *
+ * @see EncodedBitmap
+ */
+class BitmapEncoder
+{
+public:
+
+    /**
+     * @fn static bool BitmapEncoder::canEncode(const uint32_t* pixels, uint16_t width, uint16_t height, EncodedBitmap::Encoding encoding);
+     *
+     * @brief Query if pixels can be stored with an encoding.
+     *
+     *        Query if pixels can be stored with an encoding. L8 requires at most 256
+     *        different colors, RGB565_RLE requires all pixels to be opaque, and ARGB8888_LZ4
+     *        requires the width to be at most EncodedBitmap::MAX_LZ4_WIDTH.
+     *
+     * @param pixels   The ARGB8888 pixels, line by line.
+     * @param width    The width of the bitmap.
+     * @param height   The height of the bitmap.
+     * @param encoding The encoding.
+     *
+     * @return true if the pixels can be encoded.
+     */
+    static bool canEncode(const uint32_t* pixels, uint16_t width, uint16_t height, EncodedBitmap::Encoding encoding);
+
+    /**
+     * @fn static bool BitmapEncoder::encode(const uint32_t* pixels, uint16_t width, uint16_t height, EncodedBitmap::Encoding encoding, std::vector<uint8_t>& data);
+     *
+     * @brief Encodes pixels.
+     *
+     *        Encodes pixels. RGB565_RLE bitmaps are converted to RGB565 by dropping the
+     *        lowest bits of each color, like LCD16bpp does when drawing ARGB8888 bitmaps.
+     *
+     * @param pixels     The ARGB8888 pixels, line by line.
+     * @param width      The width of the bitmap.
+     * @param height     The height of the bitmap.
+     * @param encoding   The encoding.
+     * @param [out] data The encoded bitmap, including the header.
+     *
+     * @return false if the pixels cannot be stored with the encoding.
+     */
+    static bool encode(const uint32_t* pixels, uint16_t width, uint16_t height, EncodedBitmap::Encoding encoding, std::vector<uint8_t>& data);
+
+    /**
+     * @fn static EncodedBitmap::Encoding BitmapEncoder::encodeSmallest(const uint32_t* pixels, uint16_t width, uint16_t height, std::vector<uint8_t>& data);
+     *
+     * @brief Encodes pixels with the encoding giving the smallest data.
+     *
+     *        Encodes pixels with the encoding giving the smallest data. RGB565_RLE is only
+     *        considered when all pixels are opaque, in which case it draws the same pixels as
+     *        the ARGB8888 encodings on a 16 bpp display.
+     *
+     * @param pixels     The ARGB8888 pixels, line by line.
+     * @param width      The width of the bitmap.
+     * @param height     The height of the bitmap.
+     * @param [out] data The encoded bitmap, including the header.
+     *
+     * @return The encoding used.
+     */
+    static EncodedBitmap::Encoding encodeSmallest(const uint32_t* pixels, uint16_t width, uint16_t height, std::vector<uint8_t>& data);
+
+private:
+    static void encodeL8(const uint32_t* pixels, uint32_t numberOfPixels, std::vector<uint8_t>& data);
+    static void encodeRGB565RLE(const uint32_t* line, uint16_t width, std::vector<uint8_t>& data);
+    static void encodeARGB8888LZ4(const uint32_t* line, uint16_t width, std::vector<uint8_t>& data);
+    static void writeUint32(std::vector<uint8_t>& data, uint32_t value);
+    static void writeLength(std::vector<uint8_t>& data, uint32_t length);
+};
+} // namespace touchgfx
+
+#endif // BITMAPENCODER_HPP
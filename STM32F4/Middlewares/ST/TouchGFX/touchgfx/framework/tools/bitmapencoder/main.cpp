@@ -0,0 +1,313 @@
+/**
+  ******************************************************************************
+  * Copyright (c) 2026 The contributors of this repository.
+  *
+  * This file is not part of the TouchGFX distribution by STMicroelectronics
+  * and is not covered by its license SLA0044. It is licensed under the MIT
+  * License.
+  *
+  * SPDX-License-Identifier: MIT
+  *
+  ******************************************************************************
+  */
+
+/*
+ * Encodes a PNG image as a Bitmap::ENCODED bitmap:
+ *
+ *     bitmapencoder [-e l8|rle|lz4|auto] input.png output.cpp [name]
+ *
+ * The output file contains the encoded data, placed in external flash like the images
+ * converted by imageconvert. The BitmapData entry to add to the bitmap database is printed.
+ * Only non-interlaced PNG images with 8 bits per channel are supported.
+ */
+
+#include <BitmapEncoder.hpp>
+#include <zlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace touchgfx;
+
+namespace
+{
+uint32_t readBigEndian(const uint8_t* bytes)
+{
+    return (static_cast<uint32_t>(bytes[0]) << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+}
+
+uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    const int p = a + b - c;
+    const int pa = p > a ? p - a : a - p;
+    const int pb = p > b ? p - b : b - p;
+    const int pc = p > c ? p - c : c - p;
+    return (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+}
+
+bool readFile(const char* filename, std::vector<uint8_t>& bytes)
+{
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+    {
+        return false;
+    }
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        bytes.insert(bytes.end(), buffer, buffer + n);
+    }
+    fclose(f);
+    return true;
+}
+
+bool readPNG(const char* filename, std::vector<uint32_t>& pixels, uint16_t& width, uint16_t& height)
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    static const int channelsOfColorType[7] = { 1, 0, 3, 1, 2, 0, 4 };
+
+    std::vector<uint8_t> file;
+    if (!readFile(filename, file) || file.size() < 8 || memcmp(&file[0], signature, 8) != 0)
+    {
+        fprintf(stderr, "%s is not a PNG file\n", filename);
+        return false;
+    }
+
+    uint32_t w = 0;
+    uint32_t h = 0;
+    int colorType = -1;
+    std::vector<uint32_t> palette(256, 0xFF000000);
+    std::vector<uint8_t> compressed;
+    for (size_t pos = 8; pos + 12 <= file.size();)
+    {
+        const uint32_t length = readBigEndian(&file[pos]);
+        const std::string type(reinterpret_cast<const char*>(&file[pos + 4]), 4);
+        const uint8_t* chunk = &file[pos + 8];
+        if (pos + 12 + length > file.size())
+        {
+            break;
+        }
+        if (type == "IHDR")
+        {
+            w = readBigEndian(chunk);
+            h = readBigEndian(chunk + 4);
+            colorType = chunk[9];
+            if (chunk[8] != 8 || colorType > 6 || channelsOfColorType[colorType] == 0 || chunk[12] != 0)
+            {
+                fprintf(stderr, "%s: only non-interlaced PNG images with 8 bits per channel are supported\n", filename);
+                return false;
+            }
+        }
+        else if (type == "PLTE")
+        {
+            for (uint32_t i = 0; i < length / 3 && i < 256; i++)
+            {
+                palette[i] = 0xFF000000 | (chunk[i * 3] << 16) | (chunk[i * 3 + 1] << 8) | chunk[i * 3 + 2];
+            }
+        }
+        else if (type == "tRNS" && colorType == 3)
+        {
+            for (uint32_t i = 0; i < length && i < 256; i++)
+            {
+                palette[i] = (palette[i] & 0x00FFFFFF) | (static_cast<uint32_t>(chunk[i]) << 24);
+            }
+        }
+        else if (type == "IDAT")
+        {
+            compressed.insert(compressed.end(), chunk, chunk + length);
+        }
+        pos += 12 + length;
+    }
+    if (colorType < 0 || w == 0 || h == 0 || w > 0xFFFF || h > 0xFFFF)
+    {
+        fprintf(stderr, "%s: missing or invalid header\n", filename);
+        return false;
+    }
+
+    const uint32_t channels = channelsOfColorType[colorType];
+    const uint32_t stride = w * channels;
+    std::vector<uint8_t> raw(h * (stride + 1));
+    uLongf rawSize = raw.size();
+    if (uncompress(&raw[0], &rawSize, &compressed[0], compressed.size()) != Z_OK || rawSize != raw.size())
+    {
+        fprintf(stderr, "%s: corrupt image data\n", filename);
+        return false;
+    }
+
+    // Undo the filter of each line, then convert the pixels
+    std::vector<uint8_t> previous(stride, 0);
+    std::vector<uint8_t> current(stride);
+    pixels.resize(w * h);
+    for (uint32_t y = 0; y < h; y++)
+    {
+        const uint8_t filter = raw[y * (stride + 1)];
+        const uint8_t* line = &raw[y * (stride + 1) + 1];
+        for (uint32_t i = 0; i < stride; i++)
+        {
+            const uint8_t a = i >= channels ? current[i - channels] : 0;
+            const uint8_t b = previous[i];
+            const uint8_t c = i >= channels ? previous[i - channels] : 0;
+            uint8_t predictor = 0;
+            switch (filter)
+            {
+            case 1:
+                predictor = a;
+                break;
+            case 2:
+                predictor = b;
+                break;
+            case 3:
+                predictor = static_cast<uint8_t>((a + b) / 2);
+                break;
+            case 4:
+                predictor = paeth(a, b, c);
+                break;
+            }
+            current[i] = static_cast<uint8_t>(line[i] + predictor);
+        }
+        for (uint32_t x = 0; x < w; x++)
+        {
+            const uint8_t* p = &current[x * channels];
+            uint32_t argb;
+            switch (colorType)
+            {
+            case 0:
+                argb = 0xFF000000 | (p[0] << 16) | (p[0] << 8) | p[0];
+                break;
+            case 2:
+                argb = 0xFF000000 | (p[0] << 16) | (p[1] << 8) | p[2];
+                break;
+            case 3:
+                argb = palette[p[0]];
+                break;
+            case 4:
+                argb = (static_cast<uint32_t>(p[1]) << 24) | (p[0] << 16) | (p[0] << 8) | p[0];
+                break;
+            default:
+                argb = (static_cast<uint32_t>(p[3]) << 24) | (p[0] << 16) | (p[1] << 8) | p[2];
+                break;
+            }
+            pixels[y * w + x] = argb;
+        }
+        previous.swap(current);
+    }
+    width = static_cast<uint16_t>(w);
+    height = static_cast<uint16_t>(h);
+    return true;
+}
+
+std::string getName(const char* filename)
+{
+    std::string name(filename);
+    const size_t slash = name.find_last_of("/\\");
+    if (slash != std::string::npos)
+    {
+        name = name.substr(slash + 1);
+    }
+    name = name.substr(0, name.find('.'));
+    for (size_t i = 0; i < name.size(); i++)
+    {
+        const char c = name[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')))
+        {
+            name[i] = '_';
+        }
+    }
+    return name;
+}
+
+void usage()
+{
+    fprintf(stderr, "Usage: bitmapencoder [-e l8|rle|lz4|auto] input.png output.cpp [name]\n");
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    static const char* const encodingNames[] = { "L8", "RGB565_RLE", "ARGB8888_LZ4" };
+
+    std::string encodingOption = "auto";
+    int arg = 1;
+    if (arg + 1 < argc && strcmp(argv[arg], "-e") == 0)
+    {
+        encodingOption = argv[arg + 1];
+        arg += 2;
+    }
+    if (argc - arg < 2 || argc - arg > 3)
+    {
+        usage();
+        return 1;
+    }
+    const char* input = argv[arg];
+    const char* output = argv[arg + 1];
+    const std::string name = argc - arg == 3 ? argv[arg + 2] : getName(input);
+
+    std::vector<uint32_t> pixels;
+    uint16_t width = 0;
+    uint16_t height = 0;
+    if (!readPNG(input, pixels, width, height))
+    {
+        return 1;
+    }
+
+    std::vector<uint8_t> data;
+    EncodedBitmap::Encoding encoding;
+    if (encodingOption == "auto")
+    {
+        encoding = BitmapEncoder::encodeSmallest(&pixels[0], width, height, data);
+    }
+    else
+    {
+        if (encodingOption == "l8")
+        {
+            encoding = EncodedBitmap::L8;
+        }
+        else if (encodingOption == "rle")
+        {
+            encoding = EncodedBitmap::RGB565_RLE;
+        }
+        else if (encodingOption == "lz4")
+        {
+            encoding = EncodedBitmap::ARGB8888_LZ4;
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+        if (!BitmapEncoder::encode(&pixels[0], width, height, encoding, data))
+        {
+            fprintf(stderr, "%s cannot be encoded as %s\n", input, encodingNames[encoding]);
+            return 1;
+        }
+    }
+
+    FILE* f = fopen(output, "w");
+    if (!f)
+    {
+        fprintf(stderr, "Cannot write %s\n", output);
+        return 1;
+    }
+    fprintf(f, "// Generated by bitmapencoder. Please, do not edit!\n\n");
+    fprintf(f, "#include <touchgfx/hal/Config.hpp>\n\n");
+    fprintf(f, "LOCATION_EXTFLASH_PRAGMA\n");
+    fprintf(f, "extern const unsigned char _%s[] LOCATION_EXTFLASH_ATTRIBUTE = { // %ux%u %s, %u bytes\n",
+            name.c_str(), width, height, encodingNames[encoding], static_cast<unsigned>(data.size()));
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        fprintf(f, "%s0x%02X%s", i % 16 == 0 ? "    " : "", data[i], i + 1 == data.size() ? "\n" : (i % 16 == 15 ? ",\n" : ", "));
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+
+    // Only a fully opaque bitmap has a solid rectangle
+    const bool solid = !EncodedBitmap::hasTransparentPixels(&data[0]);
+    const size_t rawSize = pixels.size() * (EncodedBitmap::getDecodedFormat(&data[0]) == Bitmap::RGB565 ? 2 : 4);
+    printf("%s: %ux%u %s, %u bytes instead of %u (%.1f%%)\n", input, width, height, encodingNames[encoding],
+           static_cast<unsigned>(data.size()), static_cast<unsigned>(rawSize), 100.0 * data.size() / rawSize);
+    printf("{ _%s, 0, %u, %u, 0, 0, %u, %u, touchgfx::Bitmap::ENCODED },\n", name.c_str(), width, height,
+           solid ? width : 0, solid ? height : 0);
+    return 0;
+}
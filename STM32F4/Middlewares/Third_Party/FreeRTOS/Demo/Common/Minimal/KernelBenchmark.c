@@ -0,0 +1,543 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Measures the cost of the kernel primitives, in the cycles of a free running
+ * counter, to compare configuration choices such as
+ * configUSE_PORT_OPTIMISED_TASK_SELECTION, or queues against task
+ * notifications and stream buffers, on the target or on a host port:
+ *
+ * - context switch:  a task yielding to another task of the same priority.
+ * - queue round trip:  a task sending an item to a higher priority task
+ *   blocked on a queue, which sends it back on a second queue, for items of
+ *   4, 16, 64 and 256 bytes.
+ * - task notify:  from xTaskNotify() to a higher priority task blocked in
+ *   xTaskNotifyWait() running.
+ * - stream buffer send:  from xStreamBufferSend() to a higher priority task
+ *   blocked in xStreamBufferReceive() running.
+ * - mutex handoff:  a higher priority task blocking on a mutex held by a lower
+ *   priority task, which inherits its priority and gives the mutex, until the
+ *   higher priority task holds it.
+ * - ISR to task:  from the start of an interrupt handler notifying a higher
+ *   priority task to the task running.
+ *
+ * Each benchmark is repeated configKERNEL_BENCHMARK_ITERATIONS times, 1000 by
+ * default, after a few repeats to warm up the caches, and the minimum, mean,
+ * 99th percentile and maximum are printed with printf(), less the cycles taken
+ * to read the counter.
+ *
+ * xRunKernelBenchmark() is called from a task, and creates tasks at the
+ * priority of the calling task and the priority above it, so the calling task
+ * must run at a priority above all the other tasks of the application, less
+ * one.  FreeRTOSConfig.h must define configKERNEL_BENCHMARK_CYCLE_COUNT() to
+ * return a uint32_t counter of CPU cycles, e.g. on a Cortex-M3/4/7, with the
+ * DWT cycle counter enabled by the application:
+ *
+ *     #define configKERNEL_BENCHMARK_CYCLE_COUNT()	( DWT->CYCCNT )
+ *
+ * The application also provides vKernelBenchmarkTriggerInterrupt(), raising
+ * an interrupt, e.g. by setting an unused interrupt pending in the NVIC, whose
+ * handler passes the result of xKernelBenchmarkInterruptHandler() to
+ * portYIELD_FROM_ISR().  The interrupt must have a priority at or below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+
+/* Demo program include files. */
+#include "KernelBenchmark.h"
+
+#ifndef configKERNEL_BENCHMARK_CYCLE_COUNT
+	#error configKERNEL_BENCHMARK_CYCLE_COUNT() must be defined in FreeRTOSConfig.h to use KernelBenchmark.c.
+#endif
+
+#ifndef configKERNEL_BENCHMARK_ITERATIONS
+	#define configKERNEL_BENCHMARK_ITERATIONS	1000
+#endif
+
+#define benchWARM_UP_ITERATIONS		( 10UL )
+#define benchITERATIONS				( benchWARM_UP_ITERATIONS + ( uint32_t ) configKERNEL_BENCHMARK_ITERATIONS )
+#define benchMAX_ITEM_SIZE			( 256U )
+#define benchSTREAM_BUFFER_SIZE		( 64U )
+#define benchSTREAM_MESSAGE_SIZE	( 16U )
+
+/* The longest a benchmark waits for the other task or the interrupt, so a
+broken port fails instead of hanging. */
+#define benchTIMEOUT				pdMS_TO_TICKS( 1000UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The benchmarks, each run by the task calling xRunKernelBenchmark(), with the
+ * task it creates.
+ */
+static void prvBenchmarkContextSwitch( void );
+static void prvBenchmarkQueueRoundTrip( size_t xItemSize );
+static void prvBenchmarkTaskNotify( void );
+static void prvBenchmarkStreamBufferSend( void );
+static void prvBenchmarkMutexHandoff( void );
+static void prvBenchmarkInterruptToTask( void );
+
+/*
+ * The tasks created by the benchmarks.
+ */
+static void prvContextSwitchTask( void *pvParameters );
+static void prvQueueEchoTask( void *pvParameters );
+static void prvTaskNotifyTask( void *pvParameters );
+static void prvStreamBufferTask( void *pvParameters );
+static void prvMutexTask( void *pvParameters );
+static void prvInterruptTask( void *pvParameters );
+
+/*
+ * Records the cycles of an iteration, unless it is one of the first, which
+ * warm up the caches.
+ */
+static void prvRecordSample( uint32_t ulCycles );
+
+/*
+ * Prints the samples recorded since the last call, and fails the benchmark if
+ * an iteration is missing.
+ */
+static void prvReport( const char *pcName );
+
+/*
+ * Helpers.
+ */
+static void prvMeasureCounterOverhead( void );
+static int prvCompareSamples( const void *pv1, const void *pv2 );
+
+/*-----------------------------------------------------------*/
+
+/* The cycles of each iteration of the benchmark running. */
+static uint32_t ulSamples[ configKERNEL_BENCHMARK_ITERATIONS ];
+static volatile uint32_t ulIterations = 0;
+
+/* The counter read by the task or interrupt starting an iteration, for the
+task ending it. */
+static volatile uint32_t ulStartCycles = 0;
+
+static uint32_t ulCounterOverhead = 0;
+static BaseType_t xBenchmarkPassed = pdPASS;
+
+/* The task calling xRunKernelBenchmark(), the task it created for the
+benchmark running, and the objects they share. */
+static TaskHandle_t xBenchmarkTask = NULL, xPeerTask = NULL;
+static QueueHandle_t xRequestQueue = NULL, xReplyQueue = NULL;
+static StreamBufferHandle_t xStreamBuffer = NULL;
+static SemaphoreHandle_t xMutex = NULL;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xRunKernelBenchmark( void )
+{
+static const size_t xItemSizes[] = { 4U, 16U, 64U, benchMAX_ITEM_SIZE };
+size_t x;
+
+	/* The benchmarks need a priority above the calling task. */
+	configASSERT( uxTaskPriorityGet( NULL ) < ( UBaseType_t ) ( configMAX_PRIORITIES - 1 ) );
+
+	xBenchmarkTask = xTaskGetCurrentTaskHandle();
+	xBenchmarkPassed = pdPASS;
+	prvMeasureCounterOverhead();
+
+	vTaskSuspendAll();
+	{
+		printf( "Kernel benchmark, configUSE_PORT_OPTIMISED_TASK_SELECTION %d, %lu iterations, in cycles less %lu to read the counter\n",
+				configUSE_PORT_OPTIMISED_TASK_SELECTION, ( unsigned long ) configKERNEL_BENCHMARK_ITERATIONS, ( unsigned long ) ulCounterOverhead );
+	}
+	( void ) xTaskResumeAll();
+
+	prvBenchmarkContextSwitch();
+
+	for( x = 0; x < sizeof( xItemSizes ) / sizeof( xItemSizes[ 0 ] ); x++ )
+	{
+		prvBenchmarkQueueRoundTrip( xItemSizes[ x ] );
+	}
+
+	prvBenchmarkTaskNotify();
+	prvBenchmarkStreamBufferSend();
+	prvBenchmarkMutexHandoff();
+	prvBenchmarkInterruptToTask();
+
+	return xBenchmarkPassed;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkContextSwitch( void )
+{
+	/* The two tasks take turns to yield, each recording the cycles from the
+	other yielding to itself running. */
+	ulIterations = 0;
+	xTaskCreate( prvContextSwitchTask, "BenchYield", configMINIMAL_STACK_SIZE, NULL, uxTaskPriorityGet( NULL ), &xPeerTask );
+
+	while( ulIterations < benchITERATIONS )
+	{
+		ulStartCycles = configKERNEL_BENCHMARK_CYCLE_COUNT();
+		taskYIELD();
+		prvRecordSample( configKERNEL_BENCHMARK_CYCLE_COUNT() - ulStartCycles );
+	}
+
+	vTaskDelete( xPeerTask );
+	prvReport( "context switch" );
+}
+
+static void prvContextSwitchTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	while( ulIterations < benchITERATIONS )
+	{
+		ulStartCycles = configKERNEL_BENCHMARK_CYCLE_COUNT();
+		taskYIELD();
+		prvRecordSample( configKERNEL_BENCHMARK_CYCLE_COUNT() - ulStartCycles );
+	}
+
+	/* Leave the rest of the iterations to the other task, which deletes this
+	one. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkQueueRoundTrip( size_t xItemSize )
+{
+static uint8_t ucItem[ benchMAX_ITEM_SIZE ];
+char cName[ 32 ];
+uint32_t ulStart, ulIteration;
+
+	xRequestQueue = xQueueCreate( 1, ( UBaseType_t ) xItemSize );
+	xReplyQueue = xQueueCreate( 1, ( UBaseType_t ) xItemSize );
+	configASSERT( ( xRequestQueue != NULL ) && ( xReplyQueue != NULL ) );
+	ulIterations = 0;
+	xTaskCreate( prvQueueEchoTask, "BenchEcho", configMINIMAL_STACK_SIZE, NULL, uxTaskPriorityGet( NULL ) + 1, &xPeerTask );
+
+	for( ulIteration = 0; ulIteration < benchITERATIONS; ulIteration++ )
+	{
+		ulStart = configKERNEL_BENCHMARK_CYCLE_COUNT();
+		if( ( xQueueSend( xRequestQueue, ucItem, benchTIMEOUT ) != pdPASS ) || ( xQueueReceive( xReplyQueue, ucItem, benchTIMEOUT ) != pdPASS ) )
+		{
+			break;
+		}
+		prvRecordSample( configKERNEL_BENCHMARK_CYCLE_COUNT() - ulStart );
+	}
+
+	vTaskDelete( xPeerTask );
+	vQueueDelete( xRequestQueue );
+	vQueueDelete( xReplyQueue );
+
+	snprintf( cName, sizeof( cName ), "queue round trip, %u bytes", ( unsigned ) xItemSize );
+	prvReport( cName );
+}
+
+static void prvQueueEchoTask( void *pvParameters )
+{
+static uint8_t ucItem[ benchMAX_ITEM_SIZE ];
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( xQueueReceive( xRequestQueue, ucItem, portMAX_DELAY ) == pdPASS )
+		{
+			xQueueSend( xReplyQueue, ucItem, portMAX_DELAY );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTaskNotify( void )
+{
+uint32_t ulIteration;
+
+	ulIterations = 0;
+	xTaskCreate( prvTaskNotifyTask, "BenchNotify", configMINIMAL_STACK_SIZE, NULL, uxTaskPriorityGet( NULL ) + 1, &xPeerTask );
+
+	/* The other task runs, and records the iteration, before xTaskNotify()
+	returns. */
+	for( ulIteration = 0; ulIteration < benchITERATIONS; ulIteration++ )
+	{
+		ulStartCycles = configKERNEL_BENCHMARK_CYCLE_COUNT();
+		xTaskNotify( xPeerTask, ulIteration, eSetValueWithOverwrite );
+	}
+
+	vTaskDelete( xPeerTask );
+	prvReport( "task notify" );
+}
+
+static void prvTaskNotifyTask( void *pvParameters )
+{
+uint32_t ulValue;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( xTaskNotifyWait( 0, 0, &ulValue, portMAX_DELAY ) == pdPASS )
+		{
+			prvRecordSample( configKERNEL_BENCHMARK_CYCLE_COUNT() - ulStartCycles );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkStreamBufferSend( void )
+{
+static uint8_t ucMessage[ benchSTREAM_MESSAGE_SIZE ];
+uint32_t ulIteration;
+
+	/* A trigger level of one byte, so the receiving task is unblocked by every
+	send. */
+	xStreamBuffer = xStreamBufferCreate( benchSTREAM_BUFFER_SIZE, 1 );
+	configASSERT( xStreamBuffer != NULL );
+	ulIterations = 0;
+	xTaskCreate( prvStreamBufferTask, "BenchStream", configMINIMAL_STACK_SIZE, NULL, uxTaskPriorityGet( NULL ) + 1, &xPeerTask );
+
+	for( ulIteration = 0; ulIteration < benchITERATIONS; ulIteration++ )
+	{
+		ulStartCycles = configKERNEL_BENCHMARK_CYCLE_COUNT();
+		if( xStreamBufferSend( xStreamBuffer, ucMessage, sizeof( ucMessage ), benchTIMEOUT ) != sizeof( ucMessage ) )
+		{
+			break;
+		}
+	}
+
+	vTaskDelete( xPeerTask );
+	vStreamBufferDelete( xStreamBuffer );
+	prvReport( "stream buffer send, 16 bytes" );
+}
+
+static void prvStreamBufferTask( void *pvParameters )
+{
+static uint8_t ucMessage[ benchSTREAM_MESSAGE_SIZE ];
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( xStreamBufferReceive( xStreamBuffer, ucMessage, sizeof( ucMessage ), portMAX_DELAY ) == sizeof( ucMessage ) )
+		{
+			prvRecordSample( configKERNEL_BENCHMARK_CYCLE_COUNT() - ulStartCycles );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkMutexHandoff( void )
+{
+UBaseType_t uxPriority = uxTaskPriorityGet( NULL );
+uint32_t ulIteration;
+
+	xMutex = xSemaphoreCreateMutex();
+	configASSERT( xMutex != NULL );
+	ulIterations = 0;
+	xTaskCreate( prvMutexTask, "BenchMutex", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, &xPeerTask );
+
+	for( ulIteration = 0; ulIteration < benchITERATIONS; ulIteration++ )
+	{
+		if( xSemaphoreTake( xMutex, benchTIMEOUT ) != pdPASS )
+		{
+			break;
+		}
+
+		/* The other task runs until it blocks on the mutex, raising the
+		priority of this task to its own. */
+		xTaskNotifyGive( xPeerTask );
+		if( uxTaskPriorityGet( NULL ) != uxPriority + 1 )
+		{
+			xBenchmarkPassed = pdFAIL;
+		}
+
+		xSemaphoreGive( xMutex );
+	}
+
+	vTaskDelete( xPeerTask );
+	vSemaphoreDelete( xMutex );
+	prvReport( "mutex handoff, inheritance" );
+}
+
+static void prvMutexTask( void *pvParameters )
+{
+uint32_t ulStart;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		ulStart = configKERNEL_BENCHMARK_CYCLE_COUNT();
+		if( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdPASS )
+		{
+			prvRecordSample( configKERNEL_BENCHMARK_CYCLE_COUNT() - ulStart );
+			xSemaphoreGive( xMutex );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkInterruptToTask( void )
+{
+uint32_t ulIteration;
+
+	ulIterations = 0;
+	xTaskCreate( prvInterruptTask, "BenchISR", configMINIMAL_STACK_SIZE, NULL, uxTaskPriorityGet( NULL ) + 1, &xPeerTask );
+
+	/* The interrupt may not be taken before the trigger returns, e.g. on a
+	host port, so wait for the other task to record the iteration. */
+	for( ulIteration = 0; ulIteration < benchITERATIONS; ulIteration++ )
+	{
+		vKernelBenchmarkTriggerInterrupt();
+		if( ulTaskNotifyTake( pdTRUE, benchTIMEOUT ) == 0U )
+		{
+			break;
+		}
+	}
+
+	/* No interrupt can be left to notify the deleted task. */
+	taskENTER_CRITICAL();
+	{
+		vTaskDelete( xPeerTask );
+		xPeerTask = NULL;
+	}
+	taskEXIT_CRITICAL();
+
+	prvReport( "ISR to task" );
+}
+
+BaseType_t xKernelBenchmarkInterruptHandler( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	ulStartCycles = configKERNEL_BENCHMARK_CYCLE_COUNT();
+
+	if( xPeerTask != NULL )
+	{
+		vTaskNotifyGiveFromISR( xPeerTask, &xHigherPriorityTaskWoken );
+	}
+
+	return xHigherPriorityTaskWoken;
+}
+
+static void prvInterruptTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( ulTaskNotifyTake( pdTRUE, portMAX_DELAY ) != 0U )
+		{
+			prvRecordSample( configKERNEL_BENCHMARK_CYCLE_COUNT() - ulStartCycles );
+			xTaskNotifyGive( xBenchmarkTask );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordSample( uint32_t ulCycles )
+{
+	if( ( ulIterations >= benchWARM_UP_ITERATIONS ) && ( ulIterations < benchITERATIONS ) )
+	{
+		ulSamples[ ulIterations - benchWARM_UP_ITERATIONS ] = ulCycles;
+	}
+
+	ulIterations++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReport( const char *pcName )
+{
+uint64_t ullSum = 0;
+uint32_t x;
+
+	/* The printf() of a host port takes a lock, so print with the scheduler
+	suspended. */
+	vTaskSuspendAll();
+	{
+		if( ulIterations < benchITERATIONS )
+		{
+			printf( "  %-30s FAILED after %lu iterations\n", pcName, ( unsigned long ) ulIterations );
+			xBenchmarkPassed = pdFAIL;
+		}
+		else
+		{
+			for( x = 0; x < ( uint32_t ) configKERNEL_BENCHMARK_ITERATIONS; x++ )
+			{
+				ulSamples[ x ] = ( ulSamples[ x ] > ulCounterOverhead ) ? ulSamples[ x ] - ulCounterOverhead : 0U;
+				ullSum += ulSamples[ x ];
+			}
+
+			qsort( ulSamples, configKERNEL_BENCHMARK_ITERATIONS, sizeof( uint32_t ), prvCompareSamples );
+
+			/* The maximum includes the tick interrupt, and on a host port the
+			host preempting the benchmark, so the 99th percentile is the figure
+			to compare. */
+			printf( "  %-30s min %7lu  mean %7lu  p99 %7lu  max %9lu\n",
+					pcName,
+					( unsigned long ) ulSamples[ 0 ],
+					( unsigned long ) ( ullSum / ( uint64_t ) configKERNEL_BENCHMARK_ITERATIONS ),
+					( unsigned long ) ulSamples[ ( ( uint32_t ) configKERNEL_BENCHMARK_ITERATIONS * 99U ) / 100U ],
+					( unsigned long ) ulSamples[ configKERNEL_BENCHMARK_ITERATIONS - 1 ] );
+		}
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasureCounterOverhead( void )
+{
+uint32_t ulStart, ulCycles, x;
+
+	/* The shortest time between two reads of the counter. */
+	ulCounterOverhead = UINT32_MAX;
+	for( x = 0; x < 1000U; x++ )
+	{
+		ulStart = configKERNEL_BENCHMARK_CYCLE_COUNT();
+		ulCycles = configKERNEL_BENCHMARK_CYCLE_COUNT() - ulStart;
+
+		if( ulCycles < ulCounterOverhead )
+		{
+			ulCounterOverhead = ulCycles;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareSamples( const void *pv1, const void *pv2 )
+{
+uint32_t ul1 = *( const uint32_t * ) pv1, ul2 = *( const uint32_t * ) pv2;
+
+	return ( ul1 > ul2 ) - ( ul1 < ul2 );
+}
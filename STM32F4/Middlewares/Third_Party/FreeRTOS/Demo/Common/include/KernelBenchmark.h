@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef KERNEL_BENCHMARK_H
+#define KERNEL_BENCHMARK_H
+
+/*
+ * Runs the benchmarks and prints the results, see KernelBenchmark.c.  Returns
+ * pdPASS, or pdFAIL if a benchmark did not complete.
+ */
+BaseType_t xRunKernelBenchmark( void );
+
+/*
+ * To be called by the handler of the interrupt raised by
+ * vKernelBenchmarkTriggerInterrupt(), returning whether a context switch is
+ * required when the interrupt exits.
+ */
+BaseType_t xKernelBenchmarkInterruptHandler( void );
+
+/*
+ * Provided by the application: raises the interrupt whose handler calls
+ * xKernelBenchmarkInterruptHandler().
+ */
+void vKernelBenchmarkTriggerInterrupt( void );
+
+#endif /* KERNEL_BENCHMARK_H */
+
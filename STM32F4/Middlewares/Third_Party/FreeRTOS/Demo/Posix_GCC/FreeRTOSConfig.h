@@ -0,0 +1,138 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ * Modified by the contributors of this repository.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions.
+ *
+ * These definitions should be adjusted for your particular hardware and
+ * application requirements.
+ *
+ * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+ * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
+ * http://www.freertos.org/a00110.html
+ *
+ * The POSIX port runs each task in a thread, so the stack sizes only need to
+ * hold the state of the thread.
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION					1
+
+/* The kernel benchmark is also built with the generic task selection, and the
+middleware demo with the 56 priorities and the generic task selection required
+by the CMSIS-RTOS2 wrappers. */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION	1
+#endif
+
+#define configUSE_IDLE_HOOK						1
+#define configUSE_TICK_HOOK						0
+#define configUSE_DAEMON_TASK_STARTUP_HOOK		0
+#define configTICK_RATE_HZ						( 1000 )
+#define configMINIMAL_STACK_SIZE				( ( unsigned short ) 128 )
+#define configMAX_TASK_NAME_LEN					( 16 )
+#define configUSE_TRACE_FACILITY				1
+#define configUSE_16_BIT_TICKS					0
+#define configIDLE_SHOULD_YIELD					1
+#define configUSE_MUTEXES						1
+#define configCHECK_FOR_STACK_OVERFLOW			0
+#define configUSE_RECURSIVE_MUTEXES				1
+#define configQUEUE_REGISTRY_SIZE				8
+#define configUSE_MALLOC_FAILED_HOOK			1
+#define configUSE_APPLICATION_TASK_TAG			0
+#define configUSE_COUNTING_SEMAPHORES			1
+#define configUSE_QUEUE_SETS					1
+#define configUSE_TASK_NOTIFICATIONS			1
+#define configSUPPORT_STATIC_ALLOCATION			0
+#define configSUPPORT_DYNAMIC_ALLOCATION		1
+#ifndef configMAX_PRIORITIES
+	#define configMAX_PRIORITIES				( 7 )
+#endif
+#define configGENERATE_RUN_TIME_STATS			0
+
+/* The heap benchmark is built with the smaller heap of a microcontroller. */
+#ifndef configTOTAL_HEAP_SIZE
+	#define configTOTAL_HEAP_SIZE				( ( size_t ) ( 1024 * 1024 ) )
+#endif
+
+/* The rate of the SysTick simulated from the host clock for the CMSIS-RTOS2
+wrappers, see portable/ThirdParty/GCC/Posix/CMSIS/posix_device.h. */
+#define configCPU_CLOCK_HZ						( 100000000UL )
+#define CMSIS_device_header						"posix_device.h"
+
+/* Software timer definitions. */
+#define configUSE_TIMERS						1
+#define configTIMER_TASK_PRIORITY				( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH				20
+#define configTIMER_TASK_STACK_DEPTH			( configMINIMAL_STACK_SIZE * 2 )
+
+/* Trace recorder definitions.  The timestamps are the microseconds of the host
+clock, and the task deletion check has up to 100 tasks at once.  The kernel
+benchmark is built without the recorder. */
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER				1
+#endif
+#define configTRACE_RECORDER_EVENTS					16384
+#define configTRACE_RECORDER_OBJECTS				128
+#define configTRACE_RECORDER_TIMESTAMP()			ulPortGetHostMicroseconds()
+#define configTRACE_RECORDER_TIMESTAMP_FREQUENCY	1000000UL
+
+/* Kernel benchmark definitions, see kernel_benchmark.c. */
+uint32_t ulKernelBenchmarkCycleCount( void );
+#define configKERNEL_BENCHMARK_CYCLE_COUNT()		ulKernelBenchmarkCycleCount()
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES					0
+#define configMAX_CO_ROUTINE_PRIORITIES			( 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet				1
+#define INCLUDE_uxTaskPriorityGet				1
+#define INCLUDE_vTaskDelete						1
+#define INCLUDE_vTaskCleanUpResources			0
+#define INCLUDE_vTaskSuspend					1
+#define INCLUDE_vTaskDelayUntil					1
+#define INCLUDE_vTaskDelay						1
+#define INCLUDE_xTaskGetSchedulerState			1
+#define INCLUDE_xTimerPendFunctionCall			1
+#define INCLUDE_xTaskGetCurrentTaskHandle		1
+#define INCLUDE_uxTaskGetStackHighWaterMark		1
+#define INCLUDE_xSemaphoreGetMutexHolder		1
+#define INCLUDE_eTaskGetState					1
+#define INCLUDE_xTaskAbortDelay					1
+
+/* Normal assert() semantics without relying on the provision of an assert.h
+header file. */
+void vAssertCalled( const char *pcFile, unsigned long ulLine );
+#define configASSERT( x ) if( ( x ) == 0 ) vAssertCalled( __FILE__, __LINE__ )
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,727 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * Replays traces of heap allocations against the heap implementation the
+ * program is linked with, and prints the time taken by each pvPortMalloc()
+ * and vPortFree() call and the fragmentation of the heap.  The Makefile links
+ * it once with heap_4.c and once with heap_6.c, so the two can be compared on
+ * the same traces:
+ *
+ *     make heap-benchmark
+ *     ./build/heap_benchmark_4 [-r repeats] [-w written.trace] [file.trace...]
+ *
+ * A trace has one operation per line:
+ *
+ *     m <address> <size>     - pvPortMalloc( size ) returned address
+ *     f <address>            - vPortFree( address )
+ *
+ * The addresses only identify the blocks, and lines starting with anything
+ * else are ignored.  Traces can be recorded on the target by wrapping
+ * pvPortMalloc() and vPortFree() (e.g. with the --wrap option of the GNU
+ * linker) and printing each call.  Without trace files the benchmark replays
+ * a built-in trace modelling LwIP and mbedTLS serving TLS connections: the
+ * contexts and record buffers of each connection, the certificate chain and
+ * the big number arithmetic of the handshakes, and the PBUF_RAM buffers of
+ * the packets, interleaved between concurrent connections.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined( __x86_64__ ) || defined( __i386__ )
+	#include <x86intrin.h>
+#endif
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define benchMAX_LINE_LENGTH			( 256 )
+#define benchFRAGMENTATION_INTERVAL		( 16UL )
+#define benchSCHEDULER_LOCKS			( 100000UL )
+
+/* The built-in trace. */
+#define benchCONNECTIONS				( 2000UL )
+#define benchCONCURRENT_CONNECTIONS		( 3UL )
+#define benchRANDOM_SEED				( 0x12345678UL )
+
+/*-----------------------------------------------------------*/
+
+typedef struct BENCH_OPERATION
+{
+	uint32_t ulBlock;		/* The index of the block, the same for the pvPortMalloc() and vPortFree() of a block. */
+	uint32_t ulSize;		/* The size to allocate, or 0 to free the block. */
+} BenchOperation_t;
+
+typedef struct BENCH_TRACE
+{
+	BenchOperation_t *pxOperations;
+	size_t xNumberOfOperations;
+	size_t xCapacity;
+	uint32_t ulNumberOfBlocks;
+} BenchTrace_t;
+
+/* A connection of the built-in trace: the blocks it owns, and the step of its
+life it is at. */
+typedef struct BENCH_CONNECTION
+{
+	uint32_t ulBlocks[ 256 ];
+	uint32_t ulNumberOfBlocks;
+	uint32_t ulStep;
+} BenchConnection_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Reads a trace file, mapping the addresses of the trace to block indexes.
+ */
+static BaseType_t prvReadTrace( const char *pcFileName, BenchTrace_t *pxTrace );
+
+/*
+ * Builds the built-in trace.
+ */
+static void prvBuildTrace( BenchTrace_t *pxTrace );
+
+/*
+ * Writes a trace in the format read by prvReadTrace().
+ */
+static BaseType_t prvWriteTrace( const char *pcFileName, const BenchTrace_t *pxTrace );
+
+/*
+ * Replays a trace the given number of times and prints the results.
+ */
+static void prvReplayTrace( const char *pcName, const BenchTrace_t *pxTrace, unsigned long ulRepeats );
+
+/*
+ * Helpers.
+ */
+static void prvAddOperation( BenchTrace_t *pxTrace, uint32_t ulBlock, uint32_t ulSize );
+static uint32_t prvRandom( uint32_t ulMaximum );
+static uint64_t prvGetNs( void );
+static uint64_t prvGetTime( void );
+static void prvCalibrateTime( void );
+static void prvMeasureSchedulerLock( void );
+static int prvCompareTimes( const void *pv1, const void *pv2 );
+static void prvPrintTimes( const char *pcName, uint32_t *pulTimes, size_t xNumberOfTimes );
+
+/*-----------------------------------------------------------*/
+
+#if( benchHEAP == 6 )
+	/* heap_6.c has no heap of its own, the regions are given by the
+	application. */
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif
+
+static uint32_t ulRandomState = benchRANDOM_SEED;
+static double dNsPerTimeUnit = 1.0;
+static uint32_t ulTimeOverhead = 0;
+static size_t xFailedAllocations = 0;
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char **argv )
+{
+BenchTrace_t xTrace;
+unsigned long ulRepeats = 3;
+const char *pcWrittenTrace = NULL;
+int iOption, iResult = EXIT_SUCCESS;
+
+	while( ( iOption = getopt( argc, argv, "r:w:" ) ) != -1 )
+	{
+		switch( iOption )
+		{
+			case 'r':
+				ulRepeats = strtoul( optarg, NULL, 0 );
+				break;
+
+			case 'w':
+				pcWrittenTrace = optarg;
+				break;
+
+			default:
+				fprintf( stderr, "usage: %s [-r repeats] [-w written.trace] [file.trace...]\n", argv[ 0 ] );
+				return EXIT_FAILURE;
+		}
+	}
+
+	#if( benchHEAP == 6 )
+	{
+	HeapRegion_t xHeapRegions[] =
+	{
+		{ ucHeap, sizeof( ucHeap ) },
+		{ NULL, 0 }
+	};
+
+		vPortDefineHeapRegions( xHeapRegions );
+	}
+	#endif
+
+	prvCalibrateTime();
+	printf( "heap_%d, %lu byte heap\n", benchHEAP, ( unsigned long ) configTOTAL_HEAP_SIZE );
+	prvMeasureSchedulerLock();
+
+	if( optind == argc )
+	{
+		memset( &xTrace, 0, sizeof( xTrace ) );
+		prvBuildTrace( &xTrace );
+
+		if( ( pcWrittenTrace != NULL ) && ( prvWriteTrace( pcWrittenTrace, &xTrace ) == pdFAIL ) )
+		{
+			fprintf( stderr, "cannot write %s\n", pcWrittenTrace );
+			iResult = EXIT_FAILURE;
+		}
+
+		prvReplayTrace( "built-in TLS trace", &xTrace, ulRepeats );
+		free( xTrace.pxOperations );
+	}
+
+	for( ; optind < argc; optind++ )
+	{
+		memset( &xTrace, 0, sizeof( xTrace ) );
+
+		if( prvReadTrace( argv[ optind ], &xTrace ) == pdPASS )
+		{
+			prvReplayTrace( argv[ optind ], &xTrace, ulRepeats );
+		}
+		else
+		{
+			fprintf( stderr, "cannot read %s\n", argv[ optind ] );
+			iResult = EXIT_FAILURE;
+		}
+
+		free( xTrace.pxOperations );
+	}
+
+	return iResult;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReplayTrace( const char *pcName, const BenchTrace_t *pxTrace, unsigned long ulRepeats )
+{
+void **ppvBlocks;
+uint32_t *pulMallocTimes, *pulFreeTimes;
+size_t xMallocs = 0, xFrees = 0, xOperation, xFragmentation, xMaximumFragmentation = 0, xFragmentationSum = 0, xFragmentationSamples = 0;
+unsigned long ulRepeat;
+uint64_t ullStart;
+uint32_t ulBlock;
+HeapStats_t xHeapStats;
+
+	ppvBlocks = calloc( pxTrace->ulNumberOfBlocks + 1U, sizeof( void * ) );
+	pulMallocTimes = malloc( ( pxTrace->xNumberOfOperations * ulRepeats + 1U ) * sizeof( uint32_t ) );
+	pulFreeTimes = malloc( ( pxTrace->xNumberOfOperations * ulRepeats + 1U ) * sizeof( uint32_t ) );
+	configASSERT( ( ppvBlocks != NULL ) && ( pulMallocTimes != NULL ) && ( pulFreeTimes != NULL ) );
+	xFailedAllocations = 0;
+
+	for( ulRepeat = 0; ulRepeat < ulRepeats; ulRepeat++ )
+	{
+		for( xOperation = 0; xOperation < pxTrace->xNumberOfOperations; xOperation++ )
+		{
+			ulBlock = pxTrace->pxOperations[ xOperation ].ulBlock;
+
+			if( pxTrace->pxOperations[ xOperation ].ulSize != 0U )
+			{
+				/* A block allocated again without being freed leaks in the
+				recording, so leak it here too. */
+				ullStart = prvGetTime();
+				ppvBlocks[ ulBlock ] = pvPortMalloc( pxTrace->pxOperations[ xOperation ].ulSize );
+				pulMallocTimes[ xMallocs++ ] = ( uint32_t ) ( prvGetTime() - ullStart );
+			}
+			else if( ppvBlocks[ ulBlock ] != NULL )
+			{
+				ullStart = prvGetTime();
+				vPortFree( ppvBlocks[ ulBlock ] );
+				pulFreeTimes[ xFrees++ ] = ( uint32_t ) ( prvGetTime() - ullStart );
+				ppvBlocks[ ulBlock ] = NULL;
+			}
+
+			/* Sample the fragmentation while the heap is in use.  heap_4.c
+			walks its free list to find the largest block, so not after every
+			operation. */
+			if( ( xOperation % benchFRAGMENTATION_INTERVAL ) == 0U )
+			{
+				vPortGetHeapStats( &xHeapStats );
+
+				if( xHeapStats.xAvailableHeapSpaceInBytes > 0U )
+				{
+					xFragmentation = 100U - ( xHeapStats.xSizeOfLargestFreeBlockInBytes * 100U ) / xHeapStats.xAvailableHeapSpaceInBytes;
+					xFragmentationSum += xFragmentation;
+					xFragmentationSamples++;
+
+					if( xFragmentation > xMaximumFragmentation )
+					{
+						xMaximumFragmentation = xFragmentation;
+					}
+				}
+			}
+		}
+
+		/* Free the blocks the trace did not free, so each repeat starts from
+		an empty heap. */
+		for( ulBlock = 0; ulBlock <= pxTrace->ulNumberOfBlocks; ulBlock++ )
+		{
+			vPortFree( ppvBlocks[ ulBlock ] );
+			ppvBlocks[ ulBlock ] = NULL;
+		}
+	}
+
+	vPortGetHeapStats( &xHeapStats );
+
+	printf( "%s: %lu operations x %lu\n", pcName, ( unsigned long ) pxTrace->xNumberOfOperations, ulRepeats );
+	prvPrintTimes( "pvPortMalloc", pulMallocTimes, xMallocs );
+	prvPrintTimes( "vPortFree", pulFreeTimes, xFrees );
+	printf( "  %-14s mean %lu%%, max %lu%%\n", "fragmentation", ( unsigned long ) ( xFragmentationSamples > 0U ? xFragmentationSum / xFragmentationSamples : 0U ), ( unsigned long ) xMaximumFragmentation );
+	printf( "  %-14s %lu failed allocations, minimum ever free %lu bytes\n", "heap", ( unsigned long ) xFailedAllocations, ( unsigned long ) xHeapStats.xMinimumEverFreeBytesRemaining );
+
+	free( ppvBlocks );
+	free( pulMallocTimes );
+	free( pulFreeTimes );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasureSchedulerLock( void )
+{
+static uint32_t ulTimes[ benchSCHEDULER_LOCKS ];
+uint64_t ullStart;
+uint32_t x;
+
+	/* Both heaps suspend the scheduler in each call, which on the POSIX port
+	takes system calls to mask the simulated interrupts.  Print that time, as
+	part of every pvPortMalloc() and vPortFree() time. */
+	for( x = 0; x < benchSCHEDULER_LOCKS; x++ )
+	{
+		ullStart = prvGetTime();
+		vTaskSuspendAll();
+		( void ) xTaskResumeAll();
+		ulTimes[ x ] = ( uint32_t ) ( prvGetTime() - ullStart );
+	}
+
+	prvPrintTimes( "scheduler lock", ulTimes, benchSCHEDULER_LOCKS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintTimes( const char *pcName, uint32_t *pulTimes, size_t xNumberOfTimes )
+{
+uint64_t ullSum = 0;
+size_t x;
+
+	if( xNumberOfTimes == 0U )
+	{
+		return;
+	}
+
+	/* Remove the time taken to read the time itself. */
+	for( x = 0; x < xNumberOfTimes; x++ )
+	{
+		pulTimes[ x ] = ( pulTimes[ x ] > ulTimeOverhead ) ? pulTimes[ x ] - ulTimeOverhead : 0U;
+		ullSum += pulTimes[ x ];
+	}
+
+	qsort( pulTimes, xNumberOfTimes, sizeof( uint32_t ), prvCompareTimes );
+
+	/* The maximum includes the host preempting the benchmark, so the
+	percentiles are the figures to compare. */
+	printf( "  %-14s mean %5.0f ns, p50 %5.0f ns, p99 %5.0f ns, p99.9 %6.0f ns, max %8.0f ns\n",
+			pcName,
+			( ( double ) ullSum / ( double ) xNumberOfTimes ) * dNsPerTimeUnit,
+			( double ) pulTimes[ xNumberOfTimes / 2U ] * dNsPerTimeUnit,
+			( double ) pulTimes[ ( xNumberOfTimes * 99U ) / 100U ] * dNsPerTimeUnit,
+			( double ) pulTimes[ ( xNumberOfTimes * 999U ) / 1000U ] * dNsPerTimeUnit,
+			( double ) pulTimes[ xNumberOfTimes - 1U ] * dNsPerTimeUnit );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBuildTrace( BenchTrace_t *pxTrace )
+{
+BenchConnection_t xConnections[ benchCONCURRENT_CONNECTIONS ];
+BenchConnection_t *pxConnection;
+uint32_t ulStarted = 0, ulFinished = 0, ulIndex, ulCount, x;
+uint32_t ulLongLived[ 64 ], ulNumberOfLongLived = 0;
+
+	memset( xConnections, 0, sizeof( xConnections ) );
+
+	/* Allocates a block owned by the connection, freed when it closes. */
+	#define benchALLOCATE( ulSize )																\
+		do																						\
+		{																						\
+			pxConnection->ulBlocks[ pxConnection->ulNumberOfBlocks++ ] = pxTrace->ulNumberOfBlocks;	\
+			prvAddOperation( pxTrace, pxTrace->ulNumberOfBlocks++, ( ulSize ) );					\
+		} while( 0 )
+
+	/* Allocates and frees a temporary block. */
+	#define benchTEMPORARY( ulSize )															\
+		do																						\
+		{																						\
+			prvAddOperation( pxTrace, pxTrace->ulNumberOfBlocks, ( ulSize ) );						\
+			prvAddOperation( pxTrace, pxTrace->ulNumberOfBlocks++, 0 );							\
+		} while( 0 )
+
+	while( ulFinished < benchCONNECTIONS )
+	{
+		/* Advance a random connection by one step, so the allocations of the
+		connections interleave. */
+		pxConnection = &( xConnections[ prvRandom( benchCONCURRENT_CONNECTIONS ) ] );
+
+		switch( pxConnection->ulStep )
+		{
+			case 0:
+				if( ulStarted == benchCONNECTIONS )
+				{
+					/* Wait for the other connections to finish. */
+					break;
+				}
+
+				/* A new connection: the netconn and TCP control block, the
+				SSL context and configuration, and the record buffers. */
+				ulStarted++;
+				benchALLOCATE( 36 );
+				benchALLOCATE( 168 );
+				benchALLOCATE( 408 + prvRandom( 64 ) );
+				benchALLOCATE( 16717 );
+				benchALLOCATE( 4429 );
+				pxConnection->ulStep++;
+				break;
+
+			case 1:
+			case 2:
+			case 3:
+				/* The client hello and the server flight: received packets,
+				and the parsing of one certificate of the chain each, with its
+				names, extensions and public key. */
+				benchTEMPORARY( 590 + prvRandom( 924 ) );
+				benchALLOCATE( 600 + prvRandom( 200 ) );
+				ulCount = 10U + prvRandom( 20 );
+				for( x = 0; x < ulCount; x++ )
+				{
+					benchALLOCATE( 16 + prvRandom( 112 ) );
+				}
+				benchALLOCATE( 256 + prvRandom( 2 ) * 256 );
+				benchTEMPORARY( 1514 );
+				pxConnection->ulStep++;
+				break;
+
+			case 4:
+			case 5:
+				/* The key exchange: big number arithmetic, each operation
+				allocating and freeing limbs of varying sizes. */
+				ulCount = 100U + prvRandom( 100 );
+				for( x = 0; x < ulCount; x++ )
+				{
+					ulIndex = pxTrace->ulNumberOfBlocks;
+					prvAddOperation( pxTrace, ulIndex, 8 + 8 * prvRandom( 64 ) );
+					prvAddOperation( pxTrace, ulIndex + 1U, 8 + 8 * prvRandom( 64 ) );
+					prvAddOperation( pxTrace, ulIndex, 0 );
+					prvAddOperation( pxTrace, ulIndex + 1U, 0 );
+					pxTrace->ulNumberOfBlocks += 2U;
+				}
+				benchALLOCATE( 32 + prvRandom( 96 ) );
+				pxConnection->ulStep++;
+				break;
+
+			case 6:
+				/* The session, kept by the session cache after the connection
+				closes, and freed when the cache evicts it. */
+				if( ulNumberOfLongLived == sizeof( ulLongLived ) / sizeof( ulLongLived[ 0 ] ) )
+				{
+					ulIndex = prvRandom( ulNumberOfLongLived );
+					prvAddOperation( pxTrace, ulLongLived[ ulIndex ], 0 );
+					ulLongLived[ ulIndex ] = ulLongLived[ --ulNumberOfLongLived ];
+				}
+				ulLongLived[ ulNumberOfLongLived++ ] = pxTrace->ulNumberOfBlocks;
+				prvAddOperation( pxTrace, pxTrace->ulNumberOfBlocks++, 128 + prvRandom( 128 ) );
+				pxConnection->ulStep++;
+				break;
+
+			default:
+				/* Application data: received and sent packets, until the
+				connection closes and frees everything it owns. */
+				ulCount = 1U + prvRandom( 4 );
+				for( x = 0; x < ulCount; x++ )
+				{
+					benchTEMPORARY( 54 + prvRandom( 1460 ) );
+				}
+
+				if( prvRandom( 8 ) == 0U )
+				{
+					for( x = 0; x < pxConnection->ulNumberOfBlocks; x++ )
+					{
+						prvAddOperation( pxTrace, pxConnection->ulBlocks[ x ], 0 );
+					}
+					pxConnection->ulNumberOfBlocks = 0;
+					pxConnection->ulStep = 0;
+					ulFinished++;
+				}
+				break;
+		}
+	}
+
+	#undef benchALLOCATE
+	#undef benchTEMPORARY
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddOperation( BenchTrace_t *pxTrace, uint32_t ulBlock, uint32_t ulSize )
+{
+	if( pxTrace->xNumberOfOperations == pxTrace->xCapacity )
+	{
+		pxTrace->xCapacity = ( pxTrace->xCapacity == 0U ) ? 4096U : pxTrace->xCapacity * 2U;
+		pxTrace->pxOperations = realloc( pxTrace->pxOperations, pxTrace->xCapacity * sizeof( BenchOperation_t ) );
+		configASSERT( pxTrace->pxOperations != NULL );
+	}
+
+	pxTrace->pxOperations[ pxTrace->xNumberOfOperations ].ulBlock = ulBlock;
+	pxTrace->pxOperations[ pxTrace->xNumberOfOperations ].ulSize = ulSize;
+	pxTrace->xNumberOfOperations++;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReadTrace( const char *pcFileName, BenchTrace_t *pxTrace )
+{
+FILE *pxFile;
+char cLine[ benchMAX_LINE_LENGTH ];
+char cAddress[ benchMAX_LINE_LENGTH ];
+unsigned long ulSize;
+unsigned long long *pullAddresses = NULL;
+uint32_t *pulBlocks = NULL;
+size_t xTableSize = 0, xSlot;
+unsigned long long ullAddress;
+BaseType_t xReturn = pdPASS;
+
+	pxFile = fopen( pcFileName, "r" );
+	if( pxFile == NULL )
+	{
+		return pdFAIL;
+	}
+
+	while( fgets( cLine, sizeof( cLine ), pxFile ) != NULL )
+	{
+		if( ( ( cLine[ 0 ] != 'm' ) && ( cLine[ 0 ] != 'f' ) ) || ( sscanf( cLine + 1, "%255s %lu", cAddress, &ulSize ) < 1 ) )
+		{
+			continue;
+		}
+
+		/* Failed allocations are replayed, but cannot be freed. */
+		ullAddress = strtoull( cAddress, NULL, 16 );
+		if( ullAddress == 0U )
+		{
+			if( cLine[ 0 ] == 'm' )
+			{
+				prvAddOperation( pxTrace, 0, ( uint32_t ) ulSize );
+			}
+			continue;
+		}
+
+		/* Keep the table of addresses, open addressed with linear probing, at
+		most half full. */
+		if( ( pxTrace->ulNumberOfBlocks + 1U ) * 2U > xTableSize )
+		{
+		unsigned long long *pullOldAddresses = pullAddresses;
+		uint32_t *pulOldBlocks = pulBlocks;
+		size_t xOldTableSize = xTableSize, xOldSlot;
+
+			xTableSize = ( xTableSize == 0U ) ? 1024U : xTableSize * 2U;
+			pullAddresses = calloc( xTableSize, sizeof( unsigned long long ) );
+			pulBlocks = calloc( xTableSize, sizeof( uint32_t ) );
+			configASSERT( ( pullAddresses != NULL ) && ( pulBlocks != NULL ) );
+
+			for( xOldSlot = 0; xOldSlot < xOldTableSize; xOldSlot++ )
+			{
+				if( pullOldAddresses[ xOldSlot ] != 0U )
+				{
+					for( xSlot = ( size_t ) ( pullOldAddresses[ xOldSlot ] * 0x9e3779b97f4a7c15ULL ) & ( xTableSize - 1U ); pullAddresses[ xSlot ] != 0U; xSlot = ( xSlot + 1U ) & ( xTableSize - 1U ) )
+					{
+					}
+					pullAddresses[ xSlot ] = pullOldAddresses[ xOldSlot ];
+					pulBlocks[ xSlot ] = pulOldBlocks[ xOldSlot ];
+				}
+			}
+
+			free( pullOldAddresses );
+			free( pulOldBlocks );
+		}
+
+		for( xSlot = ( size_t ) ( ullAddress * 0x9e3779b97f4a7c15ULL ) & ( xTableSize - 1U ); ( pullAddresses[ xSlot ] != 0U ) && ( pullAddresses[ xSlot ] != ullAddress ); xSlot = ( xSlot + 1U ) & ( xTableSize - 1U ) )
+		{
+		}
+
+		if( cLine[ 0 ] == 'm' )
+		{
+			/* An address is reused once its block is freed, so each
+			allocation starts a new block.  Block 0 is kept for the failed
+			allocations. */
+			pullAddresses[ xSlot ] = ullAddress;
+			pulBlocks[ xSlot ] = ++pxTrace->ulNumberOfBlocks;
+			prvAddOperation( pxTrace, pulBlocks[ xSlot ], ( uint32_t ) ulSize );
+		}
+		else if( pullAddresses[ xSlot ] == ullAddress )
+		{
+			prvAddOperation( pxTrace, pulBlocks[ xSlot ], 0 );
+		}
+	}
+
+	if( ferror( pxFile ) != 0 )
+	{
+		xReturn = pdFAIL;
+	}
+
+	fclose( pxFile );
+	free( pullAddresses );
+	free( pulBlocks );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWriteTrace( const char *pcFileName, const BenchTrace_t *pxTrace )
+{
+FILE *pxFile;
+size_t x;
+BaseType_t xReturn = pdPASS;
+
+	pxFile = fopen( pcFileName, "w" );
+	if( pxFile == NULL )
+	{
+		return pdFAIL;
+	}
+
+	/* The block indexes stand for the addresses, offset so none is 0. */
+	for( x = 0; x < pxTrace->xNumberOfOperations; x++ )
+	{
+		if( pxTrace->pxOperations[ x ].ulSize != 0U )
+		{
+			fprintf( pxFile, "m %lx %lu\n", ( unsigned long ) pxTrace->pxOperations[ x ].ulBlock + 1UL, ( unsigned long ) pxTrace->pxOperations[ x ].ulSize );
+		}
+		else
+		{
+			fprintf( pxFile, "f %lx\n", ( unsigned long ) pxTrace->pxOperations[ x ].ulBlock + 1UL );
+		}
+	}
+
+	if( fclose( pxFile ) != 0 )
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( uint32_t ulMaximum )
+{
+	/* A fixed xorshift generator, so the built-in trace is the same on every
+	host. */
+	ulRandomState ^= ulRandomState << 13;
+	ulRandomState ^= ulRandomState >> 17;
+	ulRandomState ^= ulRandomState << 5;
+
+	return ulRandomState % ulMaximum;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvGetNs( void )
+{
+struct timespec xNow;
+
+	clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( uint64_t ) xNow.tv_sec * 1000000000ULL + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvGetTime( void )
+{
+	/* Reading the clock can take longer than the calls being timed, so use the
+	time stamp counter where there is one. */
+	#if defined( __x86_64__ ) || defined( __i386__ )
+	{
+		return __rdtsc();
+	}
+	#else
+	{
+		return prvGetNs();
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvCalibrateTime( void )
+{
+uint64_t ullStartNs, ullStart, ullTime;
+uint32_t x;
+
+	/* Measure the rate of the time stamps against the clock. */
+	ullStartNs = prvGetNs();
+	ullStart = prvGetTime();
+	while( prvGetNs() - ullStartNs < 100000000ULL )
+	{
+	}
+	dNsPerTimeUnit = ( double ) ( prvGetNs() - ullStartNs ) / ( double ) ( prvGetTime() - ullStart );
+
+	/* Measure the shortest time between two time stamps. */
+	ulTimeOverhead = UINT32_MAX;
+	for( x = 0; x < 1000U; x++ )
+	{
+		ullStart = prvGetTime();
+		ullTime = prvGetTime() - ullStart;
+
+		if( ullTime < ulTimeOverhead )
+		{
+			ulTimeOverhead = ( uint32_t ) ullTime;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareTimes( const void *pv1, const void *pv2 )
+{
+uint32_t ul1 = *( const uint32_t * ) pv1, ul2 = *( const uint32_t * ) pv2;
+
+	return ( ul1 > ul2 ) - ( ul1 < ul2 );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+	/* Running out of heap is part of the results, not an error. */
+	xFailedAllocations++;
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	fprintf( stderr, "ASSERT! Line %lu, file %s\n", ulLine, pcFile );
+	abort();
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Runs the kernel benchmark of Demo/Common/Minimal/KernelBenchmark.c on the
+ * host, with the time stamp counter standing for the cycle counter, and a
+ * simulated interrupt raised by the benchmark task itself.  The Makefile
+ * builds it without the trace recorder, once with the optimised and once with
+ * the generic task selection:
+ *
+ *     make kernel-benchmark
+ *
+ * The figures include the signals and thread switches the POSIX port takes to
+ * switch tasks, so are only to compare the configurations on the same host.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined( __x86_64__ ) || defined( __i386__ )
+	#include <x86intrin.h>
+#endif
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo includes. */
+#include "KernelBenchmark.h"
+
+/* Below the timer service task, which runs at the highest priority, as the
+benchmark uses the priority above its own. */
+#define benchTASK_PRIORITY		( configMAX_PRIORITIES - 3 )
+#define benchINTERRUPT			( 2UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Runs the benchmark, then ends the scheduler.
+ */
+static void prvBenchmarkTask( void *pvParameters );
+
+/*
+ * The handler of the simulated interrupt.
+ */
+static uint32_t prvInterruptHandler( void );
+
+/*-----------------------------------------------------------*/
+
+static BaseType_t xPassed = pdFAIL;
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	vPortSetInterruptHandler( benchINTERRUPT, prvInterruptHandler );
+	xTaskCreate( prvBenchmarkTask, "Bench", configMINIMAL_STACK_SIZE, NULL, benchTASK_PRIORITY, NULL );
+
+	/* Returns when the benchmark task ends the scheduler. */
+	vTaskStartScheduler();
+
+	return xPassed != pdFALSE ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	xPassed = xRunKernelBenchmark();
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvInterruptHandler( void )
+{
+	return ( uint32_t ) xKernelBenchmarkInterruptHandler();
+}
+/*-----------------------------------------------------------*/
+
+void vKernelBenchmarkTriggerInterrupt( void )
+{
+	vPortGenerateSimulatedInterrupt( benchINTERRUPT );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulKernelBenchmarkCycleCount( void )
+{
+	/* The time stamp counter where there is one, otherwise nanoseconds. */
+	#if defined( __x86_64__ ) || defined( __i386__ )
+	{
+		return ( uint32_t ) __rdtsc();
+	}
+	#else
+	{
+	struct timespec xNow;
+
+		clock_gettime( CLOCK_MONOTONIC, &xNow );
+		return ( uint32_t ) ( ( uint64_t ) xNow.tv_sec * 1000000000ULL + ( uint64_t ) xNow.tv_nsec );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+	vAssertCalled( __FILE__, __LINE__ );
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	fprintf( stderr, "ASSERT! Line %lu, file %s\n", ulLine, pcFile );
+	abort();
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+
+/*
+ * The lwIP options of the middleware demo of the POSIX port, which runs the
+ * lwIP stack over the loopback interface, with the threads, mailboxes,
+ * semaphores and mutexes of LwIP/system/OS/sys_arch.c on the CMSIS-RTOS2
+ * wrappers.  Only IPv4, TCP and the netconn API are built.
+ */
+
+#ifndef LWIPOPTS_H
+#define LWIPOPTS_H
+
+/* The operating system emulation layer of sys_arch.c. */
+#define NO_SYS							0
+#define SYS_LIGHTWEIGHT_PROT			1
+#define LWIP_COMPAT_MUTEX				0
+#define LWIP_TCPIP_CORE_LOCKING			1
+
+/* The pointers of the host are 8 bytes. */
+#define MEM_ALIGNMENT					8
+#define MEM_SIZE						( 256 * 1024 )
+#define MEMP_NUM_TCP_SEG				128
+#define MEMP_NUM_NETBUF					16
+#define MEMP_NUM_NETCONN				8
+#define PBUF_POOL_SIZE					64
+
+/* Only the loopback interface, which passes the packets to the tcpip thread. */
+#define LWIP_IPV4						1
+#define LWIP_IPV6						0
+#define LWIP_ARP						0
+#define LWIP_ETHERNET					0
+#define LWIP_ICMP						1
+#define LWIP_RAW						0
+#define LWIP_UDP						0
+#define LWIP_DHCP						0
+#define LWIP_DNS						0
+#define LWIP_IGMP						0
+#define LWIP_HAVE_LOOPIF				1
+#define LWIP_NETIF_LOOPBACK				1
+#define LWIP_LOOPBACK_MAX_PBUFS			0
+
+#define LWIP_TCP						1
+#define TCP_MSS							1460
+#define TCP_WND							( 16 * TCP_MSS )
+#define TCP_SND_BUF						( 16 * TCP_MSS )
+#define TCP_SND_QUEUELEN				( 4 * TCP_SND_BUF / TCP_MSS )
+
+#define LWIP_NETCONN					1
+#define LWIP_SOCKET						0
+#define LWIP_NETIF_API					0
+#define LWIP_STATS						0
+
+/* The threads and mailboxes, with the priorities of CMSIS-RTOS2.  The stack
+sizes are in bytes. */
+#define TCPIP_THREAD_NAME				"tcpip"
+#define TCPIP_THREAD_STACKSIZE			4096
+#define TCPIP_THREAD_PRIO				osPriorityHigh
+#define TCPIP_MBOX_SIZE					32
+#define DEFAULT_THREAD_STACKSIZE		4096
+#define DEFAULT_THREAD_PRIO				osPriorityNormal
+#define DEFAULT_TCP_RECVMBOX_SIZE		32
+#define DEFAULT_ACCEPTMBOX_SIZE			4
+
+#endif /* LWIPOPTS_H */
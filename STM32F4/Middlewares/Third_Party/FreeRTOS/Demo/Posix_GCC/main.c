@@ -0,0 +1,610 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * Checks the POSIX port by running the kernel on the host: context switches
+ * between tasks blocking on queues, preemption of a busy task by the tick,
+ * time slicing, software timers, simulated interrupts raised by another
+ * thread, task deletion, priority inheritance and delays.  The demo is also
+ * built with configUSE_TIMER_WHEEL set to 1, to check the timing wheel.
+ *
+ * The kernel events of the checks are recorded by the trace recorder, and
+ * written to the file given on the command line, if any, to be converted with
+ * the trace decoder:
+ *
+ *     ./build/posix_demo demo.trace && ./build/trace_decoder demo.trace demo.json
+ *
+ * Each check prints a line, and the process exits with a non zero status if
+ * any check failed, so the demo can run on a build server:
+ *
+ *     make && ./build/posix_demo
+ */
+
+/* Standard includes. */
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+
+/* Priorities of the tasks. */
+#define mainCHECK_TASK_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define mainTEST_TASK_PRIORITY		( tskIDLE_PRIORITY + 2 )
+#define mainHIGH_TASK_PRIORITY		( tskIDLE_PRIORITY + 3 )
+
+#define mainPING_PONG_MESSAGES		( 10000UL )
+#define mainSIMULATED_INTERRUPTS	( 100UL )
+#define mainSIMULATED_INTERRUPT		( 2UL )
+#define mainDELETED_TASKS			( 50UL )
+#define mainDELAY_TICKS				( 100UL )
+#define mainMANY_TIMERS				( 64UL )
+#define mainMANY_TIMERS_MAX_PERIOD	( 700UL )
+
+/* The user event channel of the trace recorder logging the start of each
+check. */
+#define mainTRACE_CHECK_CHANNEL		( 1UL )
+
+/* The timeout of every check, so a broken port fails instead of hanging. */
+#define mainCHECK_TIMEOUT			pdMS_TO_TICKS( 5000UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task running the checks one after the other, then ending the scheduler.
+ */
+static void prvCheckTask( void *pvParameters );
+
+/*
+ * The checks, each returning pdPASS or pdFAIL.
+ */
+static BaseType_t prvCheckQueuePingPong( void );
+static BaseType_t prvCheckPreemption( void );
+static BaseType_t prvCheckTimeSlicing( void );
+static BaseType_t prvCheckTimers( void );
+static BaseType_t prvCheckManyTimers( void );
+static BaseType_t prvCheckSimulatedInterrupts( void );
+static BaseType_t prvCheckTaskDeletion( void );
+static BaseType_t prvCheckPriorityInheritance( void );
+static BaseType_t prvCheckDelayUntil( void );
+
+/*
+ * Prints with the scheduler suspended, as printf() takes a lock.
+ */
+static void prvPrintf( const char *pcFormat, ... );
+
+/*
+ * Writes the trace recorder to a file.
+ */
+static BaseType_t prvWriteTrace( const char *pcFileName );
+
+/*-----------------------------------------------------------*/
+
+static BaseType_t xAllPassed = pdTRUE;
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+	vTraceRecorderNameChannel( mainTRACE_CHECK_CHANNEL, "Check" );
+	vTraceRecorderNameInterrupt( mainSIMULATED_INTERRUPT, "Simulated" );
+	vTraceRecorderStart();
+	xTaskCreate( prvCheckTask, "Check", configMINIMAL_STACK_SIZE, NULL, mainCHECK_TASK_PRIORITY, NULL );
+
+	/* Returns when the check task ends the scheduler. */
+	vTaskStartScheduler();
+
+	vTraceRecorderStop();
+	if( argc > 1 && prvWriteTrace( argv[ 1 ] ) != pdPASS )
+	{
+		fprintf( stderr, "Cannot write %s\n", argv[ 1 ] );
+		xAllPassed = pdFALSE;
+	}
+
+	printf( "%s\n", xAllPassed != pdFALSE ? "All checks passed" : "Checks FAILED" );
+	return xAllPassed != pdFALSE ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckTask( void *pvParameters )
+{
+static const struct
+{
+	const char *pcName;
+	BaseType_t (*pxCheck)( void );
+} xChecks[] =
+{
+	{ "queue ping pong", prvCheckQueuePingPong },
+	{ "preemption", prvCheckPreemption },
+	{ "time slicing", prvCheckTimeSlicing },
+	{ "software timers", prvCheckTimers },
+	{ "many timers", prvCheckManyTimers },
+	{ "simulated interrupts", prvCheckSimulatedInterrupts },
+	{ "task deletion", prvCheckTaskDeletion },
+	{ "priority inheritance", prvCheckPriorityInheritance },
+	{ "delay until", prvCheckDelayUntil }
+};
+size_t x;
+
+	( void ) pvParameters;
+
+	for( x = 0; x < sizeof( xChecks ) / sizeof( xChecks[ 0 ] ); x++ )
+	{
+		BaseType_t xResult;
+
+		vTraceRecorderUserEvent( mainTRACE_CHECK_CHANNEL, ( uint32_t ) x );
+		xResult = xChecks[ x ].pxCheck();
+
+		prvPrintf( "%-22s %s\n", xChecks[ x ].pcName, xResult == pdPASS ? "pass" : "FAIL" );
+		if( xResult != pdPASS )
+		{
+			xAllPassed = pdFALSE;
+		}
+	}
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+static QueueHandle_t xPingQueue, xPongQueue;
+
+static void prvPongTask( void *pvParameters )
+{
+uint32_t ulValue;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		xQueueReceive( xPingQueue, &ulValue, portMAX_DELAY );
+		ulValue++;
+		xQueueSend( xPongQueue, &ulValue, portMAX_DELAY );
+	}
+}
+
+static BaseType_t prvCheckQueuePingPong( void )
+{
+TaskHandle_t xPongTask;
+uint32_t ulMessage, ulValue = 0;
+BaseType_t xResult = pdPASS;
+
+	xPingQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	xPongQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	vQueueAddToRegistry( xPingQueue, "Ping" );
+	vQueueAddToRegistry( xPongQueue, "Pong" );
+	xTaskCreate( prvPongTask, "Pong", configMINIMAL_STACK_SIZE, NULL, mainTEST_TASK_PRIORITY, &xPongTask );
+
+	/* Every message switches to the pong task and back. */
+	for( ulMessage = 0; ulMessage < mainPING_PONG_MESSAGES && xResult == pdPASS; ulMessage++ )
+	{
+		if( xQueueSend( xPingQueue, &ulValue, mainCHECK_TIMEOUT ) != pdPASS ||
+			xQueueReceive( xPongQueue, &ulValue, mainCHECK_TIMEOUT ) != pdPASS )
+		{
+			xResult = pdFAIL;
+		}
+	}
+	if( ulValue != mainPING_PONG_MESSAGES )
+	{
+		xResult = pdFAIL;
+	}
+
+	vTaskDelete( xPongTask );
+	vQueueDelete( xPingQueue );
+	vQueueDelete( xPongQueue );
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+static volatile BaseType_t xHighTaskRan;
+static volatile uint32_t ulBusyLoops;
+
+static void prvHighPriorityTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	vTaskDelay( pdMS_TO_TICKS( 10 ) );
+	xHighTaskRan = pdTRUE;
+	vTaskDelete( NULL );
+}
+
+static BaseType_t prvCheckPreemption( void )
+{
+TickType_t xStart = xTaskGetTickCount();
+
+	/* The high priority task can only run when the tick preempts the busy
+	loop, which never blocks nor yields. */
+	xHighTaskRan = pdFALSE;
+	xTaskCreate( prvHighPriorityTask, "High", configMINIMAL_STACK_SIZE, NULL, mainHIGH_TASK_PRIORITY, NULL );
+	while( xHighTaskRan == pdFALSE && ( xTaskGetTickCount() - xStart ) < mainCHECK_TIMEOUT )
+	{
+		ulBusyLoops++;
+	}
+
+	return xHighTaskRan != pdFALSE ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static volatile uint32_t ulSliceCounts[ 2 ];
+static volatile BaseType_t xStopSlicing;
+
+static void prvSlicingTask( void *pvParameters )
+{
+volatile uint32_t *pulCount = ( volatile uint32_t * ) pvParameters;
+
+	while( xStopSlicing == pdFALSE )
+	{
+		( *pulCount )++;
+	}
+	vTaskDelete( NULL );
+}
+
+static BaseType_t prvCheckTimeSlicing( void )
+{
+	/* Two busy tasks of the same priority only both run if the tick switches
+	between them. */
+	xStopSlicing = pdFALSE;
+	ulSliceCounts[ 0 ] = ulSliceCounts[ 1 ] = 0;
+
+	/* Raise this task above the busy tasks so it can stop them. */
+	vTaskPrioritySet( NULL, mainHIGH_TASK_PRIORITY );
+	xTaskCreate( prvSlicingTask, "Slice0", configMINIMAL_STACK_SIZE, ( void * ) &ulSliceCounts[ 0 ], mainTEST_TASK_PRIORITY, NULL );
+	xTaskCreate( prvSlicingTask, "Slice1", configMINIMAL_STACK_SIZE, ( void * ) &ulSliceCounts[ 1 ], mainTEST_TASK_PRIORITY, NULL );
+	vTaskDelay( pdMS_TO_TICKS( 50 ) );
+	xStopSlicing = pdTRUE;
+	vTaskPrioritySet( NULL, mainCHECK_TASK_PRIORITY );
+
+	/* Let the busy tasks see the flag and delete themselves. */
+	vTaskDelay( pdMS_TO_TICKS( 10 ) );
+	return ulSliceCounts[ 0 ] > 0 && ulSliceCounts[ 1 ] > 0 ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static volatile uint32_t ulAutoReloadCount;
+static volatile BaseType_t xOneShotExpired;
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+	if( pvTimerGetTimerID( xTimer ) != NULL )
+	{
+		ulAutoReloadCount++;
+	}
+	else
+	{
+		xOneShotExpired = pdTRUE;
+	}
+}
+
+static BaseType_t prvCheckTimers( void )
+{
+TimerHandle_t xOneShot, xAutoReload;
+TickType_t xStart, xElapsed;
+BaseType_t xResult;
+
+	ulAutoReloadCount = 0;
+	xOneShotExpired = pdFALSE;
+	xOneShot = xTimerCreate( "OneShot", pdMS_TO_TICKS( 20 ), pdFALSE, NULL, prvTimerCallback );
+	xAutoReload = xTimerCreate( "AutoReload", pdMS_TO_TICKS( 5 ), pdTRUE, ( void * ) 1, prvTimerCallback );
+	xStart = xTaskGetTickCount();
+	xTimerStart( xOneShot, 0 );
+	xTimerStart( xAutoReload, 0 );
+
+	/* Ticks late on a busy host are handled together, and the timer task
+	catches up with the periods missed before this task runs. */
+	vTaskDelay( pdMS_TO_TICKS( 52 ) );
+	xTimerStop( xAutoReload, 0 );
+	xElapsed = xTaskGetTickCount() - xStart;
+	xResult = xOneShotExpired != pdFALSE && ulAutoReloadCount >= 10 && ulAutoReloadCount <= xElapsed / pdMS_TO_TICKS( 5 ) ? pdPASS : pdFAIL;
+
+	xTimerDelete( xOneShot, 0 );
+	xTimerDelete( xAutoReload, 0 );
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t xManyTimersStarted[ mainMANY_TIMERS ];
+static volatile TickType_t xManyTimersExpired[ mainMANY_TIMERS ];
+
+static void prvManyTimersCallback( TimerHandle_t xTimer )
+{
+uint32_t ulTimer = ( uint32_t ) ( uintptr_t ) pvTimerGetTimerID( xTimer );
+
+	/* Record one more than the elapsed ticks, so 0 means not expired. */
+	xManyTimersExpired[ ulTimer ] = xTaskGetTickCount() - xManyTimersStarted[ ulTimer ] + 1;
+}
+
+static BaseType_t prvCheckManyTimers( void )
+{
+TimerHandle_t xTimers[ mainMANY_TIMERS ];
+TickType_t xPeriod;
+uint32_t ulTimer;
+BaseType_t xResult = pdPASS;
+
+	/* Periods from a tick to several levels of the timing wheel, with the
+	longer timers stopped or restarted with another period before they
+	expire. */
+	for( ulTimer = 0; ulTimer < mainMANY_TIMERS; ulTimer++ )
+	{
+		xPeriod = 1 + ( ulTimer * 97UL ) % mainMANY_TIMERS_MAX_PERIOD;
+		xTimers[ ulTimer ] = xTimerCreate( "Many", xPeriod, pdFALSE, ( void * ) ( uintptr_t ) ulTimer, prvManyTimersCallback );
+		xManyTimersExpired[ ulTimer ] = 0;
+		xManyTimersStarted[ ulTimer ] = xTaskGetTickCount();
+		xTimerStart( xTimers[ ulTimer ], portMAX_DELAY );
+	}
+	for( ulTimer = 2; ulTimer < mainMANY_TIMERS; ulTimer += 3 )
+	{
+		xTimerStop( xTimers[ ulTimer ], portMAX_DELAY );
+	}
+	for( ulTimer = 1; ulTimer < mainMANY_TIMERS; ulTimer += 3 )
+	{
+		xManyTimersStarted[ ulTimer ] = xTaskGetTickCount();
+		xTimerChangePeriod( xTimers[ ulTimer ], 2 * xTimerGetPeriod( xTimers[ ulTimer ] ), portMAX_DELAY );
+	}
+
+	vTaskDelay( 2 * mainMANY_TIMERS_MAX_PERIOD + pdMS_TO_TICKS( 100 ) );
+
+	/* A timer expires on time or late on a busy host, but never early. */
+	for( ulTimer = 0; ulTimer < mainMANY_TIMERS; ulTimer++ )
+	{
+		if( ulTimer % 3 == 2 )
+		{
+			if( xManyTimersExpired[ ulTimer ] != 0 )
+			{
+				xResult = pdFAIL;
+			}
+		}
+		else if( xManyTimersExpired[ ulTimer ] <= xTimerGetPeriod( xTimers[ ulTimer ] ) )
+		{
+			xResult = pdFAIL;
+		}
+		xTimerDelete( xTimers[ ulTimer ], portMAX_DELAY );
+	}
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+static SemaphoreHandle_t xInterruptSemaphore;
+
+static uint32_t prvSimulatedInterruptHandler( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	xSemaphoreGiveFromISR( xInterruptSemaphore, &xHigherPriorityTaskWoken );
+	return ( uint32_t ) xHigherPriorityTaskWoken;
+}
+
+static void *prvInterruptThread( void *pvParameters )
+{
+uint32_t ulInterrupt;
+
+	( void ) pvParameters;
+
+	/* Like a peripheral, raise the interrupts from outside the kernel. */
+	for( ulInterrupt = 0; ulInterrupt < mainSIMULATED_INTERRUPTS; ulInterrupt++ )
+	{
+		vPortGenerateSimulatedInterrupt( mainSIMULATED_INTERRUPT );
+		usleep( 200 );
+	}
+	return NULL;
+}
+
+static BaseType_t prvCheckSimulatedInterrupts( void )
+{
+pthread_t xThread;
+uint32_t ulTaken = 0;
+
+	xInterruptSemaphore = xSemaphoreCreateCounting( mainSIMULATED_INTERRUPTS, 0 );
+	vQueueAddToRegistry( xInterruptSemaphore, "Interrupt" );
+	vPortSetInterruptHandler( mainSIMULATED_INTERRUPT, prvSimulatedInterruptHandler );
+
+	/* Interrupts raised while another is pending are merged, like on
+	hardware, so the semaphore is given at most once per interrupt. */
+	vTaskSuspendAll();
+	pthread_create( &xThread, NULL, prvInterruptThread, NULL );
+	xTaskResumeAll();
+	while( xSemaphoreTake( xInterruptSemaphore, pdMS_TO_TICKS( 100 ) ) == pdPASS )
+	{
+		ulTaken++;
+	}
+
+	vTaskSuspendAll();
+	pthread_join( xThread, NULL );
+	xTaskResumeAll();
+	vSemaphoreDelete( xInterruptSemaphore );
+	return ulTaken > 0 && ulTaken <= mainSIMULATED_INTERRUPTS ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSelfDeletingTask( void *pvParameters )
+{
+	( void ) pvParameters;
+	vTaskDelete( NULL );
+}
+
+static void prvBlockedTask( void *pvParameters )
+{
+	( void ) pvParameters;
+	vTaskDelay( portMAX_DELAY );
+}
+
+static void prvWaitForDeletedTasks( UBaseType_t uxRemainingTasks )
+{
+TickType_t xStart = xTaskGetTickCount();
+
+	/* The idle task frees the tasks which deleted themselves when it runs,
+	which may take a while on a busy host. */
+	do
+	{
+		vTaskDelay( pdMS_TO_TICKS( 10 ) );
+	} while( uxTaskGetNumberOfTasks() > uxRemainingTasks && ( xTaskGetTickCount() - xStart ) < mainCHECK_TIMEOUT );
+}
+
+static BaseType_t prvCheckTaskDeletion( void )
+{
+size_t xFreeHeap;
+UBaseType_t uxTasks;
+TaskHandle_t xBlockedTasks[ mainDELETED_TASKS ];
+uint32_t ulTask;
+
+	/* The check, idle and timer tasks remain of the earlier checks. */
+	uxTasks = 3;
+	prvWaitForDeletedTasks( uxTasks );
+	xFreeHeap = xPortGetFreeHeapSize();
+
+	/* Tasks deleting themselves are freed by the idle task, tasks deleted by
+	another task are freed at once. */
+	for( ulTask = 0; ulTask < mainDELETED_TASKS; ulTask++ )
+	{
+		xTaskCreate( prvSelfDeletingTask, "SelfDelete", configMINIMAL_STACK_SIZE, NULL, mainTEST_TASK_PRIORITY, NULL );
+		xTaskCreate( prvBlockedTask, "Blocked", configMINIMAL_STACK_SIZE, NULL, mainTEST_TASK_PRIORITY, &xBlockedTasks[ ulTask ] );
+	}
+	for( ulTask = 0; ulTask < mainDELETED_TASKS; ulTask++ )
+	{
+		vTaskDelete( xBlockedTasks[ ulTask ] );
+	}
+	prvWaitForDeletedTasks( uxTasks );
+
+	return uxTaskGetNumberOfTasks() == uxTasks && xPortGetFreeHeapSize() == xFreeHeap ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static SemaphoreHandle_t xMutex;
+
+static void prvMutexTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	/* Blocks, as the check task holds the mutex. */
+	xSemaphoreTake( xMutex, portMAX_DELAY );
+	xSemaphoreGive( xMutex );
+	vTaskDelete( NULL );
+}
+
+static BaseType_t prvCheckPriorityInheritance( void )
+{
+UBaseType_t uxInheritedPriority, uxRestoredPriority;
+
+	xMutex = xSemaphoreCreateMutex();
+	vQueueAddToRegistry( xMutex, "Mutex" );
+	xSemaphoreTake( xMutex, portMAX_DELAY );
+	xTaskCreate( prvMutexTask, "Mutex", configMINIMAL_STACK_SIZE, NULL, mainHIGH_TASK_PRIORITY, NULL );
+	uxInheritedPriority = uxTaskPriorityGet( NULL );
+	xSemaphoreGive( xMutex );
+	uxRestoredPriority = uxTaskPriorityGet( NULL );
+
+	vTaskDelay( pdMS_TO_TICKS( 10 ) );
+	vSemaphoreDelete( xMutex );
+	return uxInheritedPriority == mainHIGH_TASK_PRIORITY && uxRestoredPriority == mainCHECK_TASK_PRIORITY ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCheckDelayUntil( void )
+{
+TickType_t xLastWakeTime = xTaskGetTickCount(), xStart = xLastWakeTime;
+struct timespec xBefore, xAfter;
+uint64_t ullElapsedMicroseconds;
+uint32_t ulDelay;
+
+	clock_gettime( CLOCK_MONOTONIC, &xBefore );
+	for( ulDelay = 0; ulDelay < mainDELAY_TICKS; ulDelay++ )
+	{
+		vTaskDelayUntil( &xLastWakeTime, 1 );
+	}
+	clock_gettime( CLOCK_MONOTONIC, &xAfter );
+	ullElapsedMicroseconds = ( uint64_t ) ( xAfter.tv_sec - xBefore.tv_sec ) * 1000000ULL + ( uint64_t ) ( xAfter.tv_nsec - xBefore.tv_nsec ) / 1000;
+
+	/* The tick never runs ahead of the host clock, but may be late on a busy
+	host, so the task may wake up more than a tick later. */
+	return xLastWakeTime - xStart == mainDELAY_TICKS && xTaskGetTickCount() - xStart >= mainDELAY_TICKS &&
+		   ullElapsedMicroseconds + 1000000ULL / configTICK_RATE_HZ >= mainDELAY_TICKS * 1000000ULL / configTICK_RATE_HZ ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintf( const char *pcFormat, ... )
+{
+va_list xArguments;
+
+	va_start( xArguments, pcFormat );
+	vTaskSuspendAll();
+	vprintf( pcFormat, xArguments );
+	fflush( stdout );
+	xTaskResumeAll();
+	va_end( xArguments );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWriteTrace( const char *pcFileName )
+{
+const void *pvDump;
+size_t xDumpSize;
+FILE *pxFile;
+BaseType_t xResult = pdFAIL;
+
+	pvDump = pvTraceRecorderGetDump( &xDumpSize );
+	pxFile = fopen( pcFileName, "wb" );
+	if( pxFile != NULL )
+	{
+		if( fwrite( pvDump, 1, xDumpSize, pxFile ) == xDumpSize )
+		{
+			xResult = pdPASS;
+		}
+		if( fclose( pxFile ) != 0 )
+		{
+			xResult = pdFAIL;
+		}
+	}
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+	/* Sleep until the next tick or simulated interrupt, like a WFI instruction
+	would, instead of keeping a host core busy. */
+	pause();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+	vAssertCalled( __FILE__, __LINE__ );
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	fprintf( stderr, "ASSERT! Line %lu, file %s\n", ulLine, pcFile );
+	abort();
+}
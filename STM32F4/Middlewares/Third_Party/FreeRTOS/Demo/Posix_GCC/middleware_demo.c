@@ -0,0 +1,760 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+
+/*
+ * Runs the middleware built on the CMSIS-RTOS2 wrappers on the host, with the
+ * POSIX port, so it can be checked and measured on a build server:
+ *
+ * - the CMSIS-RTOS2 wrappers of Source/CMSIS_RTOS_V2, including the calls made
+ *   from a simulated interrupt and the system timer read from the SysTick
+ *   simulated by portable/ThirdParty/GCC/Posix/CMSIS;
+ * - the lwIP operating system layer of LwIP/system/OS/sys_arch.c, and the
+ *   lwIP stack sending TCP over the loopback interface with the netconn API;
+ * - FatFs with _FS_REENTRANT on a RAM disk, with two threads writing files to
+ *   the same volume at once.
+ *
+ * Each check prints a line, the lwIP and FatFs checks with their throughput,
+ * and the process exits with a non zero status if any check failed:
+ *
+ *     make middleware
+ */
+
+/* Standard includes. */
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cmsis_os2.h"
+
+/* lwIP includes. */
+#include "lwip/api.h"
+#include "lwip/sys.h"
+#include "lwip/tcpip.h"
+
+/* FatFs includes. */
+#include "ff_gen_drv.h"
+
+#define mainPING_PONG_MESSAGES		( 10000UL )
+#define mainSIMULATED_INTERRUPTS	( 100UL )
+#define mainSIMULATED_INTERRUPT		( 2UL )
+#define mainSYS_TIMER_DELAY_MS		( 100UL )
+#define mainTIMER_PERIOD_MS			( 10UL )
+#define mainTIMER_EXPIRIES			( 10UL )
+#define mainMBOX_MESSAGES			( 1000UL )
+#define mainMBOX_TIMEOUT_MS			( 20UL )
+
+/* The TCP transfer over the loopback interface. */
+#define mainTCP_PORT				( 7U )
+#define mainTCP_BYTES				( 8UL * 1024UL * 1024UL )
+#define mainTCP_CHUNK_BYTES			( 16UL * 1024UL )
+
+/* The RAM disk, and the files written to it at once by two threads. */
+#define mainRAM_DISK_SECTOR_SIZE	( 512UL )
+#define mainRAM_DISK_SECTORS		( 8192UL )
+#define mainFILE_BYTES				( 512UL * 1024UL )
+#define mainFILE_CHUNK_BYTES		( 4096UL )
+#define mainFILE_WRITERS			( 2UL )
+
+/* The timeout of every check, so a broken port fails instead of hanging. */
+#define mainCHECK_TIMEOUT_MS		( 5000UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The thread running the checks one after the other, then ending the
+ * scheduler.
+ */
+static void prvCheckThread( void *pvParameters );
+
+/*
+ * The checks, each returning pdPASS or pdFAIL.  The checks measuring a
+ * throughput write it to cResultDetail.
+ */
+static BaseType_t prvCheckMessageQueue( void );
+static BaseType_t prvCheckThreadFlags( void );
+static BaseType_t prvCheckFromInterrupt( void );
+static BaseType_t prvCheckSysTimer( void );
+static BaseType_t prvCheckTimers( void );
+static BaseType_t prvCheckLwipSysArch( void );
+static BaseType_t prvCheckLwipTcp( void );
+static BaseType_t prvCheckFatFs( void );
+
+/*
+ * Prints with the scheduler suspended, as printf() takes a lock.
+ */
+static void prvPrintf( const char *pcFormat, ... );
+
+/*
+ * The throughput of a transfer in kilobytes per second.
+ */
+static uint32_t prvKilobytesPerSecond( uint32_t ulBytes, uint32_t ulMicroseconds );
+
+/*-----------------------------------------------------------*/
+
+static BaseType_t xAllPassed = pdTRUE;
+static char cResultDetail[ 64 ];
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	osKernelInitialize();
+	osThreadNew( prvCheckThread, NULL, NULL );
+
+	/* Returns when the check thread ends the scheduler. */
+	osKernelStart();
+
+	printf( "%s\n", xAllPassed != pdFALSE ? "All checks passed" : "Checks FAILED" );
+	return xAllPassed != pdFALSE ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckThread( void *pvParameters )
+{
+static const struct
+{
+	const char *pcName;
+	BaseType_t (*pxCheck)( void );
+} xChecks[] =
+{
+	{ "cmsis message queue", prvCheckMessageQueue },
+	{ "cmsis thread flags", prvCheckThreadFlags },
+	{ "cmsis from interrupt", prvCheckFromInterrupt },
+	{ "cmsis sys timer", prvCheckSysTimer },
+	{ "cmsis timers", prvCheckTimers },
+	{ "lwip sys_arch", prvCheckLwipSysArch },
+	{ "lwip tcp loopback", prvCheckLwipTcp },
+	{ "fatfs ram disk", prvCheckFatFs }
+};
+size_t x;
+
+	( void ) pvParameters;
+
+	for( x = 0; x < sizeof( xChecks ) / sizeof( xChecks[ 0 ] ); x++ )
+	{
+		BaseType_t xResult;
+
+		cResultDetail[ 0 ] = '\0';
+		xResult = xChecks[ x ].pxCheck();
+
+		prvPrintf( "%-22s %s%s\n", xChecks[ x ].pcName, xResult == pdPASS ? "pass" : "FAIL", cResultDetail );
+		if( xResult != pdPASS )
+		{
+			xAllPassed = pdFALSE;
+		}
+	}
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+static osMessageQueueId_t xPingQueue, xPongQueue;
+
+static void prvPongThread( void *pvParameters )
+{
+uint32_t ulValue;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		osMessageQueueGet( xPingQueue, &ulValue, NULL, osWaitForever );
+		ulValue++;
+		osMessageQueuePut( xPongQueue, &ulValue, 0, osWaitForever );
+	}
+}
+
+static BaseType_t prvCheckMessageQueue( void )
+{
+const osThreadAttr_t xAttributes = { .name = "Pong", .priority = osPriorityAboveNormal };
+osThreadId_t xPongThread;
+uint32_t ulMessage, ulValue;
+BaseType_t xResult = pdPASS;
+
+	xPingQueue = osMessageQueueNew( 1, sizeof( uint32_t ), NULL );
+	xPongQueue = osMessageQueueNew( 1, sizeof( uint32_t ), NULL );
+	xPongThread = osThreadNew( prvPongThread, NULL, &xAttributes );
+
+	for( ulMessage = 0; ulMessage < mainPING_PONG_MESSAGES && xResult == pdPASS; ulMessage++ )
+	{
+		ulValue = ulMessage;
+		if( osMessageQueuePut( xPingQueue, &ulValue, 0, mainCHECK_TIMEOUT_MS ) != osOK ||
+			osMessageQueueGet( xPongQueue, &ulValue, NULL, mainCHECK_TIMEOUT_MS ) != osOK ||
+			ulValue != ulMessage + 1 )
+		{
+			xResult = pdFAIL;
+		}
+	}
+
+	osThreadTerminate( xPongThread );
+	osMessageQueueDelete( xPingQueue );
+	osMessageQueueDelete( xPongQueue );
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+static osThreadId_t xFlagsWaiter;
+
+static void prvFlagsThread( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	/* Wait for both flags, then report back to the check thread. */
+	if( osThreadFlagsWait( 0x3U, osFlagsWaitAll, mainCHECK_TIMEOUT_MS ) == 0x3U )
+	{
+		osThreadFlagsSet( xFlagsWaiter, 0x100U );
+	}
+	osThreadExit();
+}
+
+static BaseType_t prvCheckThreadFlags( void )
+{
+osThreadId_t xThread;
+uint32_t ulFlags;
+
+	xFlagsWaiter = osThreadGetId();
+	xThread = osThreadNew( prvFlagsThread, NULL, NULL );
+
+	osThreadFlagsSet( xThread, 0x1U );
+	osDelay( 1 );
+	osThreadFlagsSet( xThread, 0x2U );
+	ulFlags = osThreadFlagsWait( 0x100U, osFlagsWaitAny, mainCHECK_TIMEOUT_MS );
+
+	return ulFlags == 0x100U ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static osSemaphoreId_t xInterruptSemaphore;
+static volatile BaseType_t xInterruptPathFailed = pdFALSE;
+
+static uint32_t prvSimulatedInterruptHandler( void )
+{
+	/* The wrappers must see the interrupt, refusing to block and releasing
+	the semaphore from the ISR. */
+	if( osDelay( 1 ) != osErrorISR || osSemaphoreRelease( xInterruptSemaphore ) != osOK )
+	{
+		xInterruptPathFailed = pdTRUE;
+	}
+
+	/* osSemaphoreRelease() has already requested the context switch. */
+	return pdFALSE;
+}
+
+static void *prvInterruptThread( void *pvParameters )
+{
+uint32_t ulInterrupt;
+
+	( void ) pvParameters;
+
+	/* Like a peripheral, raise the interrupts from outside the kernel. */
+	for( ulInterrupt = 0; ulInterrupt < mainSIMULATED_INTERRUPTS; ulInterrupt++ )
+	{
+		vPortGenerateSimulatedInterrupt( mainSIMULATED_INTERRUPT );
+		usleep( 200 );
+	}
+	return NULL;
+}
+
+static BaseType_t prvCheckFromInterrupt( void )
+{
+pthread_t xThread;
+uint32_t ulTaken = 0;
+
+	xInterruptSemaphore = osSemaphoreNew( mainSIMULATED_INTERRUPTS, 0, NULL );
+	vPortSetInterruptHandler( mainSIMULATED_INTERRUPT, prvSimulatedInterruptHandler );
+
+	/* Interrupts raised while another is pending are merged, like on
+	hardware, so the semaphore is released at most once per interrupt. */
+	vTaskSuspendAll();
+	pthread_create( &xThread, NULL, prvInterruptThread, NULL );
+	xTaskResumeAll();
+	while( osSemaphoreAcquire( xInterruptSemaphore, 100 ) == osOK )
+	{
+		ulTaken++;
+	}
+
+	vTaskSuspendAll();
+	pthread_join( xThread, NULL );
+	xTaskResumeAll();
+	osSemaphoreDelete( xInterruptSemaphore );
+	return xInterruptPathFailed == pdFALSE && ulTaken > 0 && ulTaken <= mainSIMULATED_INTERRUPTS ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCheckSysTimer( void )
+{
+const uint32_t ulCountsPerMs = osKernelGetSysTimerFreq() / 1000UL;
+uint32_t ulStart, ulPrevious, ulNow, ulRead, ulElapsed;
+BaseType_t xResult = pdPASS;
+
+	/* The count never goes back, also across the ticks. */
+	ulStart = osKernelGetSysTimerCount();
+	ulPrevious = ulStart;
+	for( ulRead = 0; ulRead < 100000UL && xResult == pdPASS; ulRead++ )
+	{
+		ulNow = osKernelGetSysTimerCount();
+		if( ( int32_t ) ( ulNow - ulPrevious ) < 0 )
+		{
+			xResult = pdFAIL;
+		}
+		ulPrevious = ulNow;
+	}
+
+	/* And counts the time of a delay, give or take a tick. */
+	ulStart = osKernelGetSysTimerCount();
+	osDelay( mainSYS_TIMER_DELAY_MS );
+	ulElapsed = osKernelGetSysTimerCount() - ulStart;
+	if( ulElapsed + ulCountsPerMs < mainSYS_TIMER_DELAY_MS * ulCountsPerMs ||
+		ulElapsed > 2UL * mainSYS_TIMER_DELAY_MS * ulCountsPerMs )
+	{
+		xResult = pdFAIL;
+	}
+
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( void *pvArgument )
+{
+	osSemaphoreRelease( ( osSemaphoreId_t ) pvArgument );
+}
+
+static BaseType_t prvCheckTimers( void )
+{
+osSemaphoreId_t xExpired;
+osTimerId_t xTimer;
+uint32_t ulExpiries = 0;
+
+	xExpired = osSemaphoreNew( mainTIMER_EXPIRIES * 2UL, 0, NULL );
+	xTimer = osTimerNew( prvTimerCallback, osTimerPeriodic, xExpired, NULL );
+	osTimerStart( xTimer, mainTIMER_PERIOD_MS );
+	while( ulExpiries < mainTIMER_EXPIRIES && osSemaphoreAcquire( xExpired, mainCHECK_TIMEOUT_MS ) == osOK )
+	{
+		ulExpiries++;
+	}
+
+	osTimerStop( xTimer );
+	osTimerDelete( xTimer );
+	osSemaphoreDelete( xExpired );
+	return ulExpiries == mainTIMER_EXPIRIES ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+static sys_mbox_t xLwipMbox;
+static sys_sem_t xLwipDone;
+
+static void prvMboxProducer( void *pvParameters )
+{
+uintptr_t uxMessage;
+
+	( void ) pvParameters;
+
+	for( uxMessage = 1; uxMessage <= mainMBOX_MESSAGES; uxMessage++ )
+	{
+		sys_mbox_post( &xLwipMbox, ( void * ) uxMessage );
+	}
+	sys_sem_signal( &xLwipDone );
+	osThreadExit();
+}
+
+static BaseType_t prvCheckLwipSysArch( void )
+{
+sys_sem_t xNeverSignalled;
+sys_mutex_t xMutex;
+void *pvMessage;
+uintptr_t uxExpected;
+BaseType_t xResult = pdPASS;
+
+	sys_init();
+	if( sys_mbox_new( &xLwipMbox, 8 ) != ERR_OK || sys_sem_new( &xLwipDone, 0 ) != ERR_OK ||
+		sys_sem_new( &xNeverSignalled, 0 ) != ERR_OK || sys_mutex_new( &xMutex ) != ERR_OK )
+	{
+		return pdFAIL;
+	}
+
+	/* The messages arrive in order through the mailbox. */
+	sys_thread_new( "Producer", prvMboxProducer, NULL, DEFAULT_THREAD_STACKSIZE, DEFAULT_THREAD_PRIO );
+	for( uxExpected = 1; uxExpected <= mainMBOX_MESSAGES && xResult == pdPASS; uxExpected++ )
+	{
+		if( sys_arch_mbox_fetch( &xLwipMbox, &pvMessage, mainCHECK_TIMEOUT_MS ) == SYS_ARCH_TIMEOUT ||
+			( uintptr_t ) pvMessage != uxExpected )
+		{
+			xResult = pdFAIL;
+		}
+	}
+	if( sys_arch_sem_wait( &xLwipDone, mainCHECK_TIMEOUT_MS ) == SYS_ARCH_TIMEOUT )
+	{
+		xResult = pdFAIL;
+	}
+
+	/* Waiting on an empty mailbox or a semaphore times out. */
+	if( sys_arch_mbox_fetch( &xLwipMbox, &pvMessage, mainMBOX_TIMEOUT_MS ) != SYS_ARCH_TIMEOUT ||
+		sys_arch_mbox_tryfetch( &xLwipMbox, &pvMessage ) != SYS_MBOX_EMPTY ||
+		sys_arch_sem_wait( &xNeverSignalled, mainMBOX_TIMEOUT_MS ) != SYS_ARCH_TIMEOUT )
+	{
+		xResult = pdFAIL;
+	}
+
+	sys_mutex_lock( &xMutex );
+	sys_mutex_unlock( &xMutex );
+
+	sys_mutex_free( &xMutex );
+	sys_sem_free( &xNeverSignalled );
+	sys_sem_free( &xLwipDone );
+	sys_mbox_free( &xLwipMbox );
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+static volatile uint32_t ulTcpBytesReceived;
+
+static void prvTcpInitDone( void *pvArgument )
+{
+	sys_sem_signal( ( sys_sem_t * ) pvArgument );
+}
+
+static void prvTcpServerThread( void *pvParameters )
+{
+struct netconn *pxListener, *pxConnection;
+struct pbuf *pxBuffer;
+
+	( void ) pvParameters;
+
+	pxListener = netconn_new( NETCONN_TCP );
+	if( netconn_bind( pxListener, IP_ADDR_ANY, mainTCP_PORT ) == ERR_OK && netconn_listen( pxListener ) == ERR_OK )
+	{
+		sys_sem_signal( &xLwipDone );
+		if( netconn_accept( pxListener, &pxConnection ) == ERR_OK )
+		{
+			while( netconn_recv_tcp_pbuf( pxConnection, &pxBuffer ) == ERR_OK )
+			{
+				ulTcpBytesReceived += pxBuffer->tot_len;
+				pbuf_free( pxBuffer );
+			}
+			netconn_close( pxConnection );
+			netconn_delete( pxConnection );
+		}
+	}
+	netconn_close( pxListener );
+	netconn_delete( pxListener );
+	sys_sem_signal( &xLwipDone );
+	osThreadExit();
+}
+
+static BaseType_t prvCheckLwipTcp( void )
+{
+static uint8_t ucChunk[ mainTCP_CHUNK_BYTES ];
+struct netconn *pxConnection;
+ip_addr_t xLoopback;
+uint32_t ulSent, ulStart, ulElapsed;
+BaseType_t xResult = pdPASS;
+
+	if( sys_sem_new( &xLwipDone, 0 ) != ERR_OK )
+	{
+		return pdFAIL;
+	}
+	tcpip_init( prvTcpInitDone, &xLwipDone );
+	sys_arch_sem_wait( &xLwipDone, 0 );
+
+	/* Wait for the server to listen before connecting. */
+	sys_thread_new( "Server", prvTcpServerThread, NULL, DEFAULT_THREAD_STACKSIZE, DEFAULT_THREAD_PRIO );
+	if( sys_arch_sem_wait( &xLwipDone, mainCHECK_TIMEOUT_MS ) == SYS_ARCH_TIMEOUT )
+	{
+		return pdFAIL;
+	}
+
+	memset( ucChunk, 0x5a, sizeof( ucChunk ) );
+	IP_ADDR4( &xLoopback, 127, 0, 0, 1 );
+	pxConnection = netconn_new( NETCONN_TCP );
+	ulStart = ulPortGetHostMicroseconds();
+	if( netconn_connect( pxConnection, &xLoopback, mainTCP_PORT ) == ERR_OK )
+	{
+		for( ulSent = 0; ulSent < mainTCP_BYTES && xResult == pdPASS; ulSent += sizeof( ucChunk ) )
+		{
+			if( netconn_write( pxConnection, ucChunk, sizeof( ucChunk ), NETCONN_NOCOPY ) != ERR_OK )
+			{
+				xResult = pdFAIL;
+			}
+		}
+	}
+	else
+	{
+		xResult = pdFAIL;
+	}
+	netconn_close( pxConnection );
+	netconn_delete( pxConnection );
+
+	/* The server has received everything once it sees the connection close. */
+	if( sys_arch_sem_wait( &xLwipDone, mainCHECK_TIMEOUT_MS ) == SYS_ARCH_TIMEOUT || ulTcpBytesReceived != mainTCP_BYTES )
+	{
+		xResult = pdFAIL;
+	}
+	ulElapsed = ulPortGetHostMicroseconds() - ulStart;
+	snprintf( cResultDetail, sizeof( cResultDetail ), "  %lu KB/s", ( unsigned long ) prvKilobytesPerSecond( ulTcpBytesReceived, ulElapsed ) );
+
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+static uint8_t ucRamDisk[ mainRAM_DISK_SECTORS * mainRAM_DISK_SECTOR_SIZE ];
+
+static DSTATUS prvRamDiskInitialize( BYTE ucLun )
+{
+	( void ) ucLun;
+	return 0;
+}
+
+static DSTATUS prvRamDiskStatus( BYTE ucLun )
+{
+	( void ) ucLun;
+	return 0;
+}
+
+static DRESULT prvRamDiskRead( BYTE ucLun, BYTE *pucBuffer, DWORD ulSector, UINT uxCount )
+{
+	( void ) ucLun;
+	memcpy( pucBuffer, &ucRamDisk[ ulSector * mainRAM_DISK_SECTOR_SIZE ], uxCount * mainRAM_DISK_SECTOR_SIZE );
+	return RES_OK;
+}
+
+static DRESULT prvRamDiskWrite( BYTE ucLun, const BYTE *pucBuffer, DWORD ulSector, UINT uxCount )
+{
+	( void ) ucLun;
+	memcpy( &ucRamDisk[ ulSector * mainRAM_DISK_SECTOR_SIZE ], pucBuffer, uxCount * mainRAM_DISK_SECTOR_SIZE );
+	return RES_OK;
+}
+
+static DRESULT prvRamDiskIoctl( BYTE ucLun, BYTE ucCommand, void *pvBuffer )
+{
+DRESULT xResult = RES_OK;
+
+	( void ) ucLun;
+
+	switch( ucCommand )
+	{
+		case CTRL_SYNC:
+			break;
+		case GET_SECTOR_COUNT:
+			*( DWORD * ) pvBuffer = mainRAM_DISK_SECTORS;
+			break;
+		case GET_SECTOR_SIZE:
+			*( WORD * ) pvBuffer = mainRAM_DISK_SECTOR_SIZE;
+			break;
+		case GET_BLOCK_SIZE:
+			*( DWORD * ) pvBuffer = 1;
+			break;
+		default:
+			xResult = RES_PARERR;
+			break;
+	}
+	return xResult;
+}
+
+static const Diskio_drvTypeDef xRamDiskDriver =
+{
+	prvRamDiskInitialize,
+	prvRamDiskStatus,
+	prvRamDiskRead,
+	prvRamDiskWrite,
+	prvRamDiskIoctl
+};
+
+static char cRamDiskPath[ 4 ];
+static osSemaphoreId_t xFileWritten;
+static volatile BaseType_t xFileWriteFailed = pdFALSE;
+
+static void prvFileWriterThread( void *pvParameters )
+{
+static uint8_t ucChunks[ mainFILE_WRITERS ][ mainFILE_CHUNK_BYTES ];
+const uint32_t ulWriter = ( uint32_t ) ( uintptr_t ) pvParameters;
+char cName[ 32 ];
+FIL xFile;
+UINT uxWritten;
+uint32_t ulOffset;
+
+	snprintf( cName, sizeof( cName ), "%sw%lu.bin", cRamDiskPath, ( unsigned long ) ulWriter );
+	memset( ucChunks[ ulWriter ], ( int ) ( 'a' + ulWriter ), mainFILE_CHUNK_BYTES );
+
+	if( f_open( &xFile, cName, FA_CREATE_ALWAYS | FA_WRITE ) == FR_OK )
+	{
+		for( ulOffset = 0; ulOffset < mainFILE_BYTES; ulOffset += mainFILE_CHUNK_BYTES )
+		{
+			if( f_write( &xFile, ucChunks[ ulWriter ], mainFILE_CHUNK_BYTES, &uxWritten ) != FR_OK || uxWritten != mainFILE_CHUNK_BYTES )
+			{
+				xFileWriteFailed = pdTRUE;
+			}
+
+			/* Let the other writer in between the chunks. */
+			osThreadYield();
+		}
+		if( f_close( &xFile ) != FR_OK )
+		{
+			xFileWriteFailed = pdTRUE;
+		}
+	}
+	else
+	{
+		xFileWriteFailed = pdTRUE;
+	}
+
+	osSemaphoreRelease( xFileWritten );
+	osThreadExit();
+}
+
+static BaseType_t prvCheckFatFs( void )
+{
+static FATFS xFileSystem;
+static uint8_t ucWork[ _MAX_SS ];
+static uint8_t ucChunk[ mainFILE_CHUNK_BYTES ];
+char cName[ 32 ];
+FIL xFile;
+UINT uxRead;
+uint32_t ulWriter, ulOffset, ulByte, ulStart, ulElapsed;
+BaseType_t xResult = pdPASS;
+
+	if( FATFS_LinkDriver( &xRamDiskDriver, cRamDiskPath ) != 0 ||
+		f_mkfs( cRamDiskPath, FM_ANY, 0, ucWork, sizeof( ucWork ) ) != FR_OK ||
+		f_mount( &xFileSystem, cRamDiskPath, 1 ) != FR_OK )
+	{
+		return pdFAIL;
+	}
+
+	/* The writers share the volume, each access locked by the mutex of
+	option/syscall.c. */
+	xFileWritten = osSemaphoreNew( mainFILE_WRITERS, 0, NULL );
+	ulStart = ulPortGetHostMicroseconds();
+	for( ulWriter = 0; ulWriter < mainFILE_WRITERS; ulWriter++ )
+	{
+		osThreadNew( prvFileWriterThread, ( void * ) ( uintptr_t ) ulWriter, NULL );
+	}
+	for( ulWriter = 0; ulWriter < mainFILE_WRITERS; ulWriter++ )
+	{
+		if( osSemaphoreAcquire( xFileWritten, mainCHECK_TIMEOUT_MS ) != osOK )
+		{
+			xResult = pdFAIL;
+		}
+	}
+	ulElapsed = ulPortGetHostMicroseconds() - ulStart;
+	if( xFileWriteFailed != pdFALSE )
+	{
+		xResult = pdFAIL;
+	}
+
+	/* Each file reads back as written by its writer. */
+	for( ulWriter = 0; ulWriter < mainFILE_WRITERS && xResult == pdPASS; ulWriter++ )
+	{
+		snprintf( cName, sizeof( cName ), "%sw%lu.bin", cRamDiskPath, ( unsigned long ) ulWriter );
+		if( f_open( &xFile, cName, FA_READ ) != FR_OK || f_size( &xFile ) != mainFILE_BYTES )
+		{
+			xResult = pdFAIL;
+			break;
+		}
+		for( ulOffset = 0; ulOffset < mainFILE_BYTES && xResult == pdPASS; ulOffset += mainFILE_CHUNK_BYTES )
+		{
+			if( f_read( &xFile, ucChunk, sizeof( ucChunk ), &uxRead ) != FR_OK || uxRead != sizeof( ucChunk ) )
+			{
+				xResult = pdFAIL;
+			}
+			for( ulByte = 0; ulByte < sizeof( ucChunk ) && xResult == pdPASS; ulByte++ )
+			{
+				if( ucChunk[ ulByte ] != ( uint8_t ) ( 'a' + ulWriter ) )
+				{
+					xResult = pdFAIL;
+				}
+			}
+		}
+		f_close( &xFile );
+	}
+
+	f_mount( NULL, cRamDiskPath, 0 );
+	FATFS_UnLinkDriver( cRamDiskPath );
+	osSemaphoreDelete( xFileWritten );
+	snprintf( cResultDetail, sizeof( cResultDetail ), "  %lu KB/s written", ( unsigned long ) prvKilobytesPerSecond( mainFILE_WRITERS * mainFILE_BYTES, ulElapsed ) );
+
+	return xResult;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvKilobytesPerSecond( uint32_t ulBytes, uint32_t ulMicroseconds )
+{
+	if( ulMicroseconds == 0 )
+	{
+		ulMicroseconds = 1;
+	}
+	return ( uint32_t ) ( ( ( uint64_t ) ulBytes * 1000000ULL / 1024ULL ) / ulMicroseconds );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintf( const char *pcFormat, ... )
+{
+va_list xArguments;
+
+	va_start( xArguments, pcFormat );
+	vTaskSuspendAll();
+	vprintf( pcFormat, xArguments );
+	fflush( stdout );
+	xTaskResumeAll();
+	va_end( xArguments );
+}
+/*-----------------------------------------------------------*/
+
+u32_t sys_now( void )
+{
+	/* lwIP leaves the clock of its timeouts to the application, which the
+ethernetif.c of the boards takes from the HAL tick. */
+	return ( u32_t ) ( ( uint64_t ) osKernelGetTickCount() * 1000ULL / osKernelGetTickFreq() );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+	/* Sleep until the next tick or simulated interrupt, like a WFI instruction
+	would, instead of keeping a host core busy. */
+	pause();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+	vAssertCalled( __FILE__, __LINE__ );
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	fprintf( stderr, "ASSERT! Line %lu, file %s\n", ulLine, pcFile );
+	abort();
+}
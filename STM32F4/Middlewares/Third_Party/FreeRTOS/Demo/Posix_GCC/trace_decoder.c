@@ -0,0 +1,687 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * Converts a dump of the trace recorder of trace_recorder.c to JSON in the
+ * Chrome trace event format, which can be opened in chrome://tracing or
+ * Perfetto (ui.perfetto.dev):
+ *
+ *     ./build/trace_decoder recorder.dump [trace.json]
+ *
+ * The dump is the block of memory returned by pvTraceRecorderGetDump(),
+ * written out by the application or dumped with a debugger, e.g. with GDB:
+ *
+ *     dump binary value recorder.dump xTraceRecorder
+ *
+ * The trace shows which task runs on a CPU track per core, and a track per
+ * task with the time it runs, the time it waits to run once ready, and the
+ * kernel events of the task.  The interrupts of each core and each user event
+ * channel have a track of their own, and the priority of each task is a
+ * counter, so priority inheritance is visible.  A summary of each task, with
+ * the longest time it waited to run once ready, is printed on stderr to find
+ * latency spikes.
+ *
+ * The events of the cores are merged in the order of their timestamps, which
+ * the events of a core are not quite in when an interrupt logged an event in
+ * the middle of logging another, see trace_recorder.h.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Kernel includes, for the format of the recorder. */
+#include "FreeRTOS.h"
+#include "trace_recorder.h"
+
+#define decoderHEADER_WORDS			( 9UL )
+#define decoderEVENT_WORDS			( 4UL )
+#define decoderMAX_ISR_NESTING		( 32UL )
+#define decoderMAX_CORES			( 16UL )
+
+/* The tracks, the CPU and the interrupts of each core, with the tasks and
+user event channels after them. */
+#define decoderCPU_TRACK( ulCore )			( 1UL + 2UL * ( ulCore ) )
+#define decoderINTERRUPT_TRACK( ulCore )	( 2UL + 2UL * ( ulCore ) )
+#define decoderFIRST_OBJECT_TRACK			( 1UL + 2UL * decoderMAX_CORES )
+
+/*-----------------------------------------------------------*/
+
+typedef struct DECODER_OBJECT
+{
+	uint32_t ulHandle;
+	uint32_t ulKind;
+	char pcName[ traceRECORDER_NAME_LENGTH + 12 ];
+	uint32_t ulTrack;
+
+	/* For tasks. */
+	uint64_t ullReadyTime;
+	BaseType_t xReady;
+	uint32_t ulPriority;
+	uint32_t ulSwitches;
+	uint64_t ullRunningTime;
+	uint64_t ullMaxReadyTime;
+	uint64_t ullMaxReadyAt;
+} DecoderObject_t;
+
+typedef struct DECODER_EVENT
+{
+	uint64_t ullTime;
+	uint32_t ulCore;
+	uint32_t ulSequence;
+	uint32_t ulType;
+	uint32_t ulHandle;
+	uint32_t ulValue;
+} DecoderEvent_t;
+
+/* What runs on a core. */
+typedef struct DECODER_CORE
+{
+	DecoderObject_t *pxRunning;
+	uint64_t ullRunningSince;
+	uint32_t ulISRNesting;
+	uint64_t ullISRStart[ decoderMAX_ISR_NESTING ];
+} DecoderCore_t;
+
+typedef struct DECODER
+{
+	const uint8_t *pucDump;
+	BaseType_t xSwapBytes;
+	uint32_t ulFrequency;
+	DecoderObject_t *pxObjects;
+	uint32_t ulObjects;
+	uint32_t ulMaxObjects;
+	FILE *pxOutput;
+	BaseType_t xFirstOutput;
+} Decoder_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Reads a 32 bit word of the dump, in the byte order of the target.
+ */
+static uint32_t prvReadWord( const Decoder_t *pxDecoder, size_t xOffset );
+
+/*
+ * Returns the object with the handle, adding an unnamed one if the recorder
+ * had no room for it.
+ */
+static DecoderObject_t *prvGetObject( Decoder_t *pxDecoder, uint32_t ulHandle, BaseType_t xIsAddress, uint32_t ulKind );
+
+/*
+ * Writes one trace event, each argument a "name":value pair in JSON.
+ */
+static void prvWriteEvent( Decoder_t *pxDecoder, const char *pcPhase, const char *pcName, uint32_t ulTrack, double dTime, double dDuration, const char *pcArguments );
+
+/*
+ * Writes the name of a track.
+ */
+static void prvWriteTrackName( Decoder_t *pxDecoder, uint32_t ulTrack, const char *pcName, uint32_t ulSortIndex );
+
+/*
+ * Converts a timestamp to the microseconds of the trace.
+ */
+static double prvMicroseconds( const Decoder_t *pxDecoder, uint64_t ullTime );
+
+/*
+ * Copies a name, escaping the characters JSON requires.
+ */
+static void prvEscape( char *pcDestination, size_t xSize, const char *pcSource );
+
+/*
+ * Orders the events by time, and the events with the same time by core and
+ * by their order in the buffer of the core, for qsort().
+ */
+static int prvCompareEvents( const void *pvFirst, const void *pvSecond );
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvReadWord( const Decoder_t *pxDecoder, size_t xOffset )
+{
+const uint8_t *pucWord = pxDecoder->pucDump + xOffset;
+uint32_t ulWord;
+
+	/* Both the targets and the hosts are little endian, but a big endian
+	target is detected from the magic number. */
+	ulWord = ( uint32_t ) pucWord[ 0 ] | ( ( uint32_t ) pucWord[ 1 ] << 8 ) | ( ( uint32_t ) pucWord[ 2 ] << 16 ) | ( ( uint32_t ) pucWord[ 3 ] << 24 );
+	if( pxDecoder->xSwapBytes != pdFALSE )
+	{
+		ulWord = ( ulWord >> 24 ) | ( ( ulWord >> 8 ) & 0xff00UL ) | ( ( ulWord << 8 ) & 0xff0000UL ) | ( ulWord << 24 );
+	}
+	return ulWord;
+}
+/*-----------------------------------------------------------*/
+
+static DecoderObject_t *prvGetObject( Decoder_t *pxDecoder, uint32_t ulHandle, BaseType_t xIsAddress, uint32_t ulKind )
+{
+DecoderObject_t *pxObject;
+uint32_t ulObject;
+static const char * const pcUnnamed[] = { "", "Task", "Queue", "Mutex", "Counting semaphore", "Binary semaphore", "Recursive mutex", "Interrupt", "Channel" };
+
+	for( ulObject = 0; ulObject < pxDecoder->ulObjects; ulObject++ )
+	{
+		pxObject = &( pxDecoder->pxObjects[ ulObject ] );
+		if( pxObject->ulHandle == ulHandle && ( pxObject->ulKind < traceRECORDER_OBJECT_INTERRUPT ) == ( xIsAddress != pdFALSE ) )
+		{
+			return pxObject;
+		}
+	}
+
+	if( pxDecoder->ulObjects == pxDecoder->ulMaxObjects )
+	{
+		pxDecoder->ulMaxObjects = pxDecoder->ulMaxObjects * 2 + 16;
+		pxDecoder->pxObjects = realloc( pxDecoder->pxObjects, pxDecoder->ulMaxObjects * sizeof( DecoderObject_t ) );
+		if( pxDecoder->pxObjects == NULL )
+		{
+			fprintf( stderr, "Out of memory\n" );
+			exit( EXIT_FAILURE );
+		}
+	}
+
+	pxObject = &( pxDecoder->pxObjects[ pxDecoder->ulObjects ] );
+	memset( pxObject, 0, sizeof( DecoderObject_t ) );
+	pxObject->ulHandle = ulHandle;
+	pxObject->ulKind = ulKind;
+	pxObject->ulTrack = decoderFIRST_OBJECT_TRACK + pxDecoder->ulObjects;
+	if( xIsAddress != pdFALSE )
+	{
+		snprintf( pxObject->pcName, sizeof( pxObject->pcName ), "%s 0x%08lx", pcUnnamed[ ulKind < traceRECORDER_OBJECT_CHANNEL ? ulKind : 0 ], ( unsigned long ) ulHandle );
+	}
+	else
+	{
+		snprintf( pxObject->pcName, sizeof( pxObject->pcName ), "%s %lu", pcUnnamed[ ulKind <= traceRECORDER_OBJECT_CHANNEL ? ulKind : 0 ], ( unsigned long ) ulHandle );
+	}
+	pxDecoder->ulObjects++;
+	return pxObject;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteEvent( Decoder_t *pxDecoder, const char *pcPhase, const char *pcName, uint32_t ulTrack, double dTime, double dDuration, const char *pcArguments )
+{
+	fprintf( pxDecoder->pxOutput, "%s{\"ph\":\"%s\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"name\":\"%s\"", pxDecoder->xFirstOutput != pdFALSE ? "" : ",\n", pcPhase, ( unsigned long ) ulTrack, dTime, pcName );
+	pxDecoder->xFirstOutput = pdFALSE;
+	if( pcPhase[ 0 ] == 'X' )
+	{
+		fprintf( pxDecoder->pxOutput, ",\"dur\":%.3f", dDuration );
+	}
+	else if( pcPhase[ 0 ] == 'i' )
+	{
+		fprintf( pxDecoder->pxOutput, ",\"s\":\"t\"" );
+	}
+	fprintf( pxDecoder->pxOutput, ",\"args\":{%s}}", pcArguments != NULL ? pcArguments : "" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteTrackName( Decoder_t *pxDecoder, uint32_t ulTrack, const char *pcName, uint32_t ulSortIndex )
+{
+	fprintf( pxDecoder->pxOutput, "%s{\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"name\":\"thread_name\",\"args\":{\"name\":\"%s\"}},\n", pxDecoder->xFirstOutput != pdFALSE ? "" : ",\n", ( unsigned long ) ulTrack, pcName );
+	fprintf( pxDecoder->pxOutput, "{\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":%lu}}", ( unsigned long ) ulTrack, ( unsigned long ) ulSortIndex );
+	pxDecoder->xFirstOutput = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static double prvMicroseconds( const Decoder_t *pxDecoder, uint64_t ullTime )
+{
+	return ( double ) ullTime * 1000000.0 / ( double ) pxDecoder->ulFrequency;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEscape( char *pcDestination, size_t xSize, const char *pcSource )
+{
+size_t xLength = 0;
+
+	while( *pcSource != '\0' && xLength + 7 < xSize )
+	{
+		if( *pcSource == '"' || *pcSource == '\\' )
+		{
+			pcDestination[ xLength++ ] = '\\';
+			pcDestination[ xLength++ ] = *pcSource;
+		}
+		else if( ( unsigned char ) *pcSource < 0x20 )
+		{
+			xLength += ( size_t ) snprintf( pcDestination + xLength, xSize - xLength, "\\u%04x", ( unsigned int ) ( unsigned char ) *pcSource );
+		}
+		else
+		{
+			pcDestination[ xLength++ ] = *pcSource;
+		}
+		pcSource++;
+	}
+	pcDestination[ xLength ] = '\0';
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareEvents( const void *pvFirst, const void *pvSecond )
+{
+const DecoderEvent_t *pxFirst = pvFirst, *pxSecond = pvSecond;
+
+	if( pxFirst->ullTime != pxSecond->ullTime )
+	{
+		return pxFirst->ullTime < pxSecond->ullTime ? -1 : 1;
+	}
+	if( pxFirst->ulCore != pxSecond->ulCore )
+	{
+		return pxFirst->ulCore < pxSecond->ulCore ? -1 : 1;
+	}
+	return pxFirst->ulSequence < pxSecond->ulSequence ? -1 : ( pxFirst->ulSequence > pxSecond->ulSequence ? 1 : 0 );
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+static const char * const pcEventNames[] =
+{
+	"", "Switched in", "Ready", "Delay", "Delay until", "Priority set", "Priority inherit", "Priority disinherit", "Delete",
+	"Notify", "Notify from ISR", "Notify wait", "Notify wait block", "Send", "Send failed", "Send from ISR",
+	"Receive", "Receive failed", "Receive from ISR", "Peek", "Blocking on send", "Blocking on receive", "ISR enter", "ISR exit", "User", "Delete"
+};
+Decoder_t xDecoder;
+DecoderObject_t *pxObject, *pxEventObject;
+DecoderEvent_t *pxEvents, *pxEvent;
+DecoderCore_t *pxCores, *pxCore;
+FILE *pxInput;
+uint8_t *pucDump;
+long lDumpSize;
+uint32_t ulEventCapacity, ulObjectCapacity, ulNameLength, ulCores, ulCoreEvents, ulLogged, ulEvents = 0, ulLostEvents = 0, ulObjects;
+uint32_t ulObject, ulCore, ulEvent, ulIndex, ulType, ulHandle, ulValue, ulTimestamp, ulReferenceTimestamp = 0, ulPreviousTimestamp = 0;
+uint32_t ulIgnored = 0;
+int64_t llTime, llEarliest = 0;
+uint64_t ullTime = 0;
+size_t xObjectSize, xCoresOffset, xObjectsOffset, xEventsOffset, xOffset;
+char pcName[ 2 * ( traceRECORDER_NAME_LENGTH + 12 ) ], pcEventName[ 128 ], pcArguments[ 128 ];
+BaseType_t xIsAddress, xHasReference = pdFALSE;
+
+	if( argc < 2 || argc > 3 )
+	{
+		fprintf( stderr, "Usage: %s <recorder dump> [<trace.json>]\n", argv[ 0 ] );
+		return EXIT_FAILURE;
+	}
+
+	/* Read the whole dump. */
+	pxInput = fopen( argv[ 1 ], "rb" );
+	if( pxInput == NULL || fseek( pxInput, 0, SEEK_END ) != 0 || ( lDumpSize = ftell( pxInput ) ) < 0 || fseek( pxInput, 0, SEEK_SET ) != 0 )
+	{
+		fprintf( stderr, "Cannot read %s\n", argv[ 1 ] );
+		return EXIT_FAILURE;
+	}
+	pucDump = malloc( ( size_t ) lDumpSize + 1 );
+	if( pucDump == NULL || fread( pucDump, 1, ( size_t ) lDumpSize, pxInput ) != ( size_t ) lDumpSize )
+	{
+		fprintf( stderr, "Cannot read %s\n", argv[ 1 ] );
+		return EXIT_FAILURE;
+	}
+	fclose( pxInput );
+
+	memset( &xDecoder, 0, sizeof( xDecoder ) );
+	xDecoder.pucDump = pucDump;
+	xDecoder.xFirstOutput = pdTRUE;
+
+	/* Check the header. */
+	if( ( size_t ) lDumpSize < decoderHEADER_WORDS * sizeof( uint32_t ) )
+	{
+		fprintf( stderr, "%s is not a trace recorder dump\n", argv[ 1 ] );
+		return EXIT_FAILURE;
+	}
+	if( prvReadWord( &xDecoder, 0 ) != traceRECORDER_MAGIC )
+	{
+		xDecoder.xSwapBytes = pdTRUE;
+		if( prvReadWord( &xDecoder, 0 ) != traceRECORDER_MAGIC )
+		{
+			fprintf( stderr, "%s is not a trace recorder dump\n", argv[ 1 ] );
+			return EXIT_FAILURE;
+		}
+	}
+	if( prvReadWord( &xDecoder, 4 ) != traceRECORDER_VERSION )
+	{
+		fprintf( stderr, "%s is version %lu of the trace recorder, not %lu\n", argv[ 1 ], ( unsigned long ) prvReadWord( &xDecoder, 4 ), ( unsigned long ) traceRECORDER_VERSION );
+		return EXIT_FAILURE;
+	}
+	xDecoder.ulFrequency = prvReadWord( &xDecoder, 8 );
+	ulEventCapacity = prvReadWord( &xDecoder, 12 );
+	ulObjectCapacity = prvReadWord( &xDecoder, 16 );
+	ulNameLength = prvReadWord( &xDecoder, 20 );
+	ulCores = prvReadWord( &xDecoder, 28 );
+	ulObjects = prvReadWord( &xDecoder, 32 );
+
+	xObjectSize = 2 * sizeof( uint32_t ) + ulNameLength;
+	xCoresOffset = decoderHEADER_WORDS * sizeof( uint32_t );
+	xObjectsOffset = xCoresOffset + ( size_t ) ulCores * sizeof( uint32_t );
+	xEventsOffset = xObjectsOffset + ( size_t ) ulObjectCapacity * xObjectSize;
+	if( xDecoder.ulFrequency == 0 || ulNameLength > traceRECORDER_NAME_LENGTH || ulObjects > ulObjectCapacity || ulEventCapacity == 0 ||
+		( ulEventCapacity & ( ulEventCapacity - 1 ) ) != 0 || ulCores == 0 || ulCores > decoderMAX_CORES ||
+		( size_t ) lDumpSize < xEventsOffset + ( size_t ) ulCores * ulEventCapacity * decoderEVENT_WORDS * sizeof( uint32_t ) )
+	{
+		fprintf( stderr, "%s is truncated or corrupt\n", argv[ 1 ] );
+		return EXIT_FAILURE;
+	}
+
+	/* The named objects, with a track for each task and user event channel. */
+	for( ulObject = 0; ulObject < ulObjects; ulObject++ )
+	{
+		xOffset = xObjectsOffset + ulObject * xObjectSize;
+		ulHandle = prvReadWord( &xDecoder, xOffset );
+		ulType = pucDump[ xOffset + 4 ] & ~traceRECORDER_OBJECT_DELETED;
+		pxObject = prvGetObject( &xDecoder, ulHandle, ulType < traceRECORDER_OBJECT_INTERRUPT ? pdTRUE : pdFALSE, ulType );
+		memcpy( pcName, pucDump + xOffset + 8, ulNameLength );
+		pcName[ ulNameLength ] = '\0';
+		if( pcName[ 0 ] != '\0' )
+		{
+			prvEscape( pxObject->pcName, sizeof( pxObject->pcName ), pcName );
+		}
+	}
+
+	if( argc == 3 )
+	{
+		xDecoder.pxOutput = fopen( argv[ 2 ], "w" );
+		if( xDecoder.pxOutput == NULL )
+		{
+			fprintf( stderr, "Cannot write %s\n", argv[ 2 ] );
+			return EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		xDecoder.pxOutput = stdout;
+	}
+
+	fprintf( xDecoder.pxOutput, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n" );
+	fprintf( xDecoder.pxOutput, "{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"FreeRTOS\"}}" );
+	xDecoder.xFirstOutput = pdFALSE;
+	for( ulCore = 0; ulCore < ulCores; ulCore++ )
+	{
+		if( ulCores == 1 )
+		{
+			prvWriteTrackName( &xDecoder, decoderCPU_TRACK( ulCore ), "CPU", decoderCPU_TRACK( ulCore ) );
+			prvWriteTrackName( &xDecoder, decoderINTERRUPT_TRACK( ulCore ), "Interrupts", decoderINTERRUPT_TRACK( ulCore ) );
+		}
+		else
+		{
+			snprintf( pcName, sizeof( pcName ), "CPU %lu", ( unsigned long ) ulCore );
+			prvWriteTrackName( &xDecoder, decoderCPU_TRACK( ulCore ), pcName, decoderCPU_TRACK( ulCore ) );
+			snprintf( pcName, sizeof( pcName ), "Interrupts %lu", ( unsigned long ) ulCore );
+			prvWriteTrackName( &xDecoder, decoderINTERRUPT_TRACK( ulCore ), pcName, decoderINTERRUPT_TRACK( ulCore ) );
+		}
+	}
+
+	/* The events of each core, oldest first.  The timestamps wrap around, so
+	each is taken relative to the one before, and the first of a core relative
+	to the first of the first core. */
+	pxEvents = malloc( ( size_t ) ulCores * ulEventCapacity * sizeof( DecoderEvent_t ) + 1 );
+	pxCores = calloc( ulCores, sizeof( DecoderCore_t ) );
+	if( pxEvents == NULL || pxCores == NULL )
+	{
+		fprintf( stderr, "Out of memory\n" );
+		return EXIT_FAILURE;
+	}
+	for( ulCore = 0; ulCore < ulCores; ulCore++ )
+	{
+		ulLogged = prvReadWord( &xDecoder, xCoresOffset + ulCore * sizeof( uint32_t ) );
+		ulCoreEvents = ulLogged < ulEventCapacity ? ulLogged : ulEventCapacity;
+		ulLostEvents += ulLogged - ulCoreEvents;
+		llTime = 0;
+		for( ulEvent = 0; ulEvent < ulCoreEvents; ulEvent++ )
+		{
+			ulIndex = ( ulLogged - ulCoreEvents + ulEvent ) & ( ulEventCapacity - 1 );
+			xOffset = xEventsOffset + ( ( size_t ) ulCore * ulEventCapacity + ulIndex ) * decoderEVENT_WORDS * sizeof( uint32_t );
+			ulTimestamp = prvReadWord( &xDecoder, xOffset );
+			ulType = prvReadWord( &xDecoder, xOffset + 12 );
+
+			/* An event still being written has no type, and no timestamp yet. */
+			if( ulType == 0 || ulType > traceRECORDER_EVENT_QUEUE_DELETE )
+			{
+				ulIgnored++;
+				continue;
+			}
+
+			if( xHasReference == pdFALSE )
+			{
+				ulReferenceTimestamp = ulTimestamp;
+				xHasReference = pdTRUE;
+			}
+			llTime = ( ulEvents == 0 || pxEvents[ ulEvents - 1 ].ulCore != ulCore ) ?
+					 ( int64_t ) ( int32_t ) ( ulTimestamp - ulReferenceTimestamp ) :
+					 llTime + ( int64_t ) ( int32_t ) ( ulTimestamp - ulPreviousTimestamp );
+			ulPreviousTimestamp = ulTimestamp;
+			if( llTime < llEarliest )
+			{
+				llEarliest = llTime;
+			}
+
+			pxEvent = &( pxEvents[ ulEvents++ ] );
+			pxEvent->ullTime = ( uint64_t ) llTime;
+			pxEvent->ulCore = ulCore;
+			pxEvent->ulSequence = ulEvent;
+			pxEvent->ulType = ulType;
+			pxEvent->ulHandle = prvReadWord( &xDecoder, xOffset + 4 );
+			pxEvent->ulValue = prvReadWord( &xDecoder, xOffset + 8 );
+		}
+	}
+
+	/* The times made relative to the earliest event. */
+	for( ulEvent = 0; ulEvent < ulEvents; ulEvent++ )
+	{
+		pxEvents[ ulEvent ].ullTime = ( uint64_t ) ( ( int64_t ) pxEvents[ ulEvent ].ullTime - llEarliest );
+	}
+	qsort( pxEvents, ulEvents, sizeof( DecoderEvent_t ), prvCompareEvents );
+
+	for( ulEvent = 0; ulEvent < ulEvents; ulEvent++ )
+	{
+		pxEvent = &( pxEvents[ ulEvent ] );
+		pxCore = &( pxCores[ pxEvent->ulCore ] );
+		ullTime = pxEvent->ullTime;
+		ulType = pxEvent->ulType;
+		ulHandle = pxEvent->ulHandle;
+		ulValue = pxEvent->ulValue;
+
+		xIsAddress = ( ulType != traceRECORDER_EVENT_ISR_ENTER && ulType != traceRECORDER_EVENT_ISR_EXIT && ulType != traceRECORDER_EVENT_USER ) ? pdTRUE : pdFALSE;
+		if( ulType == traceRECORDER_EVENT_ISR_ENTER || ulType == traceRECORDER_EVENT_ISR_EXIT )
+		{
+			pxEventObject = prvGetObject( &xDecoder, ulHandle, pdFALSE, traceRECORDER_OBJECT_INTERRUPT );
+		}
+		else if( ulType == traceRECORDER_EVENT_USER )
+		{
+			pxEventObject = prvGetObject( &xDecoder, ulHandle, pdFALSE, traceRECORDER_OBJECT_CHANNEL );
+		}
+		else
+		{
+			pxEventObject = prvGetObject( &xDecoder, ulHandle, xIsAddress, ulType <= traceRECORDER_EVENT_TASK_NOTIFY_WAIT_BLOCK ? traceRECORDER_OBJECT_TASK : traceRECORDER_OBJECT_QUEUE );
+		}
+
+		switch( ulType )
+		{
+			case traceRECORDER_EVENT_TASK_SWITCHED_IN:
+				/* The task running before is switched out. */
+				if( pxCore->pxRunning != NULL )
+				{
+					prvWriteEvent( &xDecoder, "X", pxCore->pxRunning->pcName, decoderCPU_TRACK( pxEvent->ulCore ), prvMicroseconds( &xDecoder, pxCore->ullRunningSince ), prvMicroseconds( &xDecoder, ullTime - pxCore->ullRunningSince ), NULL );
+					prvWriteEvent( &xDecoder, "X", "Running", pxCore->pxRunning->ulTrack, prvMicroseconds( &xDecoder, pxCore->ullRunningSince ), prvMicroseconds( &xDecoder, ullTime - pxCore->ullRunningSince ), NULL );
+					pxCore->pxRunning->ullRunningTime += ullTime - pxCore->ullRunningSince;
+				}
+				if( pxEventObject->xReady != pdFALSE )
+				{
+					prvWriteEvent( &xDecoder, "X", "Ready", pxEventObject->ulTrack, prvMicroseconds( &xDecoder, pxEventObject->ullReadyTime ), prvMicroseconds( &xDecoder, ullTime - pxEventObject->ullReadyTime ), NULL );
+					if( ullTime - pxEventObject->ullReadyTime > pxEventObject->ullMaxReadyTime )
+					{
+						pxEventObject->ullMaxReadyTime = ullTime - pxEventObject->ullReadyTime;
+						pxEventObject->ullMaxReadyAt = pxEventObject->ullReadyTime;
+					}
+					pxEventObject->xReady = pdFALSE;
+				}
+				if( pxEventObject->ulPriority != ulValue + 1 )
+				{
+					pxEventObject->ulPriority = ulValue + 1;
+					snprintf( pcEventName, sizeof( pcEventName ), "Priority %s", pxEventObject->pcName );
+					snprintf( pcArguments, sizeof( pcArguments ), "\"priority\":%lu", ( unsigned long ) ulValue );
+					prvWriteEvent( &xDecoder, "C", pcEventName, pxEventObject->ulTrack, prvMicroseconds( &xDecoder, ullTime ), 0, pcArguments );
+				}
+				pxEventObject->ulSwitches++;
+				pxCore->pxRunning = pxEventObject;
+				pxCore->ullRunningSince = ullTime;
+				break;
+
+			case traceRECORDER_EVENT_TASK_READY:
+				/* A task is also moved to the ready list while it runs, e.g.
+				when its priority changes. */
+				if( pxEventObject != pxCore->pxRunning && pxEventObject->xReady == pdFALSE )
+				{
+					pxEventObject->xReady = pdTRUE;
+					pxEventObject->ullReadyTime = ullTime;
+				}
+				break;
+
+			case traceRECORDER_EVENT_TASK_PRIORITY_SET:
+			case traceRECORDER_EVENT_TASK_PRIORITY_INHERIT:
+			case traceRECORDER_EVENT_TASK_PRIORITY_DISINHERIT:
+				snprintf( pcArguments, sizeof( pcArguments ), "\"priority\":%lu", ( unsigned long ) ulValue );
+				prvWriteEvent( &xDecoder, "i", pcEventNames[ ulType ], pxEventObject->ulTrack, prvMicroseconds( &xDecoder, ullTime ), 0, pcArguments );
+				pxEventObject->ulPriority = ulValue + 1;
+				snprintf( pcEventName, sizeof( pcEventName ), "Priority %s", pxEventObject->pcName );
+				prvWriteEvent( &xDecoder, "C", pcEventName, pxEventObject->ulTrack, prvMicroseconds( &xDecoder, ullTime ), 0, pcArguments );
+				break;
+
+			case traceRECORDER_EVENT_TASK_DELAY:
+			case traceRECORDER_EVENT_TASK_DELAY_UNTIL:
+			case traceRECORDER_EVENT_TASK_DELETE:
+			case traceRECORDER_EVENT_TASK_NOTIFY_WAIT:
+			case traceRECORDER_EVENT_TASK_NOTIFY_WAIT_BLOCK:
+				snprintf( pcArguments, sizeof( pcArguments ), "\"value\":%lu", ( unsigned long ) ulValue );
+				prvWriteEvent( &xDecoder, "i", pcEventNames[ ulType ], pxEventObject->ulTrack, prvMicroseconds( &xDecoder, ullTime ), 0, pcArguments );
+				if( ulType == traceRECORDER_EVENT_TASK_DELETE )
+				{
+					pxEventObject->xReady = pdFALSE;
+				}
+				break;
+
+			case traceRECORDER_EVENT_TASK_NOTIFY:
+			case traceRECORDER_EVENT_TASK_NOTIFY_FROM_ISR:
+				/* Shown on the track of the task notified, and of the task
+				notifying it. */
+				snprintf( pcArguments, sizeof( pcArguments ), "\"value\":%lu", ( unsigned long ) ulValue );
+				prvWriteEvent( &xDecoder, "i", pcEventNames[ ulType ], pxEventObject->ulTrack, prvMicroseconds( &xDecoder, ullTime ), 0, pcArguments );
+				if( ulType == traceRECORDER_EVENT_TASK_NOTIFY && pxCore->pxRunning != NULL && pxCore->pxRunning != pxEventObject )
+				{
+					snprintf( pcEventName, sizeof( pcEventName ), "Notify %s", pxEventObject->pcName );
+					prvWriteEvent( &xDecoder, "i", pcEventName, pxCore->pxRunning->ulTrack, prvMicroseconds( &xDecoder, ullTime ), 0, pcArguments );
+				}
+				break;
+
+			case traceRECORDER_EVENT_ISR_ENTER:
+				if( pxCore->ulISRNesting < decoderMAX_ISR_NESTING )
+				{
+					pxCore->ullISRStart[ pxCore->ulISRNesting ] = ullTime;
+				}
+				pxCore->ulISRNesting++;
+				break;
+
+			case traceRECORDER_EVENT_ISR_EXIT:
+				/* An interrupt entered before the oldest event is ignored. */
+				if( pxCore->ulISRNesting > 0 )
+				{
+					pxCore->ulISRNesting--;
+					if( pxCore->ulISRNesting < decoderMAX_ISR_NESTING )
+					{
+						prvWriteEvent( &xDecoder, "X", pxEventObject->pcName, decoderINTERRUPT_TRACK( pxEvent->ulCore ), prvMicroseconds( &xDecoder, pxCore->ullISRStart[ pxCore->ulISRNesting ] ), prvMicroseconds( &xDecoder, ullTime - pxCore->ullISRStart[ pxCore->ulISRNesting ] ), NULL );
+					}
+				}
+				break;
+
+			case traceRECORDER_EVENT_USER:
+				snprintf( pcArguments, sizeof( pcArguments ), "\"value\":%lu", ( unsigned long ) ulValue );
+				prvWriteEvent( &xDecoder, "i", pxEventObject->pcName, pxEventObject->ulTrack, prvMicroseconds( &xDecoder, ullTime ), 0, pcArguments );
+				break;
+
+			default:
+				/* Queue and semaphore operations, shown on the track of the
+				running task, or of the interrupts when called from an
+				interrupt. */
+				snprintf( pcEventName, sizeof( pcEventName ), "%s %s", pcEventNames[ ulType ], pxEventObject->pcName );
+				snprintf( pcArguments, sizeof( pcArguments ), "\"messages_waiting\":%lu", ( unsigned long ) ulValue );
+				prvWriteEvent( &xDecoder, "i", pcEventName, pxCore->ulISRNesting > 0 ? decoderINTERRUPT_TRACK( pxEvent->ulCore ) : ( pxCore->pxRunning != NULL ? pxCore->pxRunning->ulTrack : decoderCPU_TRACK( pxEvent->ulCore ) ), prvMicroseconds( &xDecoder, ullTime ), 0, pcArguments );
+				break;
+		}
+	}
+
+	/* The tasks running at the end of the trace. */
+	for( ulCore = 0; ulCore < ulCores; ulCore++ )
+	{
+		pxCore = &( pxCores[ ulCore ] );
+		if( pxCore->pxRunning != NULL )
+		{
+			prvWriteEvent( &xDecoder, "X", pxCore->pxRunning->pcName, decoderCPU_TRACK( ulCore ), prvMicroseconds( &xDecoder, pxCore->ullRunningSince ), prvMicroseconds( &xDecoder, ullTime - pxCore->ullRunningSince ), NULL );
+			prvWriteEvent( &xDecoder, "X", "Running", pxCore->pxRunning->ulTrack, prvMicroseconds( &xDecoder, pxCore->ullRunningSince ), prvMicroseconds( &xDecoder, ullTime - pxCore->ullRunningSince ), NULL );
+			pxCore->pxRunning->ullRunningTime += ullTime - pxCore->ullRunningSince;
+		}
+	}
+	free( pxCores );
+	free( pxEvents );
+
+	/* The tracks of the tasks and channels, sorted after the fixed ones. */
+	for( ulObject = 0; ulObject < xDecoder.ulObjects; ulObject++ )
+	{
+		pxObject = &( xDecoder.pxObjects[ ulObject ] );
+		if( pxObject->ulKind == traceRECORDER_OBJECT_TASK || pxObject->ulKind == traceRECORDER_OBJECT_CHANNEL )
+		{
+			prvWriteTrackName( &xDecoder, pxObject->ulTrack, pxObject->pcName, pxObject->ulTrack );
+		}
+	}
+	fprintf( xDecoder.pxOutput, "\n]}\n" );
+
+	if( ferror( xDecoder.pxOutput ) != 0 || ( xDecoder.pxOutput != stdout && fclose( xDecoder.pxOutput ) != 0 ) )
+	{
+		fprintf( stderr, "Cannot write %s\n", argv[ 2 ] );
+		return EXIT_FAILURE;
+	}
+
+	/* The summary. */
+	fprintf( stderr, "%lu events over %.3f ms, %lu older events overwritten", ( unsigned long ) ulEvents, prvMicroseconds( &xDecoder, ullTime ) / 1000.0, ( unsigned long ) ulLostEvents );
+	if( ulCores > 1 )
+	{
+		fprintf( stderr, " on %lu cores", ( unsigned long ) ulCores );
+	}
+	if( ulIgnored > 0 )
+	{
+		fprintf( stderr, ", %lu unknown events ignored", ( unsigned long ) ulIgnored );
+	}
+	fprintf( stderr, "\n\n%-24s %10s %10s %16s %16s\n", "Task", "switches", "running", "max ready (us)", "at (us)" );
+	for( ulObject = 0; ulObject < xDecoder.ulObjects; ulObject++ )
+	{
+		pxObject = &( xDecoder.pxObjects[ ulObject ] );
+		if( pxObject->ulKind == traceRECORDER_OBJECT_TASK && pxObject->ulSwitches > 0 )
+		{
+			fprintf( stderr, "%-24s %10lu %9.1f%% %16.3f %16.3f\n", pxObject->pcName, ( unsigned long ) pxObject->ulSwitches,
+					 ullTime > 0 ? 100.0 * ( double ) pxObject->ullRunningTime / ( double ) ullTime : 0.0,
+					 prvMicroseconds( &xDecoder, pxObject->ullMaxReadyTime ), prvMicroseconds( &xDecoder, pxObject->ullMaxReadyAt ) );
+		}
+	}
+
+	free( xDecoder.pxObjects );
+	free( pucDump );
+	return EXIT_SUCCESS;
+}
@@ -276,6 +276,31 @@ hold explicit before calling the code. */
 		#error If configUSE_TIMERS is set to 1 then configTIMER_TASK_STACK_DEPTH must also be defined.
 	#endif /* configTIMER_TASK_STACK_DEPTH */
 
+	/* Set configUSE_TIMER_WHEEL to 1 to keep the active timers in a
+	hierarchical timing wheel, rather than in lists sorted by expiry time, so
+	starting, stopping and resetting a timer takes constant time however many
+	timers are active.  The wheel has configTIMER_WHEEL_LEVELS levels of
+	( 1 << configTIMER_WHEEL_SLOT_BITS ) lists each. */
+	#ifndef configUSE_TIMER_WHEEL
+		#define configUSE_TIMER_WHEEL 0
+	#endif
+
+	#ifndef configTIMER_WHEEL_SLOT_BITS
+		#define configTIMER_WHEEL_SLOT_BITS 4
+	#endif
+
+	#ifndef configTIMER_WHEEL_LEVELS
+		#define configTIMER_WHEEL_LEVELS 4
+	#endif
+
+	#if ( configTIMER_WHEEL_SLOT_BITS < 1 ) || ( configTIMER_WHEEL_SLOT_BITS > 5 )
+		#error configTIMER_WHEEL_SLOT_BITS must be between 1 and 5.
+	#endif
+
+	#if ( configTIMER_WHEEL_LEVELS < 1 ) || ( ( configUSE_16_BIT_TICKS == 1 ) && ( ( configTIMER_WHEEL_LEVELS * configTIMER_WHEEL_SLOT_BITS ) > 16 ) ) || ( ( configTIMER_WHEEL_LEVELS * configTIMER_WHEEL_SLOT_BITS ) > 32 )
+		#error configTIMER_WHEEL_LEVELS * configTIMER_WHEEL_SLOT_BITS must not be more than the number of bits in TickType_t.
+	#endif
+
 #endif /* configUSE_TIMERS */
 
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
@@ -312,6 +337,16 @@ hold explicit before calling the code. */
 	#define portPOINTER_SIZE_TYPE uint32_t
 #endif
 
+/* Set configUSE_TRACE_RECORDER to 1 to record kernel events with the trace
+recorder of trace_recorder.c, which defines the trace macros it uses. */
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER 0
+#endif
+
+#if( configUSE_TRACE_RECORDER == 1 )
+	#include "trace_recorder.h"
+#endif
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 	/* Used to perform any necessary initialisation - for example, open a file
@@ -712,6 +747,16 @@ hold explicit before calling the code. */
 	#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
 #endif
 
+#ifndef traceISR_ENTER
+	/* Called by ports that simulate interrupts before calling the handler of
+	an interrupt, and by interrupt handlers of the application if desired. */
+	#define traceISR_ENTER( ulInterrupt )
+#endif
+
+#ifndef traceISR_EXIT
+	#define traceISR_EXIT( ulInterrupt )
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
 	#define configGENERATE_RUN_TIME_STATS 0
 #endif
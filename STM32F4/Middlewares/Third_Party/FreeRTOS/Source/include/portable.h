@@ -118,8 +118,8 @@ extern "C" {
 	#endif
 #endif
 
-/* Used by heap_5.c to define the start address and size of each memory region
-that together comprise the total FreeRTOS heap space. */
+/* Used by heap_5.c and heap_6.c to define the start address and size of each
+memory region that together comprise the total FreeRTOS heap space. */
 typedef struct HeapRegion
 {
 	uint8_t *pucStartAddress;
@@ -138,16 +138,32 @@ typedef struct xHeapStats
 	size_t xNumberOfSuccessfulFrees;		/* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* Used to pass information about the heap out of vPortGetHeapExtendedStats(),
+which is only implemented by heap_6.c.  The times are in the units of the run
+time stats counter, and are only measured if configGENERATE_RUN_TIME_STATS is 1. */
+typedef struct xHeapExtendedStats
+{
+	HeapStats_t xHeapStats;					/* The same information as returned by vPortGetHeapStats(). */
+	size_t xFragmentationPercentage;		/* How much of the available heap space cannot be allocated in a single block: 100 * ( 1 - largest free block / available heap space ). */
+	size_t xNumberOfHeapRegions;			/* The number of memory regions added with vPortDefineHeapRegions(). */
+	uint32_t ulMaximumMallocTime;			/* The longest time spent in pvPortMalloc(). */
+	uint32_t ulTotalMallocTime;				/* The total time spent in pvPortMalloc(), wrapping on overflow. */
+	uint32_t ulMaximumFreeTime;				/* The longest time spent in vPortFree(). */
+	uint32_t ulTotalFreeTime;				/* The total time spent in vPortFree(), wrapping on overflow. */
+} HeapExtendedStats_t;
+
 /*
- * Used to define multiple heap regions for use by heap_5.c.  This function
- * must be called before any calls to pvPortMalloc() - not creating a task,
- * queue, semaphore, mutex, software timer, event group, etc. will result in
- * pvPortMalloc being called.
+ * Used to define multiple heap regions for use by heap_5.c and heap_6.c.  This
+ * function must be called before any calls to pvPortMalloc() - not creating a
+ * task, queue, semaphore, mutex, software timer, event group, etc. will result
+ * in pvPortMalloc being called.
  *
  * pxHeapRegions passes in an array of HeapRegion_t structures - each of which
  * defines a region of memory that can be used as the heap.  The array is
  * terminated by a HeapRegions_t structure that has a size of 0.  The region
- * with the lowest start address must appear first in the array.
+ * with the lowest start address must appear first in the array.  heap_6.c
+ * accepts the regions in any order, and allows the function to be called again
+ * to add more regions.
  */
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
@@ -157,6 +173,12 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t *pxHeapStats );
 
+/*
+ * Returns a HeapExtendedStats_t structure filled with information about the
+ * fragmentation of the heap and the time spent allocating and freeing memory.
+ */
+void vPortGetHeapExtendedStats( HeapExtendedStats_t *pxHeapExtendedStats );
+
 /*
  * Map to the memory management routines required for the port.
  */
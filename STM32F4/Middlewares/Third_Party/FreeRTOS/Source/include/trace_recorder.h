@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * A recorder of kernel events, enabled by setting configUSE_TRACE_RECORDER to
+ * 1 in FreeRTOSConfig.h.  It defines the trace macros of FreeRTOS.h to log
+ * context switches, tasks made ready, delays, priority changes, queue and
+ * semaphore operations, task notifications, interrupts and user events into a
+ * ring buffer in RAM per core, with a timestamp from a cycle counter,
+ * overwriting the oldest events when full.  Logging an event does not mask
+ * interrupts:  the slot of the event is claimed with an atomic increment of
+ * the number of events the core has logged, an LDREX/STREX loop on a
+ * Cortex-M3/4/7, and the event is written to the slot.  Logging an event
+ * takes a few instructions, so the recorder can stay enabled under real load
+ * without adding to the interrupt latency.
+ *
+ * The recorder, including its buffer, is a single block of memory in the
+ * format described below, which pvTraceRecorderGetDump() returns.  It can be
+ * written out by the application, or dumped with a debugger, then converted
+ * to the Chrome trace event format, which chrome://tracing and Perfetto open,
+ * by the host tool Demo/Posix_GCC/trace_decoder.c.
+ *
+ * FreeRTOSConfig.h must define:
+ *
+ * configTRACE_RECORDER_TIMESTAMP() - returns a uint32_t timestamp, e.g. the
+ * DWT cycle counter of a Cortex-M3/4/7:  ( DWT->CYCCNT ).
+ *
+ * configTRACE_RECORDER_TIMESTAMP_FREQUENCY - the frequency of the timestamps
+ * in Hz, e.g. the CPU clock frequency for the DWT cycle counter.  The
+ * timestamps wrap around, so there must be an event at least every 2^31
+ * timestamps, e.g. a context switch to the idle task, for the decoder to
+ * order the events.
+ *
+ * and may define:
+ *
+ * configTRACE_RECORDER_EVENTS - the number of events in the ring buffer of
+ * each core, each taking 16 bytes.  Must be a power of 2.  Defaults to 1024.
+ *
+ * configTRACE_RECORDER_OBJECTS - the number of tasks, queues, semaphores,
+ * interrupts and user event channels the recorder keeps the name of.
+ * Defaults to 32.  The objects of deleted tasks and queues are replaced once
+ * there is no room left.
+ *
+ * configTRACE_RECORDER_CORES - the number of cores logging events, each into
+ * a buffer of its own.  Defaults to 1.
+ *
+ * configTRACE_RECORDER_CORE_ID() - returns the number of the core logging an
+ * event, from 0 to configTRACE_RECORDER_CORES - 1.  Defaults to 0.  With
+ * several cores, configTRACE_RECORDER_TIMESTAMP() must read a clock shared by
+ * the cores.
+ *
+ * configTRACE_RECORDER_FETCH_AND_INCREMENT( pulValue ) - atomically increments
+ * the uint32_t pointed to and returns its value before, for compilers other
+ * than GCC, or cores without atomic instructions such as the Cortex-M0.  By
+ * default GCC's __atomic_fetch_add() is used, and other compilers mask
+ * interrupts around the increment.
+ *
+ * Interrupts are only recorded when their handler calls
+ * vTraceRecorderISREnter() and vTraceRecorderISRExit().  Interrupts of any
+ * priority can log events, but an interrupt logging an event in between the
+ * claim of a slot and the timestamp of an event it interrupted gets the next
+ * slot.  The events of a core are therefore not quite in the order of their
+ * timestamps, and the decoder sorts them.  Adding and naming objects, which
+ * only happens when tasks, queues, interrupts and channels are created or
+ * named, masks interrupts on the calling core, so with several cores the
+ * objects must not be created on two cores at the same time.
+ *
+ * The format of the recorder, in the byte order of the target, with
+ * traceRECORDER_MAGIC telling the byte order, is:
+ *
+ * - 9 32 bit words:  traceRECORDER_MAGIC, traceRECORDER_VERSION, the timestamp
+ *   frequency, the number of events per core and of objects the recorder has
+ *   room for, the length of the object names, whether the recorder is started,
+ *   the number of cores and the number of objects.
+ * - For each core, a 32 bit word with the number of events it has logged,
+ *   modulo 2^32.  The next event of the core is written to that number modulo
+ *   the number of events per core.
+ * - The objects:  each a 32 bit handle - the address of the task or queue, or
+ *   the number of the interrupt or user event channel - an 8 bit kind
+ *   (traceRECORDER_OBJECT_xxx, plus traceRECORDER_OBJECT_DELETED once the
+ *   task or queue is deleted), 3 padding bytes, and the name, terminated
+ *   by a null character unless it fills all the bytes of the name.
+ * - The events of each core, the buffers of the cores one after the other:
+ *   each a 32 bit timestamp, handle of the object, value, and event type
+ *   (traceRECORDER_EVENT_xxx).  The type is written last, and is 0 while the
+ *   event is being written.
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include trace_recorder.h"
+#endif
+
+#ifndef configTRACE_RECORDER_TIMESTAMP
+	#error configTRACE_RECORDER_TIMESTAMP() must be defined to use the trace recorder.  See trace_recorder.h.
+#endif
+
+#ifndef configTRACE_RECORDER_TIMESTAMP_FREQUENCY
+	#error configTRACE_RECORDER_TIMESTAMP_FREQUENCY must be defined to use the trace recorder.  See trace_recorder.h.
+#endif
+
+#ifndef configTRACE_RECORDER_EVENTS
+	#define configTRACE_RECORDER_EVENTS 1024
+#endif
+
+#ifndef configTRACE_RECORDER_OBJECTS
+	#define configTRACE_RECORDER_OBJECTS 32
+#endif
+
+#ifndef configTRACE_RECORDER_CORES
+	#define configTRACE_RECORDER_CORES 1
+#endif
+
+#ifndef configTRACE_RECORDER_CORE_ID
+	#define configTRACE_RECORDER_CORE_ID() ( 0 )
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define traceRECORDER_MAGIC			( ( uint32_t ) 0x52545246UL ) /* "FRTR" in little endian byte order. */
+#define traceRECORDER_VERSION		( ( uint32_t ) 2UL )
+#define traceRECORDER_NAME_LENGTH	( 16 )
+
+/* The kinds of objects. */
+#define traceRECORDER_OBJECT_TASK				( 1 )
+#define traceRECORDER_OBJECT_QUEUE				( 2 )
+#define traceRECORDER_OBJECT_MUTEX				( 3 )
+#define traceRECORDER_OBJECT_COUNTING_SEMAPHORE	( 4 )
+#define traceRECORDER_OBJECT_BINARY_SEMAPHORE	( 5 )
+#define traceRECORDER_OBJECT_RECURSIVE_MUTEX	( 6 )
+#define traceRECORDER_OBJECT_INTERRUPT			( 7 )
+#define traceRECORDER_OBJECT_CHANNEL			( 8 )
+#define traceRECORDER_OBJECT_DELETED			( 0x80 )
+
+/* The events, with the object and the value they log. */
+#define traceRECORDER_EVENT_TASK_SWITCHED_IN			( 1 )	/* The task, its priority. */
+#define traceRECORDER_EVENT_TASK_READY					( 2 )	/* The task, its priority. */
+#define traceRECORDER_EVENT_TASK_DELAY					( 3 )	/* The running task, the ticks to delay. */
+#define traceRECORDER_EVENT_TASK_DELAY_UNTIL			( 4 )	/* The running task, the tick to wake at. */
+#define traceRECORDER_EVENT_TASK_PRIORITY_SET			( 5 )	/* The task, its new priority. */
+#define traceRECORDER_EVENT_TASK_PRIORITY_INHERIT		( 6 )	/* The mutex holder, the priority inherited. */
+#define traceRECORDER_EVENT_TASK_PRIORITY_DISINHERIT	( 7 )	/* The mutex holder, the priority restored. */
+#define traceRECORDER_EVENT_TASK_DELETE					( 8 )	/* The task, 0. */
+#define traceRECORDER_EVENT_TASK_NOTIFY					( 9 )	/* The task notified, its notification value. */
+#define traceRECORDER_EVENT_TASK_NOTIFY_FROM_ISR		( 10 )	/* The task notified, its notification value. */
+#define traceRECORDER_EVENT_TASK_NOTIFY_WAIT			( 11 )	/* The running task, its notification value. */
+#define traceRECORDER_EVENT_TASK_NOTIFY_WAIT_BLOCK		( 12 )	/* The running task, its notification value. */
+#define traceRECORDER_EVENT_QUEUE_SEND					( 13 )	/* The queue, the messages waiting before. */
+#define traceRECORDER_EVENT_QUEUE_SEND_FAILED			( 14 )	/* The queue, the messages waiting. */
+#define traceRECORDER_EVENT_QUEUE_SEND_FROM_ISR			( 15 )	/* The queue, the messages waiting before. */
+#define traceRECORDER_EVENT_QUEUE_RECEIVE				( 16 )	/* The queue, the messages waiting before. */
+#define traceRECORDER_EVENT_QUEUE_RECEIVE_FAILED		( 17 )	/* The queue, the messages waiting. */
+#define traceRECORDER_EVENT_QUEUE_RECEIVE_FROM_ISR		( 18 )	/* The queue, the messages waiting before. */
+#define traceRECORDER_EVENT_QUEUE_PEEK					( 19 )	/* The queue, the messages waiting. */
+#define traceRECORDER_EVENT_QUEUE_BLOCKING_ON_SEND		( 20 )	/* The queue, the messages waiting. */
+#define traceRECORDER_EVENT_QUEUE_BLOCKING_ON_RECEIVE	( 21 )	/* The queue, the messages waiting. */
+#define traceRECORDER_EVENT_ISR_ENTER					( 22 )	/* The interrupt, 0. */
+#define traceRECORDER_EVENT_ISR_EXIT					( 23 )	/* The interrupt, 0. */
+#define traceRECORDER_EVENT_USER						( 24 )	/* The channel, the value given. */
+#define traceRECORDER_EVENT_QUEUE_DELETE				( 25 )	/* The queue, the messages waiting. */
+
+/*
+ * Start, stop or clear the recording.  The recorder starts stopped, so the
+ * application chooses what to record.  An event being logged while the
+ * recording is cleared may be kept, or lost, so clear it while stopped.
+ */
+void vTraceRecorderStart( void );
+void vTraceRecorderStop( void );
+void vTraceRecorderClear( void );
+
+/*
+ * Log a user event with a value, e.g. the start and end of a processing step,
+ * in a channel given a name with vTraceRecorderNameChannel().  Can be called
+ * from tasks and interrupts.
+ */
+void vTraceRecorderUserEvent( uint32_t ulChannel, uint32_t ulValue );
+void vTraceRecorderNameChannel( uint32_t ulChannel, const char *pcName );
+
+/*
+ * Log the entry to and the exit from an interrupt handler, called at the
+ * start and the end of the handler.
+ */
+void vTraceRecorderISREnter( uint32_t ulInterrupt );
+void vTraceRecorderISRExit( uint32_t ulInterrupt );
+void vTraceRecorderNameInterrupt( uint32_t ulInterrupt, const char *pcName );
+
+/*
+ * Return the start of the recorder and set *pxDumpSize to its size, to be
+ * written out as a whole and converted with the trace decoder.  Stop the
+ * recorder first, so events are not logged while it is written out.
+ */
+const void *pvTraceRecorderGetDump( size_t *pxDumpSize );
+
+/*
+ * Used by the trace macros below.  Not to be called by the application.
+ */
+void vTraceRecorderEvent( uint32_t ulEvent, uint32_t ulHandle, uint32_t ulValue );
+void vTraceRecorderAddObject( uint32_t ulKind, uint32_t ulHandle, const char *pcName );
+void vTraceRecorderNameObject( uint32_t ulHandle, const char *pcName );
+void vTraceRecorderDeleteObject( uint32_t ulEvent, uint32_t ulHandle, uint32_t ulValue );
+
+/* The handle of a task or queue is its address, truncated to 32 bits on 64 bit
+hosts. */
+#define traceRECORDER_HANDLE( pvObject )	( ( uint32_t ) ( portPOINTER_SIZE_TYPE ) ( pvObject ) )
+
+/* The trace macros of FreeRTOS.h, expanded in tasks.c and queue.c. */
+#define traceTASK_CREATE( pxNewTCB )											vTraceRecorderAddObject( traceRECORDER_OBJECT_TASK, traceRECORDER_HANDLE( pxNewTCB ), ( pxNewTCB )->pcTaskName )
+#define traceTASK_DELETE( pxTCB )												vTraceRecorderDeleteObject( traceRECORDER_EVENT_TASK_DELETE, traceRECORDER_HANDLE( pxTCB ), 0 )
+#define traceTASK_SWITCHED_IN()													vTraceRecorderEvent( traceRECORDER_EVENT_TASK_SWITCHED_IN, traceRECORDER_HANDLE( pxCurrentTCB ), ( uint32_t ) pxCurrentTCB->uxPriority )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )									vTraceRecorderEvent( traceRECORDER_EVENT_TASK_READY, traceRECORDER_HANDLE( pxTCB ), ( uint32_t ) ( pxTCB )->uxPriority )
+#define traceTASK_DELAY()														vTraceRecorderEvent( traceRECORDER_EVENT_TASK_DELAY, traceRECORDER_HANDLE( pxCurrentTCB ), ( uint32_t ) xTicksToDelay )
+#define traceTASK_DELAY_UNTIL( xTimeToWake )									vTraceRecorderEvent( traceRECORDER_EVENT_TASK_DELAY_UNTIL, traceRECORDER_HANDLE( pxCurrentTCB ), ( uint32_t ) ( xTimeToWake ) )
+#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )							vTraceRecorderEvent( traceRECORDER_EVENT_TASK_PRIORITY_SET, traceRECORDER_HANDLE( pxTask ), ( uint32_t ) ( uxNewPriority ) )
+#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority )	vTraceRecorderEvent( traceRECORDER_EVENT_TASK_PRIORITY_INHERIT, traceRECORDER_HANDLE( pxTCBOfMutexHolder ), ( uint32_t ) ( uxInheritedPriority ) )
+#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority )	vTraceRecorderEvent( traceRECORDER_EVENT_TASK_PRIORITY_DISINHERIT, traceRECORDER_HANDLE( pxTCBOfMutexHolder ), ( uint32_t ) ( uxOriginalPriority ) )
+#define traceTASK_NOTIFY()														vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY, traceRECORDER_HANDLE( pxTCB ), pxTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_FROM_ISR()												vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY_FROM_ISR, traceRECORDER_HANDLE( pxTCB ), pxTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR()										vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY_FROM_ISR, traceRECORDER_HANDLE( pxTCB ), pxTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_TAKE()													vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY_WAIT, traceRECORDER_HANDLE( pxCurrentTCB ), pxCurrentTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_TAKE_BLOCK()											vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY_WAIT_BLOCK, traceRECORDER_HANDLE( pxCurrentTCB ), pxCurrentTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_WAIT()													vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY_WAIT, traceRECORDER_HANDLE( pxCurrentTCB ), pxCurrentTCB->ulNotifiedValue )
+#define traceTASK_NOTIFY_WAIT_BLOCK()											vTraceRecorderEvent( traceRECORDER_EVENT_TASK_NOTIFY_WAIT_BLOCK, traceRECORDER_HANDLE( pxCurrentTCB ), pxCurrentTCB->ulNotifiedValue )
+
+/* The kind of a queue is traceRECORDER_OBJECT_QUEUE plus its queueQUEUE_TYPE_xxx
+value, taken from prvInitialiseNewQueue(). */
+#define traceQUEUE_CREATE( pxNewQueue )							vTraceRecorderAddObject( traceRECORDER_OBJECT_QUEUE + ( uint32_t ) ucQueueType, traceRECORDER_HANDLE( pxNewQueue ), NULL )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )			vTraceRecorderNameObject( traceRECORDER_HANDLE( xQueue ), ( pcQueueName ) )
+#define traceQUEUE_DELETE( pxQueue )							vTraceRecorderDeleteObject( traceRECORDER_EVENT_QUEUE_DELETE, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND( pxQueue )								vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_SEND, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FAILED( pxQueue )						vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_SEND_FAILED, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )						vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_SEND_FROM_ISR, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )				vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_SEND_FAILED, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE( pxQueue )							vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_RECEIVE, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )					vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_RECEIVE_FAILED, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )					vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_RECEIVE_FROM_ISR, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue )			vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_RECEIVE_FAILED, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_PEEK( pxQueue )								vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_PEEK, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_PEEK_FROM_ISR( pxQueue )						vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_PEEK, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )					vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_BLOCKING_ON_SEND, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )				vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_BLOCKING_ON_RECEIVE, traceRECORDER_HANDLE( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+
+/* The interrupt macros of FreeRTOS.h, expanded in the ports that simulate
+interrupts. */
+#define traceISR_ENTER( ulInterrupt )	vTraceRecorderISREnter( ulInterrupt )
+#define traceISR_EXIT( ulInterrupt )	vTraceRecorderISRExit( ulInterrupt )
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* TRACE_RECORDER_H */
@@ -0,0 +1,832 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that allocates and
+ * frees memory in constant time, using a two level segregated fit (TLSF)
+ * algorithm, and that allows the heap to be defined across multiple
+ * non-contiguous blocks like heap_5.c.
+ *
+ * heap_4.c and heap_5.c search a single list of free blocks, ordered by
+ * address, both to allocate and to free memory, so the time taken grows with
+ * the number of free blocks - that is, with the fragmentation of the heap.
+ * heap_6.c instead keeps the free blocks in a table of lists, each holding the
+ * blocks of a range of sizes, and a bitmap of the lists that are not empty.
+ * The first level of the table divides the sizes in powers of two, and the
+ * second level divides each power of two in heapSECOND_LEVEL_COUNT linear
+ * ranges.  Allocating memory takes the first block of the first non-empty list
+ * with sizes large enough for the request, found with a couple of bit scans,
+ * and freeing memory merges the block with the adjacent blocks, found through
+ * the header of each block, so neither searches a list - except when no list
+ * has blocks that are all large enough, when the list of the requested size is
+ * searched rather than failing.  The cost is that a request can be served from
+ * a larger range of sizes than strictly necessary, and that each allocated
+ * block carries a header of two words.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ *
+ * Usage notes:
+ *
+ * vPortDefineHeapRegions() ***must*** be called before pvPortMalloc(), exactly
+ * as with heap_5.c - see heap_5.c for an example.  Unlike heap_5.c, the regions
+ * can be passed in any order, and vPortDefineHeapRegions() can be called again
+ * to add more regions to the heap.  Each region must be smaller than 1GB.
+ *
+ * vPortGetHeapExtendedStats() returns the fragmentation of the heap in addition
+ * to the information returned by vPortGetHeapStats().  If
+ * configGENERATE_RUN_TIME_STATS is set to 1 it also returns the longest and the
+ * total time spent in pvPortMalloc() and vPortFree(), measured with the run time
+ * stats counter.
+ */
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* The size of each block is a multiple of portBYTE_ALIGNMENT, so its lowest
+bits are free to hold flags. */
+#if portBYTE_ALIGNMENT == 32
+	#define heapALIGNMENT_LOG2		( 5U )
+#elif portBYTE_ALIGNMENT == 16
+	#define heapALIGNMENT_LOG2		( 4U )
+#elif portBYTE_ALIGNMENT == 8
+	#define heapALIGNMENT_LOG2		( 3U )
+#elif portBYTE_ALIGNMENT == 4
+	#define heapALIGNMENT_LOG2		( 2U )
+#else
+	#error heap_6.c requires portBYTE_ALIGNMENT to be 4, 8, 16 or 32
+#endif
+
+/* Each power of two of block sizes is divided into heapSECOND_LEVEL_COUNT
+lists.  More lists waste less memory when a request is rounded up to the sizes
+of a list, but make the table of lists larger. */
+#define heapSECOND_LEVEL_COUNT_LOG2	( 4U )
+#define heapSECOND_LEVEL_COUNT		( 1U << heapSECOND_LEVEL_COUNT_LOG2 )
+
+/* The blocks smaller than heapSMALL_BLOCK_SIZE are all kept in the first row
+of the table, with one list per multiple of portBYTE_ALIGNMENT.  The larger
+blocks are kept in the row of their most significant bit. */
+#define heapFIRST_LEVEL_SHIFT		( heapSECOND_LEVEL_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE		( ( size_t ) 1 << heapFIRST_LEVEL_SHIFT )
+
+/* Blocks must be smaller than 1GB, so the bitmap of the first level fits in a
+uint32_t. */
+#define heapFIRST_LEVEL_MAX_LOG2	( 30U )
+#define heapFIRST_LEVEL_COUNT		( heapFIRST_LEVEL_MAX_LOG2 - heapFIRST_LEVEL_SHIFT + 1U )
+#define heapMAXIMUM_BLOCK_SIZE		( ( size_t ) 1 << heapFIRST_LEVEL_MAX_LOG2 )
+
+/* Set in the xBlockSize member of a BlockLink_t structure when the block
+belongs to the application, or is the zero sized block that marks the end of a
+region. */
+#define heapBLOCK_ALLOCATED_BIT		( ( size_t ) 1 )
+
+#define heapBLOCK_SIZE( pxBlock )			( ( pxBlock )->xBlockSize & ~heapBLOCK_ALLOCATED_BIT )
+#define heapBLOCK_IS_FREE( pxBlock )		( ( ( pxBlock )->xBlockSize & heapBLOCK_ALLOCATED_BIT ) == 0 )
+#define heapNEXT_PHYSICAL_BLOCK( pxBlock )	( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) ) )
+
+/* The time spent in pvPortMalloc() and vPortFree() is only measured when the
+run time stats counter is available. */
+#if( configGENERATE_RUN_TIME_STATS == 1 ) && defined( portGET_RUN_TIME_COUNTER_VALUE )
+	#define heapRECORD_TIMES			1
+#else
+	#define heapRECORD_TIMES			0
+#endif
+
+/* Define the structure at the start of each block.  Only the first two
+members are used while the block is allocated, the free list links are
+overwritten by the application data. */
+typedef struct A_BLOCK_LINK
+{
+	struct A_BLOCK_LINK *pxPreviousPhysicalBlock;	/*<< The block just below this block in memory, or NULL if this is the first block of a region. */
+	size_t xBlockSize;								/*<< The size of the block, including this header. */
+	struct A_BLOCK_LINK *pxNextFreeBlock;			/*<< The next block in the same free list, only valid while the block is free. */
+	struct A_BLOCK_LINK *pxPreviousFreeBlock;		/*<< The previous block in the same free list, only valid while the block is free. */
+} BlockLink_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Finds the list holding the free blocks of size xSize.
+ */
+static void prvMapSizeToFreeList( size_t xSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel );
+
+/*
+ * Finds a free block of at least xWantedSize bytes, or returns NULL if there is
+ * none.
+ */
+static BlockLink_t *prvFindSuitableFreeBlock( size_t xWantedSize );
+
+/*
+ * Adds a free block to, or removes a free block from, its free list.
+ */
+static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert );
+static void prvRemoveBlockFromFreeList( BlockLink_t *pxBlockToRemove );
+
+/*
+ * Return the index of the least and of the most significant bit set in a non
+ * zero value.
+ */
+static UBaseType_t prvFindFirstSet( uint32_t ulValue );
+static UBaseType_t prvFindLastSet( uint32_t ulValue );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the structure placed at the beginning of each allocated memory
+block must by correctly byte aligned. */
+static const size_t xHeapStructSize	= ( offsetof( BlockLink_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Block sizes must not get too small - a free block must hold its free list
+links. */
+static const size_t xMinimumBlockSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The free lists, and the bitmaps of the lists that are not empty.  Bit n of
+ulFirstLevelBitmap is set when row n of the table has a list that is not
+empty, and bit m of ulSecondLevelBitmaps[ n ] when pxFreeLists[ n ][ m ] is not
+empty. */
+static BlockLink_t *pxFreeLists[ heapFIRST_LEVEL_COUNT ][ heapSECOND_LEVEL_COUNT ];
+static uint32_t ulFirstLevelBitmap = 0U;
+static uint32_t ulSecondLevelBitmaps[ heapFIRST_LEVEL_COUNT ];
+
+/* Keeps track of the number of calls to allocate and free memory, the number
+of free bytes remaining and the number of free blocks. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+static size_t xNumberOfFreeBlocks = 0U;
+static size_t xNumberOfSuccessfulAllocations = 0U;
+static size_t xNumberOfSuccessfulFrees = 0U;
+static size_t xNumberOfHeapRegions = 0U;
+
+#if( heapRECORD_TIMES == 1 )
+	static uint32_t ulMaximumMallocTime = 0U;
+	static uint32_t ulTotalMallocTime = 0U;
+	static uint32_t ulMaximumFreeTime = 0U;
+	static uint32_t ulTotalFreeTime = 0U;
+#endif
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+#if( heapRECORD_TIMES == 1 )
+	uint32_t ulStartTime, ulTime;
+#endif
+
+	/* The heap must be initialised before the first call to
+	prvPortMalloc(). */
+	configASSERT( xNumberOfHeapRegions > 0U );
+
+	vTaskSuspendAll();
+	{
+		#if( heapRECORD_TIMES == 1 )
+		{
+			ulStartTime = portGET_RUN_TIME_COUNTER_VALUE();
+		}
+		#endif
+
+		/* Check the requested block size is not so large that it cannot be
+		held by any block once the BlockLink_t structure is added. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize < ( heapMAXIMUM_BLOCK_SIZE - xHeapStructSize - portBYTE_ALIGNMENT ) ) )
+		{
+			/* The wanted size is increased so it can contain a BlockLink_t
+			structure in addition to the requested amount of bytes, and so
+			blocks are always aligned to the required number of bytes. */
+			xWantedSize += xHeapStructSize;
+			xWantedSize = ( xWantedSize + ( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+			if( xWantedSize < xMinimumBlockSize )
+			{
+				xWantedSize = xMinimumBlockSize;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xWantedSize <= xFreeBytesRemaining )
+			{
+				pxBlock = prvFindSuitableFreeBlock( xWantedSize );
+
+				if( pxBlock != NULL )
+				{
+					/* This block is being returned for use so must be taken
+					out of its free list. */
+					prvRemoveBlockFromFreeList( pxBlock );
+
+					/* If the block is larger than required it can be split
+					into two.  The block following a free block is always
+					allocated, so the remainder does not need to be merged with
+					it. */
+					if( ( pxBlock->xBlockSize - xWantedSize ) >= xMinimumBlockSize )
+					{
+						/* Create a new block following the number of bytes
+						requested.  The void cast is used to prevent byte
+						alignment warnings from the compiler. */
+						pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+						pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+						pxNewBlockLink->pxPreviousPhysicalBlock = pxBlock;
+						heapNEXT_PHYSICAL_BLOCK( pxNewBlockLink )->pxPreviousPhysicalBlock = pxNewBlockLink;
+						pxBlock->xBlockSize = xWantedSize;
+
+						/* Insert the new block into its free list. */
+						prvInsertBlockIntoFreeList( pxNewBlockLink );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+					if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+					{
+						xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* Return the memory space pointed to - jumping over the
+					BlockLink_t header at its start.  The block is now owned by
+					the application. */
+					pxBlock->xBlockSize |= heapBLOCK_ALLOCATED_BIT;
+					pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+					xNumberOfSuccessfulAllocations++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+
+		#if( heapRECORD_TIMES == 1 )
+		{
+			ulTime = portGET_RUN_TIME_COUNTER_VALUE() - ulStartTime;
+			ulTotalMallocTime += ulTime;
+
+			if( ulTime > ulMaximumMallocTime )
+			{
+				ulMaximumMallocTime = ulTime;
+			}
+		}
+		#endif
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink, *pxNeighbour;
+#if( heapRECORD_TIMES == 1 )
+	uint32_t ulStartTime, ulTime;
+#endif
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have an BlockLink_t structure immediately
+		before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 );
+		configASSERT( heapBLOCK_SIZE( pxLink ) >= xMinimumBlockSize );
+
+		if( ( pxLink->xBlockSize & heapBLOCK_ALLOCATED_BIT ) != 0 )
+		{
+			vTaskSuspendAll();
+			{
+				#if( heapRECORD_TIMES == 1 )
+				{
+					ulStartTime = portGET_RUN_TIME_COUNTER_VALUE();
+				}
+				#endif
+
+				/* The block is being returned to the heap - it is no longer
+				allocated. */
+				pxLink->xBlockSize &= ~heapBLOCK_ALLOCATED_BIT;
+				xFreeBytesRemaining += pxLink->xBlockSize;
+				traceFREE( pv, pxLink->xBlockSize );
+
+				/* Merge the block with the free blocks before and after it in
+				memory, if any, so no two free blocks are ever adjacent. */
+				pxNeighbour = pxLink->pxPreviousPhysicalBlock;
+				if( ( pxNeighbour != NULL ) && heapBLOCK_IS_FREE( pxNeighbour ) )
+				{
+					prvRemoveBlockFromFreeList( pxNeighbour );
+					pxNeighbour->xBlockSize += pxLink->xBlockSize;
+					pxLink = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxLink );
+				if( heapBLOCK_IS_FREE( pxNeighbour ) )
+				{
+					prvRemoveBlockFromFreeList( pxNeighbour );
+					pxLink->xBlockSize += pxNeighbour->xBlockSize;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				heapNEXT_PHYSICAL_BLOCK( pxLink )->pxPreviousPhysicalBlock = pxLink;
+
+				/* Add the merged block to its free list. */
+				prvInsertBlockIntoFreeList( pxLink );
+				xNumberOfSuccessfulFrees++;
+
+				#if( heapRECORD_TIMES == 1 )
+				{
+					ulTime = portGET_RUN_TIME_COUNTER_VALUE() - ulStartTime;
+					ulTotalFreeTime += ulTime;
+
+					if( ulTime > ulMaximumFreeTime )
+					{
+						ulMaximumFreeTime = ulTime;
+					}
+				}
+				#endif
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindFirstSet( uint32_t ulValue )
+{
+	#if defined( __GNUC__ )
+	{
+		return ( UBaseType_t ) __builtin_ctz( ulValue );
+	}
+	#else
+	{
+	UBaseType_t uxBit;
+
+		/* At most 32 iterations, so the time is still bounded. */
+		for( uxBit = 0U; ( ulValue & 1UL ) == 0U; uxBit++ )
+		{
+			ulValue >>= 1U;
+		}
+
+		return uxBit;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( uint32_t ulValue )
+{
+	#if defined( __GNUC__ )
+	{
+		return ( UBaseType_t ) ( 31 - __builtin_clz( ulValue ) );
+	}
+	#else
+	{
+	UBaseType_t uxBit;
+
+		/* At most 32 iterations, so the time is still bounded. */
+		for( uxBit = 31U; ( ulValue & 0x80000000UL ) == 0U; uxBit-- )
+		{
+			ulValue <<= 1U;
+		}
+
+		return uxBit;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvMapSizeToFreeList( size_t xSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel )
+{
+UBaseType_t uxMostSignificantBit;
+
+	if( xSize < heapSMALL_BLOCK_SIZE )
+	{
+		/* The small blocks have one list per multiple of portBYTE_ALIGNMENT. */
+		*puxFirstLevel = 0U;
+		*puxSecondLevel = ( UBaseType_t ) ( xSize >> heapALIGNMENT_LOG2 );
+	}
+	else
+	{
+		/* The most significant bit selects the row, and the following
+		heapSECOND_LEVEL_COUNT_LOG2 bits select the list within the row. */
+		uxMostSignificantBit = prvFindLastSet( ( uint32_t ) xSize );
+		*puxFirstLevel = uxMostSignificantBit - ( heapFIRST_LEVEL_SHIFT - 1U );
+		*puxSecondLevel = ( UBaseType_t ) ( xSize >> ( uxMostSignificantBit - heapSECOND_LEVEL_COUNT_LOG2 ) ) & ( heapSECOND_LEVEL_COUNT - 1U );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t *prvFindSuitableFreeBlock( size_t xWantedSize )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+uint32_t ulBitmap;
+size_t xRoundedSize;
+BlockLink_t *pxBlock, *pxSameSizeBlocks;
+
+	/* A block freed by an earlier request of the same size is at the head of
+	the list of the wanted size, so try it first - otherwise repeated requests
+	of the same size would keep splitting larger blocks. */
+	prvMapSizeToFreeList( xWantedSize, &uxFirstLevel, &uxSecondLevel );
+	pxSameSizeBlocks = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+
+	if( ( pxSameSizeBlocks != NULL ) && ( pxSameSizeBlocks->xBlockSize >= xWantedSize ) )
+	{
+		return pxSameSizeBlocks;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Round the size up to the next list boundary, so that every block of the
+	list found, and of the lists after it, is large enough.  Only the first
+	block of a list is looked at, so no list is searched. */
+	if( xWantedSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xRoundedSize = xWantedSize + ( ( size_t ) 1 << ( prvFindLastSet( ( uint32_t ) xWantedSize ) - heapSECOND_LEVEL_COUNT_LOG2 ) ) - 1U;
+		prvMapSizeToFreeList( xRoundedSize, &uxFirstLevel, &uxSecondLevel );
+	}
+	else
+	{
+		/* The lists of small blocks hold blocks of a single size. */
+		uxSecondLevel++;
+	}
+
+	pxBlock = NULL;
+
+	if( ( uxFirstLevel < heapFIRST_LEVEL_COUNT ) && ( uxSecondLevel < heapSECOND_LEVEL_COUNT ) )
+	{
+		/* Look for a list with large enough blocks in the same row first. */
+		ulBitmap = ulSecondLevelBitmaps[ uxFirstLevel ] & ( ~( ( uint32_t ) 0U ) << uxSecondLevel );
+	}
+	else
+	{
+		ulBitmap = 0U;
+	}
+
+	if( ( ulBitmap == 0U ) && ( uxFirstLevel < heapFIRST_LEVEL_COUNT ) )
+	{
+		/* Then for the first row with larger blocks. */
+		ulBitmap = ulFirstLevelBitmap & ( ~( ( uint32_t ) 0U ) << ( uxFirstLevel + 1U ) );
+
+		if( ulBitmap != 0U )
+		{
+			uxFirstLevel = prvFindFirstSet( ulBitmap );
+			ulBitmap = ulSecondLevelBitmaps[ uxFirstLevel ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( ulBitmap != 0U )
+	{
+		pxBlock = pxFreeLists[ uxFirstLevel ][ prvFindFirstSet( ulBitmap ) ];
+	}
+	else
+	{
+		/* There is no list whose blocks are all large enough.  Rather than
+		failing, search the list of the wanted size for a block that is large
+		enough.  This is the only search of a list, and only happens when the
+		heap is nearly exhausted. */
+		for( pxBlock = pxSameSizeBlocks; ( pxBlock != NULL ) && ( pxBlock->xBlockSize < xWantedSize ); pxBlock = pxBlock->pxNextFreeBlock )
+		{
+		}
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+BlockLink_t *pxHead;
+
+	prvMapSizeToFreeList( pxBlockToInsert->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+	/* Insert the block at the head of its list, and mark the list as not
+	empty. */
+	pxHead = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+	pxBlockToInsert->pxNextFreeBlock = pxHead;
+	pxBlockToInsert->pxPreviousFreeBlock = NULL;
+
+	if( pxHead != NULL )
+	{
+		pxHead->pxPreviousFreeBlock = pxBlockToInsert;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlockToInsert;
+	ulFirstLevelBitmap |= ( uint32_t ) 1U << uxFirstLevel;
+	ulSecondLevelBitmaps[ uxFirstLevel ] |= ( uint32_t ) 1U << uxSecondLevel;
+	xNumberOfFreeBlocks++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveBlockFromFreeList( BlockLink_t *pxBlockToRemove )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	prvMapSizeToFreeList( pxBlockToRemove->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+	if( pxBlockToRemove->pxNextFreeBlock != NULL )
+	{
+		pxBlockToRemove->pxNextFreeBlock->pxPreviousFreeBlock = pxBlockToRemove->pxPreviousFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlockToRemove->pxPreviousFreeBlock != NULL )
+	{
+		pxBlockToRemove->pxPreviousFreeBlock->pxNextFreeBlock = pxBlockToRemove->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was the head of its list.  Mark the list, and the row if
+		it has no other list, as empty when the list has no other block. */
+		pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlockToRemove->pxNextFreeBlock;
+
+		if( pxBlockToRemove->pxNextFreeBlock == NULL )
+		{
+			ulSecondLevelBitmaps[ uxFirstLevel ] &= ~( ( uint32_t ) 1U << uxSecondLevel );
+
+			if( ulSecondLevelBitmaps[ uxFirstLevel ] == 0U )
+			{
+				ulFirstLevelBitmap &= ~( ( uint32_t ) 1U << uxFirstLevel );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	xNumberOfFreeBlocks--;
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+BlockLink_t *pxFirstFreeBlockInRegion, *pxEnd;
+size_t xTotalRegionSize, xTotalHeapSize = 0;
+BaseType_t xDefinedRegions = 0;
+size_t xAddress;
+const HeapRegion_t *pxHeapRegion;
+
+	pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+	vTaskSuspendAll();
+	{
+		while( pxHeapRegion->xSizeInBytes > 0 )
+		{
+			xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+			/* Ensure the heap region starts on a correctly aligned boundary. */
+			xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+			if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+			{
+				xAddress += ( portBYTE_ALIGNMENT - 1 );
+				xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+				/* Adjust the size for the bytes lost to alignment. */
+				xTotalRegionSize -= xAddress - ( size_t ) pxHeapRegion->pucStartAddress;
+			}
+
+			xTotalRegionSize &= ~portBYTE_ALIGNMENT_MASK;
+
+			/* The region must hold at least one block and the end marker, and
+			its blocks must be small enough to be mapped to a free list. */
+			configASSERT( xTotalRegionSize >= ( xMinimumBlockSize + xHeapStructSize ) );
+			configASSERT( xTotalRegionSize <= heapMAXIMUM_BLOCK_SIZE );
+
+			/* To start with there is a single free block in this region that
+			is sized to take up the entire heap region minus the space taken by
+			the block that marks the end of the region.  The end marker is a
+			zero sized block that is always allocated, so the blocks of the
+			region are never merged with memory past its end. */
+			pxFirstFreeBlockInRegion = ( BlockLink_t * ) xAddress;
+			pxFirstFreeBlockInRegion->xBlockSize = xTotalRegionSize - xHeapStructSize;
+			pxFirstFreeBlockInRegion->pxPreviousPhysicalBlock = NULL;
+
+			pxEnd = heapNEXT_PHYSICAL_BLOCK( pxFirstFreeBlockInRegion );
+			pxEnd->xBlockSize = heapBLOCK_ALLOCATED_BIT;
+			pxEnd->pxPreviousPhysicalBlock = pxFirstFreeBlockInRegion;
+
+			prvInsertBlockIntoFreeList( pxFirstFreeBlockInRegion );
+			xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
+
+			/* Move onto the next HeapRegion_t structure. */
+			xDefinedRegions++;
+			pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+		}
+
+		xFreeBytesRemaining += xTotalHeapSize;
+		xMinimumEverFreeBytesRemaining += xTotalHeapSize;
+		xNumberOfHeapRegions += ( size_t ) xDefinedRegions;
+	}
+	( void ) xTaskResumeAll();
+
+	/* Check something was actually defined before it is accessed. */
+	configASSERT( xTotalHeapSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+BlockLink_t *pxBlock;
+UBaseType_t uxFirstLevel, uxSecondLevel;
+size_t xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+
+	vTaskSuspendAll();
+	{
+		/* Only the lists holding the largest and the smallest blocks need to
+		be searched. */
+		if( ulFirstLevelBitmap != 0U )
+		{
+			uxFirstLevel = prvFindLastSet( ulFirstLevelBitmap );
+			uxSecondLevel = prvFindLastSet( ulSecondLevelBitmaps[ uxFirstLevel ] );
+
+			for( pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				if( pxBlock->xBlockSize > xMaxSize )
+				{
+					xMaxSize = pxBlock->xBlockSize;
+				}
+			}
+
+			uxFirstLevel = prvFindFirstSet( ulFirstLevelBitmap );
+			uxSecondLevel = prvFindFirstSet( ulSecondLevelBitmaps[ uxFirstLevel ] );
+
+			for( pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				if( pxBlock->xBlockSize < xMinSize )
+				{
+					xMinSize = pxBlock->xBlockSize;
+				}
+			}
+		}
+
+		pxHeapStats->xNumberOfFreeBlocks = xNumberOfFreeBlocks;
+	}
+	( void ) xTaskResumeAll();
+
+	pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+	pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+
+	taskENTER_CRITICAL();
+	{
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapExtendedStats( HeapExtendedStats_t *pxHeapExtendedStats )
+{
+HeapStats_t *pxHeapStats = &( pxHeapExtendedStats->xHeapStats );
+
+	vPortGetHeapStats( pxHeapStats );
+
+	if( pxHeapStats->xAvailableHeapSpaceInBytes > 0U )
+	{
+		pxHeapExtendedStats->xFragmentationPercentage = ( size_t ) 100U - ( size_t ) ( ( ( uint64_t ) pxHeapStats->xSizeOfLargestFreeBlockInBytes * 100U ) / pxHeapStats->xAvailableHeapSpaceInBytes );
+	}
+	else
+	{
+		pxHeapExtendedStats->xFragmentationPercentage = 0U;
+	}
+
+	taskENTER_CRITICAL();
+	{
+		pxHeapExtendedStats->xNumberOfHeapRegions = xNumberOfHeapRegions;
+
+		#if( heapRECORD_TIMES == 1 )
+		{
+			pxHeapExtendedStats->ulMaximumMallocTime = ulMaximumMallocTime;
+			pxHeapExtendedStats->ulTotalMallocTime = ulTotalMallocTime;
+			pxHeapExtendedStats->ulMaximumFreeTime = ulMaximumFreeTime;
+			pxHeapExtendedStats->ulTotalFreeTime = ulTotalFreeTime;
+		}
+		#else
+		{
+			pxHeapExtendedStats->ulMaximumMallocTime = 0U;
+			pxHeapExtendedStats->ulTotalMallocTime = 0U;
+			pxHeapExtendedStats->ulMaximumFreeTime = 0U;
+			pxHeapExtendedStats->ulTotalFreeTime = 0U;
+		}
+		#endif
+	}
+	taskEXIT_CRITICAL();
+}
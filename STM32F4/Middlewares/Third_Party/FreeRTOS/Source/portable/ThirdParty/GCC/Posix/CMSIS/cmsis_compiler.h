@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+
+/*
+ * The CMSIS compiler header for the POSIX port, so the CMSIS-RTOS2 wrappers of
+ * Source/CMSIS_RTOS_V2 build and run on the host.  cmsis_os2.c only needs the
+ * attributes below, and the intrinsics reading the exception number and the
+ * interrupt mask, which are taken from the simulated interrupts of the port.
+ * The wrappers then take the FromISR path in the handlers installed with
+ * vPortSetInterruptHandler(), as they do in an interrupt on the target.
+ *
+ * The wrappers include this header before FreeRTOS.h, so the intrinsics are
+ * macros, expanded where portmacro.h is known.
+ */
+
+#ifndef CMSIS_COMPILER_H
+#define CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+#ifndef __ASM
+	#define __ASM					__asm
+#endif
+#ifndef __INLINE
+	#define __INLINE				inline
+#endif
+#ifndef __STATIC_INLINE
+	#define __STATIC_INLINE			static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+	#define __STATIC_FORCEINLINE	__attribute__( ( always_inline ) ) static inline
+#endif
+#ifndef __NO_RETURN
+	#define __NO_RETURN				__attribute__( ( __noreturn__ ) )
+#endif
+#ifndef __USED
+	#define __USED					__attribute__( ( used ) )
+#endif
+#ifndef __WEAK
+	#define __WEAK					__attribute__( ( weak ) )
+#endif
+#ifndef __PACKED
+	#define __PACKED				__attribute__( ( packed, aligned( 1 ) ) )
+#endif
+#ifndef __ALIGNED
+	#define __ALIGNED( x )			__attribute__( ( aligned( x ) ) )
+#endif
+
+/* The exception number is not zero in a simulated interrupt, like IPSR in an
+exception handler of a Cortex-M. */
+#define __get_IPSR()				( ( uint32_t ) xPortIsInsideInterrupt() )
+
+/* PRIMASK is set while the interrupt signal is blocked, i.e. in a critical
+section, in a simulated interrupt, or after __disable_irq(). */
+#define __get_PRIMASK()				( ( uint32_t ) xPortAreInterruptsDisabled() )
+#define __disable_irq()				vPortDisableInterrupts()
+#define __enable_irq()				vPortEnableInterrupts()
+
+#define __NOP()
+#define __DSB()						__sync_synchronize()
+#define __ISB()						__sync_synchronize()
+#define __DMB()						__sync_synchronize()
+
+#endif /* CMSIS_COMPILER_H */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+
+/*
+ * The CMSIS device header for the POSIX port, named by CMSIS_device_header in
+ * FreeRTOSConfig.h, so the CMSIS-RTOS2 wrappers of Source/CMSIS_RTOS_V2 build
+ * and run on the host.
+ *
+ * The port has no NVIC, so setting a priority does nothing.  The SysTick read
+ * by osKernelGetSysTimerCount() is simulated from the host clock: it counts
+ * down from SysTick->LOAD at configCPU_CLOCK_HZ, in the phase of the timer of
+ * the port, and sets COUNTFLAG once a tick is due but not yet handled.  It
+ * then stays at zero until the tick is handled, so the count never goes back,
+ * even when the host handles the ticks late.
+ * The tick itself is counted by the timer thread of the port, not by a
+ * SysTick_Handler, so the handler of cmsis_os2.c is left out.
+ */
+
+#ifndef POSIX_DEVICE_H
+#define POSIX_DEVICE_H
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+#ifndef configCPU_CLOCK_HZ
+	#error configCPU_CLOCK_HZ must be defined, as the rate of the simulated SysTick.
+#endif
+
+#define USE_CUSTOM_SYSTICK_HANDLER_IMPLEMENTATION	1
+
+typedef int32_t IRQn_Type;
+
+#define NVIC_SetPriority( xIRQn, ulPriority )	do { ( void ) ( xIRQn ); ( void ) ( ulPriority ); } while( 0 )
+
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t LOAD;
+	volatile uint32_t VAL;
+	volatile uint32_t CALIB;
+} SysTick_Type;
+
+#define SysTick_CTRL_ENABLE_Msk		( 1UL << 0 )
+#define SysTick_CTRL_COUNTFLAG_Msk	( 1UL << 16 )
+
+static inline SysTick_Type *pxPosixDeviceReadSysTick( void )
+{
+static SysTick_Type xSysTick;
+const uint64_t ullCyclesPerTick = ( uint64_t ) configCPU_CLOCK_HZ / ( uint64_t ) configTICK_RATE_HZ;
+uint64_t ullCycles;
+
+	ullCycles = ( ullPortGetNanosecondsSinceTick() * ( uint64_t ) configCPU_CLOCK_HZ ) / 1000000000ULL;
+
+	xSysTick.LOAD = ( uint32_t ) ( ullCyclesPerTick - 1ULL );
+	xSysTick.CTRL = SysTick_CTRL_ENABLE_Msk;
+	if( ullCycles >= ullCyclesPerTick )
+	{
+		/* cmsis_os2.c reads the count again, and adds the tick pending. */
+		xSysTick.CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+		ullCycles = ( ullCycles >= 2ULL * ullCyclesPerTick ) ? ullCyclesPerTick - 1ULL : ullCycles - ullCyclesPerTick;
+	}
+	xSysTick.VAL = ( uint32_t ) ( ullCyclesPerTick - 1ULL - ullCycles );
+
+	return &xSysTick;
+}
+
+#define SysTick		( pxPosixDeviceReadSysTick() )
+
+#endif /* POSIX_DEVICE_H */
@@ -0,0 +1,724 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX port, which
+ * runs FreeRTOS as a process on a Linux host, e.g. to run tests and benchmarks
+ * of the kernel and the middleware on a build server.
+ *
+ * Every task runs in a thread of its own, but only the thread of the running
+ * task is allowed to run; the other threads wait for their event.  A context
+ * switch signals the event of the next task, then waits for the event of the
+ * task switched out.
+ *
+ * Interrupts are simulated by a signal sent to the thread of the running task.
+ * The tick is counted by a thread reading a timerfd, which then raises the
+ * signal.  The signal handler increments the tick once for every tick counted,
+ * calls the handlers of the pending simulated interrupts, and switches context
+ * if required, like the PendSV handler of the Cortex-M ports.  Disabling
+ * interrupts blocks the signal, so critical sections behave like those on a
+ * single core.  Each task has a critical nesting count of its own, saved and
+ * restored on a context switch.
+ *
+ * The stack of a task only holds the state of its thread, as the thread runs
+ * on a stack allocated by pthreads.  The stack high water mark and the stack
+ * overflow checks therefore do not reflect the stack used by the task.
+ *
+ * A task can be preempted wherever its interrupts are enabled, including in C
+ * library functions holding a lock, like printf() and malloc().  Call these
+ * with the scheduler suspended, or in a critical section, so no other task can
+ * run and call them while the lock is held.  Threads other than the tasks must
+ * not call the FreeRTOS API, but may raise simulated interrupts.
+ *----------------------------------------------------------*/
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The signal simulating interrupts. */
+#define portINTERRUPT_SIGNAL				SIGALRM
+
+#define portNANOSECONDS_PER_SECOND			( 1000000000ULL )
+
+/* Each task maintains its own interrupt status in the critical nesting
+variable.  It is initialised to a non zero value so interrupts are not enabled
+by critical sections left before the scheduler is started. */
+#define portINITIAL_CRITICAL_NESTING		( ( UBaseType_t ) 0xaaaaaaaa )
+
+/* An event a thread can wait for, which stays signalled until waited for. */
+typedef struct THREAD_EVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCondition;
+	BaseType_t xSignalled;
+} ThreadEvent_t;
+
+/* The state of the thread of a task, stored at the top of the stack of the
+task, so the TCB points to it as its top of stack. */
+typedef struct THREAD
+{
+	pthread_t xThread;
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	ThreadEvent_t xEvent;					/*< Signalled when the task is switched in. */
+	UBaseType_t uxCriticalNesting;			/*< The critical nesting of the task while switched out. */
+	volatile BaseType_t xDying;				/*< Set when the thread must exit instead of running. */
+	struct THREAD *pxNextThread;			/*< The next thread in the list of all threads. */
+} Thread_t;
+
+/*
+ * Functions to wait for and signal thread events.
+ */
+static void prvEventInit( ThreadEvent_t *pxEvent );
+static void prvEventDestroy( ThreadEvent_t *pxEvent );
+static void prvEventSignal( ThreadEvent_t *pxEvent );
+static void prvEventWait( ThreadEvent_t *pxEvent );
+
+/*
+ * The function each thread runs, calling the function implementing the task
+ * once the task is switched in for the first time.
+ */
+static void *prvThreadEntry( void *pvParameters );
+
+/*
+ * Waits until the task of the thread is switched in, or exits the thread if
+ * the task has been deleted.
+ */
+static void prvWaitToRun( Thread_t *pxThread );
+
+/*
+ * Switches from the thread of the current task to the thread of the next task.
+ */
+static void prvSwitchThread( Thread_t *pxNext, Thread_t *pxCurrent );
+
+/*
+ * Stops a thread which is not running and releases its resources.
+ */
+static void prvStopThread( Thread_t *pxThread );
+
+/*
+ * Sends the interrupt signal to the thread of the running task.  The calling
+ * thread must have the signal blocked.
+ */
+static void prvRaiseInterruptSignal( void );
+
+/*
+ * The handler of the interrupt signal, which calls the simulated interrupts.
+ */
+static void prvInterruptSignalHandler( int iSignal );
+
+/*
+ * Setup the timer to generate the tick interrupts.
+ */
+static void prvSetupTimerInterrupt( void );
+
+/*
+ * The thread counting the ticks of the timer.
+ */
+static void *prvTimerThread( void *pvParameters );
+
+/*
+ * Used to catch tasks that attempt to return from their implementing function.
+ */
+static void prvTaskExitError( void );
+
+/*
+ * The nanoseconds of the monotonic host clock.
+ */
+static uint64_t prvGetHostNanoseconds( void );
+
+/*-----------------------------------------------------------*/
+
+/* The TCB of the running task, which starts with the pointer to its thread. */
+extern void * volatile pxCurrentTCB;
+
+static UBaseType_t uxCriticalNesting = portINITIAL_CRITICAL_NESTING;
+
+/* The thread of the running task, or NULL if the scheduler is not running.  It
+is written before the thread is switched in, so an interrupt raised while
+switching is delivered as soon as the thread enables interrupts. */
+static Thread_t *pxRunningThread = NULL;
+
+/* All threads not yet stopped, so they can be stopped with the scheduler. */
+static Thread_t *pxThreadList = NULL;
+static pthread_mutex_t xThreadListMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Held while sending the interrupt signal, so a thread is not stopped while
+the signal is being sent to it. */
+static pthread_mutex_t xInterruptMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* The ticks and interrupts raised but not yet handled. */
+static uint32_t ulPendingTicks = 0;
+static uint32_t ulPendingInterrupts = 0;
+static uint32_t (*ulInterruptHandlers[ portMAX_INTERRUPTS ])( void );
+
+/* Set by portYIELD_FROM_ISR() in a simulated interrupt. */
+static BaseType_t xSwitchRequiredFromISR = pdFALSE;
+static __thread BaseType_t xInsideInterrupt = pdFALSE;
+
+/* The host time the timer was started, and the ticks handled since, see
+ullPortGetNanosecondsSinceTick(). */
+static uint64_t ullTimerStartNanoseconds = 0;
+static uint64_t ullTicksHandled = 0;
+
+static int iTimerDescriptor = -1;
+static pthread_t xTimerThread;
+static volatile BaseType_t xTimerStopped = pdFALSE;
+
+/* Signalled by vPortEndScheduler() to let xPortStartScheduler() return. */
+static ThreadEvent_t xSchedulerEndEvent;
+
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThreadFromTask( void *pxTCB )
+{
+	return *( Thread_t ** ) pxTCB;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetInterruptSignalMask( int iHow, sigset_t *pxOriginalSignals )
+{
+sigset_t xSignals;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portINTERRUPT_SIGNAL );
+	pthread_sigmask( iHow, &xSignals, pxOriginalSignals );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+sigset_t xAllSignals, xOriginalSignals;
+int iResult;
+
+	pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+	memset( pxThread, 0, sizeof( Thread_t ) );
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->uxCriticalNesting = 0;
+	pxThread->xDying = pdFALSE;
+	prvEventInit( &pxThread->xEvent );
+
+	/* The thread inherits the signal mask, so it starts with all signals
+	blocked.  Blocking the interrupt signal also keeps the task creating the
+	thread from being switched out while pthreads holds a lock. */
+	sigfillset( &xAllSignals );
+	pthread_sigmask( SIG_SETMASK, &xAllSignals, &xOriginalSignals );
+	iResult = pthread_create( &pxThread->xThread, NULL, prvThreadEntry, pxThread );
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+
+	pthread_mutex_lock( &xThreadListMutex );
+	pxThread->pxNextThread = pxThreadList;
+	pxThreadList = pxThread;
+	pthread_mutex_unlock( &xThreadListMutex );
+	pthread_sigmask( SIG_SETMASK, &xOriginalSignals, NULL );
+
+	return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadEntry( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	prvWaitToRun( pxThread );
+	vPortEnableInterrupts();
+	pxThread->pxCode( pxThread->pvParameters );
+	prvTaskExitError();
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskExitError( void )
+{
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ).
+
+	Artificially force an assert() to be triggered if configASSERT() is
+	defined, then delete the task so its thread exits. */
+	configASSERT( pdFALSE );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+struct sigaction xAction;
+Thread_t *pxFirstThread;
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvInterruptSignalHandler;
+	sigfillset( &xAction.sa_mask );
+	xAction.sa_flags = SA_RESTART;
+	sigaction( portINTERRUPT_SIGNAL, &xAction, NULL );
+
+	prvEventInit( &xSchedulerEndEvent );
+
+	/* Start the timer that generates the tick ISR, then start the first
+	task. */
+	pxFirstThread = prvGetThreadFromTask( pxCurrentTCB );
+	__atomic_store_n( &pxRunningThread, pxFirstThread, __ATOMIC_RELEASE );
+	prvSetupTimerInterrupt();
+	prvEventSignal( &pxFirstThread->xEvent );
+
+	/* Wait for a task to call vTaskEndScheduler(), then stop the tick and all
+	threads, so the process can exit cleanly. */
+	prvEventWait( &xSchedulerEndEvent );
+	__atomic_store_n( &xTimerStopped, pdTRUE, __ATOMIC_RELEASE );
+	pthread_join( xTimerThread, NULL );
+	close( iTimerDescriptor );
+	iTimerDescriptor = -1;
+
+	pthread_mutex_lock( &xThreadListMutex );
+	while( pxThreadList != NULL )
+	{
+		Thread_t *pxThread = pxThreadList;
+		pxThreadList = pxThread->pxNextThread;
+		prvStopThread( pxThread );
+	}
+	pthread_mutex_unlock( &xThreadListMutex );
+	prvEventDestroy( &xSchedulerEndEvent );
+
+	/* Should only get here if a task called vTaskEndScheduler(). */
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+Thread_t *pxCurrent;
+
+	/* Called by a task, with interrupts disabled by vTaskEndScheduler().  No
+	task runs from now on. */
+	pxCurrent = prvGetThreadFromTask( pxCurrentTCB );
+	pthread_mutex_lock( &xInterruptMutex );
+	__atomic_store_n( &pxRunningThread, NULL, __ATOMIC_RELEASE );
+	pthread_mutex_unlock( &xInterruptMutex );
+	prvEventSignal( &xSchedulerEndEvent );
+
+	/* Stopped by xPortStartScheduler(). */
+	prvWaitToRun( pxCurrent );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+Thread_t *pxCurrent;
+sigset_t xOriginalSignals;
+
+	prvSetInterruptSignalMask( SIG_BLOCK, &xOriginalSignals );
+	pxCurrent = prvGetThreadFromTask( pxCurrentTCB );
+	vTaskSwitchContext();
+	prvSwitchThread( prvGetThreadFromTask( pxCurrentTCB ), pxCurrent );
+	pthread_sigmask( SIG_SETMASK, &xOriginalSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+	if( xInsideInterrupt != pdFALSE )
+	{
+		/* Switch when the simulated interrupts have been handled. */
+		xSwitchRequiredFromISR = pdTRUE;
+	}
+	else
+	{
+		vPortYield();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	prvSetInterruptSignalMask( SIG_BLOCK, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	prvSetInterruptSignalMask( SIG_UNBLOCK, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	vPortDisableInterrupts();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+sigset_t xOriginalSignals;
+UBaseType_t uxWasMasked = pdTRUE;
+
+	/* Avoid the system call when the interrupt signal is known to be blocked
+	already, in an interrupt or a critical section. */
+	if( xInsideInterrupt == pdFALSE && uxCriticalNesting == 0 )
+	{
+		prvSetInterruptSignalMask( SIG_BLOCK, &xOriginalSignals );
+		uxWasMasked = sigismember( &xOriginalSignals, portINTERRUPT_SIGNAL ) == 1 ? pdTRUE : pdFALSE;
+	}
+	return uxWasMasked;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxSavedInterruptStatus )
+{
+	if( uxSavedInterruptStatus == pdFALSE )
+	{
+		prvSetInterruptSignalMask( SIG_UNBLOCK, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetHostMicroseconds( void )
+{
+	return ( uint32_t ) ( prvGetHostNanoseconds() / 1000ULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortAreInterruptsDisabled( void )
+{
+sigset_t xSignals;
+
+	if( xInsideInterrupt != pdFALSE || uxCriticalNesting != 0 )
+	{
+		return pdTRUE;
+	}
+
+	pthread_sigmask( SIG_BLOCK, NULL, &xSignals );
+	return sigismember( &xSignals, portINTERRUPT_SIGNAL ) == 1 ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortGetNanosecondsSinceTick( void )
+{
+const uint64_t ullPeriodNanoseconds = portNANOSECONDS_PER_SECOND / configTICK_RATE_HZ;
+uint64_t ullTickDue;
+
+	/* The time the last tick handled was due, which keeps the phase of the
+	timer however late the tick was handled. */
+	ullTickDue = __atomic_load_n( &ullTimerStartNanoseconds, __ATOMIC_ACQUIRE ) +
+				 __atomic_load_n( &ullTicksHandled, __ATOMIC_ACQUIRE ) * ullPeriodNanoseconds;
+	return prvGetHostNanoseconds() - ullTickDue;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortIsInsideInterrupt( void )
+{
+	return xInsideInterrupt;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+sigset_t xOriginalSignals;
+
+	configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+	if( ulInterruptNumber == portINTERRUPT_TICK )
+	{
+		__atomic_add_fetch( &ulPendingTicks, 1, __ATOMIC_ACQ_REL );
+	}
+	else
+	{
+		__atomic_or_fetch( &ulPendingInterrupts, 1UL << ulInterruptNumber, __ATOMIC_ACQ_REL );
+	}
+
+	/* If called by the running task with interrupts enabled, the interrupt is
+	handled when the signal is unblocked again. */
+	prvSetInterruptSignalMask( SIG_BLOCK, &xOriginalSignals );
+	prvRaiseInterruptSignal();
+	pthread_sigmask( SIG_SETMASK, &xOriginalSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber, uint32_t (*pvHandler)( void ) )
+{
+	/* The yield and tick interrupts are handled by the port. */
+	configASSERT( ulInterruptNumber > portINTERRUPT_TICK && ulInterruptNumber < portMAX_INTERRUPTS );
+
+	if( ulInterruptNumber > portINTERRUPT_TICK && ulInterruptNumber < portMAX_INTERRUPTS )
+	{
+		ulInterruptHandlers[ ulInterruptNumber ] = pvHandler;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pxTaskToDelete )
+{
+Thread_t *pxThread = prvGetThreadFromTask( pxTaskToDelete );
+Thread_t **ppxLink;
+sigset_t xOriginalSignals;
+
+	prvSetInterruptSignalMask( SIG_BLOCK, &xOriginalSignals );
+
+	pthread_mutex_lock( &xThreadListMutex );
+	for( ppxLink = &pxThreadList; *ppxLink != NULL; ppxLink = &( *ppxLink )->pxNextThread )
+	{
+		if( *ppxLink == pxThread )
+		{
+			*ppxLink = pxThread->pxNextThread;
+			break;
+		}
+	}
+	pthread_mutex_unlock( &xThreadListMutex );
+
+	prvStopThread( pxThread );
+	pthread_sigmask( SIG_SETMASK, &xOriginalSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStopThread( Thread_t *pxThread )
+{
+	/* The thread is not running, but a signal may still be being sent to it
+	from when it was. */
+	pthread_mutex_lock( &xInterruptMutex );
+	pthread_mutex_unlock( &xInterruptMutex );
+
+	pxThread->xDying = pdTRUE;
+	prvEventSignal( &pxThread->xEvent );
+	pthread_join( pxThread->xThread, NULL );
+	prvEventDestroy( &pxThread->xEvent );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitToRun( Thread_t *pxThread )
+{
+	prvEventWait( &pxThread->xEvent );
+	if( pxThread->xDying != pdFALSE )
+	{
+		pthread_exit( NULL );
+	}
+	uxCriticalNesting = pxThread->uxCriticalNesting;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxNext, Thread_t *pxCurrent )
+{
+	if( pxNext != pxCurrent )
+	{
+		pxCurrent->uxCriticalNesting = uxCriticalNesting;
+		__atomic_store_n( &pxRunningThread, pxNext, __ATOMIC_RELEASE );
+		prvEventSignal( &pxNext->xEvent );
+		prvWaitToRun( pxCurrent );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRaiseInterruptSignal( void )
+{
+Thread_t *pxThread;
+
+	pthread_mutex_lock( &xInterruptMutex );
+	pxThread = __atomic_load_n( &pxRunningThread, __ATOMIC_ACQUIRE );
+	if( pxThread != NULL )
+	{
+		pthread_kill( pxThread->xThread, portINTERRUPT_SIGNAL );
+	}
+	pthread_mutex_unlock( &xInterruptMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptSignalHandler( int iSignal )
+{
+uint32_t ulTicks, ulInterrupts, ulInterrupt;
+Thread_t *pxCurrent;
+int iSavedErrno = errno;
+
+	( void ) iSignal;
+
+	/* The signal may have been raised for this thread while it was switched
+	out, and delivered after the interrupts were handled by another thread, in
+	which case there is nothing left to do. */
+	ulTicks = __atomic_exchange_n( &ulPendingTicks, 0, __ATOMIC_ACQ_REL );
+	ulInterrupts = __atomic_exchange_n( &ulPendingInterrupts, 0, __ATOMIC_ACQ_REL );
+
+	xInsideInterrupt = pdTRUE;
+	if( ( ulInterrupts & ( 1UL << portINTERRUPT_YIELD ) ) != 0 )
+	{
+		xSwitchRequiredFromISR = pdTRUE;
+	}
+	__atomic_add_fetch( &ullTicksHandled, ulTicks, __ATOMIC_ACQ_REL );
+	while( ulTicks > 0 )
+	{
+		/* Increment the RTOS tick. */
+		if( xTaskIncrementTick() != pdFALSE )
+		{
+			xSwitchRequiredFromISR = pdTRUE;
+		}
+		ulTicks--;
+	}
+	for( ulInterrupt = portINTERRUPT_TICK + 1; ulInterrupt < portMAX_INTERRUPTS; ulInterrupt++ )
+	{
+		if( ( ulInterrupts & ( 1UL << ulInterrupt ) ) != 0 && ulInterruptHandlers[ ulInterrupt ] != NULL )
+		{
+			traceISR_ENTER( ulInterrupt );
+			if( ulInterruptHandlers[ ulInterrupt ]() != pdFALSE )
+			{
+				xSwitchRequiredFromISR = pdTRUE;
+			}
+			traceISR_EXIT( ulInterrupt );
+		}
+	}
+	xInsideInterrupt = pdFALSE;
+
+	if( xSwitchRequiredFromISR != pdFALSE )
+	{
+		/* The signal stays blocked while switched out, and is unblocked when
+		the handler returns after the task is switched in again. */
+		xSwitchRequiredFromISR = pdFALSE;
+		pxCurrent = prvGetThreadFromTask( pxCurrentTCB );
+		vTaskSwitchContext();
+		prvSwitchThread( prvGetThreadFromTask( pxCurrentTCB ), pxCurrent );
+	}
+
+	errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void )
+{
+struct itimerspec xPeriod;
+sigset_t xAllSignals, xOriginalSignals;
+const unsigned long long ullPeriodNanoseconds = portNANOSECONDS_PER_SECOND / configTICK_RATE_HZ;
+int iResult;
+
+	iTimerDescriptor = timerfd_create( CLOCK_MONOTONIC, 0 );
+	configASSERT( iTimerDescriptor >= 0 );
+
+	xPeriod.it_interval.tv_sec = ( time_t ) ( ullPeriodNanoseconds / portNANOSECONDS_PER_SECOND );
+	xPeriod.it_interval.tv_nsec = ( long ) ( ullPeriodNanoseconds % portNANOSECONDS_PER_SECOND );
+	xPeriod.it_value = xPeriod.it_interval;
+	__atomic_store_n( &ullTicksHandled, 0, __ATOMIC_RELEASE );
+	__atomic_store_n( &ullTimerStartNanoseconds, prvGetHostNanoseconds(), __ATOMIC_RELEASE );
+	iResult = timerfd_settime( iTimerDescriptor, 0, &xPeriod, NULL );
+	configASSERT( iResult == 0 );
+
+	/* The timer thread must never handle the interrupt signal itself. */
+	__atomic_store_n( &xTimerStopped, pdFALSE, __ATOMIC_RELEASE );
+	sigfillset( &xAllSignals );
+	pthread_sigmask( SIG_SETMASK, &xAllSignals, &xOriginalSignals );
+	iResult = pthread_create( &xTimerThread, NULL, prvTimerThread, NULL );
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+	pthread_sigmask( SIG_SETMASK, &xOriginalSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvTimerThread( void *pvParameters )
+{
+uint64_t ullExpirations;
+
+	( void ) pvParameters;
+
+	while( __atomic_load_n( &xTimerStopped, __ATOMIC_ACQUIRE ) == pdFALSE )
+	{
+		/* Ticks missed while the host was busy are counted, not lost. */
+		if( read( iTimerDescriptor, &ullExpirations, sizeof( ullExpirations ) ) == ( ssize_t ) sizeof( ullExpirations ) )
+		{
+			__atomic_add_fetch( &ulPendingTicks, ( uint32_t ) ullExpirations, __ATOMIC_ACQ_REL );
+			prvRaiseInterruptSignal();
+		}
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventInit( ThreadEvent_t *pxEvent )
+{
+	pthread_mutex_init( &pxEvent->xMutex, NULL );
+	pthread_cond_init( &pxEvent->xCondition, NULL );
+	pxEvent->xSignalled = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventDestroy( ThreadEvent_t *pxEvent )
+{
+	pthread_cond_destroy( &pxEvent->xCondition );
+	pthread_mutex_destroy( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventSignal( ThreadEvent_t *pxEvent )
+{
+	pthread_mutex_lock( &pxEvent->xMutex );
+	pxEvent->xSignalled = pdTRUE;
+	pthread_cond_signal( &pxEvent->xCondition );
+	pthread_mutex_unlock( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventWait( ThreadEvent_t *pxEvent )
+{
+	pthread_mutex_lock( &pxEvent->xMutex );
+	while( pxEvent->xSignalled == pdFALSE )
+	{
+		pthread_cond_wait( &pxEvent->xCondition, &pxEvent->xMutex );
+	}
+	pxEvent->xSignalled = pdFALSE;
+	pthread_mutex_unlock( &pxEvent->xMutex );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvGetHostNanoseconds( void )
+{
+struct timespec xNow;
+
+	clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( uint64_t ) xNow.tv_sec * portNANOSECONDS_PER_SECOND + ( uint64_t ) xNow.tv_nsec;
+}
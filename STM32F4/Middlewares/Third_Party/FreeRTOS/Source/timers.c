@@ -58,6 +58,10 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+/* The number of lists in each level of the timing wheel. */
+#define tmrWHEEL_SLOTS		( ( UBaseType_t ) 1U << configTIMER_WHEEL_SLOT_BITS )
+#define tmrWHEEL_SLOT_MASK	( tmrWHEEL_SLOTS - ( UBaseType_t ) 1U )
+
 /* The name assigned to the timer service task.  This can be overridden by
 defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 #ifndef configTIMER_SERVICE_TASK_NAME
@@ -126,16 +130,38 @@ typedef struct tmrTimerQueueMessage
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists.
-xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
-breaks some kernel aware debuggers, and debuggers that reply on removing the
-static qualifier. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if( configUSE_TIMER_WHEEL == 0 )
+
+	/* The list in which active timers are stored.  Timers are referenced in
+	expire time order, with the nearest expiry time at the front of the list.
+	Only the timer service task is allowed to access these lists.
+	xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
+	breaks some kernel aware debuggers, and debuggers that reply on removing the
+	static qualifier. */
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+
+#else
+
+	/* The hierarchical timing wheel in which active timers are stored.  Level
+	n of the wheel divides time into periods of tmrWHEEL_SLOTS^n ticks, and a
+	timer is kept in the lowest level in which its expiry time is less than
+	tmrWHEEL_SLOTS periods ahead, in the list of the period it expires in -
+	so inserting and removing a timer takes constant time.  When the wheel
+	enters a period of a level above the lowest, the timers of that period are
+	moved down the wheel, and the timers in the list of a tick of the lowest
+	level expire at that tick.  Timers that expire too far ahead for the
+	highest level are kept in its last period, and are moved again when it is
+	reached.  ulTimerWheelBitmaps[ n ] has bit m set when xTimerWheel[ n ][ m ]
+	is not empty, and xTimerWheelTime is the next tick the wheel will process.
+	Only the timer service task is allowed to access the wheel. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ configTIMER_WHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+	PRIVILEGED_DATA static uint32_t ulTimerWheelBitmaps[ configTIMER_WHEEL_LEVELS ];
+	PRIVILEGED_DATA static TickType_t xTimerWheelTime = ( TickType_t ) 0U;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -176,21 +202,47 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow - or into
+ * the timing wheel if configUSE_TIMER_WHEEL is 1.
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
-/*
- * An active timer has reached its expire time.  Reload the timer if it is an
- * auto-reload timer, then call its callback.
- */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+#if( configUSE_TIMER_WHEEL == 0 )
 
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+	/*
+	 * An active timer has reached its expire time.  Reload the timer if it is
+	 * an auto-reload timer, then call its callback.
+	 */
+	static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+#else
+
+	/*
+	 * Add a timer to, or remove a timer from, the list of the timing wheel for
+	 * its expiry time.
+	 */
+	static void prvInsertTimerInWheel( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+	static void prvRemoveTimerFromWheel( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Process the ticks of the timing wheel up to and including xTimeNow,
+	 * calling the callbacks of all the timers that expired.
+	 */
+	static void prvAdvanceTimerWheel( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * A timer of the timing wheel has reached its expire time.  Reload the
+	 * timer if it is an auto-reload timer, then call its callback.
+	 */
+	static void prvProcessExpiredWheelTimer( Timer_t * const pxTimer, TickType_t xExpiredTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -202,7 +254,8 @@ static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched
  * If the timer list contains any active timers then return the expire time of
  * the timer that will expire first and set *pxListWasEmpty to false.  If the
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
- * to pdTRUE.
+ * to pdTRUE.  With the timing wheel the time returned is the next tick at which
+ * the wheel has to move timers down or expire timers.
  */
 static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
@@ -504,6 +557,8 @@ Timer_t *pxTimer = xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
@@ -545,6 +600,8 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 }
 /*-----------------------------------------------------------*/
 
+#endif /* configUSE_TIMER_WHEEL */
+
 static portTASK_FUNCTION( prvTimerTask, pvParameters )
 {
 TickType_t xNextExpireTime;
@@ -581,6 +638,8 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
@@ -690,6 +749,10 @@ PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Va
 }
 /*-----------------------------------------------------------*/
 
+#endif /* configUSE_TIMER_WHEEL */
+
+#if( configUSE_TIMER_WHEEL == 0 )
+
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
 {
 BaseType_t xProcessTimerNow = pdFALSE;
@@ -731,12 +794,17 @@ BaseType_t xProcessTimerNow = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
+#endif /* configUSE_TIMER_WHEEL */
+
 static void	prvProcessReceivedCommands( void )
 {
 DaemonTaskMessage_t xMessage;
 Timer_t *pxTimer;
 BaseType_t xTimerListsWereSwitched, xResult;
 TickType_t xTimeNow;
+#if( configUSE_TIMER_WHEEL == 1 )
+	BaseType_t xWheelWasEmpty;
+#endif
 
 	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 	{
@@ -773,7 +841,15 @@ TickType_t xTimeNow;
 			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
 			{
 				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				#if( configUSE_TIMER_WHEEL == 0 )
+				{
+					( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				}
+				#else
+				{
+					prvRemoveTimerFromWheel( pxTimer );
+				}
+				#endif
 			}
 			else
 			{
@@ -790,6 +866,23 @@ TickType_t xTimeNow;
 			pre-empted the timer daemon task after the xTimeNow value was set). */
 			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
 
+			#if( configUSE_TIMER_WHEEL == 1 )
+			{
+				/* An empty wheel is not advanced while the timer service task
+				blocks, so move it to the current time before inserting. */
+				( void ) prvGetNextExpireTime( &xWheelWasEmpty );
+
+				if( xWheelWasEmpty != pdFALSE )
+				{
+					xTimerWheelTime = xTimeNow + ( TickType_t ) 1U;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_TIMER_WHEEL */
+
 			switch( xMessage.xMessageID )
 			{
 				case tmrCOMMAND_START :
@@ -879,6 +972,8 @@ TickType_t xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -938,6 +1033,304 @@ BaseType_t xResult;
 }
 /*-----------------------------------------------------------*/
 
+#endif /* configUSE_TIMER_WHEEL */
+
+#if( configUSE_TIMER_WHEEL == 1 )
+
+static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+{
+TickType_t xTimeNow;
+BaseType_t xTimerListsWereSwitched;
+
+	vTaskSuspendAll();
+	{
+		/* The wheel has processed the ticks before xTimerWheelTime, and is due
+		to process the ticks up to and including xTimeNow.  Compare the times
+		relative to xTimerWheelTime to remain correct when the tick count
+		overflows. */
+		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+
+		if( ( xListWasEmpty == pdFALSE ) && ( ( TickType_t ) ( xNextExpireTime - xTimerWheelTime ) < ( TickType_t ) ( ( xTimeNow + ( TickType_t ) 1U ) - xTimerWheelTime ) ) )
+		{
+			( void ) xTaskResumeAll();
+
+			/* Expire all the timers that are due in one go, rather than one
+			timer per iteration of the timer service task. */
+			prvAdvanceTimerWheel( xTimeNow );
+		}
+		else
+		{
+			/* Block until the next tick the wheel has to process, or until a
+			command is received if the wheel is empty. */
+			vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				/* Yield to wait for either a command to arrive, or the block
+				time to expire.  If a command arrived between the critical
+				section being exited and this yield then the yield will not
+				cause the task to block. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+{
+TickType_t xNextEventTime = ( TickType_t ) 0U, xTicksToEvent, xTicksIntoPeriod;
+UBaseType_t uxLevel, uxShift, uxSlot, uxFirstOffset, uxOffset;
+uint32_t ulBitmap;
+
+	*pxListWasEmpty = pdTRUE;
+
+	/* The wheel has to process a tick when it expires the timers of a list of
+	the lowest level, or when it enters the period of a list of a higher level
+	and moves its timers down.  Find the nearest such tick in each level. */
+	for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+	{
+		ulBitmap = ulTimerWheelBitmaps[ uxLevel ];
+
+		if( ulBitmap != 0U )
+		{
+			uxShift = uxLevel * ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS;
+			uxSlot = ( UBaseType_t ) ( xTimerWheelTime >> uxShift ) & tmrWHEEL_SLOT_MASK;
+			xTicksIntoPeriod = xTimerWheelTime & ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U );
+
+			/* The list of the current period of a higher level has already
+			been moved down, unless the wheel is at the start of the period. */
+			uxFirstOffset = ( xTicksIntoPeriod == ( TickType_t ) 0U ) ? 0U : 1U;
+
+			for( uxOffset = uxFirstOffset; uxOffset < tmrWHEEL_SLOTS; uxOffset++ )
+			{
+				if( ( ulBitmap & ( ( uint32_t ) 1U << ( ( uxSlot + uxOffset ) & tmrWHEEL_SLOT_MASK ) ) ) != 0U )
+				{
+					xTicksToEvent = ( ( TickType_t ) uxOffset << uxShift ) - xTicksIntoPeriod;
+
+					if( ( *pxListWasEmpty != pdFALSE ) || ( xTicksToEvent < ( TickType_t ) ( xNextEventTime - xTimerWheelTime ) ) )
+					{
+						xNextEventTime = xTimerWheelTime + xTicksToEvent;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					*pxListWasEmpty = pdFALSE;
+					break;
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xNextEventTime;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+{
+	/* The timing wheel works with times relative to the tick it is at, so
+	there are no lists to switch when the tick count overflows. */
+	*pxTimerListsWereSwitched = pdFALSE;
+
+	return xTaskGetTickCount();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+{
+BaseType_t xProcessTimerNow = pdFALSE;
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+	/* Has the expiry time elapsed between the command to start/reset a timer
+	was issued, and the time the command was processed?  Otherwise the expiry
+	time is after xTimeNow, so after any tick the wheel has processed. */
+	if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	{
+		xProcessTimerNow = pdTRUE;
+	}
+	else
+	{
+		prvInsertTimerInWheel( pxTimer );
+	}
+
+	return xProcessTimerNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertTimerInWheel( Timer_t * const pxTimer )
+{
+const TickType_t xTicksToExpiry = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) - xTimerWheelTime;
+TickType_t xPeriodsToExpiry, xTicksIntoPeriod, xPeriodMask;
+UBaseType_t uxLevel, uxShift = 0U, uxSlot;
+
+	/* Find the lowest level in which the expiry time is less than
+	tmrWHEEL_SLOTS periods after the current period.  The sum is split so it
+	cannot overflow. */
+	for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+	{
+		uxShift = uxLevel * ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS;
+		xPeriodMask = ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U;
+		xTicksIntoPeriod = xTimerWheelTime & xPeriodMask;
+		xPeriodsToExpiry = ( xTicksToExpiry >> uxShift ) + ( ( xTicksIntoPeriod + ( xTicksToExpiry & xPeriodMask ) ) >> uxShift );
+
+		if( xPeriodsToExpiry < ( TickType_t ) tmrWHEEL_SLOTS )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( uxLevel == ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+	{
+		/* The timer expires too far ahead for the highest level.  Keep it in
+		the last period of the highest level, and find its place again when
+		the wheel gets there. */
+		uxLevel--;
+		xPeriodsToExpiry = ( TickType_t ) tmrWHEEL_SLOT_MASK;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	uxSlot = ( UBaseType_t ) ( ( ( UBaseType_t ) ( xTimerWheelTime >> uxShift ) + ( UBaseType_t ) xPeriodsToExpiry ) & tmrWHEEL_SLOT_MASK );
+	vListInsertEnd( &( xTimerWheel[ uxLevel ][ uxSlot ] ), &( pxTimer->xTimerListItem ) );
+	ulTimerWheelBitmaps[ uxLevel ] |= ( uint32_t ) 1U << uxSlot;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveTimerFromWheel( Timer_t * const pxTimer )
+{
+List_t * const pxList = listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+UBaseType_t uxIndex;
+
+	if( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0U )
+	{
+		/* The list is now empty.  Its position in the wheel gives its level
+		and slot. */
+		uxIndex = ( UBaseType_t ) ( pxList - &( xTimerWheel[ 0 ][ 0 ] ) );
+		ulTimerWheelBitmaps[ uxIndex >> configTIMER_WHEEL_SLOT_BITS ] &= ~( ( uint32_t ) 1U << ( uxIndex & tmrWHEEL_SLOT_MASK ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvAdvanceTimerWheel( const TickType_t xTimeNow )
+{
+TickType_t xNextEventTime;
+BaseType_t xWheelWasEmpty;
+UBaseType_t uxLevel, uxShift;
+List_t *pxList;
+Timer_t *pxTimer;
+
+	for( ;; )
+	{
+		/* Skip straight to the next tick at which there is something to do,
+		stopping once past xTimeNow. */
+		xNextEventTime = prvGetNextExpireTime( &xWheelWasEmpty );
+
+		if( ( xWheelWasEmpty != pdFALSE ) || ( ( TickType_t ) ( xNextEventTime - xTimerWheelTime ) >= ( TickType_t ) ( ( xTimeNow + ( TickType_t ) 1U ) - xTimerWheelTime ) ) )
+		{
+			xTimerWheelTime = xTimeNow + ( TickType_t ) 1U;
+			break;
+		}
+
+		xTimerWheelTime = xNextEventTime;
+
+		/* Move the timers of the periods the wheel enters at this tick down
+		the wheel.  A tick at the start of a period of a level is also at the
+		start of a period of every lower level. */
+		for( uxLevel = 1U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+		{
+			uxShift = uxLevel * ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS;
+
+			if( ( xTimerWheelTime & ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U ) ) != ( TickType_t ) 0U )
+			{
+				break;
+			}
+
+			pxList = &( xTimerWheel[ uxLevel ][ ( UBaseType_t ) ( xTimerWheelTime >> uxShift ) & tmrWHEEL_SLOT_MASK ] );
+
+			while( listLIST_IS_EMPTY( pxList ) == pdFALSE )
+			{
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				prvRemoveTimerFromWheel( pxTimer );
+				prvInsertTimerInWheel( pxTimer );
+			}
+		}
+
+		/* Expire the timers of this tick.  Reloaded timers expire at least one
+		tick later, so are never added back to this list.  With a single level
+		the list can also hold timers that expire too far ahead, which are moved
+		on. */
+		pxList = &( xTimerWheel[ 0 ][ ( UBaseType_t ) xTimerWheelTime & tmrWHEEL_SLOT_MASK ] );
+
+		while( listLIST_IS_EMPTY( pxList ) == pdFALSE )
+		{
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			prvRemoveTimerFromWheel( pxTimer );
+
+			if( listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) == xTimerWheelTime )
+			{
+				prvProcessExpiredWheelTimer( pxTimer, xTimerWheelTime, xTimeNow );
+			}
+			else
+			{
+				prvInsertTimerInWheel( pxTimer );
+			}
+		}
+
+		xTimerWheelTime++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessExpiredWheelTimer( Timer_t * const pxTimer, TickType_t xExpiredTime, const TickType_t xTimeNow )
+{
+	traceTIMER_EXPIRED( pxTimer );
+
+	if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+	{
+		/* Reload the timer relative to the time it should have expired, then
+		call its callback.  If the timer service task is late enough for the
+		reloaded timer to have expired too, call the callback once for each
+		missed period - without going through the timer queue. */
+		while( prvInsertTimerInActiveList( pxTimer, ( xExpiredTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xExpiredTime ) != pdFALSE )
+		{
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+			xExpiredTime += pxTimer->xTimerPeriodInTicks;
+		}
+	}
+	else
+	{
+		pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+	}
+
+	/* Call the timer callback. */
+	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TIMER_WHEEL */
+
 static void prvCheckForValidListAndQueue( void )
 {
 	/* Check that the list from which active timers are referenced, and the
@@ -947,10 +1340,26 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if( configUSE_TIMER_WHEEL == 0 )
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#else
+			{
+			UBaseType_t uxLevel, uxSlot;
+
+				for( uxLevel = 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+				{
+					for( uxSlot = 0U; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+					{
+						vListInitialise( &( xTimerWheel[ uxLevel ][ uxSlot ] ) );
+					}
+				}
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
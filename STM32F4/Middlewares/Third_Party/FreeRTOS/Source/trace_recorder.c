@@ -0,0 +1,372 @@
+/*
+ * Copyright (C) 2026 The contributors of this repository.
+ *
+ * Written for the FreeRTOS Kernel V10.3.1, but not part of the kernel
+ * distributed by Amazon. It is licensed under the same MIT license:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+/*
+ * A recorder of kernel events into a ring buffer.  See trace_recorder.h.
+ */
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+
+#if( configUSE_TRACE_RECORDER == 1 )
+
+typedef struct TraceRecorderObject
+{
+	uint32_t ulHandle;
+	uint8_t ucKind;
+	uint8_t ucPadding[ 3 ];
+	char pcName[ traceRECORDER_NAME_LENGTH ];
+} TraceRecorderObject_t;
+
+typedef struct TraceRecorderEvent
+{
+	uint32_t ulTimestamp;
+	uint32_t ulHandle;
+	uint32_t ulValue;
+	uint32_t ulEvent;
+} TraceRecorderEvent_t;
+
+/* The whole recorder, in the format described in trace_recorder.h, so it can
+be dumped as one block of memory. */
+typedef struct TraceRecorder
+{
+	uint32_t ulMagic;
+	uint32_t ulVersion;
+	uint32_t ulTimestampFrequency;
+	uint32_t ulEventCapacity;
+	uint32_t ulObjectCapacity;
+	uint32_t ulNameLength;
+	volatile uint32_t ulStarted;
+	uint32_t ulCores;
+	uint32_t ulObjects;
+	volatile uint32_t ulLogged[ configTRACE_RECORDER_CORES ];
+	TraceRecorderObject_t xObjects[ configTRACE_RECORDER_OBJECTS ];
+	TraceRecorderEvent_t xEvents[ configTRACE_RECORDER_CORES ][ configTRACE_RECORDER_EVENTS ];
+} TraceRecorder_t;
+
+#if( ( configTRACE_RECORDER_EVENTS & ( configTRACE_RECORDER_EVENTS - 1 ) ) != 0 )
+	#error configTRACE_RECORDER_EVENTS must be a power of 2.  See trace_recorder.h.
+#endif
+
+/*
+ * Find the object with the handle.  Tasks and queues are told apart from
+ * interrupts and user event channels, as their handles are addresses rather
+ * than numbers.
+ */
+static TraceRecorderObject_t *prvFindObject( uint32_t ulHandle, BaseType_t xIsAddress );
+
+/*
+ * Add an object, or replace the object with the same handle, unless the
+ * recorder has no room left for it, even after replacing a deleted object.
+ */
+static void prvSetObject( uint32_t ulKind, uint32_t ulHandle, const char *pcName );
+
+/*
+ * Copy a name, terminated by a null character unless it fills the whole name
+ * of the object.
+ */
+static void prvCopyName( char *pcObjectName, const char *pcName );
+
+/*
+ * Increment the number of events logged by a core and return the number
+ * before, without masking interrupts where the compiler provides atomic
+ * operations.
+ */
+static uint32_t prvClaimEvent( volatile uint32_t *pulLogged );
+
+/*-----------------------------------------------------------*/
+
+static TraceRecorder_t xTraceRecorder =
+{
+	traceRECORDER_MAGIC,
+	traceRECORDER_VERSION,
+	configTRACE_RECORDER_TIMESTAMP_FREQUENCY,
+	configTRACE_RECORDER_EVENTS,
+	configTRACE_RECORDER_OBJECTS,
+	traceRECORDER_NAME_LENGTH,
+	0,
+	configTRACE_RECORDER_CORES,
+	0,
+	{ 0 },
+	{ { 0 } },
+	{ { { 0 } } }
+};
+
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderEvent( uint32_t ulEvent, uint32_t ulHandle, uint32_t ulValue )
+{
+uint32_t ulCore, ulSlot;
+TraceRecorderEvent_t *pxEvent;
+
+	if( xTraceRecorder.ulStarted != 0UL )
+	{
+		/* Each core claims the slots of its own buffer.  An interrupt which
+		logs an event between the claim and the timestamp below takes the next
+		slot, so the events of a core are only nearly in the order of their
+		timestamps, which the decoder sorts. */
+		ulCore = ( uint32_t ) configTRACE_RECORDER_CORE_ID();
+		ulSlot = prvClaimEvent( &( xTraceRecorder.ulLogged[ ulCore ] ) ) & ( ( uint32_t ) configTRACE_RECORDER_EVENTS - 1UL );
+		pxEvent = &( xTraceRecorder.xEvents[ ulCore ][ ulSlot ] );
+
+		/* The type is written last, so an event still being written when the
+		recorder is dumped has no type, and is ignored by the decoder. */
+		pxEvent->ulEvent = 0UL;
+		pxEvent->ulTimestamp = configTRACE_RECORDER_TIMESTAMP();
+		pxEvent->ulHandle = ulHandle;
+		pxEvent->ulValue = ulValue;
+		#if defined( __GNUC__ )
+		{
+			__atomic_store_n( &( pxEvent->ulEvent ), ulEvent, __ATOMIC_RELEASE );
+		}
+		#else
+		{
+			pxEvent->ulEvent = ulEvent;
+		}
+		#endif
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( void )
+{
+	xTraceRecorder.ulStarted = 1UL;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+	xTraceRecorder.ulStarted = 0UL;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderClear( void )
+{
+uint32_t ulCore;
+
+	/* The objects are kept, as they are only added when created. */
+	for( ulCore = 0UL; ulCore < ( uint32_t ) configTRACE_RECORDER_CORES; ulCore++ )
+	{
+		xTraceRecorder.ulLogged[ ulCore ] = 0UL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderUserEvent( uint32_t ulChannel, uint32_t ulValue )
+{
+	vTraceRecorderEvent( traceRECORDER_EVENT_USER, ulChannel, ulValue );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderNameChannel( uint32_t ulChannel, const char *pcName )
+{
+	prvSetObject( traceRECORDER_OBJECT_CHANNEL, ulChannel, pcName );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderISREnter( uint32_t ulInterrupt )
+{
+	vTraceRecorderEvent( traceRECORDER_EVENT_ISR_ENTER, ulInterrupt, 0UL );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderISRExit( uint32_t ulInterrupt )
+{
+	vTraceRecorderEvent( traceRECORDER_EVENT_ISR_EXIT, ulInterrupt, 0UL );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderNameInterrupt( uint32_t ulInterrupt, const char *pcName )
+{
+	prvSetObject( traceRECORDER_OBJECT_INTERRUPT, ulInterrupt, pcName );
+}
+/*-----------------------------------------------------------*/
+
+const void *pvTraceRecorderGetDump( size_t *pxDumpSize )
+{
+	*pxDumpSize = sizeof( xTraceRecorder );
+	return &xTraceRecorder;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderAddObject( uint32_t ulKind, uint32_t ulHandle, const char *pcName )
+{
+	prvSetObject( ulKind, ulHandle, pcName );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderDeleteObject( uint32_t ulEvent, uint32_t ulHandle, uint32_t ulValue )
+{
+TraceRecorderObject_t *pxObject;
+UBaseType_t uxSavedInterruptStatus;
+
+	vTraceRecorderEvent( ulEvent, ulHandle, ulValue );
+
+	/* The object keeps naming the events logged before it was deleted, until
+	its room is needed. */
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pxObject = prvFindObject( ulHandle, pdTRUE );
+		if( pxObject != NULL )
+		{
+			pxObject->ucKind |= ( uint8_t ) traceRECORDER_OBJECT_DELETED;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderNameObject( uint32_t ulHandle, const char *pcName )
+{
+TraceRecorderObject_t *pxObject;
+UBaseType_t uxSavedInterruptStatus;
+
+	/* Called when a queue is added to the registry, after it was created.  The
+	CMSIS-RTOS2 wrappers add the queues created without a name too. */
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pxObject = prvFindObject( ulHandle, pdTRUE );
+		if( ( pxObject != NULL ) && ( pcName != NULL ) )
+		{
+			prvCopyName( pxObject->pcName, pcName );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static TraceRecorderObject_t *prvFindObject( uint32_t ulHandle, BaseType_t xIsAddress )
+{
+TraceRecorderObject_t *pxObject;
+uint32_t ulObject;
+BaseType_t xObjectIsAddress;
+
+	for( ulObject = 0UL; ulObject < xTraceRecorder.ulObjects; ulObject++ )
+	{
+		pxObject = &( xTraceRecorder.xObjects[ ulObject ] );
+		xObjectIsAddress = ( ( pxObject->ucKind & ~traceRECORDER_OBJECT_DELETED ) < traceRECORDER_OBJECT_INTERRUPT ) ? pdTRUE : pdFALSE;
+
+		if( ( pxObject->ulHandle == ulHandle ) && ( xObjectIsAddress == xIsAddress ) )
+		{
+			return pxObject;
+		}
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetObject( uint32_t ulKind, uint32_t ulHandle, const char *pcName )
+{
+TraceRecorderObject_t *pxObject;
+UBaseType_t uxSavedInterruptStatus;
+uint32_t ulObject;
+
+	/* A task or queue created at the address of one deleted replaces it. */
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pxObject = prvFindObject( ulHandle, ( ulKind < ( uint32_t ) traceRECORDER_OBJECT_INTERRUPT ) ? pdTRUE : pdFALSE );
+
+		if( ( pxObject == NULL ) && ( xTraceRecorder.ulObjects < ( uint32_t ) configTRACE_RECORDER_OBJECTS ) )
+		{
+			pxObject = &( xTraceRecorder.xObjects[ xTraceRecorder.ulObjects ] );
+			xTraceRecorder.ulObjects++;
+		}
+
+		for( ulObject = 0UL; ( pxObject == NULL ) && ( ulObject < xTraceRecorder.ulObjects ); ulObject++ )
+		{
+			if( ( xTraceRecorder.xObjects[ ulObject ].ucKind & traceRECORDER_OBJECT_DELETED ) != 0U )
+			{
+				pxObject = &( xTraceRecorder.xObjects[ ulObject ] );
+			}
+		}
+
+		if( pxObject != NULL )
+		{
+			pxObject->ulHandle = ulHandle;
+			pxObject->ucKind = ( uint8_t ) ulKind;
+			pxObject->pcName[ 0 ] = ( char ) 0x00;
+
+			if( pcName != NULL )
+			{
+				prvCopyName( pxObject->pcName, pcName );
+			}
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvClaimEvent( volatile uint32_t *pulLogged )
+{
+uint32_t ulLogged;
+
+	#if defined( configTRACE_RECORDER_FETCH_AND_INCREMENT )
+	{
+		ulLogged = configTRACE_RECORDER_FETCH_AND_INCREMENT( pulLogged );
+	}
+	#elif defined( __GNUC__ )
+	{
+		/* LDREX/STREX on Cortex-M3/4/7, a locked add on x86. */
+		ulLogged = __atomic_fetch_add( pulLogged, 1UL, __ATOMIC_RELAXED );
+	}
+	#else
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulLogged = *pulLogged;
+			*pulLogged = ulLogged + 1UL;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	#endif
+
+	return ulLogged;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyName( char *pcObjectName, const char *pcName )
+{
+UBaseType_t x;
+
+	for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) traceRECORDER_NAME_LENGTH; x++ )
+	{
+		pcObjectName[ x ] = pcName[ x ];
+
+		if( pcName[ x ] == ( char ) 0x00 )
+		{
+			break;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TRACE_RECORDER */